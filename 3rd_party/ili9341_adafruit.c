@@ -445,6 +445,9 @@ int16_t x2, int16_t y2, uint16_t color)
 
 
 /// @brief Fill a triangle
+/// Spans and edges are inclusive so the fill covers the tft_drawTriangle()
+/// outline, use tft_fillPolygon() for triangles that must tile without overlap
+/// Outline and spans are runs of one span writer, inside one chip select
 /// @param[in] *win: window structure
 /// @param[in] x0: X0 offset
 /// @param[in] y0: Y0 offset
@@ -461,6 +464,14 @@ int16_t x2, int16_t y2, uint16_t color)
 {
 
     int16_t a, b, y, last;
+    tft_span_t s;
+
+// The spans round toward x0 and can miss pixels of the Bresenham edges,
+// draw the outline in tft_drawTriangle() order so the fill covers it
+    tft_span_begin(&s, win, color);
+    tft_span_line(&s, x0, y0, x1, y1);
+    tft_span_line(&s, x1, y1, x2, y2);
+    tft_span_line(&s, x2, y2, x0, y0);
 
 // Sort coordinates by Y order (y2 >= y1 >= y0)
     if (y0 > y1)
@@ -476,18 +487,14 @@ int16_t x2, int16_t y2, uint16_t color)
         SWAP(y0, y1); SWAP(x0, x1);
     }
 
-    if(y0 == y2)                                  // Handle awkward all-on-same-line case as its own thing
+    if(y0 == y2)                                  // All on the same line, the outline already covers it
     {
-        a = b = x0;
-        if(x1 < a)      a = x1;
-        else if(x1 > b) b = x1;
-        if(x2 < a)      a = x2;
-        else if(x2 > b) b = x2;
-        tft_drawFastHLine(win,a, y0, b-a+1, color);
+        tft_span_end(&s);
         return;
     }
 
-    int16_t
+// 32 bit accumulators: dx * dy overflows int16_t for large triangles
+    int32_t
         dx01 = x1 - x0,
         dy01 = y1 - y0,
         dx02 = x2 - x0,
@@ -517,7 +524,7 @@ a = x0 + (x1 - x0) * (y - y0) / (y1 - y0);
 b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
  */
         if(a > b) SWAP(a,b);
-        tft_drawFastHLine(win,a, y, b-a+1, color);
+        tft_span_line(&s, a, y, b, y);
     }
 
 // For lower part of triangle, find scanline crossings for segments
@@ -535,6 +542,7 @@ a = x1 + (x2 - x1) * (y - y1) / (y2 - y1);
 b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
  */
         if(a > b) SWAP(a,b);
-        tft_drawFastHLine(win,a, y, b-a+1, color);
+        tft_span_line(&s, a, y, b, y);
     }
+    tft_span_end(&s);
 }
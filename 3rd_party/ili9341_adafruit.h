@@ -143,7 +143,7 @@ typedef union
 */
 
 // Color definitions
-#define ILI9341_BLACK       0x0000      /,   0,   0 */
+#define ILI9341_BLACK       0x0000                /*   0,   0,   0 */
 #define ILI9341_NAVY        0x000F                /*   0,   0, 128 */
 #define ILI9341_DARKGREEN   0x03E0                /*   0, 128,   0 */
 #define ILI9341_DARKCYAN    0x03EF                /*   0, 128, 128 */
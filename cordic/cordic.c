@@ -231,6 +231,54 @@ void cordic_rad(double rad, double *s, double *c)
 }
 
 
+/// @brief  Compute Sin and Cos from angle in quads using integer Cordic only
+/// No floating point is used, for fixed point render paths
+/// @see http://en.wikipedia.org/wiki/CORDIC
+/// @param[in] quads: angle in quads, Cordic_One = 90 degrees
+/// @param[out] *s: sin, Cordic_One = 1.0
+/// @param[out] *c: cos, Cordic_One = 1.0
+/// @return void
+MEMSPACE
+void cordic_quad_fixed(Cordic_T quads, Cordic_T *s, Cordic_T *c)
+{
+    Cordic_T cs,cc,tmp;
+    int quad;
+
+    quad = 0;
+    if(quads < 0)
+    {
+        quads = -quads;
+        quad = 4;                                 // sign information flag
+    }
+    quad |= (quads >> Cordic_T_FractionBits) & 3;
+
+    Circular(Cordic_K,0,quads & (Cordic_One-1));
+    cc = X;
+    cs = Y;
+
+// Same quadrant handling as cordic_quad()
+    if(quad & 1)
+    {
+        tmp = cc;
+        cc = cs;
+        cs = tmp;
+        cc = -cc;
+    }
+    if(quad & 2 )
+    {
+        cs = -cs;
+        cc = -cc;
+    }
+    if(quad & 4 )
+    {
+        cs = -cs;
+    }
+
+    *c = cc;
+    *s = cs;
+}
+
+
 /// @brief  Scale x,y,z by scale factor
 /// @param[in] *P: x,y,z point
 /// @param[in] scale: scale factor
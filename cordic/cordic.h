@@ -48,6 +48,7 @@ void Circular ( Cordic_T x , Cordic_T y , Cordic_T z );
 MEMSPACE void cordic_quad ( double angle , double *s , double *c );
 MEMSPACE void cordic_deg ( double deg , double *s , double *c );
 MEMSPACE void cordic_rad ( double rad , double *s , double *c );
+MEMSPACE void cordic_quad_fixed ( Cordic_T quads , Cordic_T *s , Cordic_T *c );
 MEMSPACE void scale_point ( point *P , double scale );
 MEMSPACE void shift_point ( point *P , point *shift );
 MEMSPACE void rotate ( point *P , point *V );
@@ -0,0 +1,270 @@
+/**
+ @file fixed3d.c
+
+ @brief Fixed point 3D vector and matrix math
+ Integer only versions of the rotate and projection code in cordic.c
+ Sin and Cos come directly from the integer Cordic code
+ @see fixed3d.h for the Q15, Q14 and Q16 formats
+
+ @par Copyright &copy; 2015 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "user_config.h"
+#include <stdint.h>
+#include <string.h>
+
+#include "cordic2c_inc.h"
+#include "cordic.h"
+#include "fixed3d.h"
+
+/// @brief  Limit a value to the signed 16 bit range
+/// The negative limit matches the positive one so negation is exact
+/// @param[in] v: value
+/// @return  -32767 .. 32767
+static int16_t fx_sat16(int32_t v)
+{
+    if(v > FX_Q15_MAX)
+        return(FX_Q15_MAX);
+    if(v < -FX_Q15_MAX)
+        return(-FX_Q15_MAX);
+    return(v);
+}
+
+/// @brief  Multiply two Q15 numbers with rounding
+/// @param[in] a: Q15 number
+/// @param[in] b: Q15 number
+/// @return  Q15 product
+q15_t fx_mul_q15(q15_t a, q15_t b)
+{
+    return(fx_sat16(((int32_t) a * b + (1L << 14)) >> 15));
+}
+
+/// @brief  Compute Sin and Cos from angle in degrees using integer Cordic
+/// @param[in] deg: angle in Q16 degrees, any sign, see FX_DEG()
+/// @param[out] *s: Q15 sin
+/// @param[out] *c: Q15 cos
+/// @return void
+MEMSPACE
+void fx_sincos(int32_t deg, q15_t *s, q15_t *c)
+{
+    Cordic_T quads, cs, cc;
+
+    // |deg| < 360 degrees, so deg * 64 fits in 32 bits
+    deg %= (360L << 16);
+    // Q16 degrees to Cordic quads, 1.0 = Cordic_One = 90 degrees
+    quads = ((deg * 64) / 90) * 64;
+    cordic_quad_fixed(quads, &cs, &cc);
+
+    // Cordic_One has 28 fraction bits
+    *s = fx_sat16((cs + (1L << 12)) >> 13);
+    *c = fx_sat16((cc + (1L << 12)) >> 13);
+}
+
+/// @brief  Set matrix to identity
+/// @param[out] *M: matrix
+/// @return void
+MEMSPACE
+void fx_mat3_identity(fx_mat3 *M)
+{
+    int i,k;
+
+    for(i=0;i<3;++i)
+        for(k=0;k<3;++k)
+            M->m[i][k] = (i == k) ? FX_Q15_MAX : 0;
+}
+
+/// @brief  Multiply matrices R = A * B
+/// Rows of A and columns of B must not be longer than 1.0, true for rotations
+/// @param[out] *R: result, may be the same as A or B
+/// @param[in] *A: matrix
+/// @param[in] *B: matrix
+/// @return void
+MEMSPACE
+void fx_mat3_mul(fx_mat3 *R, fx_mat3 *A, fx_mat3 *B)
+{
+    fx_mat3 T;
+    int32_t sum;
+    int i,j,k;
+
+    for(i=0;i<3;++i)
+    {
+        for(j=0;j<3;++j)
+        {
+            sum = 1L << 14;
+            for(k=0;k<3;++k)
+                sum += (int32_t) A->m[i][k] * B->m[k][j];
+            T.m[i][j] = fx_sat16(sum >> 15);
+        }
+    }
+    *R = T;
+}
+
+/// @brief  Build the rotation matrix that matches rotate() in cordic.c
+/// Rotation around axis Z, then X, then Y
+/// @param[out] *M: matrix
+/// @param[in] ax: Q16 degrees around X
+/// @param[in] ay: Q16 degrees around Y
+/// @param[in] az: Q16 degrees around Z
+/// @return void
+MEMSPACE
+void fx_mat3_rotate(fx_mat3 *M, int32_t ax, int32_t ay, int32_t az)
+{
+    fx_mat3 R;
+    q15_t s,c;
+
+    fx_mat3_identity(M);
+    fx_sincos(az, &s, &c);
+    M->m[0][0] = c;
+    M->m[0][1] = s;
+    M->m[1][0] = -s;
+    M->m[1][1] = c;
+
+    fx_mat3_identity(&R);
+    fx_sincos(ax, &s, &c);
+    R.m[1][1] = c;
+    R.m[1][2] = s;
+    R.m[2][1] = -s;
+    R.m[2][2] = c;
+    fx_mat3_mul(M, &R, M);
+
+    fx_mat3_identity(&R);
+    fx_sincos(ay, &s, &c);
+    R.m[0][0] = c;
+    R.m[0][2] = -s;
+    R.m[2][0] = s;
+    R.m[2][2] = c;
+    fx_mat3_mul(M, &R, M);
+}
+
+/// @brief  Transform a vector, out = M * in
+/// Rows of M must not be longer than 1.0, so the sums fit in 32 bits
+/// @param[in] *M: matrix
+/// @param[in] *in: Q14 vector
+/// @param[out] *out: Q14 vector, may be the same as in
+/// @return void
+void fx_mat3_apply(fx_mat3 *M, fx_vec3 *in, fx_vec3 *out)
+{
+    int32_t x = in->x, y = in->y, z = in->z;
+
+    out->x = fx_sat16((M->m[0][0] * x + M->m[0][1] * y + M->m[0][2] * z + (1L << 14)) >> 15);
+    out->y = fx_sat16((M->m[1][0] * x + M->m[1][1] * y + M->m[1][2] * z + (1L << 14)) >> 15);
+    out->z = fx_sat16((M->m[2][0] * x + M->m[2][1] * y + M->m[2][2] * z + (1L << 14)) >> 15);
+}
+
+/// @brief  Perspective Projection with Offset and Scale
+/// Same as PerspectiveProjection() in cordic.c
+/// @param[in] *P: Q14 vector
+/// @param[in] scale: Q16 pixels per 1.0, less than 43690
+/// @param[in] x: X offset
+/// @param[in] y: Y offset
+/// @param[out] *X: screen X
+/// @param[out] *Y: screen Y
+/// @return void
+void fx_project(fx_vec3 *P, int32_t scale, int x, int y, int16_t *X, int16_t *Y)
+{
+    int32_t si = scale >> 16;
+    int32_t sf = (scale & 0xffff) >> 2;
+    int32_t vx = P->x + P->z / 2;
+    int32_t vy = P->y - P->z / 2;
+
+    // Integer and Q14 fraction parts of the scale keep the products in 32 bits
+    *X = ((vx * si + ((vx * sf) >> 14) + (1L << 13)) >> 14) + x;
+    *Y = ((vy * si + ((vy * sf) >> 14) + (1L << 13)) >> 14) + y;
+}
+
+/// @brief  Dot product
+/// Vectors must not be longer than 2.0
+/// @param[in] *a: Q14 vector
+/// @param[in] *b: Q14 vector
+/// @return  Q28 result
+int32_t fx_dot(fx_vec3 *a, fx_vec3 *b)
+{
+    return((int32_t) a->x * b->x + (int32_t) a->y * b->y + (int32_t) a->z * b->z);
+}
+
+/// @brief  Cross product
+/// @param[in] *a: Q14 vector
+/// @param[in] *b: Q14 vector
+/// @param[out] *out: Q14 result, saturated, may be the same as a or b
+/// @return void
+void fx_cross(fx_vec3 *a, fx_vec3 *b, fx_vec3 *out)
+{
+    int32_t x,y,z;
+
+    x = ((int32_t) a->y * b->z - (int32_t) a->z * b->y) >> 14;
+    y = ((int32_t) a->z * b->x - (int32_t) a->x * b->z) >> 14;
+    z = ((int32_t) a->x * b->y - (int32_t) a->y * b->x) >> 14;
+    out->x = fx_sat16(x);
+    out->y = fx_sat16(y);
+    out->z = fx_sat16(z);
+}
+
+/// @brief  Integer square root
+/// @param[in] n: value
+/// @return  floor(sqrt(n))
+uint32_t fx_sqrt(uint32_t n)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while(bit > n)
+        bit >>= 2;
+
+    while(bit)
+    {
+        if(n >= root + bit)
+        {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+            root >>= 1;
+        bit >>= 2;
+    }
+    return(root);
+}
+
+/// @brief  Scale a vector to length 1.0
+/// @param[in,out] *v: Q14 vector
+/// @return  0 on success, -1 if v has zero length
+int fx_normalize(fx_vec3 *v)
+{
+    int32_t x = v->x, y = v->y, z = v->z;
+    uint32_t len;
+    int32_t half;
+
+    if(x == 0 && y == 0 && z == 0)
+        return(-1);
+
+    // Scale up so the length has at least 14 significant bits
+    while(x >= -16384 && x < 16384 && y >= -16384 && y < 16384 && z >= -16384 && z < 16384)
+    {
+        x *= 2;
+        y *= 2;
+        z *= 2;
+    }
+
+    // Each square is at most 2^30, so the sum fits unsigned
+    len = fx_sqrt((uint32_t) (x * x) + (uint32_t) (y * y) + (uint32_t) (z * z));
+
+    half = len / 2;
+    v->x = (x * FX_Q14_ONE + (x < 0 ? -half : half)) / (int32_t) len;
+    v->y = (y * FX_Q14_ONE + (y < 0 ? -half : half)) / (int32_t) len;
+    v->z = (z * FX_Q14_ONE + (z < 0 ? -half : half)) / (int32_t) len;
+    return(0);
+}
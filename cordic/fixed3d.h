@@ -0,0 +1,68 @@
+/**
+ @file fixed3d.h
+
+ @brief Fixed point 3D vector and matrix math
+ Integer only versions of the rotate and projection code in cordic.c
+ Sin and Cos come directly from the integer Cordic code
+
+ @par Copyright &copy; 2015 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _FIXED3D_H_
+#define _FIXED3D_H_
+
+/// @brief Q15: 1.0 = 32768, Sin, Cos and rotation matrices, saturates at 32767
+#define FX_Q15_ONE 32768L
+#define FX_Q15_MAX 32767
+/// @brief Q14: 1.0 = 16384, vertices and vectors, same as WIRE_ONE
+#define FX_Q14_ONE 16384
+/// @brief Q16: 1.0 = 65536, angles in degrees and scale factors
+#define FX_Q16(a) ((int32_t) ((a) * 65536.0))
+#define FX_DEG(a) FX_Q16(a)
+
+typedef int16_t q15_t;
+typedef int16_t q14_t;
+
+/// @brief Q14 vector, same layout as wire_p
+typedef struct
+{
+    q14_t x;
+    q14_t y;
+    q14_t z;
+} fx_vec3;
+
+/// @brief Q15 matrix, m[row][column], applied to column vectors
+typedef struct
+{
+    q15_t m[3][3];
+} fx_mat3;
+
+/* fixed3d.c */
+q15_t fx_mul_q15 ( q15_t a , q15_t b );
+MEMSPACE void fx_sincos ( int32_t deg , q15_t *s , q15_t *c );
+MEMSPACE void fx_mat3_identity ( fx_mat3 *M );
+MEMSPACE void fx_mat3_mul ( fx_mat3 *R , fx_mat3 *A , fx_mat3 *B );
+MEMSPACE void fx_mat3_rotate ( fx_mat3 *M , int32_t ax , int32_t ay , int32_t az );
+void fx_mat3_apply ( fx_mat3 *M , fx_vec3 *in , fx_vec3 *out );
+void fx_project ( fx_vec3 *P , int32_t scale , int x , int y , int16_t *X , int16_t *Y );
+int32_t fx_dot ( fx_vec3 *a , fx_vec3 *b );
+void fx_cross ( fx_vec3 *a , fx_vec3 *b , fx_vec3 *out );
+uint32_t fx_sqrt ( uint32_t n );
+int fx_normalize ( fx_vec3 *v );
+
+#endif // _FIXED3D_H_
@@ -106,6 +106,7 @@ int font_attr(window *win, int c, _fontc *f)
         return(-1);
 
     f->ptr = z->bitmap;
+    f->rle = z->Rle;
 
 // If we have font specifications defined and included we can use them.
 // Notes: Normally for small fixed fonts we do not want to included them.
@@ -149,6 +150,10 @@ int font_attr(window *win, int c, _fontc *f)
 
     else   
     {
+		// Run length encoded glyphs have no fixed size
+		if(z->Rle)
+			return(-1);
+
 		// No Specifications, therefore the font must be fixed.
 		// We create one using the master font size spec
 		// There are no proportional options here.
@@ -185,45 +190,292 @@ int font_attr(window *win, int c, _fontc *f)
     return(win->font);
 }
 
+/// @brief Start decoding a run length encoded glyph
+/// @param[out] *r: decoder state
+/// @param[in] *ptr: first run pair of the glyph
+/// @return  void
+static void font_rle_init(_font_rle *r, uint8_t *ptr)
+{
+	r->ptr = ptr;
+	r->bg = 0;
+	r->fg = 0;
+	r->row = 0;
+}
 
-/// @brief Display a character and optionally wrap the graphic cursor
-/// @see tft_putch  for main output function
-/// Does not handle control characters
+/// @brief Take the next run from a run length encoded glyph
+/// @param[in] *r: decoder state
+/// @param[in] max: most pixels wanted, > 0
+/// @param[out] *on: 1 for a foreground run, 0 for background
+/// @return  run length 1 .. max
+static int font_rle_run(_font_rle *r, int max, int *on)
+{
+	int c;
+	int n;
+
+	while(!r->bg && !r->fg)
+	{
+		c = read_flash8(r->ptr);
+		if(c == FONT_RLE_END)
+		{
+			// Background for the rest of the glyph, MAXWIDTH * MAXHEIGHT
+			r->bg = 0x7fff;
+			break;
+		}
+		r->ptr++;
+		r->bg = c >> 4;
+		r->fg = c & 15;
+	}
+	if(r->bg)
+	{
+		n = (r->bg < max) ? r->bg : max;
+		r->bg -= n;
+		*on = 0;
+	}
+	else
+	{
+		n = (r->fg < max) ? r->fg : max;
+		r->fg -= n;
+		*on = 1;
+	}
+	return(n);
+}
+
+/// @brief Expand rows of a character cell to RGB565
+/// Run length encoded glyphs decode in order so calls must cover
+/// the cell rows in order, starting with row 0
+/// @param[in] *f: font attributes from font_attr()
+/// @param[in] *r: decoder state from font_rle_init(), run length encoded glyphs only
+/// @param[out] *pixels: f->skip * rows pixels
+/// @param[in] row: first cell row
+/// @param[in] rows: number of rows
+/// @param[in] fg: forground color
+/// @param[in] bg: background color
+/// @return  void
+static void font_cell_rows(_fontc *f, _font_rle *r, uint16_t *pixels, int row, int rows, uint16_t fg, uint16_t bg)
+{
+	int i,n;
+	int on;
+	int xx,yy;
+	int px,py;
+	int yskip;
+
+	for(i=0; i < f->skip * rows; ++i)
+		pixels[i] = bg;
+
+	// Top of bit bounding box ( first row with a 1 bit in it)
+	yskip = f->Height - (f->y+f->h);
+
+	if(f->rle)
+	{
+		// Glyph rows above the cell are decoded and dropped
+		while(r->row < f->h && yskip + r->row < row + rows)
+		{
+			py = yskip + r->row - row;
+			for(xx=0; xx < f->w; xx += n)
+			{
+				n = font_rle_run(r, f->w - xx, &on);
+				if(!on || py < 0)
+					continue;
+				for(i=0; i < n; ++i)
+				{
+					px = f->x + xx + i;
+					if(px >= 0 && px < f->skip)
+						pixels[py * f->skip + px] = fg;
+				}
+			}
+			r->row++;
+		}
+		return;
+	}
+
+	for(py=0; py < rows; ++py)
+	{
+		yy = row + py - yskip;
+		if(yy < 0 || yy >= f->h)
+			continue;
+		for(xx=0; xx < f->w; ++xx)
+		{
+			px = f->x + xx;
+			if(px < 0 || px >= f->skip)
+				continue;
+			if(bittestv(f->ptr, yy * f->w + xx))
+				pixels[py * f->skip + px] = fg;
+		}
+	}
+}
+
+/// @brief Draw a run length encoded character cell, background and gap included
+/// Rows are expanded in blocks and written with tft_writeRect
 /// @param[in] *win: Window Structure of active window
+/// @param[in] *f: font attributes from font_attr()
+/// @return  void
+static void font_rle_cell(window *win, _fontc *f)
+{
+	uint16_t pixels[FONT_RLE_PIXELS];
+	_font_rle r;
+	int row,rows;
+
+	rows = FONT_RLE_PIXELS / f->skip;
+	font_rle_init(&r, f->ptr);
+	for(row = 0; row < f->Height; row += rows)
+	{
+		if(rows > f->Height - row)
+			rows = f->Height - row;
+		font_cell_rows(f, &r, pixels, row, rows, win->fg, win->bg);
+		tft_writeRect(win, win->xpos, win->ypos + row, f->skip, rows, pixels);
+	}
+}
+
+#if FONT_CACHE_SIZE > 0
+/// @brief Glyph cache, most recently used first
+static _font_cache_t *font_cache_list = NULL;
+/// @brief Glyph cache statistics
+_font_cache_stats font_cache;
+
+/// @brief Find a glyph in the cache and make it the most recently used
+/// @param[in] *win: Window Structure
+/// @param[in] c: character
+/// @return  cache entry or NULL
+static _font_cache_t *font_cache_search(window *win, int c)
+{
+	_font_cache_t *e, **prev;
+
+	for(prev = &font_cache_list; (e = *prev) != NULL; prev = &e->next)
+	{
+		if(e->c == c && e->font == win->font && e->fg == win->fg && e->bg == win->bg
+			&& e->flags == (win->flags & FONT_VAR))
+		{
+			// Move to the front
+			*prev = e->next;
+			e->next = font_cache_list;
+			font_cache_list = e;
+			return(e);
+		}
+	}
+	return(NULL);
+}
+
+/// @brief Find a glyph in the cache and count the hit or miss
+/// @param[in] *win: Window Structure
 /// @param[in] c: character
+/// @return  cache entry or NULL
+static _font_cache_t *font_cache_find(window *win, int c)
+{
+	_font_cache_t *e = font_cache_search(win, c);
+
+	if(e)
+		font_cache.hits++;
+	else
+		font_cache.misses++;
+	return(e);
+}
+
+/// @brief Remove the least recently used glyph from the cache
 /// @return  void
-/// TODO: To make proportional fonts render even better we should reduce
-/// the font gap so that all of the active pixels between two fonts come no 
-/// nearer then a defined value.
-/// Example: consider the characters "Td", the 'd' can actually be part way INSIDE the T
-///
-void tft_drawChar(window *win, uint8_t c)
+static void font_cache_evict()
 {
-    _fontc f;
-    int ret;
-    int yskip;
+	_font_cache_t *e, **prev;
 
-    ret = font_attr(win, c, &f);
-    if(ret < 0)
-        return;
+	if(!font_cache_list)
+		return;
+	for(prev = &font_cache_list; (*prev)->next != NULL; prev = &(*prev)->next)
+		;
+	e = *prev;
+	*prev = NULL;
+	font_cache.bytes -= sizeof(_font_cache_t) + e->skip * e->Height * 2;
+	font_cache.entries--;
+	font_cache.evictions++;
+	free(e);
+}
+
+/// @brief Expand a glyph into a new cache entry
+/// Glyphs larger then 1/4 of the cache are not cached
+/// @param[in] *win: Window Structure
+/// @param[in] c: character
+/// @param[in] *f: font attributes from font_attr()
+/// @return  cache entry or NULL
+static _font_cache_t *font_cache_add(window *win, int c, _fontc *f)
+{
+	_font_cache_t *e;
+	_font_rle r;
+	int size;
+
+	size = sizeof(_font_cache_t) + f->skip * f->Height * 2;
+	if(size > FONT_CACHE_SIZE/4)
+		return(NULL);
+
+	while(font_cache.entries >= FONT_CACHE_ENTRIES || font_cache.bytes + size > FONT_CACHE_SIZE)
+		font_cache_evict();
+
+	e = (_font_cache_t *) calloc(size,1);
+	if(!e)
+		return(NULL);
+
+	e->fg = win->fg;
+	e->bg = win->bg;
+	e->font = win->font;
+	e->c = c;
+	e->flags = win->flags & FONT_VAR;
+	e->skip = f->skip;
+	e->Height = f->Height;
+
+	// The whole cell, background and gap included
+	font_rle_init(&r, f->ptr);
+	font_cell_rows(f, &r, e->pixels, 0, e->Height, e->fg, e->bg);
+
+	e->next = font_cache_list;
+	font_cache_list = e;
+	font_cache.bytes += size;
+	font_cache.entries++;
+	return(e);
+}
 
+/// @brief Empty the glyph cache and free its memory
+/// Statistics are kept
+/// @return  void
+MEMSPACE
+void font_cache_flush()
+{
+	while(font_cache_list)
+		font_cache_evict();
+	font_cache.evictions = 0;
+}
+
+/// @brief Display glyph cache statistics
+/// @return  void
+MEMSPACE
+void font_cache_print()
+{
+	printf("font cache: hits:%lu, misses:%lu, evictions:%lu, entries:%u, bytes:%lu of %lu\n",
+		(long) font_cache.hits, (long) font_cache.misses, (long) font_cache.evictions,
+		(int) font_cache.entries, (long) font_cache.bytes, (long) FONT_CACHE_SIZE);
+}
+#endif
+
+/// @brief Wrap or scroll the graphic cursor so a character cell fits
+/// @param[in] *win: Window Structure of active window
+/// @param[in] skip: character cell width
+/// @param[in] Height: character cell height
+/// @return  1 if the character can be drawn, 0 if not
+static int font_wrap(window *win, int skip, int Height)
+{
 // process wrapping - will the character fit ?
-	if((win->xpos + f.skip - 1)  >= win->w)
+	if((win->xpos + skip - 1)  >= win->w)
 	{
 		if(win->flags & WRAP_H)
 		{
-			win->ypos += f.Height;
+			win->ypos += Height;
 			win->xpos = 0;
 		}
 		else
 		{
 			// TODO H scroll
-			return;
+			return(0);
 		}
 	}
 
 	// Will the character fit ?
-	if((win->ypos+f.Height-1) >= win->h)
+	if((win->ypos+Height-1) >= win->h)
 	{
 		if(win->flags & WRAP_V)
 		{
@@ -231,10 +483,69 @@ void tft_drawChar(window *win, uint8_t c)
 		}
 		else
 		{
-			win->ypos -= f.Height;
-			tft_Vscroll(win,f.Height);
+			win->ypos -= Height;
+			tft_Vscroll(win,Height);
 		}
 	}
+	return(1);
+}
+
+/// @brief Display a character and optionally wrap the graphic cursor
+/// @see tft_putch  for main output function
+/// Does not handle control characters
+/// @param[in] *win: Window Structure of active window
+/// @param[in] c: character
+/// @return  void
+/// TODO: To make proportional fonts render even better we should reduce
+/// the font gap so that all of the active pixels between two fonts come no 
+/// nearer then a defined value.
+/// Example: consider the characters "Td", the 'd' can actually be part way INSIDE the T
+///
+void tft_drawChar(window *win, uint8_t c)
+{
+    _fontc f;
+    int ret;
+    int yskip;
+#if FONT_CACHE_SIZE > 0
+	_font_cache_t *e;
+
+	// A cached glyph has the cell size we need for wrapping
+	e = font_cache_find(win, c);
+	if(e)
+	{
+		f.skip = e->skip;
+		f.Height = e->Height;
+	}
+	else
+#endif
+	{
+		ret = font_attr(win, c, &f);
+		if(ret < 0)
+			return;
+	}
+
+	if(!font_wrap(win, f.skip, f.Height))
+		return;
+
+#if FONT_CACHE_SIZE > 0
+	// Write the whole cell, background and gap included, in one window
+	if(!e)
+		e = font_cache_add(win, c, &f);
+	if(e)
+	{
+		tft_writeRect(win, win->xpos, win->ypos, e->skip, e->Height, e->pixels);
+		win->xpos += e->skip;
+		return;
+	}
+#endif
+
+	// Run length encoded glyphs include the background
+	if(f.rle)
+	{
+		font_rle_cell(win, &f);
+		win->xpos += f.skip;
+		return;
+	}
 
 // Conditionally clear the character area - not needed for full size fixed fonts..
 // If the character is not full size then pre-clear the full font bit array
@@ -265,3 +576,212 @@ void tft_drawChar(window *win, uint8_t c)
 	// skip is the offset to the next character
 	win->xpos += f.skip;
 }
+
+/// @brief Glyph of a text run
+typedef struct
+{
+	_fontc f;
+	_font_rle rle;				// run length decoder state
+	uint8_t c;					// character
+	int8_t yskip;				// first glyph row in the cell
+#if FONT_CACHE_SIZE > 0
+	_font_cache_t *e;			// expanded cell or NULL
+#endif
+} _font_run_glyph;
+
+/// @brief Text run stream state
+typedef struct
+{
+	window *win;
+	_font_run_glyph *g;
+	int count;					// glyphs in the run
+	int Height;					// cell height
+	int row;					// current row
+	int ind;					// current glyph
+	int col;					// current column in the glyph cell
+} _font_run;
+
+/// @brief Stream fill function for a text run, row by row across all glyphs
+/// Background and run length encoded runs are written as spans
+/// @param[in] *arg: text run state
+/// @param[out] *buf: buffer to fill
+/// @param[in] bytes: buffer size
+/// @return  bytes written to buf, 0 when done
+static int font_run_fill(void *arg, uint8_t *buf, int bytes)
+{
+	_font_run *r = (_font_run *) arg;
+	_font_run_glyph *g;
+	uint16_t color;
+	int gx,gy;
+	int n,max;
+	int on;
+	int ind = 0;
+
+	while(r->row < r->Height && (max = (bytes - ind) >> 1) > 0)
+	{
+		g = &r->g[r->ind];
+		n = 1;
+#if FONT_CACHE_SIZE > 0
+		if(g->e)
+			color = g->e->pixels[r->row * g->e->skip + r->col];
+		else
+#endif
+		{
+			color = r->win->bg;
+			gx = r->col - g->f.x;
+			gy = r->row - g->yskip;
+			// Background to the end of the cell
+			n = g->f.skip - r->col;
+			if(gy >= 0 && gy < g->f.h)
+			{
+				if(gx < 0)
+					n = -gx;
+				else if(gx < g->f.w && g->f.rle)
+				{
+					n = font_rle_run(&g->rle, (g->f.w - gx < max) ? g->f.w - gx : max, &on);
+					if(on)
+						color = r->win->fg;
+				}
+				else if(gx < g->f.w)
+				{
+					n = 1;
+					if(bittestv(g->f.ptr, gy * g->f.w + gx))
+						color = r->win->fg;
+				}
+			}
+			if(n > max)
+				n = max;
+		}
+		r->col += n;
+		while(n--)
+		{
+			buf[ind++] = color >> 8;
+			buf[ind++] = color & 0xff;
+		}
+
+		if(r->col >= g->f.skip)
+		{
+			r->col = 0;
+			if(++r->ind >= r->count)
+			{
+				r->ind = 0;
+				r->row++;
+			}
+		}
+	}
+	return(ind);
+}
+
+/// @brief Draw printable characters that fit on the current line
+/// The cells, gaps and background of all characters are sent row by row
+/// with a single window setup.
+/// @param[in] *win: Window Structure of active window
+/// @param[in] *str: string
+/// @return  characters used from str, at least 1
+static int font_drawRun(window *win, char *str)
+{
+	_font_run_glyph g[FONT_RUN_MAX];
+	_font_run r;
+	int width;
+	int used;
+	int c;
+	int16_t y,h;
+#if FONT_CACHE_SIZE > 0
+	int i;
+	uint32_t evictions = font_cache.evictions;
+#endif
+
+	// The first character may wrap or scroll
+	c = 0xff & *str;
+	if(font_attr(win, c, &g[0].f) < 0)
+		return(1);
+	if(!font_wrap(win, g[0].f.skip, g[0].f.Height))
+		return(1);
+
+	// A line that wraps in a terminal window needs two windows per character
+	y = win->ypos;
+	h = g[0].f.Height;
+	if(tft_term_rows(win, &y, &h) < g[0].f.Height)
+	{
+		tft_drawChar(win, c);
+		return(1);
+	}
+
+	r.count = 0;
+	width = 0;
+	for(used = 0; str[used] && r.count < FONT_RUN_MAX; ++used)
+	{
+		c = 0xff & str[used];
+		if(c < ' ' || c > 0x7e)
+			break;
+		if(font_attr(win, c, &g[r.count].f) < 0)
+			continue;
+		if(win->xpos + width + g[r.count].f.skip > win->w)
+			break;
+		g[r.count].c = c;
+		g[r.count].yskip = g[r.count].f.Height - (g[r.count].f.y + g[r.count].f.h);
+		font_rle_init(&g[r.count].rle, g[r.count].f.ptr);
+#if FONT_CACHE_SIZE > 0
+		g[r.count].e = font_cache_find(win, c);
+		if(!g[r.count].e)
+			g[r.count].e = font_cache_add(win, c, &g[r.count].f);
+#endif
+		width += g[r.count].f.skip;
+		r.count++;
+	}
+	if(!used)
+		used = 1;
+	if(!r.count)
+		return(used);
+
+#if FONT_CACHE_SIZE > 0
+	// Adding glyphs may have evicted earlier glyphs of this run
+	if(evictions != font_cache.evictions)
+	{
+		for(i=0;i<r.count;++i)
+			g[i].e = font_cache_search(win, g[i].c);
+	}
+#endif
+
+	r.win = win;
+	r.g = g;
+	r.Height = g[0].f.Height;
+	r.row = 0;
+	r.ind = 0;
+	r.col = 0;
+
+	if(tft_rel_window(win, win->xpos, win->ypos, width, r.Height))
+	{
+		tft_spi_begin();
+		tft_Cmd(0x2c);
+		tft_spi_TX_stream(font_run_fill, &r);
+		tft_spi_end();
+	}
+	win->xpos += width;
+	return(used);
+}
+
+/// @brief Draw a string at the graphic cursor
+/// Runs of printable characters are drawn a line at a time with one
+/// window setup each, control characters are handled by tft_putch
+/// @param[in] *win: Window Structure of active window
+/// @param[in] *str: string
+/// @return  void
+void tft_drawString(window *win, char *str)
+{
+	while(*str)
+	{
+		if(*str < ' ' || *str > 0x7e)
+		{
+			tft_putch(win, *str++);
+			continue;
+		}
+		// Frame buffer windows are already cheap per character
+		if(win->fb)
+		{
+			tft_drawChar(win, *str++);
+			continue;
+		}
+		str += font_drawRun(win, str);
+	}
+}
@@ -84,6 +84,7 @@ typedef struct
     uint8_t *bitmap;                              /* Font Bitmap */
     _fontspecs *specs;                            /* Glyph info */
     _fontinfo *info;                              /* Copywrite, etc */
+    uint8_t Rle;                                  /* Bitmap is run length encoded, see FONT_RLE_END */
 } _font;
 
 typedef struct
@@ -97,9 +98,78 @@ typedef struct
     int8_t Width;                                 // font max width
     int8_t Height;                                // font max width
     int8_t skip;                                  // font spacing - zero for fixed fonts
+    uint8_t rle;                                  // ptr is run length encoded
     uint8_t *ptr;
 } _fontc;
 
+/// @brief Run length encoded glyphs
+/// Each byte is a background run in the high nibble followed by a
+/// foreground run in the low nibble, both 0 .. 15 pixels, that cover the
+/// glyph bit array in the same order as the bit encoding, runs continue
+/// across rows. Longer runs are split into pairs with an empty run, a
+/// pair of two empty runs is FONT_RLE_END which fills the rest of the glyph
+/// with background.
+/// The glyph specs Offset is the byte offset of the first run.
+#define FONT_RLE_END 0x00
+
+/// @brief Run length decoder state, one glyph
+typedef struct
+{
+    uint8_t *ptr;                                 // next run pair
+    int16_t bg;                                   // background pixels left in this pair
+    int16_t fg;                                   // foreground pixels left in this pair
+    int16_t row;                                  // next glyph row
+} _font_rle;
+
+/// @brief Pixel buffer for drawing run length encoded glyphs without the cache
+#ifndef FONT_RLE_PIXELS
+#define FONT_RLE_PIXELS 256
+#endif
+
+/// @brief Glyph cache RAM limit in bytes, 0 disables the cache
+#ifndef FONT_CACHE_SIZE
+#define FONT_CACHE_SIZE 4096
+#endif
+/// @brief Maximum glyphs held in the glyph cache
+#ifndef FONT_CACHE_ENTRIES
+#define FONT_CACHE_ENTRIES 32
+#endif
+
+/// @brief Maximum characters drawn with one window by tft_drawString
+/// Each character takes about 36 bytes of stack in font_drawRun(), which
+/// can run under tft_printf, longer lines use more than one window
+#ifndef FONT_RUN_MAX
+#define FONT_RUN_MAX 16
+#endif
+
+/// @brief Glyph cache entry - a character cell expanded to RGB565
+/// The cell includes the gap and the background around the glyph
+/// Entries are kept in most recently used order
+typedef struct _font_cache_t
+{
+    struct _font_cache_t *next;                   // next less recently used entry
+    uint16_t fg;                                  // forground color
+    uint16_t bg;                                  // background color
+    uint8_t font;                                 // font index
+    uint8_t c;                                    // character
+    uint8_t flags;                                // FONT_VAR flag
+    int8_t skip;                                  // cell width
+    int8_t Height;                                // cell height
+    uint16_t pixels[];                            // skip * Height pixels
+} _font_cache_t;
+
+/// @brief Glyph cache statistics
+typedef struct
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t bytes;                               // RAM in use
+    uint16_t entries;                             // glyphs in use
+} _font_cache_stats;
+
+extern _font_cache_stats font_cache;
+
 #if 0
 typedef struct {
 	int16_t xoff;   /* X offset */
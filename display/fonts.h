@@ -64,10 +64,12 @@ _font Fixed_Bold_R_X7_Y13 = {
 	NULL, /* font->specs */
 #endif
 #ifdef FONTINFO
-	Fixed_Bold_R_X7_Y13_info
+	Fixed_Bold_R_X7_Y13_info,
 #else
-	NULL /* font->info */
+	NULL, /* font->info */
 #endif
+	/* Run Length Encoded Bitmap = 0 */
+		0,
 };
 
 #ifdef FONTINFO
@@ -1972,10 +1974,12 @@ _font Terminus_Bold_R_X12_Y24 = {
 	NULL, /* font->specs */
 #endif
 #ifdef FONTINFO
-	Terminus_Bold_R_X12_Y24_info
+	Terminus_Bold_R_X12_Y24_info,
 #else
-	NULL /* font->info */
+	NULL, /* font->info */
 #endif
+	/* Run Length Encoded Bitmap = 0 */
+		0,
 };
 
 #ifdef FONTINFO
@@ -5064,8 +5068,8 @@ _font Terminus_Bold_R_X16_Y32 = {
 		6,
 	/* Font Gap = 1 */
 		1,
-	/* Font Bytes for entire Bitmap = 2437 */
-		2437,
+	/* Font Bytes for entire Bitmap = 1846 */
+		1846,
 	Terminus_Bold_R_X16_Y32_bitmap,
 #ifdef FONTSPECS
 	Terminus_Bold_R_X16_Y32_specs,
@@ -5073,10 +5077,12 @@ _font Terminus_Bold_R_X16_Y32 = {
 	NULL, /* font->specs */
 #endif
 #ifdef FONTINFO
-	Terminus_Bold_R_X16_Y32_info
+	Terminus_Bold_R_X16_Y32_info,
 #else
-	NULL /* font->info */
+	NULL, /* font->info */
 #endif
+	/* Run Length Encoded Bitmap = 1 */
+		1,
 };
 
 #ifdef FONTINFO
@@ -5106,418 +5112,369 @@ MEMSPACE_FONT _fontspecs Terminus_Bold_R_X16_Y32_specs[95] = /* Terminus_Bold_R_
 		/* Offset, Width, Height,  X,     Y*/
 		{     0,     0,     0,     0,     0 }, /* [ ]*/
 		{     0,     3,    20,     6,     6 }, /* [!]*/
-		{     8,     9,     6,     3,    23 }, /* ["]*/
-		{    15,    13,    20,     1,     6 }, /* [#]*/
+		{     4,     9,     6,     3,    23 }, /* ["]*/
+		{    11,    13,    20,     1,     6 }, /* [#]*/
 		{    48,    13,    22,     1,     5 }, /* [$]*/
-		{    84,    12,    20,     2,     6 }, /* [%]*/
+		{    83,    12,    20,     2,     6 }, /* [%]*/
 		{   114,    14,    20,     1,     6 }, /* [&]*/
-		{   149,     3,     6,     6,    23 }, /* [']*/
+		{   150,     3,     6,     6,    23 }, /* [']*/
 		{   152,     7,    20,     4,     6 }, /* [(]*/
-		{   170,     7,    20,     4,     6 }, /* [)]*/
-		{   188,    13,    12,     1,    10 }, /* [*]*/
-		{   208,    13,    12,     1,    10 }, /* [+]*/
-		{   228,     5,     6,     4,     4 }, /* [,]*/
+		{   172,     7,    20,     4,     6 }, /* [)]*/
+		{   193,    13,    12,     1,    10 }, /* [*]*/
+		{   212,    13,    12,     1,    10 }, /* [+]*/
+		{   225,     5,     6,     4,     4 }, /* [,]*/
 		{   232,    13,     2,     1,    15 }, /* [-]*/
-		{   236,     3,     4,     6,     6 }, /* [.]*/
-		{   238,    12,    20,     2,     6 }, /* [/]*/
-		{   268,    13,    20,     1,     6 }, /* [0]*/
-		{   301,     9,    20,     3,     6 }, /* [1]*/
-		{   324,    13,    20,     1,     6 }, /* [2]*/
-		{   357,    13,    20,     1,     6 }, /* [3]*/
-		{   390,    13,    20,     1,     6 }, /* [4]*/
-		{   423,    13,    20,     1,     6 }, /* [5]*/
-		{   456,    13,    20,     1,     6 }, /* [6]*/
-		{   489,    13,    20,     1,     6 }, /* [7]*/
-		{   522,    13,    20,     1,     6 }, /* [8]*/
-		{   555,    13,    20,     1,     6 }, /* [9]*/
-		{   588,     3,    14,     6,     6 }, /* [:]*/
-		{   594,     5,    16,     4,     4 }, /* [;]*/
-		{   604,    12,    20,     2,     6 }, /* [<]*/
-		{   634,    13,     8,     1,    12 }, /* [=]*/
-		{   647,    12,    20,     2,     6 }, /* [>]*/
-		{   677,    13,    20,     1,     6 }, /* [?]*/
-		{   710,    14,    20,     1,     6 }, /* [@]*/
-		{   745,    13,    20,     1,     6 }, /* [A]*/
-		{   778,    13,    20,     1,     6 }, /* [B]*/
-		{   811,    13,    20,     1,     6 }, /* [C]*/
-		{   844,    13,    20,     1,     6 }, /* [D]*/
-		{   877,    13,    20,     1,     6 }, /* [E]*/
-		{   910,    13,    20,     1,     6 }, /* [F]*/
-		{   943,    13,    20,     1,     6 }, /* [G]*/
-		{   976,    13,    20,     1,     6 }, /* [H]*/
-		{  1009,     7,    20,     4,     6 }, /* [I]*/
-		{  1027,    14,    20,     1,     6 }, /* [J]*/
-		{  1062,    13,    20,     1,     6 }, /* [K]*/
-		{  1095,    13,    20,     1,     6 }, /* [L]*/
-		{  1128,    14,    20,     1,     6 }, /* [M]*/
-		{  1163,    13,    20,     1,     6 }, /* [N]*/
-		{  1196,    13,    20,     1,     6 }, /* [O]*/
-		{  1229,    13,    20,     1,     6 }, /* [P]*/
-		{  1262,    13,    22,     1,     4 }, /* [Q]*/
-		{  1298,    13,    20,     1,     6 }, /* [R]*/
-		{  1331,    13,    20,     1,     6 }, /* [S]*/
-		{  1364,    13,    20,     1,     6 }, /* [T]*/
-		{  1397,    13,    20,     1,     6 }, /* [U]*/
-		{  1430,    13,    20,     1,     6 }, /* [V]*/
-		{  1463,    14,    20,     1,     6 }, /* [W]*/
-		{  1498,    13,    20,     1,     6 }, /* [X]*/
-		{  1531,    13,    20,     1,     6 }, /* [Y]*/
-		{  1564,    13,    20,     1,     6 }, /* [Z]*/
-		{  1597,     8,    20,     4,     6 }, /* [[]*/
-		{  1617,    12,    20,     2,     6 }, /* [\]*/
-		{  1647,     8,    20,     4,     6 }, /* []]*/
-		{  1667,    13,     6,     1,    23 }, /* [^]*/
-		{  1677,    13,     2,     1,     3 }, /* [_]*/
-		{  1681,     6,     4,     3,    27 }, /* [`]*/
-		{  1684,    13,    14,     1,     6 }, /* [a]*/
-		{  1707,    13,    20,     1,     6 }, /* [b]*/
-		{  1740,    13,    14,     1,     6 }, /* [c]*/
-		{  1763,    13,    20,     1,     6 }, /* [d]*/
-		{  1796,    13,    14,     1,     6 }, /* [e]*/
-		{  1819,    13,    20,     1,     6 }, /* [f]*/
-		{  1852,    13,    19,     1,     1 }, /* [g]*/
-		{  1883,    13,    20,     1,     6 }, /* [h]*/
-		{  1916,     7,    20,     4,     6 }, /* [i]*/
-		{  1934,    11,    25,     2,     1 }, /* [j]*/
-		{  1969,    12,    20,     2,     6 }, /* [k]*/
-		{  1999,     7,    20,     4,     6 }, /* [l]*/
-		{  2017,    13,    14,     1,     6 }, /* [m]*/
-		{  2040,    13,    14,     1,     6 }, /* [n]*/
-		{  2063,    13,    14,     1,     6 }, /* [o]*/
-		{  2086,    13,    19,     1,     1 }, /* [p]*/
-		{  2117,    13,    19,     1,     1 }, /* [q]*/
-		{  2148,    13,    14,     1,     6 }, /* [r]*/
-		{  2171,    13,    14,     1,     6 }, /* [s]*/
-		{  2194,    13,    20,     1,     6 }, /* [t]*/
-		{  2227,    13,    14,     1,     6 }, /* [u]*/
-		{  2250,    13,    14,     1,     6 }, /* [v]*/
-		{  2273,    13,    14,     1,     6 }, /* [w]*/
-		{  2296,    13,    14,     1,     6 }, /* [x]*/
-		{  2319,    13,    19,     1,     1 }, /* [y]*/
-		{  2350,    13,    14,     1,     6 }, /* [z]*/
-		{  2373,     9,    20,     3,     6 }, /* [{]*/
-		{  2396,     3,    20,     6,     6 }, /* [|]*/
-		{  2404,     9,    20,     3,     6 }, /* [}]*/
-		{  2427,    13,     6,     1,    23 }, /* [~]*/
+		{   234,     3,     4,     6,     6 }, /* [.]*/
+		{   235,    12,    20,     2,     6 }, /* [/]*/
+		{   256,    13,    20,     1,     6 }, /* [0]*/
+		{   281,     9,    20,     3,     6 }, /* [1]*/
+		{   301,    13,    20,     1,     6 }, /* [2]*/
+		{   322,    13,    20,     1,     6 }, /* [3]*/
+		{   344,    13,    20,     1,     6 }, /* [4]*/
+		{   369,    13,    20,     1,     6 }, /* [5]*/
+		{   389,    13,    20,     1,     6 }, /* [6]*/
+		{   411,    13,    20,     1,     6 }, /* [7]*/
+		{   432,    13,    20,     1,     6 }, /* [8]*/
+		{   455,    13,    20,     1,     6 }, /* [9]*/
+		{   477,     3,    14,     6,     6 }, /* [:]*/
+		{   480,     5,    16,     4,     4 }, /* [;]*/
+		{   493,    12,    20,     2,     6 }, /* [<]*/
+		{   513,    13,     8,     1,    12 }, /* [=]*/
+		{   520,    12,    20,     2,     6 }, /* [>]*/
+		{   541,    13,    20,     1,     6 }, /* [?]*/
+		{   563,    14,    20,     1,     6 }, /* [@]*/
+		{   592,    13,    20,     1,     6 }, /* [A]*/
+		{   613,    13,    20,     1,     6 }, /* [B]*/
+		{   635,    13,    20,     1,     6 }, /* [C]*/
+		{   657,    13,    20,     1,     6 }, /* [D]*/
+		{   680,    13,    20,     1,     6 }, /* [E]*/
+		{   699,    13,    20,     1,     6 }, /* [F]*/
+		{   719,    13,    20,     1,     6 }, /* [G]*/
+		{   741,    13,    20,     1,     6 }, /* [H]*/
+		{   762,     7,    20,     4,     6 }, /* [I]*/
+		{   780,    14,    20,     1,     6 }, /* [J]*/
+		{   805,    13,    20,     1,     6 }, /* [K]*/
+		{   838,    13,    20,     1,     6 }, /* [L]*/
+		{   858,    14,    20,     1,     6 }, /* [M]*/
+		{   882,    13,    20,     1,     6 }, /* [N]*/
+		{   906,    13,    20,     1,     6 }, /* [O]*/
+		{   928,    13,    20,     1,     6 }, /* [P]*/
+		{   949,    13,    22,     1,     4 }, /* [Q]*/
+		{   974,    13,    20,     1,     6 }, /* [R]*/
+		{  1001,    13,    20,     1,     6 }, /* [S]*/
+		{  1022,    13,    20,     1,     6 }, /* [T]*/
+		{  1043,    13,    20,     1,     6 }, /* [U]*/
+		{  1065,    13,    20,     1,     6 }, /* [V]*/
+		{  1099,    14,    20,     1,     6 }, /* [W]*/
+		{  1123,    13,    20,     1,     6 }, /* [X]*/
+		{  1157,    13,    20,     1,     6 }, /* [Y]*/
+		{  1185,    13,    20,     1,     6 }, /* [Z]*/
+		{  1205,     8,    20,     4,     6 }, /* [[]*/
+		{  1224,    12,    20,     2,     6 }, /* [\]*/
+		{  1244,     8,    20,     4,     6 }, /* []]*/
+		{  1263,    13,     6,     1,    23 }, /* [^]*/
+		{  1273,    13,     2,     1,     3 }, /* [_]*/
+		{  1275,     6,     4,     3,    27 }, /* [`]*/
+		{  1279,    13,    14,     1,     6 }, /* [a]*/
+		{  1293,    13,    20,     1,     6 }, /* [b]*/
+		{  1314,    13,    14,     1,     6 }, /* [c]*/
+		{  1330,    13,    20,     1,     6 }, /* [d]*/
+		{  1350,    13,    14,     1,     6 }, /* [e]*/
+		{  1366,    13,    20,     1,     6 }, /* [f]*/
+		{  1387,    13,    19,     1,     1 }, /* [g]*/
+		{  1407,    13,    20,     1,     6 }, /* [h]*/
+		{  1428,     7,    20,     4,     6 }, /* [i]*/
+		{  1446,    11,    25,     2,     1 }, /* [j]*/
+		{  1471,    12,    20,     2,     6 }, /* [k]*/
+		{  1502,     7,    20,     4,     6 }, /* [l]*/
+		{  1521,    13,    14,     1,     6 }, /* [m]*/
+		{  1548,    13,    14,     1,     6 }, /* [n]*/
+		{  1563,    13,    14,     1,     6 }, /* [o]*/
+		{  1579,    13,    19,     1,     1 }, /* [p]*/
+		{  1599,    13,    19,     1,     1 }, /* [q]*/
+		{  1618,    13,    14,     1,     6 }, /* [r]*/
+		{  1633,    13,    14,     1,     6 }, /* [s]*/
+		{  1648,    13,    20,     1,     6 }, /* [t]*/
+		{  1668,    13,    14,     1,     6 }, /* [u]*/
+		{  1683,    13,    14,     1,     6 }, /* [v]*/
+		{  1708,    13,    14,     1,     6 }, /* [w]*/
+		{  1732,    13,    14,     1,     6 }, /* [x]*/
+		{  1754,    13,    19,     1,     1 }, /* [y]*/
+		{  1775,    13,    14,     1,     6 }, /* [z]*/
+		{  1789,     9,    20,     3,     6 }, /* [{]*/
+		{  1809,     3,    20,     6,     6 }, /* [|]*/
+		{  1813,     9,    20,     3,     6 }, /* [}]*/
+		{  1834,    13,     6,     1,    23 }, /* [~]*/
 };
 
 #endif
-/* Font BIT DATA , MSB Left to Right (padded to byte alignment), Top Down */
-MEMSPACE_FONT unsigned char Terminus_Bold_R_X16_Y32_bitmap[2437]= { /* Terminus_Bold_R_X16_Y32_bitmap */
+/* Font RLE DATA , background run high nibble, foreground run low nibble, Left to Right, Top Down, 0x00 ends */
+MEMSPACE_FONT unsigned char Terminus_Bold_R_X16_Y32_bitmap[1846]= { /* Terminus_Bold_R_X16_Y32_bitmap */
 /* index:0, [ ] 0x20, W:  0, H:  0, X:  0, Y:  0 */
 /* index:1, [!] 0x21, W:  3, H: 20, X:  6, Y:  6 */
-	0xff,0xff,0xff,0xff,0xff,0xc0,0xff,0xf0,
+	0x0f,0x0f,0x0c,0x6c,
 /* index:2, ["] 0x22, W:  9, H:  6, X:  3, Y: 23 */
-	0xe3,0xf1,0xf8,0xfc,0x7e,0x3f,0x1c,
+	0x03,0x36,0x36,0x36,0x36,0x36,0x33,
 /* index:3, [#] 0x23, W: 13, H: 20, X:  1, Y:  6 */
-	0x38,0xe1,0xc7,0x0e,0x38,0x71,0xc3,0x8e,0x7f,0xff,0xff,0xe7,0x1c,0x38,0xe1,0xc7,
-	0x0e,0x38,0x71,0xc3,0x8e,0x7f,0xff,0xff,0xe7,0x1c,0x38,0xe1,0xc7,0x0e,0x38,0x71,
-	0xc0,
+	0x23,0x33,0x43,0x33,0x43,0x33,0x43,0x33,0x43,0x33,0x2f,0x0b,0x23,0x33,0x43,0x33,
+	0x43,0x33,0x43,0x33,0x43,0x33,0x43,0x33,0x2f,0x0b,0x23,0x33,0x43,0x33,0x43,0x33,
+	0x43,0x33,0x43,0x33,0x00,
 /* index:4, [$] 0x24, W: 13, H: 22, X:  1, Y:  5 */
-	0x07,0x00,0x38,0x0f,0xf8,0xff,0xee,0x73,0xf3,0x9f,0x9c,0x1c,0xe0,0xe7,0x07,0x38,
-	0x1f,0xf8,0x7f,0xe0,0x73,0x83,0x9c,0x1c,0xe0,0xe7,0xe7,0x3f,0x39,0xdf,0xfc,0x7f,
-	0xc0,0x70,0x03,0x80,
+	0x53,0xa3,0x79,0x3b,0x13,0x23,0x26,0x23,0x26,0x23,0x53,0x23,0x53,0x23,0x53,0x23,
+	0x6a,0x4a,0x63,0x23,0x53,0x23,0x53,0x23,0x53,0x26,0x23,0x26,0x23,0x23,0x1b,0x39,
+	0x73,0xa3,0x00,
 /* index:5, [%] 0x25, W: 12, H: 20, X:  2, Y:  6 */
-	0x7c,0x7f,0xe7,0xee,0xee,0xee,0xff,0xc7,0xdc,0x03,0x80,0x38,0x07,0x00,0x70,0x0e,
-	0x00,0xe0,0x1c,0x01,0xc0,0x3b,0xe3,0xff,0x77,0x77,0x77,0xe7,0xfe,0x3e,
+	0x15,0x3a,0x26,0x13,0x13,0x13,0x13,0x13,0x1a,0x35,0x13,0x83,0x93,0x83,0x93,0x83,
+	0x93,0x83,0x93,0x83,0x15,0x3a,0x13,0x13,0x13,0x13,0x13,0x16,0x2a,0x35,0x00,
 /* index:6, [&] 0x26, W: 14, H: 20, X:  1, Y:  6 */
-	0x1f,0x80,0xff,0x07,0x0e,0x1c,0x38,0x70,0xe1,0xc3,0x87,0x0e,0x0e,0x70,0x1f,0x80,
-	0x7c,0x03,0xf9,0xdc,0x77,0xe0,0xfb,0x81,0xce,0x07,0x38,0x1c,0xe0,0x73,0x83,0xe7,
-	0xfd,0xcf,0xe7,
+	0x36,0x78,0x53,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x53,0x23,0x76,0x85,
+	0x87,0x23,0x13,0x33,0x16,0x55,0x13,0x63,0x23,0x63,0x23,0x63,0x23,0x63,0x23,0x55,
+	0x29,0x13,0x27,0x23,
 /* index:7, ['] 0x27, W:  3, H:  6, X:  6, Y: 23 */
-	0xff,0xff,0xc0,
+	0x0f,0x03,
 /* index:8, [(] 0x28, W:  7, H: 20, X:  4, Y:  6 */
-	0x0e,0x38,0xe3,0x87,0x1c,0x38,0x70,0xe1,0xc3,0x87,0x0e,0x1c,0x38,0x38,0x70,0x70,
-	0x70,0x70,
+	0x43,0x33,0x33,0x33,0x43,0x33,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x53,
+	0x43,0x53,0x53,0x53,
 /* index:9, [)] 0x29, W:  7, H: 20, X:  4, Y:  6 */
-	0xe0,0xe0,0xe0,0xe1,0xc1,0xc3,0x87,0x0e,0x1c,0x38,0x70,0xe1,0xc3,0x8e,0x1c,0x71,
-	0xc7,0x00,
+	0x03,0x53,0x53,0x53,0x43,0x53,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x33,
+	0x43,0x33,0x33,0x33,0x00,
 /* index:10, [*] 0x2a, W: 13, H: 12, X:  1, Y: 10 */
-	0x70,0x71,0xc7,0x07,0x70,0x1f,0x00,0x70,0x7f,0xff,0xff,0xe0,0xe0,0x0f,0x80,0xee,
-	0x0e,0x38,0xe0,0xe0,
+	0x13,0x53,0x33,0x33,0x53,0x13,0x75,0x93,0x5f,0x0b,0x53,0x95,0x73,0x13,0x53,0x33,
+	0x33,0x53,0x00,
 /* index:11, [+] 0x2b, W: 13, H: 12, X:  1, Y: 10 */
-	0x07,0x00,0x38,0x01,0xc0,0x0e,0x00,0x70,0x7f,0xff,0xff,0xe0,0xe0,0x07,0x00,0x38,
-	0x01,0xc0,0x0e,0x00,
+	0x53,0xa3,0xa3,0xa3,0xa3,0x5f,0x0b,0x53,0xa3,0xa3,0xa3,0xa3,0x00,
 /* index:12, [,] 0x2c, W:  5, H:  6, X:  4, Y:  4 */
-	0x39,0xce,0x77,0x70,
+	0x23,0x23,0x23,0x23,0x13,0x13,0x00,
 /* index:13, [-] 0x2d, W: 13, H:  2, X:  1, Y: 15 */
-	0xff,0xff,0xff,0xc0,
+	0x0f,0x0b,
 /* index:14, [.] 0x2e, W:  3, H:  4, X:  6, Y:  6 */
-	0xff,0xf0,
+	0x0c,
 /* index:15, [/] 0x2f, W: 12, H: 20, X:  2, Y:  6 */
-	0x00,0x70,0x07,0x00,0xe0,0x0e,0x01,0xc0,0x1c,0x03,0x80,0x38,0x07,0x00,0x70,0x0e,
-	0x00,0xe0,0x1c,0x01,0xc0,0x38,0x03,0x80,0x70,0x07,0x00,0xe0,0x0e,0x00,
+	0x93,0x93,0x83,0x93,0x83,0x93,0x83,0x93,0x83,0x93,0x83,0x93,0x83,0x93,0x83,0x93,
+	0x83,0x93,0x83,0x93,0x00,
 /* index:16, [0] 0x30, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x3f,0x83,0xfc,0x3f,0xe3,0xbf,0x39,
-	0xfb,0x8f,0xf8,0x7f,0x83,0xf8,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xdf,0xfc,0x7f,
-	0xc0,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0x67,0x58,0x49,0x33,0x16,0x23,0x26,0x13,0x39,0x48,
+	0x57,0x66,0x76,0x76,0x76,0x73,0x1b,0x39,0x00,
 /* index:17, [1] 0x31, W:  9, H: 20, X:  3, Y:  6 */
-	0x1c,0x1e,0x1f,0x1f,0x8f,0xc0,0xe0,0x70,0x38,0x1c,0x0e,0x07,0x03,0x81,0xc0,0xe0,
-	0x70,0x38,0x1c,0x0e,0x3f,0xff,0xf0,
+	0x33,0x54,0x45,0x36,0x36,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+	0x63,0x63,0x3f,0x03,
 /* index:18, [2] 0x32, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xe0,0x07,0x00,0x70,0x07,
-	0x00,0x70,0x07,0x00,0x70,0x07,0x00,0x70,0x07,0x00,0x70,0x07,0x00,0x3f,0xff,0xff,
-	0xf0,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0x76,0x73,0xa3,0x93,0x93,0x93,0x93,0x93,0x93,0x93,
+	0x93,0x93,0x93,0xaf,0x0b,
 /* index:19, [3] 0x33, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,0xff,
-	0x87,0xfc,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0xe0,0x3f,0x01,0xdf,0xfc,0x7f,
-	0xc0,
+	0x29,0x3b,0x13,0x76,0x73,0xa3,0xa3,0xa3,0xa3,0xa3,0x39,0x49,0xb3,0xa3,0xa3,0xa3,
+	0xa6,0x76,0x73,0x1b,0x39,0x00,
 /* index:20, [4] 0x34, W: 13, H: 20, X:  1, Y:  6 */
-	0x00,0x38,0x03,0xc0,0x3e,0x03,0xf0,0x3b,0x83,0x9c,0x38,0xe3,0x87,0x38,0x3b,0x81,
-	0xf8,0x0f,0xc0,0x7e,0x03,0xff,0xff,0xff,0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,0x00,
-	0x70,
+	0xa3,0x94,0x85,0x76,0x63,0x13,0x53,0x23,0x43,0x33,0x33,0x43,0x23,0x53,0x13,0x66,
+	0x76,0x76,0x7f,0x0e,0xa3,0xa3,0xa3,0xa3,0xa3,
 /* index:21, [5] 0x35, W: 13, H: 20, X:  1, Y:  6 */
-	0xff,0xff,0xff,0xf8,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xff,0xe7,0xff,
-	0x80,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0xe0,0x3f,0x01,0xdf,0xfc,0x7f,
-	0xc0,
+	0x0f,0x0e,0xa3,0xa3,0xa3,0xa3,0xa3,0xab,0x2c,0xb3,0xa3,0xa3,0xa3,0xa3,0xa6,0x76,
+	0x73,0x1b,0x39,0x00,
 /* index:22, [6] 0x36, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xf3,0xff,0xb8,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xff,0xe7,0xff,
-	0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xdf,0xfc,0x7f,
-	0xc0,
+	0x2a,0x2b,0x13,0xa3,0xa3,0xa3,0xa3,0xa3,0xab,0x2c,0x13,0x76,0x76,0x76,0x76,0x76,
+	0x76,0x76,0x73,0x1b,0x39,0x00,
 /* index:23, [7] 0x37, W: 13, H: 20, X:  1, Y:  6 */
-	0xff,0xff,0xff,0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x38,0x01,0xc0,0x1c,0x00,0xe0,0x0e,
-	0x00,0x70,0x07,0x00,0x38,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,
-	0x00,
+	0x0f,0x0e,0x76,0x76,0x76,0x63,0xa3,0x93,0xa3,0x93,0xa3,0x93,0xa3,0x93,0xa3,0xa3,
+	0xa3,0xa3,0xa3,0xa3,0x00,
 /* index:24, [8] 0x38, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3b,0xff,
-	0x9f,0xfd,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xdf,0xfc,0x7f,
-	0xc0,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x73,0x1b,0x2b,0x13,0x76,0x76,0x76,
+	0x76,0x76,0x76,0x73,0x1b,0x39,0x00,
 /* index:25, [9] 0x39, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xdf,0xfe,0x7f,0xf0,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,0x01,0xdf,0xfc,0xff,
-	0xc0,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x73,0x1c,0x2b,0xa3,0xa3,0xa3,
+	0xa3,0xa3,0xa3,0x1b,0x2a,0x00,
 /* index:26, [:] 0x3a, W:  3, H: 14, X:  6, Y:  6 */
-	0xff,0xf0,0x00,0x03,0xff,0xc0,
+	0x0c,0xf0,0x3c,
 /* index:27, [;] 0x3b, W:  5, H: 16, X:  4, Y:  4 */
-	0x39,0xce,0x70,0x00,0x00,0x00,0x0e,0x73,0x9d,0xdc,
+	0x23,0x23,0x23,0x23,0xf0,0xf0,0x23,0x23,0x23,0x23,0x13,0x13,0x00,
 /* index:28, [<] 0x3c, W: 12, H: 20, X:  2, Y:  6 */
-	0x00,0x70,0x0e,0x01,0xc0,0x38,0x07,0x00,0xe0,0x1c,0x03,0x80,0x70,0x0e,0x00,0xe0,
-	0x07,0x00,0x38,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,
+	0x93,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x93,0xa3,0xa3,0xa3,0xa3,0xa3,
+	0xa3,0xa3,0xa3,0xa3,
 /* index:29, [=] 0x3d, W: 13, H:  8, X:  1, Y: 12 */
-	0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xff,
+	0x0f,0x0b,0xf0,0xf0,0xf0,0x7f,0x0b,
 /* index:30, [>] 0x3e, W: 12, H: 20, X:  2, Y:  6 */
-	0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,
-	0x70,0x0e,0x01,0xc0,0x38,0x07,0x00,0xe0,0x1c,0x03,0x80,0x70,0x0e,0x00,
+	0x03,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0x93,0x83,0x83,0x83,0x83,0x83,
+	0x83,0x83,0x83,0x83,0x00,
 /* index:31, [?] 0x3f, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xe0,0x0e,0x00,0xe0,0x0e,
-	0x00,0xe0,0x0e,0x00,0x70,0x03,0x80,0x00,0x00,0x00,0x07,0x00,0x38,0x01,0xc0,0x0e,
-	0x00,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0x76,0x73,0x93,0x93,0x93,0x93,0x93,0xa3,0xa3,0xf0,
+	0xf0,0x63,0xa3,0xa3,0xa3,0x00,
 /* index:32, [@] 0x40, W: 14, H: 20, X:  1, Y:  6 */
-	0x3f,0xf1,0xff,0xee,0x01,0xf8,0x03,0xe3,0xff,0x9f,0xfe,0xe1,0xfb,0x87,0xee,0x1f,
-	0xb8,0x7e,0xe1,0xfb,0x87,0xee,0x1f,0xb8,0xfe,0x7f,0xf8,0xfb,0xe0,0x03,0x80,0x07,
-	0xff,0xcf,0xff,
+	0x2a,0x3c,0x13,0x86,0x95,0x3b,0x2c,0x13,0x46,0x13,0x46,0x13,0x46,0x13,0x46,0x13,
+	0x46,0x13,0x46,0x13,0x46,0x13,0x37,0x2c,0x35,0x15,0xb3,0xcd,0x2c,
 /* index:33, [A] 0x41, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xff,0xff,0xff,0xfe,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xf8,0x0f,0xc0,
-	0x70,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x7f,0x0f,0x02,0x76,0x76,0x76,
+	0x76,0x76,0x76,0x76,0x73,
 /* index:34, [B] 0x42, W: 13, H: 20, X:  1, Y:  6 */
-	0xff,0xe7,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x0e,0xff,0xe7,0xff,
-	0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xff,0xfd,0xff,
-	0xc0,
+	0x0b,0x2c,0x13,0x76,0x76,0x76,0x76,0x76,0x63,0x1b,0x2c,0x13,0x76,0x76,0x76,0x76,
+	0x76,0x76,0x76,0x7f,0x1b,0x00,
 /* index:35, [C] 0x43, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,
-	0x38,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x07,0xe0,0x3f,0x01,0xdf,0xfc,0x7f,
-	0xc0,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,
+	0x76,0x76,0x73,0x1b,0x39,0x00,
 /* index:36, [D] 0x44, W: 13, H: 20, X:  1, Y:  6 */
-	0xff,0xc7,0xff,0x38,0x1d,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x03,0xbf,0xf9,0xff,
-	0x80,
+	0x0a,0x3b,0x23,0x63,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,
+	0x76,0x76,0x76,0x63,0x1b,0x2a,0x00,
 /* index:37, [E] 0x45, W: 13, H: 20, X:  1, Y:  6 */
-	0xff,0xff,0xff,0xf8,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0xfe,
-	0x3f,0xf1,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x3f,0xff,0xff,
-	0xf0,
+	0x0f,0x0e,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xaa,0x3a,0x33,0xa3,0xa3,0xa3,0xa3,0xa3,
+	0xa3,0xaf,0x0b,
 /* index:38, [F] 0x46, W: 13, H: 20, X:  1, Y:  6 */
-	0xff,0xff,0xff,0xf8,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0xfe,
-	0x3f,0xf1,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,0x01,0xc0,
-	0x00,
+	0x0f,0x0e,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xaa,0x3a,0x33,0xa3,0xa3,0xa3,0xa3,0xa3,
+	0xa3,0xa3,0xa3,0x00,
 /* index:39, [G] 0x47, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x03,0x80,0x1c,0x00,0xe0,0x07,0x1f,
-	0xf8,0xff,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xdf,0xfc,0x7f,
-	0xc0,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0xa3,0xa3,0xa3,0xa3,0x3a,0x3a,0x76,0x76,0x76,0x76,
+	0x76,0x76,0x73,0x1b,0x39,0x00,
 /* index:40, [H] 0x48, W: 13, H: 20, X:  1, Y:  6 */
-	0xe0,0x3f,0x01,0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0xff,
-	0xff,0xff,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xf8,0x0f,0xc0,
-	0x70,
+	0x03,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x7f,0x0f,0x02,0x76,0x76,0x76,0x76,
+	0x76,0x76,0x76,0x76,0x73,
 /* index:41, [I] 0x49, W:  7, H: 20, X:  4, Y:  6 */
-	0xff,0xfc,0xe1,0xc3,0x87,0x0e,0x1c,0x38,0x70,0xe1,0xc3,0x87,0x0e,0x1c,0x38,0x73,
-	0xff,0xf0,
+	0x0e,0x23,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+	0x43,0x2e,
 /* index:42, [J] 0x4a, W: 14, H: 20, X:  1, Y:  6 */
-	0x01,0xfc,0x07,0xf0,0x07,0x00,0x1c,0x00,0x70,0x01,0xc0,0x07,0x00,0x1c,0x00,0x70,
-	0x01,0xc0,0x07,0x00,0x1c,0x00,0x70,0x01,0xce,0x07,0x38,0x1c,0xe0,0x73,0x81,0xc7,
-	0xfe,0x0f,0xf0,
+	0x77,0x77,0x93,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0xb3,0x23,0x63,
+	0x23,0x63,0x23,0x63,0x23,0x63,0x3a,0x58,0x00,
 /* index:43, [K] 0x4b, W: 13, H: 20, X:  1, Y:  6 */
-	0xe0,0x1f,0x01,0xf8,0x1d,0xc1,0xce,0x1c,0x71,0xc3,0x9c,0x1d,0xc0,0xfc,0x07,0xc0,
-	0x3e,0x01,0xf8,0x0e,0xe0,0x73,0x83,0x8e,0x1c,0x38,0xe0,0xe7,0x03,0xb8,0x0f,0xc0,
-	0x30,
+	0x03,0x85,0x76,0x63,0x13,0x53,0x23,0x43,0x33,0x33,0x43,0x23,0x53,0x13,0x66,0x75,
+	0x85,0x86,0x73,0x13,0x63,0x23,0x53,0x33,0x43,0x43,0x33,0x53,0x23,0x63,0x13,0x76,
+	0x82,
 /* index:44, [L] 0x4c, W: 13, H: 20, X:  1, Y:  6 */
-	0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,
-	0x38,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x3f,0xff,0xff,
-	0xf0,
+	0x03,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,
+	0xa3,0xa3,0xaf,0x0b,
 /* index:45, [M] 0x4d, W: 14, H: 20, X:  1, Y:  6 */
-	0xc0,0x0f,0x80,0x7f,0x03,0xfe,0x1f,0xfc,0xff,0xbf,0x7e,0x79,0xf8,0xc7,0xe0,0x1f,
-	0x80,0x7e,0x01,0xf8,0x07,0xe0,0x1f,0x80,0x7e,0x01,0xf8,0x07,0xe0,0x1f,0x80,0x7e,
-	0x01,0xf8,0x07,
+	0x02,0xa5,0x87,0x69,0x4b,0x29,0x16,0x16,0x24,0x26,0x32,0x36,0x86,0x86,0x86,0x86,
+	0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x83,
 /* index:46, [N] 0x4e, W: 13, H: 20, X:  1, Y:  6 */
-	0xe0,0x3f,0x01,0xf8,0x0f,0xc0,0x7e,0x03,0xf8,0x1f,0xe0,0xff,0x87,0xee,0x3f,0x39,
-	0xf8,0xef,0xc3,0xfe,0x0f,0xf0,0x3f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xf8,0x0f,0xc0,
-	0x70,
+	0x03,0x76,0x76,0x76,0x76,0x77,0x68,0x59,0x46,0x13,0x36,0x23,0x26,0x33,0x16,0x49,
+	0x58,0x67,0x76,0x76,0x76,0x76,0x76,0x73,
 /* index:47, [O] 0x4f, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xdf,0xfc,0x7f,
-	0xc0,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,
+	0x76,0x76,0x73,0x1b,0x39,0x00,
 /* index:48, [P] 0x50, W: 13, H: 20, X:  1, Y:  6 */
-	0xff,0xe7,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xff,0xfd,0xff,0xce,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,0x01,0xc0,
-	0x00,
+	0x0b,0x2c,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x7f,0x1b,0x23,0xa3,0xa3,0xa3,
+	0xa3,0xa3,0xa3,0xa3,0x00,
 /* index:49, [Q] 0x51, W: 13, H: 22, X:  1, Y:  4 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe7,0x3f,0x1d,0xdf,0xfc,0x7f,
-	0xc0,0x07,0x00,0x1c,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,
+	0x76,0x23,0x26,0x33,0x13,0x1b,0x39,0xb3,0xb3,
 /* index:50, [R] 0x52, W: 13, H: 20, X:  1, Y:  6 */
-	0xff,0xe7,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xff,0xfd,0xff,0xcf,0xc0,0x77,0x03,0x9c,0x1c,0x70,0xe1,0xc7,0x07,0x38,0x1d,0xc0,
-	0x70,
+	0x0b,0x2c,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x7f,0x1b,0x26,0x73,0x13,0x63,
+	0x23,0x53,0x33,0x43,0x43,0x33,0x53,0x23,0x63,0x13,0x73,
 /* index:51, [S] 0x53, W: 13, H: 20, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x03,0xff,
-	0x0f,0xfc,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0xe0,0x3f,0x01,0xdf,0xfc,0x7f,
-	0xc0,
+	0x29,0x3b,0x13,0x76,0x76,0xa3,0xa3,0xa3,0xa3,0xba,0x4a,0xb3,0xa3,0xa3,0xa3,0xa6,
+	0x76,0x73,0x1b,0x39,0x00,
 /* index:52, [T] 0x54, W: 13, H: 20, X:  1, Y:  6 */
-	0xff,0xff,0xff,0xc1,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,
-	0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,
-	0x00,
+	0x0f,0x0b,0x53,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,
+	0xa3,0xa3,0xa3,0xa3,0x00,
 /* index:53, [U] 0x55, W: 13, H: 20, X:  1, Y:  6 */
-	0xe0,0x3f,0x01,0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xdf,0xfc,0x7f,
-	0xc0,
+	0x03,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,
+	0x76,0x76,0x73,0x1b,0x39,0x00,
 /* index:54, [V] 0x56, W: 13, H: 20, X:  1, Y:  6 */
-	0xe0,0x3f,0x01,0xf8,0x0f,0xc0,0x77,0x07,0x38,0x39,0xc1,0xce,0x0e,0x38,0xe1,0xc7,
-	0x0e,0x38,0x71,0xc1,0xdc,0x0e,0xe0,0x77,0x03,0xb8,0x0f,0x80,0x7c,0x03,0xe0,0x0e,
-	0x00,
+	0x03,0x76,0x76,0x76,0x73,0x13,0x53,0x23,0x53,0x23,0x53,0x23,0x53,0x33,0x33,0x43,
+	0x33,0x43,0x33,0x43,0x33,0x53,0x13,0x63,0x13,0x63,0x13,0x63,0x13,0x75,0x85,0x85,
+	0x93,0x00,
 /* index:55, [W] 0x57, W: 14, H: 20, X:  1, Y:  6 */
-	0xe0,0x1f,0x80,0x7e,0x01,0xf8,0x07,0xe0,0x1f,0x80,0x7e,0x01,0xf8,0x07,0xe0,0x1f,
-	0x80,0x7e,0x01,0xf8,0x07,0xe3,0x1f,0x9e,0x7e,0xfd,0xff,0x3f,0xf8,0x7f,0xc0,0xfe,
-	0x01,0xf0,0x03,
+	0x03,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x32,0x36,0x24,
+	0x26,0x16,0x19,0x2b,0x49,0x67,0x85,0xa2,
 /* index:56, [X] 0x58, W: 13, H: 20, X:  1, Y:  6 */
-	0xe0,0x3f,0x01,0xdc,0x1c,0xe0,0xe3,0x8e,0x1c,0x70,0x77,0x03,0xb8,0x0f,0x80,0x7c,
-	0x03,0xe0,0x1f,0x01,0xdc,0x0e,0xe0,0xe3,0x87,0x1c,0x70,0x73,0x83,0xb8,0x0f,0xc0,
-	0x70,
+	0x03,0x76,0x73,0x13,0x53,0x23,0x53,0x33,0x33,0x43,0x33,0x53,0x13,0x63,0x13,0x75,
+	0x85,0x85,0x85,0x73,0x13,0x63,0x13,0x53,0x33,0x43,0x33,0x33,0x53,0x23,0x53,0x13,
+	0x76,0x73,
 /* index:57, [Y] 0x59, W: 13, H: 20, X:  1, Y:  6 */
-	0xe0,0x3f,0x01,0xf8,0x0e,0xe0,0xe7,0x07,0x1c,0x70,0xe3,0x83,0xb8,0x1d,0xc0,0x7c,
-	0x03,0xe0,0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,
-	0x00,
+	0x03,0x76,0x76,0x73,0x13,0x53,0x23,0x53,0x33,0x33,0x43,0x33,0x53,0x13,0x63,0x13,
+	0x75,0x85,0x93,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0x00,
 /* index:58, [Z] 0x5a, W: 13, H: 20, X:  1, Y:  6 */
-	0xff,0xff,0xff,0xc0,0x0e,0x00,0x70,0x03,0x80,0x38,0x03,0x80,0x38,0x03,0x80,0x38,
-	0x03,0x80,0x38,0x03,0x80,0x38,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x3f,0xff,0xff,
-	0xf0,
+	0x0f,0x0b,0xa3,0xa3,0xa3,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0xa3,
+	0xa3,0xa3,0xaf,0x0b,
 /* index:59, [[] 0x5b, W:  8, H: 20, X:  4, Y:  6 */
-	0xff,0xff,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,0xe0,
-	0xe0,0xe0,0xff,0xff,
+	0x0f,0x04,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,
+	0x53,0x5f,0x01,
 /* index:60, [\] 0x5c, W: 12, H: 20, X:  2, Y:  6 */
-	0xe0,0x0e,0x00,0x70,0x07,0x00,0x38,0x03,0x80,0x1c,0x01,0xc0,0x0e,0x00,0xe0,0x07,
-	0x00,0x70,0x03,0x80,0x38,0x01,0xc0,0x1c,0x00,0xe0,0x0e,0x00,0x70,0x07,
+	0x03,0x93,0xa3,0x93,0xa3,0x93,0xa3,0x93,0xa3,0x93,0xa3,0x93,0xa3,0x93,0xa3,0x93,
+	0xa3,0x93,0xa3,0x93,
 /* index:61, []] 0x5d, W:  8, H: 20, X:  4, Y:  6 */
-	0xff,0xff,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,
-	0x07,0x07,0xff,0xff,
+	0x0f,0x01,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,
+	0x53,0x5f,0x04,
 /* index:62, [^] 0x5e, W: 13, H:  6, X:  1, Y: 23 */
-	0x07,0x00,0x7c,0x07,0x70,0x71,0xc7,0x07,0x70,0x1c,
+	0x53,0x95,0x73,0x13,0x53,0x33,0x33,0x53,0x13,0x73,
 /* index:63, [_] 0x5f, W: 13, H:  2, X:  1, Y:  3 */
-	0xff,0xff,0xff,0xc0,
+	0x0f,0x0b,
 /* index:64, [`] 0x60, W:  6, H:  4, X:  3, Y: 27 */
-	0xe1,0xc3,0x87,
+	0x03,0x43,0x43,0x43,
 /* index:65, [a] 0x61, W: 13, H: 14, X:  1, Y:  6 */
-	0x7f,0xe3,0xff,0x80,0x0e,0x00,0x70,0x03,0x9f,0xfd,0xff,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x77,0xff,0x9f,0xfc,
+	0x1a,0x3b,0xb3,0xa3,0xa3,0x2b,0x1f,0x76,0x76,0x76,0x76,0x73,0x1c,0x2b,
 /* index:66, [b] 0x62, W: 13, H: 20, X:  1, Y:  6 */
-	0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,0x00,0x70,0x03,0xff,0x9f,0xfe,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xff,0xfd,0xff,
-	0xc0,
+	0x03,0xa3,0xa3,0xa3,0xa3,0xa3,0xab,0x2c,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,
+	0x76,0x76,0x7f,0x1b,0x00,
 /* index:67, [c] 0x63, W: 13, H: 14, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,
-	0x38,0x0f,0xc0,0x77,0xff,0x1f,0xf0,
+	0x29,0x3b,0x13,0x76,0x76,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0x76,0x73,0x1b,0x39,0x00,
 /* index:68, [d] 0x64, W: 13, H: 20, X:  1, Y:  6 */
-	0x00,0x38,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,0xff,0xef,0xff,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xdf,0xfe,0x7f,
-	0xf0,
+	0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0x2b,0x1f,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,
+	0x76,0x73,0x1c,0x2b,
 /* index:69, [e] 0x65, W: 13, H: 14, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0xff,0xff,0xff,0xe0,0x07,0x00,
-	0x38,0x01,0xc0,0x77,0xff,0x1f,0xf0,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0x7f,0x0f,0x02,0xa3,0xa3,0xa3,0x73,0x1b,0x39,0x00,
 /* index:70, [f] 0x66, W: 13, H: 20, X:  1, Y:  6 */
-	0x03,0xf8,0x3f,0xc3,0x80,0x1c,0x00,0xe0,0x07,0x03,0xff,0x9f,0xfc,0x0e,0x00,0x70,
-	0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,0x00,0x70,0x03,0x80,0x1c,
-	0x00,
+	0x67,0x58,0x43,0xa3,0xa3,0xa3,0x6b,0x2b,0x63,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,
+	0xa3,0xa3,0xa3,0xa3,0x00,
 /* index:71, [g] 0x67, W: 13, H: 19, X:  1, Y:  1 */
-	0x3f,0xfb,0xff,0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x77,0xff,0x9f,0xfc,0x00,0xe0,0x07,0x00,0x3b,0xff,0x9f,0xf8,
+	0x2b,0x1f,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x73,0x1c,0x2b,0xa3,0xa3,
+	0xa3,0x1b,0x2a,0x00,
 /* index:72, [h] 0x68, W: 13, H: 20, X:  1, Y:  6 */
-	0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,0x00,0x70,0x03,0xff,0x9f,0xfe,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xf8,0x0f,0xc0,
-	0x70,
+	0x03,0xa3,0xa3,0xa3,0xa3,0xa3,0xab,0x2c,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,
+	0x76,0x76,0x76,0x76,0x73,
 /* index:73, [i] 0x69, W:  7, H: 20, X:  4, Y:  6 */
-	0x38,0x70,0xe1,0xc0,0x00,0x3e,0x7c,0x38,0x70,0xe1,0xc3,0x87,0x0e,0x1c,0x38,0x73,
-	0xff,0xf0,
+	0x23,0x43,0x43,0x43,0xf0,0x15,0x25,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+	0x43,0x2e,
 /* index:74, [j] 0x6a, W: 11, H: 25, X:  2, Y:  1 */
-	0x00,0xe0,0x1c,0x03,0x80,0x70,0x00,0x00,0x00,0xf8,0x1f,0x00,0xe0,0x1c,0x03,0x80,
-	0x70,0x0e,0x01,0xc0,0x38,0x07,0x00,0xe0,0x1c,0x03,0x80,0x7e,0x0f,0xc1,0xf8,0x3b,
-	0xfe,0x3f,0x80,
+	0x83,0x83,0x83,0x83,0xf0,0xd5,0x65,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,0x83,
+	0x83,0x83,0x86,0x56,0x56,0x53,0x19,0x37,0x00,
 /* index:75, [k] 0x6b, W: 12, H: 20, X:  2, Y:  6 */
-	0xe0,0x0e,0x00,0xe0,0x0e,0x00,0xe0,0x0e,0x00,0xe0,0x7e,0x0e,0xe1,0xce,0x38,0xe7,
-	0x0e,0xe0,0xfc,0x0f,0xc0,0xee,0x0e,0x70,0xe3,0x8e,0x1c,0xe0,0xee,0x07,
+	0x03,0x93,0x93,0x93,0x93,0x93,0x93,0x66,0x53,0x13,0x43,0x23,0x33,0x33,0x23,0x43,
+	0x13,0x56,0x66,0x63,0x13,0x53,0x23,0x43,0x33,0x33,0x43,0x23,0x53,0x13,0x63,
 /* index:76, [l] 0x6c, W:  7, H: 20, X:  4, Y:  6 */
-	0xf9,0xf0,0xe1,0xc3,0x87,0x0e,0x1c,0x38,0x70,0xe1,0xc3,0x87,0x0e,0x1c,0x38,0x73,
-	0xff,0xf0,
+	0x05,0x25,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+	0x43,0x43,0x2e,
 /* index:77, [m] 0x6d, W: 13, H: 14, X:  1, Y:  6 */
-	0xff,0xe7,0xff,0xb9,0xcf,0xce,0x7e,0x73,0xf3,0x9f,0x9c,0xfc,0xe7,0xe7,0x3f,0x39,
-	0xf9,0xcf,0xce,0x7e,0x73,0xf3,0x9c,
+	0x0b,0x2c,0x13,0x23,0x26,0x23,0x26,0x23,0x26,0x23,0x26,0x23,0x26,0x23,0x26,0x23,
+	0x26,0x23,0x26,0x23,0x26,0x23,0x26,0x23,0x26,0x23,0x23,
 /* index:78, [n] 0x6e, W: 13, H: 14, X:  1, Y:  6 */
-	0xff,0xe7,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1c,
+	0x0b,0x2c,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x73,
 /* index:79, [o] 0x6f, W: 13, H: 14, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x77,0xff,0x1f,0xf0,
+	0x29,0x3b,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x73,0x1b,0x39,0x00,
 /* index:80, [p] 0x70, W: 13, H: 19, X:  1, Y:  1 */
-	0xff,0xe7,0xff,0xb8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x7f,0xff,0x7f,0xf3,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,0x00,
+	0x0b,0x2c,0x13,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x7f,0x1b,0x23,0xa3,
+	0xa3,0xa3,0xa3,0x00,
 /* index:81, [q] 0x71, W: 13, H: 19, X:  1, Y:  1 */
-	0x3f,0xfb,0xff,0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x77,0xff,0x9f,0xfc,0x00,0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,
+	0x2b,0x1f,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x73,0x1c,0x2b,0xa3,0xa3,
+	0xa3,0xa3,0xa3,
 /* index:82, [r] 0x72, W: 13, H: 14, X:  1, Y:  6 */
-	0xe7,0xff,0x7f,0xff,0x01,0xf0,0x0f,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,
-	0x38,0x01,0xc0,0x0e,0x00,0x70,0x00,
+	0x03,0x2b,0x1f,0x75,0x84,0x93,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0x00,
 /* index:83, [s] 0x73, W: 13, H: 14, X:  1, Y:  6 */
-	0x3f,0xe3,0xff,0xb8,0x0f,0xc0,0x0e,0x00,0x70,0x01,0xff,0x87,0xfe,0x00,0x38,0x01,
-	0xc0,0x0f,0xc0,0x77,0xff,0x1f,0xf0,
+	0x29,0x3b,0x13,0x76,0xa3,0xa3,0xba,0x4a,0xb3,0xa3,0xa6,0x73,0x1b,0x39,0x00,
 /* index:84, [t] 0x74, W: 13, H: 20, X:  1, Y:  6 */
-	0x0e,0x00,0x70,0x03,0x80,0x1c,0x00,0xe0,0x07,0x03,0xff,0x9f,0xfc,0x0e,0x00,0x70,
-	0x03,0x80,0x1c,0x00,0xe0,0x07,0x00,0x38,0x01,0xc0,0x0e,0x00,0x70,0x01,0xfe,0x07,
-	0xf0,
+	0x43,0xa3,0xa3,0xa3,0xa3,0xa3,0x6b,0x2b,0x63,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,0xa3,
+	0xa3,0xa3,0xb8,0x67,
 /* index:85, [u] 0x75, W: 13, H: 14, X:  1, Y:  6 */
-	0xe0,0x3f,0x01,0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x77,0xff,0x9f,0xfc,
+	0x03,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x73,0x1c,0x2b,
 /* index:86, [v] 0x76, W: 13, H: 14, X:  1, Y:  6 */
-	0xe0,0x3f,0x01,0xf8,0x0e,0xe0,0xe7,0x07,0x38,0x38,0xe3,0x87,0x1c,0x38,0xe0,0xee,
-	0x07,0x70,0x3b,0x80,0xf8,0x07,0xc0,
+	0x03,0x76,0x76,0x73,0x13,0x53,0x23,0x53,0x23,0x53,0x33,0x33,0x43,0x33,0x43,0x33,
+	0x53,0x13,0x63,0x13,0x63,0x13,0x75,0x85,0x00,
 /* index:87, [w] 0x77, W: 13, H: 14, X:  1, Y:  6 */
-	0xe0,0x3f,0x01,0xf8,0x0f,0xc0,0x7e,0x73,0xf3,0x9f,0x9c,0xfc,0xe7,0xe7,0x3f,0x39,
-	0xf9,0xcf,0xce,0x77,0xff,0x1f,0xf0,
+	0x03,0x76,0x76,0x76,0x76,0x23,0x26,0x23,0x26,0x23,0x26,0x23,0x26,0x23,0x26,0x23,
+	0x26,0x23,0x26,0x23,0x23,0x1b,0x39,0x00,
 /* index:88, [x] 0x78, W: 13, H: 14, X:  1, Y:  6 */
-	0xe0,0x3f,0x01,0xf8,0x0e,0xe0,0xe3,0x8e,0x0e,0xe0,0x3e,0x01,0xf0,0x1d,0xc1,0xc7,
-	0x1c,0x1d,0xc0,0x7e,0x03,0xf0,0x1c,
+	0x03,0x76,0x76,0x73,0x13,0x53,0x33,0x33,0x53,0x13,0x75,0x85,0x73,0x13,0x53,0x33,
+	0x33,0x53,0x13,0x76,0x76,0x73,
 /* index:89, [y] 0x79, W: 13, H: 19, X:  1, Y:  1 */
-	0xe0,0x3f,0x01,0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,
-	0xf8,0x0f,0xc0,0x77,0xff,0x9f,0xfc,0x00,0xe0,0x07,0x00,0x3b,0xff,0x9f,0xf8,
+	0x03,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x73,0x1c,0x2b,0xa3,
+	0xa3,0xa3,0x1b,0x2a,0x00,
 /* index:90, [z] 0x7a, W: 13, H: 14, X:  1, Y:  6 */
-	0xff,0xff,0xff,0xc0,0x1c,0x01,0xc0,0x1c,0x01,0xc0,0x1c,0x01,0xc0,0x1c,0x01,0xc0,
-	0x1c,0x01,0xc0,0x0f,0xff,0xff,0xfc,
+	0x0f,0x0b,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0xaf,0x0b,
 /* index:91, [{] 0x7b, W:  9, H: 20, X:  3, Y:  6 */
-	0x0f,0x8f,0xce,0x07,0x03,0x81,0xc0,0xe0,0x70,0x38,0x78,0x3c,0x07,0x03,0x81,0xc0,
-	0xe0,0x70,0x38,0x1c,0x07,0xe1,0xf0,
+	0x45,0x36,0x23,0x63,0x63,0x63,0x63,0x63,0x63,0x44,0x54,0x73,0x63,0x63,0x63,0x63,
+	0x63,0x63,0x76,0x45,
 /* index:92, [|] 0x7c, W:  3, H: 20, X:  6, Y:  6 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,
+	0x0f,0x0f,0x0f,0x0f,
 /* index:93, [}] 0x7d, W:  9, H: 20, X:  3, Y:  6 */
-	0xf8,0x7e,0x03,0x81,0xc0,0xe0,0x70,0x38,0x1c,0x0e,0x03,0xc1,0xe1,0xc0,0xe0,0x70,
-	0x38,0x1c,0x0e,0x07,0x3f,0x1f,0x00,
+	0x05,0x46,0x73,0x63,0x63,0x63,0x63,0x63,0x63,0x74,0x54,0x43,0x63,0x63,0x63,0x63,
+	0x63,0x63,0x26,0x35,0x00,
 /* index:94, [~] 0x7e, W: 13, H:  6, X:  1, Y: 23 */
-	0x3c,0x3b,0xf1,0xf9,0xcf,0xce,0x7e,0x3f,0x70,0xf0,
+	0x24,0x43,0x16,0x36,0x23,0x26,0x23,0x26,0x36,0x13,0x44,0x00,
 };
 /* Font BIT DATA , MSB Left to Right (padded to byte alignment), Top Down */
 /* index:0, [ ] 0x20, W:  0, H:  0, X:  0, Y:  0 */
@@ -8902,8 +8859,8 @@ _font FreeSans_Bold_R_X49_Y48 = {
 		10,
 	/* Font Gap = 1 */
 		1,
-	/* Font Bytes for entire Bitmap = 9139 */
-		9139,
+	/* Font Bytes for entire Bitmap = 5143 */
+		5143,
 	FreeSans_Bold_R_X49_Y48_bitmap,
 #ifdef FONTSPECS
 	FreeSans_Bold_R_X49_Y48_specs,
@@ -8911,10 +8868,12 @@ _font FreeSans_Bold_R_X49_Y48 = {
 	NULL, /* font->specs */
 #endif
 #ifdef FONTINFO
-	FreeSans_Bold_R_X49_Y48_info
+	FreeSans_Bold_R_X49_Y48_info,
 #else
-	NULL /* font->info */
+	NULL, /* font->info */
 #endif
+	/* Run Length Encoded Bitmap = 1 */
+		1,
 };
 
 #ifdef FONTINFO
@@ -8944,812 +8903,568 @@ MEMSPACE_FONT _fontspecs FreeSans_Bold_R_X49_Y48_specs[95] = /* FreeSans_Bold_R_
 		/* Offset, Width, Height,  X,     Y*/
 		{     0,     0,     0,     1,    10 }, /* [ ]*/
 		{     0,     8,    37,     7,    10 }, /* [!]*/
-		{    37,    18,    13,     4,    33 }, /* ["]*/
-		{    67,    28,    35,     1,     9 }, /* [#]*/
-		{   190,    26,    44,     2,     4 }, /* [$]*/
-		{   333,    42,    37,     2,     9 }, /* [%]*/
-		{   528,    31,    37,     4,    10 }, /* [&]*/
-		{   672,     7,    13,     4,    33 }, /* [']*/
-		{   684,    13,    46,     3,     0 }, /* [(]*/
-		{   759,    13,    46,     2,     0 }, /* [)]*/
-		{   834,    16,    16,     3,    30 }, /* [*]*/
-		{   866,    24,    24,     4,    10 }, /* [+]*/
-		{   938,     8,    16,     4,     1 }, /* [,]*/
-		{   954,    14,     6,     2,    20 }, /* [-]*/
-		{   965,     8,     7,     4,    10 }, /* [.]*/
-		{   972,    14,    36,     1,    10 }, /* [/]*/
-		{  1035,    25,    37,     2,    10 }, /* [0]*/
-		{  1151,    15,    36,     5,    10 }, /* [1]*/
-		{  1219,    24,    36,     3,    11 }, /* [2]*/
-		{  1327,    24,    37,     3,    10 }, /* [3]*/
-		{  1438,    24,    36,     2,    10 }, /* [4]*/
-		{  1546,    24,    37,     3,     9 }, /* [5]*/
-		{  1657,    24,    37,     3,    10 }, /* [6]*/
-		{  1768,    24,    36,     3,    10 }, /* [7]*/
-		{  1876,    25,    37,     2,    10 }, /* [8]*/
-		{  1992,    25,    37,     2,    10 }, /* [9]*/
-		{  2108,     8,    26,     4,    10 }, /* [:]*/
-		{  2134,     8,    35,     4,     1 }, /* [;]*/
-		{  2169,    24,    23,     3,    11 }, /* [<]*/
-		{  2238,    24,    18,     4,    13 }, /* [=]*/
-		{  2292,    24,    24,     3,    10 }, /* [>]*/
-		{  2364,    25,    37,     4,    10 }, /* [?]*/
-		{  2480,    47,    44,     2,     3 }, /* [@]*/
-		{  2739,    33,    36,     2,    10 }, /* [A]*/
-		{  2888,    29,    36,     5,    10 }, /* [B]*/
-		{  3019,    32,    37,     3,    10 }, /* [C]*/
-		{  3167,    31,    36,     5,    10 }, /* [D]*/
-		{  3307,    27,    36,     5,    10 }, /* [E]*/
-		{  3429,    26,    36,     5,    10 }, /* [F]*/
-		{  3546,    34,    37,     3,    10 }, /* [G]*/
-		{  3704,    30,    36,     5,    10 }, /* [H]*/
-		{  3839,     8,    36,     5,    10 }, /* [I]*/
-		{  3875,    23,    37,     3,     9 }, /* [J]*/
-		{  3982,    32,    36,     5,    10 }, /* [K]*/
-		{  4126,    25,    36,     5,    10 }, /* [L]*/
-		{  4239,    36,    36,     5,    10 }, /* [M]*/
-		{  4401,    30,    36,     5,    10 }, /* [N]*/
-		{  4536,    36,    37,     3,    10 }, /* [O]*/
-		{  4703,    28,    36,     5,    10 }, /* [P]*/
-		{  4829,    36,    38,     3,     8 }, /* [Q]*/
-		{  5000,    31,    36,     5,    10 }, /* [R]*/
-		{  5140,    30,    37,     3,    10 }, /* [S]*/
-		{  5279,    29,    36,     3,    10 }, /* [T]*/
-		{  5410,    29,    37,     5,     9 }, /* [U]*/
-		{  5545,    31,    36,     2,    10 }, /* [V]*/
-		{  5685,    46,    36,     2,    10 }, /* [W]*/
-		{  5892,    31,    36,     2,    10 }, /* [X]*/
-		{  6032,    31,    36,     2,    10 }, /* [Y]*/
-		{  6172,    27,    36,     3,    10 }, /* [Z]*/
-		{  6294,    12,    46,     4,     0 }, /* [[]*/
-		{  6363,    15,    36,     0,    10 }, /* [\]*/
-		{  6431,    12,    46,     2,     0 }, /* []]*/
-		{  6500,    23,    21,     4,    24 }, /* [^]*/
-		{  6561,    30,     4,     0,     0 }, /* [_]*/
-		{  6576,    10,     8,     2,    40 }, /* [`]*/
-		{  6586,    25,    28,     3,    10 }, /* [a]*/
-		{  6674,    26,    37,     4,     9 }, /* [b]*/
-		{  6795,    24,    28,     3,    10 }, /* [c]*/
-		{  6879,    26,    37,     3,     9 }, /* [d]*/
-		{  7000,    25,    28,     3,    10 }, /* [e]*/
-		{  7088,    14,    36,     3,    10 }, /* [f]*/
-		{  7151,    26,    37,     3,     1 }, /* [g]*/
-		{  7272,    24,    36,     4,    10 }, /* [h]*/
-		{  7380,     7,    36,     5,    10 }, /* [i]*/
-		{  7412,    10,    46,     2,     0 }, /* [j]*/
-		{  7470,    24,    36,     4,    10 }, /* [k]*/
-		{  7578,     7,    36,     4,    10 }, /* [l]*/
-		{  7610,    38,    27,     4,    11 }, /* [m]*/
-		{  7739,    24,    27,     4,    11 }, /* [n]*/
-		{  7820,    27,    28,     3,    10 }, /* [o]*/
-		{  7915,    26,    37,     4,     1 }, /* [p]*/
-		{  8036,    26,    37,     3,     1 }, /* [q]*/
-		{  8157,    15,    27,     4,    11 }, /* [r]*/
-		{  8208,    25,    28,     2,    10 }, /* [s]*/
-		{  8296,    13,    35,     3,     9 }, /* [t]*/
-		{  8353,    24,    28,     4,     9 }, /* [u]*/
-		{  8437,    25,    27,     2,    10 }, /* [v]*/
-		{  8522,    37,    27,     2,    10 }, /* [w]*/
-		{  8647,    25,    27,     2,    10 }, /* [x]*/
-		{  8732,    26,    37,     2,     0 }, /* [y]*/
-		{  8853,    22,    27,     3,    10 }, /* [z]*/
-		{  8928,    14,    46,     3,     0 }, /* [{]*/
-		{  9009,     4,    46,     6,     0 }, /* [|]*/
-		{  9032,    14,    46,     5,     0 }, /* [}]*/
-		{  9113,    23,     9,     2,    17 }, /* [~]*/
+		{    27,    18,    13,     4,    33 }, /* ["]*/
+		{    47,    28,    35,     1,     9 }, /* [#]*/
+		{   118,    26,    44,     2,     4 }, /* [$]*/
+		{   206,    42,    37,     2,     9 }, /* [%]*/
+		{   316,    31,    37,     4,    10 }, /* [&]*/
+		{   397,     7,    13,     4,    33 }, /* [']*/
+		{   407,    13,    46,     3,     0 }, /* [(]*/
+		{   453,    13,    46,     2,     0 }, /* [)]*/
+		{   500,    16,    16,     3,    30 }, /* [*]*/
+		{   524,    24,    24,     4,    10 }, /* [+]*/
+		{   569,     8,    16,     4,     1 }, /* [,]*/
+		{   583,    14,     6,     2,    20 }, /* [-]*/
+		{   589,     8,     7,     4,    10 }, /* [.]*/
+		{   593,    14,    36,     1,    10 }, /* [/]*/
+		{   630,    25,    37,     2,    10 }, /* [0]*/
+		{   687,    15,    36,     5,    10 }, /* [1]*/
+		{   723,    24,    36,     3,    11 }, /* [2]*/
+		{   776,    24,    37,     3,    10 }, /* [3]*/
+		{   839,    24,    36,     2,    10 }, /* [4]*/
+		{   901,    24,    37,     3,     9 }, /* [5]*/
+		{   972,    24,    37,     3,    10 }, /* [6]*/
+		{  1038,    24,    36,     3,    10 }, /* [7]*/
+		{  1109,    25,    37,     2,    10 }, /* [8]*/
+		{  1172,    25,    37,     2,    10 }, /* [9]*/
+		{  1239,     8,    26,     4,    10 }, /* [:]*/
+		{  1253,     8,    35,     4,     1 }, /* [;]*/
+		{  1277,    24,    23,     3,    11 }, /* [<]*/
+		{  1308,    24,    18,     4,    13 }, /* [=]*/
+		{  1337,    24,    24,     3,    10 }, /* [>]*/
+		{  1370,    25,    37,     4,    10 }, /* [?]*/
+		{  1436,    47,    44,     2,     3 }, /* [@]*/
+		{  1583,    33,    36,     2,    10 }, /* [A]*/
+		{  1662,    29,    36,     5,    10 }, /* [B]*/
+		{  1730,    32,    37,     3,    10 }, /* [C]*/
+		{  1809,    31,    36,     5,    10 }, /* [D]*/
+		{  1882,    27,    36,     5,    10 }, /* [E]*/
+		{  1953,    26,    36,     5,    10 }, /* [F]*/
+		{  2023,    34,    37,     3,    10 }, /* [G]*/
+		{  2106,    30,    36,     5,    10 }, /* [H]*/
+		{  2178,     8,    36,     5,    10 }, /* [I]*/
+		{  2198,    23,    37,     3,     9 }, /* [J]*/
+		{  2248,    32,    36,     5,    10 }, /* [K]*/
+		{  2321,    25,    36,     5,    10 }, /* [L]*/
+		{  2391,    36,    36,     5,    10 }, /* [M]*/
+		{  2504,    30,    36,     5,    10 }, /* [N]*/
+		{  2587,    36,    37,     3,    10 }, /* [O]*/
+		{  2680,    28,    36,     5,    10 }, /* [P]*/
+		{  2752,    36,    38,     3,     8 }, /* [Q]*/
+		{  2847,    31,    36,     5,    10 }, /* [R]*/
+		{  2919,    30,    37,     3,    10 }, /* [S]*/
+		{  2991,    29,    36,     3,    10 }, /* [T]*/
+		{  3063,    29,    37,     5,     9 }, /* [U]*/
+		{  3137,    31,    36,     2,    10 }, /* [V]*/
+		{  3214,    46,    36,     2,    10 }, /* [W]*/
+		{  3339,    31,    36,     2,    10 }, /* [X]*/
+		{  3411,    31,    36,     2,    10 }, /* [Y]*/
+		{  3483,    27,    36,     3,    10 }, /* [Z]*/
+		{  3554,    12,    46,     4,     0 }, /* [[]*/
+		{  3598,    15,    36,     0,    10 }, /* [\]*/
+		{  3634,    12,    46,     2,     0 }, /* []]*/
+		{  3678,    23,    21,     4,    24 }, /* [^]*/
+		{  3714,    30,     4,     0,     0 }, /* [_]*/
+		{  3722,    10,     8,     2,    40 }, /* [`]*/
+		{  3730,    25,    28,     3,    10 }, /* [a]*/
+		{  3783,    26,    37,     4,     9 }, /* [b]*/
+		{  3850,    24,    28,     3,    10 }, /* [c]*/
+		{  3902,    26,    37,     3,     9 }, /* [d]*/
+		{  3968,    25,    28,     3,    10 }, /* [e]*/
+		{  4019,    14,    36,     3,    10 }, /* [f]*/
+		{  4056,    26,    37,     3,     1 }, /* [g]*/
+		{  4121,    24,    36,     4,    10 }, /* [h]*/
+		{  4175,     7,    36,     5,    10 }, /* [i]*/
+		{  4192,    10,    46,     2,     0 }, /* [j]*/
+		{  4237,    24,    36,     4,    10 }, /* [k]*/
+		{  4307,     7,    36,     4,    10 }, /* [l]*/
+		{  4324,    38,    27,     4,    11 }, /* [m]*/
+		{  4386,    24,    27,     4,    11 }, /* [n]*/
+		{  4421,    27,    28,     3,    10 }, /* [o]*/
+		{  4467,    26,    37,     4,     1 }, /* [p]*/
+		{  4533,    26,    37,     3,     1 }, /* [q]*/
+		{  4599,    15,    27,     4,    11 }, /* [r]*/
+		{  4628,    25,    28,     2,    10 }, /* [s]*/
+		{  4677,    13,    35,     3,     9 }, /* [t]*/
+		{  4712,    24,    28,     4,     9 }, /* [u]*/
+		{  4749,    25,    27,     2,    10 }, /* [v]*/
+		{  4796,    37,    27,     2,    10 }, /* [w]*/
+		{  4874,    25,    27,     2,    10 }, /* [x]*/
+		{  4919,    26,    37,     2,     0 }, /* [y]*/
+		{  4985,    22,    27,     3,    10 }, /* [z]*/
+		{  5021,    14,    46,     3,     0 }, /* [{]*/
+		{  5067,     4,    46,     6,     0 }, /* [|]*/
+		{  5080,    14,    46,     5,     0 }, /* [}]*/
+		{  5127,    23,     9,     2,    17 }, /* [~]*/
 };
 
 #endif
-/* Font BIT DATA , MSB Left to Right (padded to byte alignment), Top Down */
-MEMSPACE_FONT unsigned char FreeSans_Bold_R_X49_Y48_bitmap[9139]= { /* FreeSans_Bold_R_X49_Y48_bitmap */
+/* Font RLE DATA , background run high nibble, foreground run low nibble, Left to Right, Top Down, 0x00 ends */
+MEMSPACE_FONT unsigned char FreeSans_Bold_R_X49_Y48_bitmap[5143]= { /* FreeSans_Bold_R_X49_Y48_bitmap */
 /* index:0, [ ] 0x20, W:  0, H:  0, X:  1, Y: 10 */
 /* index:1, [!] 0x21, W:  8, H: 37, X:  7, Y: 10 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xfe,0xfe,0xfe,0x7e,
-	0x7e,0x7e,0x7e,0x7c,0x7c,0x7c,0x3c,0x3c,0x3c,0x3c,0x38,0x00,0x00,0x00,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x05,0x17,0x17,0x17,0x26,0x26,0x26,0x26,0x25,0x35,
+	0x35,0x44,0x44,0x44,0x44,0x43,0xf0,0xcf,0x0f,0x0f,0x0b,
 /* index:2, ["] 0x22, W: 18, H: 13, X:  4, Y: 33 */
-	0xfe,0x1f,0xff,0x87,0xff,0xe1,0xff,0xf8,0x7f,0xfe,0x1f,0xff,0x87,0xff,0xe1,0xff,
-	0xf8,0x7f,0x7c,0x0f,0x9f,0x03,0xe7,0xc0,0xf8,0xe0,0x1c,0x38,0x07,0x00,
+	0x07,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0x47,0x15,0x65,0x25,0x65,0x25,0x65,0x33,
+	0x83,0x43,0x83,0x00,
 /* index:3, [#] 0x23, W: 28, H: 35, X:  1, Y:  9 */
-	0x00,0x7c,0x1f,0x80,0x07,0xc1,0xf8,0x00,0x7c,0x1f,0x00,0x0f,0xc1,0xf0,0x00,0xf8,
-	0x1f,0x00,0x0f,0x83,0xf0,0x00,0xf8,0x3e,0x00,0x0f,0x83,0xe0,0x7f,0xff,0xff,0xf7,
-	0xff,0xff,0xff,0x7f,0xff,0xff,0xf7,0xff,0xff,0xff,0x7f,0xff,0xff,0xf0,0x3f,0x07,
-	0xc0,0x03,0xe0,0x7c,0x00,0x3e,0x0f,0xc0,0x03,0xe0,0xf8,0x00,0x3e,0x0f,0x80,0x07,
-	0xe0,0xf8,0x00,0x7c,0x0f,0x80,0xff,0xff,0xff,0xcf,0xff,0xff,0xfc,0xff,0xff,0xff,
-	0xcf,0xff,0xff,0xfc,0xff,0xff,0xff,0xc0,0xf8,0x3f,0x00,0x0f,0x83,0xe0,0x00,0xf8,
-	0x3e,0x00,0x1f,0x83,0xe0,0x01,0xf0,0x3e,0x00,0x1f,0x07,0xe0,0x01,0xf0,0x7c,0x00,
-	0x1f,0x07,0xc0,0x03,0xf0,0x7c,0x00,0x3e,0x07,0xc0,0x00,
+	0x95,0x56,0xc5,0x56,0xc5,0x55,0xc6,0x55,0xc5,0x65,0xc5,0x56,0xc5,0x55,0xd5,0x55,
+	0x6f,0x0c,0x1f,0x0c,0x1f,0x0c,0x1f,0x0c,0x1f,0x0c,0x66,0x55,0xc5,0x65,0xc5,0x56,
+	0xc5,0x55,0xd5,0x55,0xc6,0x55,0xc5,0x65,0x7f,0x0b,0x2f,0x0b,0x2f,0x0b,0x2f,0x0b,
+	0x2f,0x0b,0x65,0x56,0xc5,0x55,0xd5,0x55,0xc6,0x55,0xc5,0x65,0xc5,0x56,0xc5,0x55,
+	0xd5,0x55,0xc6,0x55,0xc5,0x65,0x00,
 /* index:4, [$] 0x24, W: 26, H: 44, X:  2, Y:  4 */
-	0x00,0x1c,0x00,0x00,0x07,0x00,0x00,0x0f,0xfc,0x00,0x0f,0xff,0xc0,0x0f,0xff,0xfc,
-	0x07,0xff,0xff,0x81,0xff,0xff,0xf0,0xff,0x77,0xfe,0x3f,0x1c,0x7f,0x9f,0xc7,0x0f,
-	0xf7,0xe1,0xc3,0xfd,0xf8,0x70,0x7f,0x7e,0x1c,0x1f,0xdf,0x87,0x00,0x07,0xf1,0xc0,
-	0x01,0xfe,0x70,0x00,0x3f,0xfc,0x00,0x0f,0xff,0x80,0x01,0xff,0xfc,0x00,0x3f,0xff,
-	0xc0,0x07,0xff,0xfc,0x00,0x7f,0xff,0x80,0x07,0xff,0xf0,0x00,0x7f,0xfe,0x00,0x1c,
-	0xff,0x80,0x07,0x0f,0xf0,0x01,0xc3,0xfc,0x00,0x70,0x7f,0xfe,0x1c,0x1f,0xff,0x87,
-	0x07,0xff,0xe1,0xc1,0xff,0xfc,0x70,0xff,0x7f,0x9c,0x7f,0x9f,0xf7,0x7f,0xe3,0xff,
-	0xff,0xf0,0x7f,0xff,0xf8,0x0f,0xff,0xfc,0x01,0xff,0xfc,0x00,0x0f,0xf8,0x00,0x00,
-	0x70,0x00,0x00,0x1c,0x00,0x00,0x07,0x00,0x00,0x01,0xc0,0x00,0x00,0x70,0x00,
+	0xb3,0xf0,0x83,0xf0,0x5a,0xee,0xaf,0x03,0x7f,0x05,0x6f,0x06,0x48,0x13,0x1a,0x36,
+	0x33,0x38,0x27,0x33,0x48,0x16,0x43,0x48,0x16,0x43,0x57,0x16,0x43,0x57,0x16,0x43,
+	0xd7,0x33,0xd8,0x23,0xec,0xed,0xef,0xcf,0x01,0xbf,0x02,0xbf,0x01,0xcf,0xde,0xc3,
+	0x29,0xc3,0x48,0xb3,0x48,0xb3,0x5e,0x43,0x5e,0x43,0x5e,0x43,0x5f,0x33,0x48,0x18,
+	0x23,0x38,0x29,0x13,0x1a,0x3f,0x07,0x5f,0x05,0x7f,0x03,0x9f,0xe9,0xf0,0x53,0xf0,
+	0x83,0xf0,0x83,0xf0,0x83,0xf0,0x83,0x00,
 /* index:5, [%] 0x25, W: 42, H: 37, X:  2, Y:  9 */
-	0x03,0xf8,0x00,0x07,0x80,0x03,0xff,0x80,0x01,0xc0,0x01,0xff,0xf0,0x00,0xf0,0x00,
-	0xff,0xfe,0x00,0x38,0x00,0x7f,0xff,0xc0,0x1e,0x00,0x1f,0xc7,0xf0,0x07,0x00,0x0f,
-	0xc0,0x7c,0x03,0xc0,0x03,0xe0,0x1f,0x81,0xe0,0x00,0xf8,0x03,0xe0,0x78,0x00,0x3e,
-	0x00,0xf8,0x3c,0x00,0x0f,0x80,0x3e,0x0f,0x00,0x03,0xe0,0x1f,0x87,0x80,0x00,0xfc,
-	0x07,0xe1,0xe0,0x00,0x1f,0xc7,0xf0,0xf0,0x00,0x07,0xff,0xfc,0x3c,0x00,0x00,0xff,
-	0xfe,0x1e,0x00,0x00,0x1f,0xff,0x07,0x80,0x00,0x03,0xff,0x83,0xc0,0x00,0x00,0x3f,
-	0x80,0xe0,0x3f,0x00,0x00,0x00,0x78,0x3f,0xf0,0x00,0x00,0x1c,0x1f,0xfe,0x00,0x00,
-	0x0f,0x0f,0xff,0xc0,0x00,0x07,0x87,0xff,0xf8,0x00,0x01,0xe1,0xfc,0xfe,0x00,0x00,
-	0xf0,0xfc,0x0f,0xc0,0x00,0x3c,0x3e,0x01,0xf0,0x00,0x1e,0x0f,0x80,0x7c,0x00,0x07,
-	0x83,0xe0,0x1f,0x00,0x03,0xc0,0xf8,0x07,0xc0,0x00,0xf0,0x3f,0x03,0xf0,0x00,0x78,
-	0x07,0xe1,0xf8,0x00,0x1e,0x01,0xff,0xfe,0x00,0x0f,0x00,0x3f,0xff,0x00,0x03,0xc0,
-	0x0f,0xff,0xc0,0x01,0xe0,0x01,0xff,0xe0,0x00,0xf8,0x00,0x1f,0xe0,0x00,0x3c,0x00,
-	0x00,0x00,0x00,
+	0x67,0xf0,0x14,0xdb,0xe3,0xdd,0xc4,0xcf,0xb3,0xcf,0x02,0x94,0xc7,0x37,0x93,0xc6,
+	0x75,0x84,0xc5,0x86,0x64,0xd5,0x95,0x64,0xd5,0x95,0x54,0xe5,0x95,0x54,0xe5,0x86,
+	0x44,0xf6,0x76,0x44,0xf0,0x17,0x37,0x44,0xf0,0x2f,0x02,0x44,0xf0,0x3f,0x44,0xf0,
+	0x5d,0x54,0xf0,0x6b,0x54,0xf0,0x97,0x73,0x76,0xf0,0xa4,0x5a,0xf0,0x83,0x5c,0xf0,
+	0x64,0x4e,0xf0,0x44,0x4f,0x01,0xf0,0x34,0x47,0x27,0xf0,0x24,0x46,0x66,0xf0,0x14,
+	0x45,0x85,0xf4,0x55,0x85,0xf4,0x55,0x85,0xe4,0x65,0x85,0xe4,0x66,0x66,0xd4,0x86,
+	0x46,0xe4,0x8f,0x01,0xd4,0xae,0xe4,0xae,0xd4,0xcc,0xd5,0xe8,0xf4,0x00,
 /* index:6, [&] 0x26, W: 31, H: 37, X:  4, Y: 10 */
-	0x00,0x7f,0xc0,0x00,0x03,0xff,0xc0,0x00,0x0f,0xff,0xc0,0x00,0x3f,0xff,0xc0,0x00,
-	0x7f,0xff,0xc0,0x01,0xfe,0x3f,0x80,0x03,0xf8,0x3f,0x00,0x07,0xf0,0x7e,0x00,0x0f,
-	0xe0,0xfc,0x00,0x1f,0xe1,0xf8,0x00,0x1f,0xc7,0xe0,0x00,0x3f,0xdf,0xc0,0x00,0x3f,
-	0xff,0x00,0x00,0x3f,0xfc,0x00,0x00,0x7f,0xf0,0x00,0x00,0x7f,0xc0,0x00,0x01,0xff,
-	0x00,0x00,0x0f,0xff,0x03,0xf0,0x3f,0xff,0x07,0xe0,0xff,0xff,0x0f,0xc3,0xfe,0xff,
-	0x1f,0x0f,0xf0,0xfe,0x7e,0x1f,0xc0,0xfe,0xfc,0x7f,0x01,0xff,0xf8,0xfe,0x01,0xff,
-	0xe1,0xfc,0x01,0xff,0xc3,0xf8,0x03,0xff,0x07,0xf0,0x03,0xfe,0x0f,0xf0,0x03,0xfc,
-	0x1f,0xf0,0x0f,0xf8,0x1f,0xf0,0x7f,0xf8,0x3f,0xff,0xff,0xf8,0x3f,0xff,0xff,0xf8,
-	0x3f,0xff,0xf7,0xf0,0x3f,0xff,0xcf,0xf0,0x3f,0xfe,0x0f,0xf0,0x0f,0xf0,0x00,0x00,
+	0x99,0xf0,0x5c,0xf0,0x3e,0xf0,0x1f,0x01,0xff,0x02,0xd8,0x37,0xd7,0x56,0xd7,0x56,
+	0xd7,0x56,0xd8,0x46,0xe7,0x36,0xf8,0x17,0xf0,0x1e,0xf0,0x3c,0xf0,0x4b,0xf0,0x69,
+	0xf0,0x69,0xf0,0x5c,0x66,0x6e,0x56,0x5f,0x01,0x46,0x49,0x18,0x35,0x48,0x47,0x26,
+	0x47,0x67,0x16,0x37,0x7e,0x37,0x8c,0x47,0x9b,0x47,0x9a,0x57,0xa9,0x58,0xa8,0x59,
+	0x89,0x69,0x5c,0x5f,0x0c,0x5f,0x0c,0x5f,0x03,0x17,0x6f,0x01,0x28,0x6d,0x58,0x88,
+	0x00,
 /* index:7, ['] 0x27, W:  7, H: 13, X:  4, Y: 33 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7c,0xf9,0xf1,0xc3,0x80,
+	0x0f,0x0f,0x0f,0x0b,0x15,0x25,0x25,0x33,0x43,0x00,
 /* index:8, [(] 0x28, W: 13, H: 46, X:  3, Y:  0 */
-	0x00,0xf8,0x0f,0x80,0x7c,0x07,0xc0,0x7e,0x03,0xe0,0x3f,0x01,0xf8,0x1f,0x80,0xfc,
-	0x0f,0xc0,0x7e,0x03,0xf0,0x3f,0x01,0xf8,0x0f,0xc0,0x7e,0x07,0xf0,0x3f,0x01,0xf8,
-	0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xf8,0x0f,0xe0,0x3f,
-	0x01,0xf8,0x0f,0xc0,0x7e,0x01,0xf8,0x0f,0xc0,0x7e,0x01,0xf8,0x0f,0xc0,0x3e,0x01,
-	0xf8,0x07,0xc0,0x3f,0x00,0xf8,0x07,0xe0,0x1f,0x00,0x7c,
+	0x85,0x75,0x85,0x75,0x76,0x75,0x76,0x76,0x66,0x76,0x66,0x76,0x76,0x66,0x76,0x76,
+	0x76,0x67,0x66,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x77,0x76,0x76,0x76,
+	0x76,0x86,0x76,0x76,0x86,0x76,0x85,0x86,0x85,0x86,0x85,0x86,0x85,0x95,
 /* index:9, [)] 0x29, W: 13, H: 46, X:  2, Y:  0 */
-	0xf8,0x03,0xe0,0x1f,0x80,0x7c,0x03,0xf0,0x0f,0x80,0x7e,0x01,0xf0,0x0f,0xc0,0x7e,
-	0x01,0xf8,0x0f,0xc0,0x7e,0x01,0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x0f,0xc0,0x7e,0x03,
-	0xf0,0x1f,0x80,0xfc,0x07,0xe0,0x3f,0x01,0xf8,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x81,
-	0xfc,0x0f,0xc0,0x7e,0x03,0xf0,0x1f,0x81,0xf8,0x0f,0xc0,0x7c,0x07,0xe0,0x3f,0x03,
-	0xf0,0x1f,0x81,0xf8,0x0f,0x80,0xfc,0x07,0xc0,0x7e,0x00,
+	0x05,0x95,0x86,0x85,0x86,0x85,0x86,0x85,0x86,0x76,0x86,0x76,0x76,0x86,0x76,0x76,
+	0x76,0x86,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x76,0x67,0x66,0x76,
+	0x76,0x76,0x66,0x76,0x75,0x76,0x76,0x66,0x76,0x66,0x75,0x76,0x75,0x76,0x00,
 /* index:10, [*] 0x2a, W: 16, H: 16, X:  3, Y: 30 */
-	0x03,0xc0,0x03,0xc0,0x03,0xc0,0x03,0xc0,0xc3,0xc2,0xfb,0xff,0xff,0xff,0xff,0xff,
-	0x1f,0xf8,0x07,0xe0,0x0f,0xf0,0x1f,0xf0,0x1e,0x78,0x3c,0x7c,0x3c,0x38,0x08,0x10,
+	0x64,0xc4,0xc4,0xc4,0x62,0x44,0x41,0x15,0x1f,0x0f,0x0c,0x3a,0x86,0x98,0x79,0x74,
+	0x24,0x54,0x35,0x44,0x43,0x71,0x61,0x00,
 /* index:11, [+] 0x2b, W: 24, H: 24, X:  4, Y: 10 */
-	0x00,0x7e,0x00,0x00,0x7e,0x00,0x00,0x7e,0x00,0x00,0x7e,0x00,0x00,0x7e,0x00,0x00,
-	0x7e,0x00,0x00,0x7e,0x00,0x00,0x7e,0x00,0x00,0x7e,0x00,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x7e,0x00,
-	0x00,0x7e,0x00,0x00,0x7e,0x00,0x00,0x7e,0x00,0x00,0x7e,0x00,0x00,0x7e,0x00,0x00,
-	0x7e,0x00,0x00,0x7e,0x00,0x00,0x7e,0x00,
+	0x96,0xf0,0x36,0xf0,0x36,0xf0,0x36,0xf0,0x36,0xf0,0x36,0xf0,0x36,0xf0,0x36,0xf0,
+	0x36,0x9f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x09,0x96,0xf0,0x36,0xf0,0x36,
+	0xf0,0x36,0xf0,0x36,0xf0,0x36,0xf0,0x36,0xf0,0x36,0xf0,0x36,0x00,
 /* index:12, [,] 0x2c, W:  8, H: 16, X:  4, Y:  1 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0f,0x0e,0x0e,0x1e,0x1e,0x7c,0xf8,0xf0,0x80,
+	0x0f,0x0f,0x0f,0x0b,0x44,0x43,0x53,0x44,0x44,0x25,0x25,0x34,0x41,0x00,
 /* index:13, [-] 0x2d, W: 14, H:  6, X:  2, Y: 20 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x09,
 /* index:14, [.] 0x2e, W:  8, H:  7, X:  4, Y: 10 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	0x0f,0x0f,0x0f,0x0b,
 /* index:15, [/] 0x2f, W: 14, H: 36, X:  1, Y: 10 */
-	0x00,0x3c,0x00,0xe0,0x03,0x80,0x1e,0x00,0x70,0x01,0xc0,0x0f,0x00,0x3c,0x00,0xe0,
-	0x03,0x80,0x1e,0x00,0x70,0x01,0xc0,0x0f,0x00,0x3c,0x00,0xe0,0x03,0x80,0x1e,0x00,
-	0x70,0x01,0xc0,0x07,0x00,0x3c,0x00,0xe0,0x03,0x80,0x1e,0x00,0x70,0x01,0xc0,0x07,
-	0x00,0x3c,0x00,0xe0,0x03,0x80,0x1e,0x00,0x70,0x01,0xc0,0x07,0x00,0x3c,0x00,
+	0xa4,0xa3,0xb3,0xa4,0xa3,0xb3,0xa4,0xa4,0xa3,0xb3,0xa4,0xa3,0xb3,0xa4,0xa4,0xa3,
+	0xb3,0xa4,0xa3,0xb3,0xb3,0xa4,0xa3,0xb3,0xa4,0xa3,0xb3,0xb3,0xa4,0xa3,0xb3,0xa4,
+	0xa3,0xb3,0xb3,0xa4,0x00,
 /* index:16, [0] 0x30, W: 25, H: 37, X:  2, Y: 10 */
-	0x01,0xff,0xc0,0x03,0xff,0xf8,0x03,0xff,0xfe,0x03,0xff,0xff,0x81,0xff,0xff,0xc1,
-	0xff,0x1f,0xf0,0xfe,0x07,0xf8,0xff,0x01,0xfe,0x7f,0x00,0x7f,0x3f,0x80,0x3f,0x9f,
-	0xc0,0x1f,0xdf,0xc0,0x07,0xff,0xe0,0x03,0xff,0xf0,0x01,0xff,0xf8,0x00,0xff,0xfc,
-	0x00,0x7f,0xfe,0x00,0x3f,0xff,0x00,0x1f,0xff,0x80,0x0f,0xff,0xc0,0x07,0xff,0xe0,
-	0x03,0xff,0xf0,0x01,0xff,0xf8,0x00,0xff,0xfc,0x00,0x7f,0xfe,0x00,0x3f,0xbf,0x80,
-	0x3f,0xdf,0xc0,0x1f,0xcf,0xe0,0x0f,0xe7,0xf0,0x07,0xf1,0xfc,0x07,0xf0,0xff,0x07,
-	0xf8,0x7f,0xff,0xfc,0x1f,0xff,0xfc,0x07,0xff,0xfc,0x01,0xff,0xfc,0x00,0x7f,0xfc,
-	0x00,0x07,0xf0,0x00,
+	0x7b,0xcf,0x9f,0x02,0x7f,0x04,0x6f,0x04,0x59,0x39,0x47,0x68,0x38,0x78,0x27,0x97,
+	0x27,0x97,0x27,0x97,0x17,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,0xbe,
+	0xbe,0xbe,0xb7,0x17,0x98,0x17,0x97,0x27,0x97,0x27,0x97,0x37,0x77,0x48,0x58,0x4f,
+	0x06,0x5f,0x04,0x7f,0x02,0x9f,0xbd,0xf7,0x00,
 /* index:17, [1] 0x31, W: 15, H: 36, X:  5, Y: 10 */
-	0x00,0x3e,0x00,0xfc,0x01,0xf8,0x07,0xf0,0x1f,0xe0,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xf8,0x07,0xf0,0x0f,0xe0,0x1f,0xc0,0x3f,0x80,0x7f,0x00,0xfe,
-	0x01,0xfc,0x03,0xf8,0x07,0xf0,0x0f,0xe0,0x1f,0xc0,0x3f,0x80,0x7f,0x00,0xfe,0x01,
-	0xfc,0x03,0xf8,0x07,0xf0,0x0f,0xe0,0x1f,0xc0,0x3f,0x80,0x7f,0x00,0xfe,0x01,0xfc,
-	0x03,0xf8,0x07,0xf0,
+	0xa5,0x96,0x96,0x87,0x78,0x5f,0x0f,0x0f,0x0f,0x0f,0x0a,0x87,0x87,0x87,0x87,0x87,
+	0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,
+	0x87,0x87,0x87,0x87,
 /* index:18, [2] 0x32, W: 24, H: 36, X:  3, Y: 11 */
-	0x03,0xff,0xc0,0x07,0xff,0xe0,0x1f,0xff,0xf8,0x3f,0xff,0xfc,0x3f,0xff,0xfc,0x7f,
-	0xc3,0xfe,0x7f,0x81,0xfe,0xff,0x00,0xff,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,
-	0x7f,0xfe,0x00,0x7f,0x00,0x00,0x7f,0x00,0x00,0x7f,0x00,0x00,0xff,0x00,0x00,0xfe,
-	0x00,0x01,0xfe,0x00,0x03,0xfc,0x00,0x07,0xf8,0x00,0x0f,0xf8,0x00,0x3f,0xe0,0x00,
-	0x7f,0xc0,0x01,0xff,0x80,0x03,0xfe,0x00,0x07,0xfc,0x00,0x0f,0xf8,0x00,0x1f,0xe0,
-	0x00,0x3f,0xc0,0x00,0x3f,0xc0,0x00,0x7f,0x80,0x00,0x7f,0xff,0xff,0x7f,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	0x6c,0xbe,0x8f,0x03,0x5f,0x05,0x4f,0x05,0x39,0x49,0x28,0x68,0x18,0x8f,0xae,0xae,
+	0xae,0xa7,0xf0,0x27,0xf0,0x27,0xf0,0x18,0xf0,0x17,0xf0,0x18,0xf8,0xf8,0xf9,0xd9,
+	0xe9,0xda,0xd9,0xe9,0xe9,0xe8,0xf8,0xf0,0x18,0xf8,0xf0,0x1f,0x08,0x1f,0x0f,0x0f,
+	0x0f,0x0f,0x0f,0x0f,0x0e,
 /* index:19, [3] 0x33, W: 24, H: 37, X:  3, Y: 10 */
-	0x03,0xff,0x80,0x0f,0xff,0xe0,0x1f,0xff,0xf0,0x3f,0xff,0xf8,0x7f,0xff,0xfc,0x7f,
-	0xc7,0xfc,0x7f,0x01,0xfe,0xff,0x00,0xfe,0xfe,0x00,0xfe,0xfe,0x00,0xfe,0xfe,0x00,
-	0xfe,0x00,0x00,0xfe,0x00,0x00,0xfc,0x00,0x01,0xfc,0x00,0x03,0xf8,0x00,0x3f,0xf0,
-	0x00,0x3f,0xe0,0x00,0x3f,0xe0,0x00,0x3f,0xf8,0x00,0x3f,0xfc,0x00,0x03,0xfe,0x00,
-	0x01,0xfe,0x00,0x00,0xff,0x00,0x00,0x7f,0x00,0x00,0x7f,0x00,0x00,0x7f,0xfe,0x00,
-	0x7f,0xfe,0x00,0x7f,0xfe,0x00,0xff,0xff,0x00,0xff,0x7f,0x83,0xfe,0x7f,0xff,0xfe,
-	0x3f,0xff,0xfc,0x1f,0xff,0xf8,0x0f,0xff,0xf0,0x07,0xff,0xe0,0x00,0xff,0x00,
+	0x6b,0xbf,0x8f,0x02,0x6f,0x04,0x4f,0x06,0x39,0x39,0x37,0x78,0x18,0x87,0x17,0x97,
+	0x17,0x97,0x17,0x97,0xf0,0x27,0xf0,0x26,0xf0,0x27,0xf0,0x17,0xda,0xe9,0xf9,0xfb,
+	0xdc,0xf0,0x19,0xf0,0x18,0xf0,0x28,0xf0,0x27,0xf0,0x27,0xf0,0x2e,0xae,0xae,0x9f,
+	0x01,0x88,0x18,0x59,0x2f,0x07,0x3f,0x05,0x5f,0x03,0x7f,0x01,0x9e,0xd8,0x00,
 /* index:20, [4] 0x34, W: 24, H: 36, X:  2, Y: 10 */
-	0x00,0x07,0xf8,0x00,0x0f,0xf8,0x00,0x1f,0xf8,0x00,0x1f,0xf8,0x00,0x3f,0xf8,0x00,
-	0x3f,0xf8,0x00,0x7f,0xf8,0x00,0xff,0xf8,0x00,0xfb,0xf8,0x01,0xf3,0xf8,0x01,0xf3,
-	0xf8,0x03,0xe3,0xf8,0x03,0xe3,0xf8,0x07,0xc3,0xf8,0x0f,0x83,0xf8,0x0f,0x83,0xf8,
-	0x1f,0x03,0xf8,0x1e,0x03,0xf8,0x3e,0x03,0xf8,0x7c,0x03,0xf8,0x7c,0x03,0xf8,0xf8,
-	0x03,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0x00,0x03,0xf8,0x00,0x03,0xf8,0x00,0x03,0xf8,0x00,0x03,0xf8,
-	0x00,0x03,0xf8,0x00,0x03,0xf8,0x00,0x03,0xf8,0x00,0x03,0xf8,
+	0xd8,0xf9,0xea,0xea,0xdb,0xdb,0xcc,0xbd,0xb5,0x17,0xa5,0x27,0xa5,0x27,0x95,0x37,
+	0x95,0x37,0x85,0x47,0x75,0x57,0x75,0x57,0x65,0x67,0x64,0x77,0x55,0x77,0x45,0x87,
+	0x45,0x87,0x35,0x97,0x3f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x09,0xe7,0xf0,
+	0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0x00,
 /* index:21, [5] 0x35, W: 24, H: 37, X:  3, Y:  9 */
-	0x1f,0xff,0xfe,0x1f,0xff,0xfe,0x1f,0xff,0xfe,0x1f,0xff,0xfe,0x1f,0xff,0xfe,0x1f,
-	0xff,0xfe,0x3f,0x00,0x00,0x3f,0x00,0x00,0x3e,0x00,0x00,0x3e,0x00,0x00,0x3e,0x00,
-	0x00,0x3e,0x1e,0x00,0x7e,0xff,0xc0,0x7d,0xff,0xe0,0x7f,0xff,0xf8,0x7f,0xff,0xf8,
-	0x7f,0xff,0xfc,0x7f,0x03,0xfe,0xfe,0x01,0xfe,0x00,0x00,0xfe,0x00,0x00,0xff,0x00,
-	0x00,0x7f,0x00,0x00,0x7f,0x00,0x00,0x7f,0x00,0x00,0x7f,0x00,0x00,0x7f,0x00,0x00,
-	0x7f,0xfc,0x00,0xff,0xfe,0x00,0xfe,0xfe,0x01,0xfe,0xff,0x03,0xfe,0x7f,0xff,0xfc,
-	0x7f,0xff,0xf8,0x3f,0xff,0xf0,0x1f,0xff,0xe0,0x07,0xff,0xc0,0x01,0xfe,0x00,
+	0x3f,0x05,0x4f,0x05,0x4f,0x05,0x4f,0x05,0x4f,0x05,0x4f,0x05,0x36,0xf0,0x36,0xf0,
+	0x35,0xf0,0x45,0xf0,0x45,0xf0,0x45,0x44,0xa6,0x1a,0x75,0x1c,0x6f,0x05,0x4f,0x05,
+	0x4f,0x06,0x37,0x69,0x17,0x88,0xf0,0x27,0xf0,0x28,0xf0,0x27,0xf0,0x27,0xf0,0x27,
+	0xf0,0x27,0xf0,0x27,0xf0,0x2d,0xaf,0x97,0x17,0x88,0x18,0x69,0x2f,0x06,0x3f,0x05,
+	0x5f,0x03,0x7f,0x01,0xad,0xd8,0x00,
 /* index:22, [6] 0x36, W: 24, H: 37, X:  3, Y: 10 */
-	0x00,0xff,0xc0,0x03,0xff,0xf0,0x07,0xff,0xf8,0x0f,0xff,0xfc,0x1f,0xff,0xfc,0x3f,
-	0xe3,0xfe,0x3f,0x80,0xfe,0x3f,0x80,0xfe,0x7f,0x00,0x00,0x7f,0x00,0x00,0x7f,0x00,
-	0x00,0x7e,0x00,0x00,0xfe,0x00,0x00,0xfe,0x3f,0xc0,0xfe,0xff,0xf0,0xff,0xff,0xf8,
-	0xff,0xff,0xfc,0xff,0xff,0xfc,0xff,0xc3,0xfe,0xff,0x81,0xfe,0xff,0x00,0xff,0xff,
-	0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0x7e,0x00,
-	0x7f,0x7e,0x00,0xff,0x7f,0x00,0xfe,0x7f,0x81,0xfe,0x3f,0xc3,0xfe,0x3f,0xff,0xfc,
-	0x1f,0xff,0xfc,0x0f,0xff,0xf8,0x07,0xff,0xf0,0x03,0xff,0xc0,0x00,0xff,0x00,
+	0x8a,0xce,0x9f,0x01,0x7f,0x03,0x5f,0x04,0x49,0x39,0x37,0x77,0x37,0x77,0x27,0xf0,
+	0x27,0xf0,0x27,0xf0,0x26,0xf0,0x27,0xf0,0x27,0x38,0x67,0x1c,0x4f,0x06,0x3f,0x07,
+	0x2f,0x07,0x2a,0x49,0x19,0x68,0x18,0x8f,0x01,0x9e,0xae,0xae,0xae,0xa7,0x16,0xa7,
+	0x16,0x98,0x17,0x87,0x28,0x68,0x38,0x49,0x3f,0x05,0x5f,0x04,0x6f,0x02,0x8f,0xac,
+	0xe8,0x00,
 /* index:23, [7] 0x37, W: 24, H: 36, X:  3, Y: 10 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0x00,0x00,0x7e,0x00,0x00,0xfe,0x00,0x01,0xfc,0x00,0x01,0xf8,0x00,0x03,
-	0xf0,0x00,0x07,0xf0,0x00,0x07,0xe0,0x00,0x0f,0xe0,0x00,0x1f,0xc0,0x00,0x1f,0xc0,
-	0x00,0x3f,0x80,0x00,0x3f,0x80,0x00,0x7f,0x00,0x00,0x7f,0x00,0x00,0x7e,0x00,0x00,
-	0xfe,0x00,0x00,0xfe,0x00,0x00,0xfc,0x00,0x01,0xfc,0x00,0x01,0xfc,0x00,0x01,0xf8,
-	0x00,0x03,0xf8,0x00,0x03,0xf8,0x00,0x03,0xf8,0x00,0x03,0xf8,0x00,0x03,0xf0,0x00,
-	0x07,0xf0,0x00,0x07,0xf0,0x00,0x07,0xf0,0x00,0x07,0xf0,0x00,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x09,0xf0,0x26,0xf0,0x27,0xf0,0x17,
+	0xf0,0x26,0xf0,0x26,0xf0,0x27,0xf0,0x26,0xf0,0x27,0xf0,0x17,0xf0,0x27,0xf0,0x17,
+	0xf0,0x27,0xf0,0x17,0xf0,0x27,0xf0,0x26,0xf0,0x27,0xf0,0x27,0xf0,0x26,0xf0,0x27,
+	0xf0,0x27,0xf0,0x26,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x26,0xf0,0x27,
+	0xf0,0x27,0xf0,0x27,0xf0,0x27,0x00,
 /* index:24, [8] 0x38, W: 25, H: 37, X:  2, Y: 10 */
-	0x01,0xff,0xc0,0x03,0xff,0xf8,0x03,0xff,0xfe,0x03,0xff,0xff,0x83,0xff,0xff,0xe1,
-	0xfe,0x1f,0xf1,0xfe,0x03,0xf8,0xfe,0x00,0xfe,0x7e,0x00,0x3f,0x3f,0x00,0x1f,0x9f,
-	0x80,0x0f,0xcf,0xe0,0x0f,0xe3,0xf0,0x07,0xe1,0xfc,0x07,0xf0,0x7f,0xff,0xf0,0x0f,
-	0xff,0xe0,0x07,0xff,0xf0,0x07,0xff,0xfc,0x07,0xff,0xff,0x07,0xf8,0x3f,0xc7,0xf8,
-	0x0f,0xf3,0xf8,0x03,0xfb,0xf8,0x00,0xff,0xfc,0x00,0x7f,0xfe,0x00,0x3f,0xff,0x00,
-	0x1f,0xff,0x80,0x0f,0xff,0xc0,0x07,0xff,0xf0,0x07,0xfb,0xf8,0x07,0xf9,0xff,0x07,
-	0xfc,0xff,0xff,0xfc,0x3f,0xff,0xfe,0x0f,0xff,0xfe,0x03,0xff,0xfe,0x00,0x7f,0xfc,
-	0x00,0x0f,0xf0,0x00,
+	0x7b,0xcf,0x9f,0x02,0x7f,0x04,0x5f,0x06,0x48,0x49,0x38,0x77,0x37,0x97,0x26,0xb6,
+	0x26,0xb6,0x26,0xb6,0x27,0x97,0x36,0x96,0x47,0x77,0x5f,0x04,0x8f,0xaf,0x9f,0x02,
+	0x7f,0x04,0x58,0x58,0x38,0x78,0x27,0x97,0x17,0xbe,0xbe,0xbe,0xbe,0xbe,0xbf,0x98,
+	0x17,0x88,0x29,0x59,0x2f,0x07,0x4f,0x06,0x5f,0x04,0x7f,0x02,0xad,0xe8,0x00,
 /* index:25, [9] 0x39, W: 25, H: 37, X:  2, Y: 10 */
-	0x01,0xff,0x80,0x03,0xff,0xf0,0x03,0xff,0xfc,0x03,0xff,0xff,0x03,0xff,0xff,0xc1,
-	0xff,0x1f,0xf1,0xfe,0x03,0xf8,0xfe,0x00,0xfc,0xff,0x00,0x7f,0x7f,0x00,0x1f,0xbf,
-	0x80,0x0f,0xdf,0xc0,0x07,0xff,0xe0,0x03,0xff,0xf0,0x01,0xff,0xf8,0x00,0xff,0xfe,
-	0x00,0xff,0x7f,0x00,0x7f,0xbf,0xc0,0x7f,0xdf,0xf0,0x7f,0xe7,0xff,0xff,0xf3,0xff,
-	0xff,0xf8,0xff,0xff,0xfc,0x3f,0xfe,0xfe,0x07,0xfe,0x7f,0x00,0x78,0x3f,0x00,0x00,
-	0x1f,0x80,0x00,0x0f,0xc0,0x00,0x0f,0xe7,0xf0,0x07,0xe3,0xf8,0x07,0xf1,0xfe,0x07,
-	0xf8,0xff,0xff,0xf8,0x3f,0xff,0xf8,0x0f,0xff,0xfc,0x03,0xff,0xfc,0x00,0xff,0xf8,
-	0x00,0x0f,0xf0,0x00,
+	0x7a,0xde,0xaf,0x01,0x8f,0x03,0x6f,0x05,0x59,0x39,0x38,0x77,0x37,0x96,0x28,0x97,
+	0x17,0xb6,0x17,0xb6,0x17,0xbe,0xbe,0xbe,0xbf,0x98,0x17,0x98,0x18,0x79,0x19,0x5a,
+	0x2f,0x08,0x2f,0x08,0x3f,0x07,0x4d,0x17,0x6a,0x27,0x94,0x56,0xf0,0x46,0xf0,0x46,
+	0xf0,0x37,0x27,0x96,0x37,0x87,0x38,0x68,0x3f,0x06,0x5f,0x04,0x7f,0x03,0x8f,0x01,
+	0xad,0xf8,0x00,
 /* index:26, [:] 0x3a, W:  8, H: 26, X:  4, Y: 10 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	0x0f,0x0f,0x0f,0x0b,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x6f,0x0f,0x0f,0x0b,
 /* index:27, [;] 0x3b, W:  8, H: 35, X:  4, Y:  1 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0f,0x0e,0x0e,0x1e,0x1e,0x7c,
-	0xf8,0xf0,0x80,
+	0x0f,0x0f,0x0f,0x0b,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x6f,0x0f,0x0f,0x0b,0x44,0x43,
+	0x53,0x44,0x44,0x25,0x25,0x34,0x41,0x00,
 /* index:28, [<] 0x3c, W: 24, H: 23, X:  3, Y: 11 */
-	0x00,0x00,0x07,0x00,0x00,0x3f,0x00,0x00,0xff,0x00,0x07,0xff,0x00,0x3f,0xff,0x00,
-	0xff,0xfc,0x07,0xff,0xe0,0x3f,0xff,0x80,0xff,0xfc,0x00,0xff,0xe0,0x00,0xff,0x00,
-	0x00,0xfc,0x00,0x00,0xff,0x80,0x00,0xff,0xe0,0x00,0xff,0xfc,0x00,0x1f,0xff,0x80,
-	0x03,0xff,0xf0,0x00,0xff,0xfe,0x00,0x1f,0xff,0x00,0x03,0xff,0x00,0x00,0xff,0x00,
-	0x00,0x1f,0x00,0x00,0x03,
+	0xf0,0x63,0xf0,0x36,0xf0,0x18,0xdb,0xae,0x8e,0x7e,0x7f,0x7e,0xab,0xd8,0xf0,0x16,
+	0xf0,0x39,0xfb,0xde,0xde,0xde,0xcf,0xcd,0xea,0xf0,0x18,0xf0,0x45,0xf0,0x72,
 /* index:29, [=] 0x3d, W: 24, H: 18, X:  4, Y: 13 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x09,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,
+	0xf0,0xf0,0xf0,0x9f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x09,
 /* index:30, [>] 0x3e, W: 24, H: 24, X:  3, Y: 10 */
-	0x80,0x00,0x00,0xe0,0x00,0x00,0xfc,0x00,0x00,0xff,0x80,0x00,0xff,0xe0,0x00,0xff,
-	0xfc,0x00,0x3f,0xff,0x80,0x07,0xff,0xe0,0x00,0xff,0xfc,0x00,0x1f,0xff,0x00,0x03,
-	0xff,0x00,0x00,0xff,0x00,0x00,0x1f,0x00,0x00,0xff,0x00,0x07,0xff,0x00,0x3f,0xff,
-	0x01,0xff,0xfc,0x0f,0xff,0xe0,0x3f,0xff,0x00,0xff,0xfc,0x00,0xff,0xe0,0x00,0xff,
-	0x00,0x00,0xf8,0x00,0x00,0xe0,0x00,0x00,
+	0x01,0xf0,0x83,0xf0,0x66,0xf0,0x39,0xfb,0xde,0xcf,0xce,0xde,0xdd,0xea,0xf0,0x18,
+	0xf0,0x45,0xf0,0x18,0xdb,0xae,0x7f,0x6f,0x7e,0x8e,0xab,0xd8,0xf0,0x15,0xf0,0x43,
+	0x00,
 /* index:31, [?] 0x3f, W: 25, H: 37, X:  4, Y: 10 */
-	0x00,0x7f,0x80,0x01,0xff,0xf0,0x03,0xff,0xfe,0x03,0xff,0xff,0x83,0xff,0xff,0xe1,
-	0xff,0xff,0xf9,0xff,0x87,0xfc,0xff,0x00,0xfe,0x7f,0x00,0x7f,0xff,0x80,0x1f,0xff,
-	0x80,0x0f,0xff,0xc0,0x07,0xff,0xe0,0x03,0xf8,0x00,0x01,0xfc,0x00,0x01,0xfe,0x00,
-	0x00,0xfe,0x00,0x00,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x01,0xff,0x00,0x00,
-	0xff,0x00,0x00,0xfe,0x00,0x00,0x7e,0x00,0x00,0x7f,0x00,0x00,0x3f,0x00,0x00,0x1f,
-	0x80,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,
-	0x00,0x00,0xff,0x00,0x00,0x7f,0x80,0x00,0x3f,0xc0,0x00,0x1f,0xe0,0x00,0x0f,0xf0,
-	0x00,0x07,0xf8,0x00,
+	0x98,0xed,0xaf,0x02,0x7f,0x04,0x5f,0x06,0x4f,0x07,0x2a,0x49,0x28,0x87,0x27,0x9f,
+	0x01,0xae,0xbe,0xbe,0xb7,0xf0,0x37,0xf0,0x28,0xf0,0x27,0xf0,0x28,0xf9,0xf9,0xf9,
+	0xf0,0x18,0xf0,0x17,0xf0,0x36,0xf0,0x37,0xf0,0x36,0xf0,0x46,0xf0,0x46,0xf0,0xf0,
+	0xf0,0xf0,0xf0,0xf0,0x38,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,
+	0x28,0x00,
 /* index:32, [@] 0x40, W: 47, H: 44, X:  2, Y:  3 */
-	0x00,0x00,0x0f,0xfc,0x00,0x00,0x00,0x00,0xff,0xff,0x80,0x00,0x00,0x0f,0xff,0xff,
-	0xc0,0x00,0x00,0x7f,0xff,0xff,0xe0,0x00,0x01,0xff,0xe1,0xff,0xf0,0x00,0x0f,0xf8,
-	0x00,0x3f,0xf0,0x00,0x3f,0xc0,0x00,0x1f,0xf0,0x00,0xff,0x00,0x00,0x0f,0xf0,0x03,
-	0xf8,0x00,0x00,0x07,0xf0,0x0f,0xe0,0x00,0x00,0x07,0xe0,0x1f,0x80,0x00,0x00,0x07,
-	0xe0,0x7e,0x00,0x0f,0x00,0x0f,0xc1,0xf8,0x00,0xff,0x9f,0x0f,0xc3,0xe0,0x07,0xff,
-	0xbe,0x0f,0x8f,0xc0,0x1f,0xff,0x78,0x1f,0x1f,0x00,0x7f,0x0f,0xf0,0x1e,0x7e,0x01,
-	0xf8,0x0f,0xe0,0x3e,0xf8,0x03,0xe0,0x0f,0xc0,0x7d,0xf0,0x0f,0x80,0x1f,0x00,0xff,
-	0xe0,0x1f,0x00,0x3e,0x01,0xff,0x80,0x7c,0x00,0x7c,0x03,0xff,0x00,0xf8,0x00,0xf0,
-	0x07,0xfe,0x01,0xe0,0x01,0xe0,0x1f,0x7c,0x07,0xc0,0x07,0xc0,0x3e,0xf8,0x0f,0x80,
-	0x0f,0x80,0x7d,0xf0,0x1f,0x00,0x3e,0x01,0xfb,0xe0,0x3e,0x00,0x7c,0x07,0xe7,0xe0,
-	0x7e,0x01,0xf8,0x0f,0xcf,0xc0,0xfc,0x07,0xf0,0x3f,0x0f,0x80,0xfc,0x1f,0xf1,0xfc,
-	0x1f,0x81,0xff,0xff,0xff,0xf0,0x3f,0x01,0xff,0xf7,0xff,0xc0,0x3f,0x01,0xff,0xc7,
-	0xff,0x00,0x7f,0x00,0xfe,0x03,0xf8,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,
-	0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x7f,0x80,0x00,0x00,0x00,0x00,
-	0x7f,0xc0,0x00,0x30,0x00,0x00,0x7f,0xf8,0x07,0xf0,0x00,0x00,0x7f,0xff,0xff,0xe0,
-	0x00,0x00,0x3f,0xff,0xff,0xc0,0x00,0x00,0x0f,0xff,0xfe,0x00,0x00,0x00,0x01,0xff,
-	0xc0,0x00,0x00,
+	0xf0,0x5a,0xf0,0xf0,0x4f,0x02,0xf0,0xcf,0x07,0xf0,0x8f,0x0b,0xf0,0x5c,0x4d,0xf0,
+	0x19,0xda,0xe8,0xf0,0x29,0xc8,0xf0,0x58,0xa7,0xf0,0x97,0x87,0xf0,0xb6,0x86,0xf0,
+	0xd6,0x66,0xd4,0xc6,0x56,0xb9,0x25,0x46,0x45,0xac,0x15,0x55,0x36,0x9d,0x14,0x65,
+	0x35,0x97,0x48,0x74,0x26,0x86,0x77,0x75,0x15,0x95,0x96,0x75,0x15,0x85,0xa5,0x8b,
+	0x85,0xa5,0x8a,0x85,0xb5,0x8a,0x85,0xb4,0x9a,0x84,0xc4,0x85,0x15,0x75,0xb5,0x85,
+	0x15,0x75,0xb5,0x85,0x15,0x75,0xa5,0x86,0x15,0x75,0xa5,0x76,0x26,0x66,0x86,0x76,
+	0x26,0x66,0x77,0x66,0x45,0x76,0x59,0x37,0x56,0x6f,0x0e,0x66,0x7d,0x1d,0x86,0x7b,
+	0x3b,0x97,0x87,0x77,0xc7,0xf0,0xf0,0xb7,0xf0,0xf0,0xb7,0xf0,0xf0,0xb8,0xf0,0xf0,
+	0xa9,0xf0,0x12,0xf0,0x6c,0x87,0xf0,0x6f,0x0b,0xf0,0x8f,0x09,0xf0,0xbf,0x04,0xf0,
+	0xf0,0x2b,0x00,
 /* index:33, [A] 0x41, W: 33, H: 36, X:  2, Y: 10 */
-	0x00,0x0f,0xf8,0x00,0x00,0x07,0xfc,0x00,0x00,0x03,0xff,0x00,0x00,0x03,0xff,0x80,
-	0x00,0x01,0xff,0xc0,0x00,0x01,0xff,0xf0,0x00,0x00,0xff,0xf8,0x00,0x00,0x7f,0xfc,
-	0x00,0x00,0x7f,0xff,0x00,0x00,0x3f,0xbf,0x80,0x00,0x1f,0xdf,0xc0,0x00,0x1f,0xef,
-	0xf0,0x00,0x0f,0xe3,0xf8,0x00,0x07,0xf1,0xfc,0x00,0x07,0xf8,0xff,0x00,0x03,0xf8,
-	0x3f,0x80,0x01,0xfc,0x1f,0xe0,0x01,0xfe,0x0f,0xf0,0x00,0xfe,0x03,0xf8,0x00,0xff,
-	0x01,0xfe,0x00,0x7f,0x80,0xff,0x00,0x3f,0x80,0x3f,0x80,0x3f,0xc0,0x1f,0xe0,0x1f,
-	0xff,0xff,0xf0,0x0f,0xff,0xff,0xf8,0x0f,0xff,0xff,0xfe,0x07,0xff,0xff,0xff,0x03,
-	0xff,0xff,0xff,0x83,0xff,0xff,0xff,0xe1,0xfe,0x00,0x0f,0xf1,0xfe,0x00,0x03,0xf8,
-	0xff,0x00,0x01,0xfe,0x7f,0x00,0x00,0xff,0x7f,0x80,0x00,0x3f,0xbf,0xc0,0x00,0x1f,
-	0xff,0xc0,0x00,0x0f,0xf0,
+	0xc9,0xf0,0x99,0xf0,0x9a,0xf0,0x7b,0xf0,0x7b,0xf0,0x6d,0xf0,0x5d,0xf0,0x5d,0xf0,
+	0x4f,0xf0,0x37,0x17,0xf0,0x37,0x17,0xf0,0x28,0x18,0xf0,0x17,0x37,0xf0,0x17,0x37,
+	0xf8,0x38,0xe7,0x57,0xe7,0x58,0xc8,0x58,0xc7,0x77,0xb8,0x78,0xa8,0x78,0xa7,0x97,
+	0x98,0x98,0x8f,0x0a,0x8f,0x0a,0x7f,0x0c,0x6f,0x0c,0x6f,0x0c,0x5f,0x0e,0x48,0xd8,
+	0x38,0xf7,0x38,0xf8,0x27,0xf0,0x18,0x18,0xf0,0x27,0x18,0xf0,0x2f,0xf0,0x38,
 /* index:34, [B] 0x42, W: 29, H: 36, X:  5, Y: 10 */
-	0xff,0xff,0xf0,0x07,0xff,0xff,0xf0,0x3f,0xff,0xff,0xe1,0xff,0xff,0xff,0x8f,0xff,
-	0xff,0xfc,0x7f,0xff,0xff,0xf3,0xfc,0x00,0xff,0xdf,0xe0,0x01,0xfe,0xff,0x00,0x07,
-	0xf7,0xf8,0x00,0x3f,0xbf,0xc0,0x01,0xfd,0xfe,0x00,0x0f,0xef,0xf0,0x00,0xfe,0x7f,
-	0x80,0x1f,0xf3,0xff,0xff,0xff,0x1f,0xff,0xff,0xe0,0xff,0xff,0xfe,0x07,0xff,0xff,
-	0xfc,0x3f,0xff,0xff,0xf1,0xff,0xff,0xff,0xcf,0xf0,0x01,0xff,0x7f,0x80,0x03,0xfb,
-	0xfc,0x00,0x0f,0xff,0xe0,0x00,0x7f,0xff,0x00,0x03,0xff,0xf8,0x00,0x1f,0xff,0xc0,
-	0x00,0xff,0xfe,0x00,0x0f,0xff,0xf0,0x00,0x7f,0xff,0x80,0x1f,0xfb,0xff,0xff,0xff,
-	0xdf,0xff,0xff,0xfc,0xff,0xff,0xff,0xc7,0xff,0xff,0xfc,0x3f,0xff,0xff,0xc1,0xff,
-	0xff,0xf0,0x00,
+	0x0f,0x05,0x9f,0x08,0x6f,0x0a,0x4f,0x0b,0x3f,0x0b,0x3f,0x0c,0x28,0xaa,0x18,0xc8,
+	0x18,0xd7,0x18,0xd7,0x18,0xd7,0x18,0xd7,0x18,0xc7,0x28,0xa9,0x2f,0x0b,0x3f,0x09,
+	0x5f,0x08,0x6f,0x0a,0x4f,0x0b,0x3f,0x0c,0x28,0xb9,0x18,0xd7,0x18,0xef,0xef,0xef,
+	0xef,0xef,0xdf,0x01,0xdf,0x01,0xaa,0x1f,0x0d,0x1f,0x0c,0x2f,0x0b,0x3f,0x0a,0x4f,
+	0x09,0x5f,0x06,0x00,
 /* index:35, [C] 0x43, W: 32, H: 37, X:  3, Y: 10 */
-	0x00,0x1f,0xfe,0x00,0x00,0xff,0xff,0xc0,0x01,0xff,0xff,0xe0,0x03,0xff,0xff,0xf0,
-	0x07,0xff,0xff,0xf8,0x0f,0xff,0xff,0xfc,0x1f,0xfc,0x07,0xfe,0x3f,0xf0,0x03,0xfe,
-	0x3f,0xe0,0x01,0xff,0x7f,0xc0,0x00,0xff,0x7f,0x80,0x00,0x7f,0x7f,0x80,0x00,0x7f,
-	0x7f,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,
-	0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,
-	0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0xff,0x00,0x00,0x00,
-	0x7f,0x00,0x00,0x7f,0x7f,0x80,0x00,0x7f,0x7f,0x80,0x00,0xff,0x3f,0xc0,0x00,0xff,
-	0x3f,0xe0,0x01,0xff,0x1f,0xf0,0x03,0xfe,0x1f,0xfe,0x1f,0xfc,0x0f,0xff,0xff,0xfc,
-	0x07,0xff,0xff,0xf8,0x03,0xff,0xff,0xf0,0x01,0xff,0xff,0xc0,0x00,0x7f,0xff,0x80,
-	0x00,0x0f,0xf8,0x00,
+	0xbc,0xf0,0x2f,0x03,0xdf,0x05,0xbf,0x07,0x9f,0x09,0x7f,0x0b,0x5b,0x7a,0x3a,0xa9,
+	0x39,0xc9,0x19,0xe8,0x18,0xf0,0x17,0x18,0xf0,0x17,0x17,0xf0,0x98,0xf0,0x98,0xf0,
+	0x98,0xf0,0x98,0xf0,0x98,0xf0,0x98,0xf0,0x98,0xf0,0x98,0xf0,0x98,0xf0,0x98,0xf0,
+	0x98,0xf0,0xa7,0xf0,0x27,0x18,0xf0,0x17,0x18,0xf8,0x28,0xe8,0x29,0xc9,0x39,0xa9,
+	0x4c,0x4b,0x6f,0x0b,0x7f,0x09,0x9f,0x07,0xbf,0x04,0xff,0x01,0xf0,0x49,0x00,
 /* index:36, [D] 0x44, W: 31, H: 36, X:  5, Y: 10 */
-	0xff,0xff,0xf0,0x01,0xff,0xff,0xfc,0x03,0xff,0xff,0xfc,0x07,0xff,0xff,0xfc,0x0f,
-	0xff,0xff,0xfc,0x1f,0xff,0xff,0xfc,0x3f,0xc0,0x1f,0xfc,0x7f,0x80,0x0f,0xf8,0xff,
-	0x00,0x0f,0xf9,0xfe,0x00,0x0f,0xf3,0xfc,0x00,0x0f,0xe7,0xf8,0x00,0x1f,0xef,0xf0,
-	0x00,0x3f,0xdf,0xe0,0x00,0x3f,0xbf,0xc0,0x00,0x7f,0x7f,0x80,0x00,0xfe,0xff,0x00,
-	0x01,0xfd,0xfe,0x00,0x03,0xff,0xfc,0x00,0x07,0xff,0xf8,0x00,0x0f,0xef,0xf0,0x00,
-	0x1f,0xdf,0xe0,0x00,0x3f,0xbf,0xc0,0x00,0x7f,0x7f,0x80,0x01,0xfe,0xff,0x00,0x03,
-	0xfd,0xfe,0x00,0x07,0xfb,0xfc,0x00,0x1f,0xe7,0xf8,0x00,0x7f,0xcf,0xf0,0x01,0xff,
-	0x1f,0xe0,0x0f,0xfe,0x3f,0xff,0xff,0xf8,0x7f,0xff,0xff,0xe0,0xff,0xff,0xff,0x81,
-	0xff,0xff,0xfe,0x03,0xff,0xff,0xf0,0x07,0xff,0xff,0x00,0x00,
+	0x0f,0x05,0xbf,0x08,0x8f,0x09,0x7f,0x0a,0x6f,0x0b,0x5f,0x0c,0x48,0x9b,0x38,0xb9,
+	0x38,0xc9,0x28,0xd8,0x28,0xe7,0x28,0xe8,0x18,0xe8,0x18,0xf7,0x18,0xf7,0x18,0xf7,
+	0x18,0xf7,0x18,0xff,0x01,0xff,0x01,0xf7,0x18,0xf7,0x18,0xf7,0x18,0xf7,0x18,0xe8,
+	0x18,0xe8,0x18,0xe8,0x18,0xd8,0x28,0xc9,0x28,0xb9,0x38,0x9b,0x3f,0x0c,0x4f,0x0b,
+	0x5f,0x0a,0x6f,0x09,0x7f,0x07,0x9f,0x04,0x00,
 /* index:37, [E] 0x45, W: 27, H: 36, X:  5, Y: 10 */
-	0xff,0xff,0xff,0xdf,0xff,0xff,0xfb,0xff,0xff,0xff,0x7f,0xff,0xff,0xef,0xff,0xff,
-	0xfd,0xff,0xff,0xff,0xbf,0xc0,0x00,0x07,0xf8,0x00,0x00,0xff,0x00,0x00,0x1f,0xe0,
-	0x00,0x03,0xfc,0x00,0x00,0x7f,0x80,0x00,0x0f,0xf0,0x00,0x01,0xfe,0x00,0x00,0x3f,
-	0xff,0xff,0xe7,0xff,0xff,0xfc,0xff,0xff,0xff,0x9f,0xff,0xff,0xf3,0xff,0xff,0xfe,
-	0x7f,0xff,0xff,0xcf,0xf0,0x00,0x01,0xfe,0x00,0x00,0x3f,0xc0,0x00,0x07,0xf8,0x00,
-	0x00,0xff,0x00,0x00,0x1f,0xe0,0x00,0x03,0xfc,0x00,0x00,0x7f,0x80,0x00,0x0f,0xf0,
-	0x00,0x01,0xfe,0x00,0x00,0x3f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,
+	0x0f,0x0b,0x1f,0x0b,0x1f,0x0b,0x1f,0x0b,0x1f,0x0b,0x1f,0x0b,0x18,0xf0,0x48,0xf0,
+	0x48,0xf0,0x48,0xf0,0x48,0xf0,0x48,0xf0,0x48,0xf0,0x48,0xf0,0x4f,0x0a,0x2f,0x0a,
+	0x2f,0x0a,0x2f,0x0a,0x2f,0x0a,0x2f,0x0a,0x28,0xf0,0x48,0xf0,0x48,0xf0,0x48,0xf0,
+	0x48,0xf0,0x48,0xf0,0x48,0xf0,0x48,0xf0,0x48,0xf0,0x48,0xf0,0x4f,0x0f,0x0f,0x0f,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0c,
 /* index:38, [F] 0x46, W: 26, H: 36, X:  5, Y: 10 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xf0,0x00,0x03,0xfc,0x00,0x00,0xff,0x00,0x00,0x3f,0xc0,0x00,
-	0x0f,0xf0,0x00,0x03,0xfc,0x00,0x00,0xff,0x00,0x00,0x3f,0xc0,0x00,0x0f,0xff,0xff,
-	0xe3,0xff,0xff,0xf8,0xff,0xff,0xfe,0x3f,0xff,0xff,0x8f,0xff,0xff,0xe3,0xff,0xff,
-	0xf8,0xff,0x00,0x00,0x3f,0xc0,0x00,0x0f,0xf0,0x00,0x03,0xfc,0x00,0x00,0xff,0x00,
-	0x00,0x3f,0xc0,0x00,0x0f,0xf0,0x00,0x03,0xfc,0x00,0x00,0xff,0x00,0x00,0x3f,0xc0,
-	0x00,0x0f,0xf0,0x00,0x03,0xfc,0x00,0x00,0xff,0x00,0x00,0x3f,0xc0,0x00,0x0f,0xf0,
-	0x00,0x03,0xfc,0x00,0x00,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0e,0xf0,0x38,0xf0,0x38,0xf0,
+	0x38,0xf0,0x38,0xf0,0x38,0xf0,0x38,0xf0,0x38,0xf0,0x3f,0x08,0x3f,0x08,0x3f,0x08,
+	0x3f,0x08,0x3f,0x08,0x3f,0x08,0x38,0xf0,0x38,0xf0,0x38,0xf0,0x38,0xf0,0x38,0xf0,
+	0x38,0xf0,0x38,0xf0,0x38,0xf0,0x38,0xf0,0x38,0xf0,0x38,0xf0,0x38,0xf0,0x38,0xf0,
+	0x38,0xf0,0x38,0xf0,0x38,0x00,
 /* index:39, [G] 0x47, W: 34, H: 37, X:  3, Y: 10 */
-	0x00,0x1f,0xff,0x00,0x00,0x1f,0xff,0xf8,0x00,0x0f,0xff,0xff,0x00,0x0f,0xff,0xff,
-	0xf0,0x07,0xff,0xff,0xfe,0x03,0xff,0xff,0xff,0x80,0xff,0xc0,0x3f,0xf0,0x7f,0xc0,
-	0x03,0xfe,0x3f,0xe0,0x00,0x7f,0x8f,0xf0,0x00,0x0f,0xe7,0xf8,0x00,0x03,0xf9,0xfe,
-	0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x0f,0xf0,0x00,0x00,0x03,
-	0xfc,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x3f,0xc0,0x07,0xff,0xff,0xf0,0x01,0xff,
-	0xff,0xfc,0x00,0x7f,0xff,0xff,0x00,0x1f,0xff,0xff,0xc0,0x07,0xff,0xff,0xf0,0x01,
-	0xff,0xff,0xfc,0x00,0x00,0x7f,0x7f,0x80,0x00,0x1f,0xdf,0xe0,0x00,0x07,0xf7,0xfc,
-	0x00,0x03,0xfc,0xff,0x80,0x01,0xff,0x3f,0xf0,0x00,0xff,0xc7,0xfe,0x00,0x7f,0xf0,
-	0xff,0xf0,0xff,0xfc,0x1f,0xff,0xff,0xff,0x07,0xff,0xff,0xef,0xc0,0x7f,0xff,0xf1,
-	0xf0,0x0f,0xff,0xf8,0x7c,0x00,0xff,0xfc,0x1f,0x00,0x07,0xf8,0x00,0x00,
+	0xbd,0xf0,0x4f,0x03,0xff,0x05,0xcf,0x09,0x9f,0x0b,0x7f,0x0c,0x7a,0x8a,0x59,0xc9,
+	0x39,0xe8,0x38,0xf0,0x17,0x28,0xf0,0x27,0x28,0xf0,0xb7,0xf0,0xc7,0xf0,0xb8,0xf0,
+	0xb8,0xf0,0xb8,0xf0,0xb8,0xbf,0x08,0xbf,0x08,0xbf,0x08,0xbf,0x08,0xbf,0x08,0xbf,
+	0x08,0xf0,0x47,0x18,0xf0,0x37,0x18,0xf0,0x37,0x19,0xf0,0x18,0x29,0xe9,0x2a,0xca,
+	0x3a,0xab,0x4c,0x4e,0x5f,0x0e,0x5f,0x07,0x16,0x7f,0x04,0x35,0x8f,0x02,0x45,0xae,
+	0x55,0xd8,0x00,
 /* index:40, [H] 0x48, W: 30, H: 36, X:  5, Y: 10 */
-	0xff,0x00,0x03,0xff,0xfc,0x00,0x0f,0xff,0xf0,0x00,0x3f,0xff,0xc0,0x00,0xff,0xff,
-	0x00,0x03,0xff,0xfc,0x00,0x0f,0xff,0xf0,0x00,0x3f,0xff,0xc0,0x00,0xff,0xff,0x00,
-	0x03,0xff,0xfc,0x00,0x0f,0xff,0xf0,0x00,0x3f,0xff,0xc0,0x00,0xff,0xff,0x00,0x03,
-	0xff,0xfc,0x00,0x0f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x03,0xff,0xfc,
-	0x00,0x0f,0xff,0xf0,0x00,0x3f,0xff,0xc0,0x00,0xff,0xff,0x00,0x03,0xff,0xfc,0x00,
-	0x0f,0xff,0xf0,0x00,0x3f,0xff,0xc0,0x00,0xff,0xff,0x00,0x03,0xff,0xfc,0x00,0x0f,
-	0xff,0xf0,0x00,0x3f,0xff,0xc0,0x00,0xff,0xff,0x00,0x03,0xff,0xfc,0x00,0x0f,0xff,
-	0xf0,0x00,0x3f,0xff,0xc0,0x00,0xff,
+	0x08,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,
+	0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x0f,0x0f,0x0f,0x0f,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,
+	0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xef,
+	0x01,0xef,0x01,0xef,0x01,0xef,0x01,0xe8,
 /* index:41, [I] 0x49, W:  8, H: 36, X:  5, Y: 10 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,
+	0x0f,0x0f,0x0f,0x03,
 /* index:42, [J] 0x4a, W: 23, H: 37, X:  3, Y:  9 */
-	0x00,0x01,0xfe,0x00,0x03,0xfc,0x00,0x07,0xf8,0x00,0x0f,0xf0,0x00,0x1f,0xe0,0x00,
-	0x3f,0xc0,0x00,0x7f,0x80,0x00,0xff,0x00,0x01,0xfe,0x00,0x03,0xfc,0x00,0x07,0xf8,
-	0x00,0x0f,0xf0,0x00,0x1f,0xe0,0x00,0x3f,0xc0,0x00,0x7f,0x80,0x00,0xff,0x00,0x01,
-	0xfe,0x00,0x03,0xfc,0x00,0x07,0xf8,0x00,0x0f,0xf0,0x00,0x1f,0xe0,0x00,0x3f,0xc0,
-	0x00,0x7f,0xff,0x80,0xff,0xff,0x01,0xff,0xfe,0x03,0xff,0xfc,0x07,0xff,0xf8,0x0f,
-	0xff,0xf0,0x1f,0xdf,0xe0,0x7f,0x9f,0xf3,0xff,0x3f,0xff,0xfe,0x3f,0xff,0xf8,0x7f,
-	0xff,0xe0,0x7f,0xff,0x80,0x3f,0xfe,0x00,0x1f,0xe0,0x00,
+	0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,
+	0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xff,0x01,0x7f,0x01,0x7f,0x01,0x7f,0x01,0x7f,0x01,
+	0x7f,0x01,0x77,0x18,0x68,0x29,0x2a,0x2f,0x06,0x3f,0x04,0x4f,0x03,0x6f,0x01,0x9d,
+	0xc8,0x00,
 /* index:43, [K] 0x4b, W: 32, H: 36, X:  5, Y: 10 */
-	0xff,0x00,0x07,0xfc,0xff,0x00,0x0f,0xf8,0xff,0x00,0x0f,0xf0,0xff,0x00,0x1f,0xe0,
-	0xff,0x00,0x3f,0xc0,0xff,0x00,0x7f,0x80,0xff,0x00,0xff,0x80,0xff,0x01,0xff,0x00,
-	0xff,0x03,0xfe,0x00,0xff,0x07,0xfc,0x00,0xff,0x0f,0xf8,0x00,0xff,0x1f,0xf0,0x00,
-	0xff,0x1f,0xe0,0x00,0xff,0x3f,0xc0,0x00,0xff,0x7f,0x80,0x00,0xff,0xff,0x00,0x00,
-	0xff,0xff,0x80,0x00,0xff,0xff,0xc0,0x00,0xff,0xff,0xc0,0x00,0xff,0xff,0xe0,0x00,
-	0xff,0xef,0xf0,0x00,0xff,0xcf,0xf8,0x00,0xff,0x87,0xfc,0x00,0xff,0x03,0xfc,0x00,
-	0xff,0x01,0xfe,0x00,0xff,0x01,0xff,0x00,0xff,0x00,0xff,0x80,0xff,0x00,0x7f,0xc0,
-	0xff,0x00,0x3f,0xc0,0xff,0x00,0x3f,0xe0,0xff,0x00,0x1f,0xf0,0xff,0x00,0x0f,0xf8,
-	0xff,0x00,0x07,0xf8,0xff,0x00,0x07,0xfc,0xff,0x00,0x03,0xfe,0xff,0x00,0x01,0xff,
+	0x08,0xd9,0x28,0xc9,0x38,0xc8,0x48,0xb8,0x58,0xa8,0x68,0x98,0x78,0x89,0x78,0x79,
+	0x88,0x69,0x98,0x59,0xa8,0x49,0xb8,0x39,0xc8,0x38,0xd8,0x28,0xe8,0x18,0xff,0x01,
+	0xf0,0x1f,0x02,0xff,0x03,0xef,0x03,0xef,0x04,0xdb,0x18,0xca,0x29,0xb9,0x49,0xa8,
+	0x68,0xa8,0x78,0x98,0x79,0x88,0x89,0x78,0x99,0x68,0xa8,0x68,0xa9,0x58,0xb9,0x48,
+	0xc9,0x38,0xd8,0x38,0xd9,0x28,0xe9,0x18,0xf9,
 /* index:44, [L] 0x4c, W: 25, H: 36, X:  5, Y: 10 */
-	0xff,0x00,0x00,0x7f,0x80,0x00,0x3f,0xc0,0x00,0x1f,0xe0,0x00,0x0f,0xf0,0x00,0x07,
-	0xf8,0x00,0x03,0xfc,0x00,0x01,0xfe,0x00,0x00,0xff,0x00,0x00,0x7f,0x80,0x00,0x3f,
-	0xc0,0x00,0x1f,0xe0,0x00,0x0f,0xf0,0x00,0x07,0xf8,0x00,0x03,0xfc,0x00,0x01,0xfe,
-	0x00,0x00,0xff,0x00,0x00,0x7f,0x80,0x00,0x3f,0xc0,0x00,0x1f,0xe0,0x00,0x0f,0xf0,
-	0x00,0x07,0xf8,0x00,0x03,0xfc,0x00,0x01,0xfe,0x00,0x00,0xff,0x00,0x00,0x7f,0x80,
-	0x00,0x3f,0xc0,0x00,0x1f,0xe0,0x00,0x0f,0xf0,0x00,0x07,0xf8,0x00,0x03,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xf0,
+	0x08,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,
+	0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,
+	0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,
+	0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x28,0xf0,0x2f,0x0f,0x0f,0x0f,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,
 /* index:45, [M] 0x4d, W: 36, H: 36, X:  5, Y: 10 */
-	0xff,0xf0,0x00,0xff,0xff,0xff,0x00,0x0f,0xff,0xff,0xf0,0x00,0xff,0xff,0xff,0x00,
-	0x1f,0xff,0xff,0xf0,0x01,0xff,0xff,0xff,0x80,0x1f,0xff,0xff,0xf8,0x01,0xff,0xff,
-	0xff,0x80,0x1f,0xff,0xff,0xf8,0x03,0xff,0xff,0xff,0xc0,0x3f,0xff,0xff,0xfc,0x03,
-	0xef,0xff,0xff,0xc0,0x3e,0xff,0xff,0x7c,0x07,0xef,0xff,0xf7,0xc0,0x7e,0xff,0xff,
-	0x7e,0x07,0xcf,0xff,0xf7,0xe0,0x7c,0xff,0xff,0x3e,0x07,0xcf,0xff,0xf3,0xe0,0xfc,
-	0xff,0xff,0x3f,0x0f,0xcf,0xff,0xf3,0xf0,0xf8,0xff,0xff,0x3f,0x0f,0x8f,0xff,0xf1,
-	0xf1,0xf8,0xff,0xff,0x1f,0x9f,0x8f,0xff,0xf1,0xf9,0xf0,0xff,0xff,0x1f,0x9f,0x0f,
-	0xff,0xf0,0xf9,0xf0,0xff,0xff,0x0f,0xbf,0x0f,0xff,0xf0,0xff,0xe0,0xff,0xff,0x0f,
-	0xfe,0x0f,0xff,0xf0,0x7f,0xe0,0xff,0xff,0x07,0xfe,0x0f,0xff,0xf0,0x7f,0xe0,0xff,
-	0xff,0x07,0xfc,0x0f,0xff,0xf0,0x7f,0xc0,0xff,0xff,0x03,0xfc,0x0f,0xff,0xf0,0x3f,
-	0xc0,0xff,
+	0x0c,0xcf,0x09,0xcf,0x09,0xcf,0x09,0xbf,0x0a,0xbf,0x0b,0xaf,0x0b,0xaf,0x0b,0xaf,
+	0x0b,0x9f,0x0d,0x8f,0x0d,0x85,0x1f,0x07,0x85,0x1f,0x01,0x15,0x76,0x1f,0x01,0x15,
+	0x76,0x1f,0x01,0x16,0x65,0x2f,0x01,0x16,0x65,0x2f,0x01,0x25,0x65,0x2f,0x01,0x25,
+	0x56,0x2f,0x01,0x26,0x46,0x2f,0x01,0x26,0x45,0x3f,0x01,0x26,0x45,0x3f,0x01,0x35,
+	0x36,0x3f,0x01,0x36,0x26,0x3f,0x01,0x36,0x25,0x4f,0x01,0x36,0x25,0x4f,0x01,0x45,
+	0x25,0x4f,0x01,0x45,0x16,0x4f,0x01,0x4b,0x5f,0x01,0x4b,0x5f,0x01,0x5a,0x5f,0x01,
+	0x5a,0x5f,0x01,0x5a,0x5f,0x01,0x59,0x6f,0x01,0x59,0x6f,0x01,0x68,0x6f,0x01,0x68,
+	0x68,
 /* index:46, [N] 0x4e, W: 30, H: 36, X:  5, Y: 10 */
-	0xff,0x00,0x03,0xff,0xfe,0x00,0x0f,0xff,0xf8,0x00,0x3f,0xff,0xf0,0x00,0xff,0xff,
-	0xc0,0x03,0xff,0xff,0x80,0x0f,0xff,0xff,0x00,0x3f,0xff,0xfc,0x00,0xff,0xff,0xf8,
-	0x03,0xff,0xff,0xe0,0x0f,0xff,0xff,0xc0,0x3f,0xff,0xff,0x00,0xff,0xff,0xfe,0x03,
-	0xff,0xfd,0xfc,0x0f,0xff,0xf3,0xf0,0x3f,0xff,0xcf,0xe0,0xff,0xff,0x1f,0x83,0xff,
-	0xfc,0x7f,0x0f,0xff,0xf0,0xfe,0x3f,0xff,0xc3,0xf8,0xff,0xff,0x07,0xf3,0xff,0xfc,
-	0x0f,0xcf,0xff,0xf0,0x3f,0xbf,0xff,0xc0,0x7e,0xff,0xff,0x01,0xff,0xff,0xfc,0x03,
-	0xff,0xff,0xf0,0x0f,0xff,0xff,0xc0,0x1f,0xff,0xff,0x00,0x3f,0xff,0xfc,0x00,0xff,
-	0xff,0xf0,0x01,0xff,0xff,0xc0,0x07,0xff,0xff,0x00,0x0f,0xff,0xfc,0x00,0x1f,0xff,
-	0xf0,0x00,0x7f,0xff,0xc0,0x00,0xff,
+	0x08,0xef,0x02,0xdf,0x02,0xdf,0x03,0xcf,0x03,0xcf,0x04,0xbf,0x05,0xaf,0x05,0xaf,
+	0x06,0x9f,0x06,0x9f,0x07,0x8f,0x07,0x8f,0x08,0x7f,0x01,0x17,0x6f,0x01,0x26,0x6f,
+	0x01,0x27,0x5f,0x01,0x36,0x5f,0x01,0x37,0x4f,0x01,0x47,0x3f,0x01,0x47,0x3f,0x01,
+	0x57,0x2f,0x01,0x66,0x2f,0x01,0x67,0x1f,0x01,0x76,0x1f,0x01,0x7f,0x08,0x8f,0x07,
+	0x8f,0x07,0x9f,0x06,0xaf,0x05,0xaf,0x05,0xbf,0x04,0xbf,0x04,0xcf,0x03,0xdf,0x02,
+	0xdf,0x02,0xe8,
 /* index:47, [O] 0x4f, W: 36, H: 37, X:  3, Y: 10 */
-	0x00,0x1f,0xff,0x00,0x00,0x07,0xff,0xfc,0x00,0x01,0xff,0xff,0xf0,0x00,0x3f,0xff,
-	0xff,0x80,0x07,0xff,0xff,0xfc,0x00,0xff,0xff,0xff,0xe0,0x1f,0xfc,0x07,0xff,0x01,
-	0xff,0x00,0x1f,0xf8,0x3f,0xe0,0x00,0xff,0x83,0xfc,0x00,0x07,0xfc,0x7f,0x80,0x00,
-	0x3f,0xc7,0xf8,0x00,0x01,0xfe,0x7f,0x00,0x00,0x1f,0xef,0xf0,0x00,0x01,0xfe,0xff,
-	0x00,0x00,0x0f,0xef,0xf0,0x00,0x00,0xfe,0xff,0x00,0x00,0x0f,0xef,0xf0,0x00,0x00,
-	0xff,0xff,0x00,0x00,0x0f,0xff,0xf0,0x00,0x00,0xff,0xff,0x00,0x00,0x0f,0xef,0xf0,
-	0x00,0x00,0xfe,0xff,0x00,0x00,0x0f,0xe7,0xf0,0x00,0x01,0xfe,0x7f,0x80,0x00,0x1f,
-	0xe7,0xf8,0x00,0x03,0xfc,0x7f,0xc0,0x00,0x3f,0xc3,0xfe,0x00,0x07,0xfc,0x3f,0xf0,
-	0x00,0xff,0x81,0xff,0x80,0x1f,0xf0,0x0f,0xff,0x1f,0xff,0x00,0x7f,0xff,0xff,0xe0,
-	0x03,0xff,0xff,0xfc,0x00,0x1f,0xff,0xff,0x80,0x00,0xff,0xff,0xe0,0x00,0x03,0xff,
-	0xf8,0x00,0x00,0x07,0xfc,0x00,0x00,
+	0xbd,0xf0,0x6f,0x02,0xf0,0x2f,0x06,0xef,0x08,0xcf,0x0a,0xaf,0x0c,0x8b,0x7b,0x79,
+	0xba,0x59,0xd9,0x58,0xf9,0x38,0xf0,0x28,0x38,0xf0,0x38,0x27,0xf0,0x48,0x18,0xf0,
+	0x48,0x18,0xf0,0x57,0x18,0xf0,0x57,0x18,0xf0,0x57,0x18,0xf0,0x5f,0x01,0xf0,0x5f,
+	0x01,0xf0,0x5f,0x01,0xf0,0x57,0x18,0xf0,0x57,0x18,0xf0,0x57,0x27,0xf0,0x48,0x28,
+	0xf0,0x38,0x28,0xf0,0x28,0x39,0xf0,0x18,0x49,0xe9,0x4a,0xc9,0x6a,0xa9,0x8c,0x3d,
+	0x9f,0x0b,0xbf,0x09,0xdf,0x07,0xff,0x04,0xf0,0x4f,0xf0,0x99,0x00,
 /* index:48, [P] 0x50, W: 28, H: 36, X:  5, Y: 10 */
-	0xff,0xff,0xf0,0x0f,0xff,0xff,0xe0,0xff,0xff,0xff,0x0f,0xff,0xff,0xf8,0xff,0xff,
-	0xff,0xcf,0xff,0xff,0xfc,0xff,0x00,0xff,0xef,0xf0,0x01,0xfe,0xff,0x00,0x1f,0xef,
-	0xf0,0x00,0xfe,0xff,0x00,0x0f,0xff,0xf0,0x00,0xff,0xff,0x00,0x0f,0xff,0xf0,0x00,
-	0xfe,0xff,0x00,0x1f,0xef,0xf0,0x01,0xfe,0xff,0x00,0x7f,0xef,0xff,0xff,0xfc,0xff,
-	0xff,0xff,0xcf,0xff,0xff,0xf8,0xff,0xff,0xff,0x0f,0xff,0xff,0xe0,0xff,0xff,0xf8,
-	0x0f,0xf0,0x00,0x00,0xff,0x00,0x00,0x0f,0xf0,0x00,0x00,0xff,0x00,0x00,0x0f,0xf0,
-	0x00,0x00,0xff,0x00,0x00,0x0f,0xf0,0x00,0x00,0xff,0x00,0x00,0x0f,0xf0,0x00,0x00,
-	0xff,0x00,0x00,0x0f,0xf0,0x00,0x00,0xff,0x00,0x00,0x0f,0xf0,0x00,0x00,
+	0x0f,0x05,0x8f,0x08,0x5f,0x09,0x4f,0x0a,0x3f,0x0b,0x2f,0x0b,0x28,0x8b,0x18,0xb8,
+	0x18,0xb8,0x18,0xc7,0x18,0xcf,0x01,0xcf,0x01,0xcf,0x01,0xc7,0x18,0xb8,0x18,0xb8,
+	0x18,0x9a,0x1f,0x0b,0x2f,0x0b,0x2f,0x0a,0x3f,0x09,0x4f,0x08,0x5f,0x06,0x78,0xf0,
+	0x58,0xf0,0x58,0xf0,0x58,0xf0,0x58,0xf0,0x58,0xf0,0x58,0xf0,0x58,0xf0,0x58,0xf0,
+	0x58,0xf0,0x58,0xf0,0x58,0xf0,0x58,0x00,
 /* index:49, [Q] 0x51, W: 36, H: 38, X:  3, Y:  8 */
-	0x00,0x1f,0xff,0x00,0x00,0x07,0xff,0xfc,0x00,0x00,0xff,0xff,0xf0,0x00,0x3f,0xff,
-	0xff,0x80,0x07,0xff,0xff,0xfc,0x00,0xff,0xff,0xff,0xe0,0x1f,0xfc,0x07,0xff,0x01,
-	0xff,0x00,0x1f,0xf8,0x3f,0xe0,0x00,0x7f,0x83,0xfc,0x00,0x07,0xfc,0x7f,0x80,0x00,
-	0x3f,0xc7,0xf8,0x00,0x01,0xfe,0x7f,0x00,0x00,0x1f,0xef,0xf0,0x00,0x01,0xfe,0xff,
-	0x00,0x00,0x0f,0xef,0xf0,0x00,0x00,0xfe,0xff,0x00,0x00,0x0f,0xef,0xf0,0x00,0x00,
-	0xff,0xff,0x00,0x00,0x0f,0xff,0xf0,0x00,0x00,0xff,0xff,0x00,0x00,0x0f,0xef,0xf0,
-	0x00,0x00,0xfe,0xff,0x00,0x00,0x0f,0xe7,0xf0,0x00,0x71,0xfe,0x7f,0x80,0x0f,0x9f,
-	0xe7,0xf8,0x01,0xfd,0xfc,0x3f,0xc0,0x1f,0xff,0xc3,0xfe,0x00,0xff,0xfc,0x3f,0xf0,
-	0x07,0xff,0x81,0xff,0x80,0x3f,0xf0,0x0f,0xff,0x1f,0xff,0x00,0x7f,0xff,0xff,0xf0,
-	0x03,0xff,0xff,0xff,0x80,0x1f,0xff,0xff,0xfc,0x00,0xff,0xff,0xff,0xf0,0x03,0xff,
-	0xf8,0xfe,0x00,0x07,0xfc,0x03,0xc0,0x00,0x00,0x00,0x18,
+	0xbd,0xf0,0x6f,0x02,0xf0,0x3f,0x05,0xef,0x08,0xcf,0x0a,0xaf,0x0c,0x8b,0x7b,0x79,
+	0xba,0x59,0xe8,0x58,0xf9,0x38,0xf0,0x28,0x38,0xf0,0x38,0x27,0xf0,0x48,0x18,0xf0,
+	0x48,0x18,0xf0,0x57,0x18,0xf0,0x57,0x18,0xf0,0x57,0x18,0xf0,0x5f,0x01,0xf0,0x5f,
+	0x01,0xf0,0x5f,0x01,0xf0,0x57,0x18,0xf0,0x57,0x18,0xf0,0x57,0x27,0xd3,0x38,0x28,
+	0xb5,0x28,0x28,0xa7,0x17,0x48,0x9f,0x49,0x9e,0x4a,0x9c,0x6a,0x9a,0x8c,0x3d,0x9f,
+	0x0c,0xaf,0x0c,0xaf,0x0c,0xaf,0x0d,0xaf,0x37,0xe9,0x84,0xf0,0xf0,0x32,0x00,
 /* index:50, [R] 0x52, W: 31, H: 36, X:  5, Y: 10 */
-	0xff,0xff,0xfe,0x01,0xff,0xff,0xff,0x03,0xff,0xff,0xff,0x87,0xff,0xff,0xff,0x8f,
-	0xff,0xff,0xff,0x1f,0xff,0xff,0xff,0x3f,0xc0,0x07,0xfe,0x7f,0x80,0x03,0xfc,0xff,
-	0x00,0x03,0xf9,0xfe,0x00,0x07,0xfb,0xfc,0x00,0x0f,0xf7,0xf8,0x00,0x1f,0xcf,0xf0,
-	0x00,0x3f,0x9f,0xe0,0x00,0x7f,0x3f,0xc0,0x01,0xfe,0x7f,0x80,0x07,0xf8,0xff,0xff,
-	0xff,0xe1,0xff,0xff,0xff,0x83,0xff,0xff,0xfe,0x07,0xff,0xff,0xf8,0x0f,0xff,0xff,
-	0xfc,0x1f,0xff,0xff,0xfc,0x3f,0xc0,0x0f,0xfc,0x7f,0x80,0x07,0xf8,0xff,0x00,0x07,
-	0xf1,0xfe,0x00,0x0f,0xe3,0xfc,0x00,0x1f,0xc7,0xf8,0x00,0x3f,0x8f,0xf0,0x00,0x7f,
-	0x1f,0xe0,0x00,0xfe,0x3f,0xc0,0x01,0xfe,0x7f,0x80,0x03,0xfc,0xff,0x00,0x07,0xf9,
-	0xfe,0x00,0x0f,0xf3,0xfc,0x00,0x1f,0xf7,0xf8,0x00,0x1f,0xf0,
+	0x0f,0x08,0x8f,0x0a,0x6f,0x0c,0x4f,0x0d,0x3f,0x0d,0x3f,0x0e,0x28,0xba,0x28,0xd8,
+	0x28,0xe7,0x28,0xe8,0x18,0xe8,0x18,0xe7,0x28,0xe7,0x28,0xe7,0x28,0xd8,0x28,0xc8,
+	0x3f,0x0c,0x4f,0x0b,0x5f,0x0a,0x6f,0x09,0x7f,0x0b,0x5f,0x0c,0x48,0xaa,0x38,0xc8,
+	0x38,0xd7,0x38,0xd7,0x38,0xd7,0x38,0xd7,0x38,0xd7,0x38,0xd7,0x38,0xd8,0x28,0xd8,
+	0x28,0xd8,0x28,0xd8,0x28,0xd9,0x18,0xe9,
 /* index:51, [S] 0x53, W: 30, H: 37, X:  3, Y: 10 */
-	0x00,0xff,0xfc,0x00,0x0f,0xff,0xfc,0x00,0xff,0xff,0xfc,0x07,0xff,0xff,0xf8,0x1f,
-	0xff,0xff,0xe0,0xff,0xf7,0xff,0xc3,0xfc,0x00,0xff,0x1f,0xe0,0x01,0xfe,0x7f,0x00,
-	0x07,0xf9,0xfc,0x00,0x0f,0xe7,0xf0,0x00,0x00,0x1f,0xc0,0x00,0x00,0x7f,0x80,0x00,
-	0x01,0xff,0xc0,0x00,0x03,0xff,0xf0,0x00,0x0f,0xff,0xfe,0x00,0x1f,0xff,0xff,0x00,
-	0x3f,0xff,0xff,0x00,0x3f,0xff,0xff,0x00,0x1f,0xff,0xfc,0x00,0x03,0xff,0xf8,0x00,
-	0x00,0xff,0xe0,0x00,0x00,0x7f,0xc0,0x00,0x00,0xff,0x00,0x00,0x01,0xff,0xfc,0x00,
-	0x07,0xff,0xf0,0x00,0x1f,0xdf,0xc0,0x00,0x7f,0x7f,0x80,0x03,0xfd,0xff,0x00,0x1f,
-	0xe3,0xff,0x00,0xff,0x8f,0xff,0xff,0xfc,0x1f,0xff,0xff,0xf0,0x3f,0xff,0xff,0x80,
-	0x7f,0xff,0xf8,0x00,0x7f,0xff,0xc0,0x00,0x3f,0xf0,0x00,
+	0x8e,0xef,0x03,0xaf,0x07,0x7f,0x09,0x6f,0x09,0x5c,0x1d,0x48,0xa8,0x38,0xc8,0x27,
+	0xd8,0x27,0xe7,0x27,0xf0,0x87,0xf0,0x88,0xf0,0x7b,0xf0,0x5e,0xf0,0x1f,0x04,0xcf,
+	0x06,0xaf,0x07,0xaf,0x07,0xbf,0x04,0xf0,0x1f,0xf0,0x4b,0xf0,0x79,0xf0,0x78,0xf0,
+	0x8f,0xff,0xf7,0x17,0xf7,0x18,0xd8,0x19,0xb8,0x3a,0x89,0x3f,0x0b,0x5f,0x0a,0x6f,
+	0x08,0x8f,0x05,0xcf,0x02,0xf0,0x1a,0x00,
 /* index:52, [T] 0x54, W: 29, H: 36, X:  3, Y: 10 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xfc,0x00,0x7f,0x80,0x00,0x03,0xfc,0x00,0x00,0x1f,0xe0,
-	0x00,0x00,0xff,0x00,0x00,0x07,0xf8,0x00,0x00,0x3f,0xc0,0x00,0x01,0xfe,0x00,0x00,
-	0x0f,0xf0,0x00,0x00,0x7f,0x80,0x00,0x03,0xfc,0x00,0x00,0x1f,0xe0,0x00,0x00,0xff,
-	0x00,0x00,0x07,0xf8,0x00,0x00,0x3f,0xc0,0x00,0x01,0xfe,0x00,0x00,0x0f,0xf0,0x00,
-	0x00,0x7f,0x80,0x00,0x03,0xfc,0x00,0x00,0x1f,0xe0,0x00,0x00,0xff,0x00,0x00,0x07,
-	0xf8,0x00,0x00,0x3f,0xc0,0x00,0x01,0xfe,0x00,0x00,0x0f,0xf0,0x00,0x00,0x7f,0x80,
-	0x00,0x03,0xfc,0x00,0x00,0x1f,0xe0,0x00,0x00,0xff,0x00,0x00,0x07,0xf8,0x00,0x00,
-	0x3f,0xc0,0x00,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x09,0xb8,0xf0,0x68,0xf0,
+	0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,
+	0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,
+	0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0xf0,
+	0x68,0xf0,0x68,0xf0,0x68,0xf0,0x68,0x00,
 /* index:53, [U] 0x55, W: 29, H: 37, X:  5, Y:  9 */
-	0xff,0x00,0x07,0xff,0xf8,0x00,0x3f,0xff,0xc0,0x01,0xff,0xfe,0x00,0x0f,0xff,0xf0,
-	0x00,0x7f,0xff,0x80,0x03,0xff,0xfc,0x00,0x1f,0xff,0xe0,0x00,0xff,0xff,0x00,0x07,
-	0xff,0xf8,0x00,0x3f,0xff,0xc0,0x01,0xff,0xfe,0x00,0x0f,0xff,0xf0,0x00,0x7f,0xff,
-	0x80,0x03,0xff,0xfc,0x00,0x1f,0xff,0xe0,0x00,0xff,0xff,0x00,0x07,0xff,0xf8,0x00,
-	0x3f,0xff,0xc0,0x01,0xff,0xfe,0x00,0x0f,0xff,0xf0,0x00,0x7f,0xff,0x80,0x03,0xff,
-	0xfc,0x00,0x1f,0xff,0xe0,0x00,0xff,0xff,0x00,0x07,0xff,0xf8,0x00,0x3f,0xff,0xc0,
-	0x01,0xfd,0xfe,0x00,0x1f,0xe7,0xf8,0x00,0xff,0x3f,0xe0,0x0f,0xf9,0xff,0xe7,0xff,
-	0x87,0xff,0xff,0xfc,0x1f,0xff,0xff,0xc0,0x7f,0xff,0xfc,0x01,0xff,0xff,0xc0,0x03,
-	0xff,0xf8,0x00,0x03,0xfe,0x00,0x00,
+	0x08,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,
+	0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,
+	0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,0x01,0xdf,
+	0x01,0xdf,0x01,0xdf,0x01,0xd7,0x18,0xc8,0x28,0xb8,0x29,0x99,0x2c,0x2c,0x4f,0x0a,
+	0x5f,0x08,0x7f,0x06,0x9f,0x04,0xcf,0xf0,0x29,0x00,
 /* index:54, [V] 0x56, W: 31, H: 36, X:  2, Y: 10 */
-	0xff,0x00,0x01,0xfe,0xfe,0x00,0x03,0xfd,0xfc,0x00,0x07,0xf3,0xfc,0x00,0x0f,0xe3,
-	0xf8,0x00,0x3f,0xc7,0xf0,0x00,0x7f,0x0f,0xe0,0x00,0xfe,0x0f,0xe0,0x03,0xfc,0x1f,
-	0xc0,0x07,0xf0,0x3f,0x80,0x0f,0xe0,0x3f,0x80,0x3f,0xc0,0x7f,0x00,0x7f,0x00,0xfe,
-	0x00,0xfe,0x00,0xfe,0x01,0xf8,0x01,0xfc,0x07,0xf0,0x03,0xf8,0x0f,0xe0,0x03,0xf0,
-	0x1f,0x80,0x07,0xf0,0x7f,0x00,0x0f,0xe0,0xfe,0x00,0x0f,0xc1,0xf8,0x00,0x1f,0xc3,
-	0xf0,0x00,0x3f,0x8f,0xe0,0x00,0x3f,0x1f,0x80,0x00,0x7f,0x3f,0x00,0x00,0xfe,0xfe,
-	0x00,0x00,0xfd,0xf8,0x00,0x01,0xfb,0xf0,0x00,0x03,0xff,0xe0,0x00,0x03,0xff,0x80,
-	0x00,0x07,0xff,0x00,0x00,0x0f,0xfe,0x00,0x00,0x0f,0xf8,0x00,0x00,0x1f,0xf0,0x00,
-	0x00,0x3f,0xe0,0x00,0x00,0x3f,0x80,0x00,0x00,0x7f,0x00,0x00,
+	0x08,0xf8,0x17,0xf8,0x17,0xf7,0x28,0xe7,0x37,0xd8,0x37,0xd7,0x47,0xd7,0x57,0xb8,
+	0x57,0xb7,0x67,0xb7,0x77,0x98,0x77,0x97,0x87,0x97,0x97,0x86,0xa7,0x77,0xa7,0x77,
+	0xb6,0x76,0xc7,0x57,0xc7,0x57,0xd6,0x56,0xe7,0x46,0xe7,0x37,0xf6,0x36,0xf0,0x17,
+	0x26,0xf0,0x17,0x17,0xf0,0x26,0x16,0xf0,0x36,0x16,0xf0,0x3d,0xf0,0x4b,0xf0,0x5b,
+	0xf0,0x5b,0xf0,0x69,0xf0,0x79,0xf0,0x79,0xf0,0x87,0xf0,0x97,0x00,
 /* index:55, [W] 0x57, W: 46, H: 36, X:  2, Y: 10 */
-	0xff,0x00,0x1f,0xe0,0x03,0xfd,0xfc,0x00,0x7f,0x80,0x0f,0xe7,0xf8,0x01,0xfe,0x00,
-	0x7f,0x9f,0xe0,0x07,0xf8,0x01,0xfe,0x7f,0x80,0x3f,0xf0,0x07,0xf8,0xfe,0x00,0xff,
-	0xc0,0x1f,0xc3,0xf8,0x03,0xff,0x00,0x7f,0x0f,0xf0,0x0f,0xfc,0x03,0xfc,0x1f,0xc0,
-	0x7f,0xf0,0x0f,0xf0,0x7f,0x01,0xff,0xe0,0x3f,0x81,0xfc,0x07,0xcf,0x80,0xfe,0x07,
-	0xf0,0x1f,0x3e,0x03,0xf8,0x0f,0xe0,0x7c,0xf8,0x1f,0xc0,0x3f,0x83,0xf3,0xf0,0x7f,
-	0x00,0xfe,0x0f,0xcf,0xc1,0xfc,0x01,0xf8,0x3e,0x1f,0x07,0xf0,0x07,0xf0,0xf8,0x7c,
-	0x1f,0x80,0x1f,0xc3,0xe1,0xf0,0xfe,0x00,0x7f,0x1f,0x87,0xe3,0xf8,0x00,0xfc,0x7e,
-	0x0f,0x8f,0xc0,0x03,0xf1,0xf0,0x3e,0x3f,0x00,0x0f,0xe7,0xc0,0xf8,0xfc,0x00,0x1f,
-	0x9f,0x03,0xf7,0xf0,0x00,0x7e,0xfc,0x0f,0xdf,0x80,0x01,0xfb,0xf0,0x1f,0x7e,0x00,
-	0x07,0xef,0x80,0x7d,0xf8,0x00,0x0f,0xfe,0x01,0xf7,0xc0,0x00,0x3f,0xf8,0x07,0xff,
-	0x00,0x00,0xff,0xe0,0x1f,0xfc,0x00,0x01,0xff,0x80,0x3f,0xf0,0x00,0x07,0xfc,0x00,
-	0xff,0x80,0x00,0x1f,0xf0,0x03,0xfe,0x00,0x00,0x7f,0xc0,0x0f,0xf8,0x00,0x00,0xff,
-	0x00,0x1f,0xc0,0x00,0x03,0xf8,0x00,0x7f,0x00,0x00,0x0f,0xe0,0x01,0xfc,0x00,
+	0x08,0xb8,0xb8,0x17,0xb8,0xb7,0x28,0xa8,0xa8,0x28,0xa8,0xa8,0x28,0x9a,0x98,0x37,
+	0x9a,0x97,0x47,0x9a,0x97,0x48,0x8a,0x88,0x57,0x7b,0x88,0x57,0x7c,0x77,0x67,0x75,
+	0x25,0x77,0x67,0x75,0x25,0x77,0x77,0x65,0x25,0x67,0x87,0x56,0x26,0x57,0x87,0x56,
+	0x26,0x57,0x96,0x55,0x45,0x57,0x97,0x45,0x45,0x56,0xa7,0x45,0x45,0x47,0xa7,0x36,
+	0x46,0x37,0xb6,0x36,0x55,0x36,0xc6,0x35,0x65,0x36,0xc7,0x25,0x65,0x36,0xd6,0x25,
+	0x66,0x17,0xd6,0x16,0x66,0x16,0xe6,0x16,0x75,0x16,0xe6,0x15,0x85,0x16,0xfb,0x85,
+	0x15,0xf0,0x1b,0x8b,0xf0,0x1b,0x8b,0xf0,0x2a,0x9a,0xf0,0x29,0xa9,0xf0,0x39,0xa9,
+	0xf0,0x39,0xa9,0xf0,0x48,0xb7,0xf0,0x57,0xc7,0xf0,0x57,0xc7,0x00,
 /* index:56, [X] 0x58, W: 31, H: 36, X:  2, Y: 10 */
-	0x7f,0xc0,0x03,0xfe,0xff,0x80,0x07,0xf8,0xff,0x80,0x1f,0xf0,0xff,0x00,0x3f,0xc1,
-	0xff,0x00,0xff,0x01,0xfe,0x03,0xfe,0x01,0xfe,0x07,0xf8,0x03,0xfc,0x1f,0xe0,0x03,
-	0xfc,0x3f,0xc0,0x07,0xfc,0xff,0x00,0x07,0xf9,0xfe,0x00,0x07,0xff,0xf8,0x00,0x0f,
-	0xff,0xe0,0x00,0x0f,0xff,0xc0,0x00,0x1f,0xff,0x00,0x00,0x1f,0xfc,0x00,0x00,0x1f,
-	0xf8,0x00,0x00,0x3f,0xe0,0x00,0x00,0x7f,0xe0,0x00,0x00,0xff,0xc0,0x00,0x03,0xff,
-	0xc0,0x00,0x0f,0xff,0x80,0x00,0x1f,0xff,0x80,0x00,0x7f,0xff,0x80,0x01,0xfe,0xff,
-	0x00,0x03,0xfc,0xff,0x00,0x0f,0xf1,0xff,0x00,0x3f,0xe1,0xfe,0x00,0x7f,0x81,0xfe,
-	0x01,0xfe,0x03,0xfe,0x03,0xfc,0x03,0xfc,0x0f,0xf0,0x07,0xfc,0x3f,0xe0,0x07,0xf8,
-	0x7f,0x80,0x0f,0xf9,0xff,0x00,0x0f,0xff,0xfc,0x00,0x1f,0xf0,
+	0x19,0xc9,0x19,0xc8,0x39,0xa9,0x48,0xa8,0x59,0x88,0x78,0x79,0x88,0x68,0x98,0x58,
+	0xb8,0x48,0xb9,0x28,0xd8,0x28,0xef,0x01,0xff,0xf0,0x2e,0xf0,0x2d,0xf0,0x4b,0xf0,
+	0x6a,0xf0,0x69,0xf0,0x7a,0xf0,0x6a,0xf0,0x5c,0xf0,0x3d,0xf0,0x3e,0xf0,0x1f,0x01,
+	0xe8,0x18,0xe8,0x28,0xc8,0x39,0xa9,0x48,0xa8,0x68,0x88,0x79,0x78,0x88,0x68,0x99,
+	0x49,0xa8,0x48,0xb9,0x29,0xcf,0x03,0xd9,
 /* index:57, [Y] 0x59, W: 31, H: 36, X:  2, Y: 10 */
-	0xff,0x00,0x03,0xfe,0xff,0x00,0x07,0xf9,0xfe,0x00,0x0f,0xf1,0xfe,0x00,0x3f,0xc3,
-	0xfc,0x00,0x7f,0x83,0xfc,0x01,0xfe,0x07,0xf8,0x03,0xfc,0x07,0xf8,0x0f,0xf0,0x0f,
-	0xf0,0x1f,0xe0,0x0f,0xf0,0x3f,0x80,0x0f,0xe0,0xff,0x00,0x1f,0xe1,0xfc,0x00,0x1f,
-	0xc7,0xf8,0x00,0x3f,0xcf,0xe0,0x00,0x3f,0xbf,0xc0,0x00,0x7f,0xff,0x00,0x00,0x7f,
-	0xfe,0x00,0x00,0xff,0xf8,0x00,0x00,0xff,0xf0,0x00,0x01,0xff,0xc0,0x00,0x01,0xff,
-	0x80,0x00,0x03,0xfe,0x00,0x00,0x03,0xfc,0x00,0x00,0x07,0xf8,0x00,0x00,0x0f,0xf0,
-	0x00,0x00,0x1f,0xe0,0x00,0x00,0x3f,0xc0,0x00,0x00,0x7f,0x80,0x00,0x00,0xff,0x00,
-	0x00,0x01,0xfe,0x00,0x00,0x03,0xfc,0x00,0x00,0x07,0xf8,0x00,0x00,0x0f,0xf0,0x00,
-	0x00,0x1f,0xe0,0x00,0x00,0x3f,0xc0,0x00,0x00,0x7f,0x80,0x00,
+	0x08,0xe9,0x18,0xd8,0x28,0xd8,0x38,0xb8,0x48,0xb8,0x58,0x98,0x68,0x98,0x78,0x78,
+	0x88,0x78,0x98,0x67,0xb7,0x58,0xb8,0x47,0xd7,0x38,0xd8,0x27,0xf7,0x18,0xff,0xf0,
+	0x2e,0xf0,0x2d,0xf0,0x4c,0xf0,0x4b,0xf0,0x6a,0xf0,0x69,0xf0,0x88,0xf0,0x88,0xf0,
+	0x88,0xf0,0x88,0xf0,0x88,0xf0,0x88,0xf0,0x88,0xf0,0x88,0xf0,0x88,0xf0,0x88,0xf0,
+	0x88,0xf0,0x88,0xf0,0x88,0xf0,0x88,0x00,
 /* index:58, [Z] 0x5a, W: 27, H: 36, X:  3, Y: 10 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xc0,0x00,0x0f,0xf8,0x00,0x03,0xfe,0x00,0x00,0xff,0x80,0x00,
-	0x1f,0xe0,0x00,0x07,0xfc,0x00,0x01,0xff,0x00,0x00,0x7f,0xc0,0x00,0x1f,0xf0,0x00,
-	0x03,0xfc,0x00,0x00,0xff,0x80,0x00,0x3f,0xe0,0x00,0x0f,0xf8,0x00,0x03,0xfe,0x00,
-	0x00,0x7f,0x80,0x00,0x1f,0xf0,0x00,0x07,0xfc,0x00,0x01,0xff,0x00,0x00,0x7f,0xc0,
-	0x00,0x0f,0xf0,0x00,0x03,0xfe,0x00,0x00,0xff,0x80,0x00,0x3f,0xe0,0x00,0x0f,0xf8,
-	0x00,0x01,0xff,0x00,0x00,0x3f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0c,0xf0,0x39,0xf0,0x29,0xf0,
+	0x29,0xf0,0x38,0xf0,0x39,0xf0,0x29,0xf0,0x29,0xf0,0x29,0xf0,0x38,0xf0,0x39,0xf0,
+	0x29,0xf0,0x29,0xf0,0x29,0xf0,0x38,0xf0,0x39,0xf0,0x29,0xf0,0x29,0xf0,0x29,0xf0,
+	0x38,0xf0,0x39,0xf0,0x29,0xf0,0x29,0xf0,0x29,0xf0,0x39,0xf0,0x3f,0x0f,0x0f,0x0f,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0c,
 /* index:59, [[] 0x5b, W: 12, H: 46, X:  4, Y:  0 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,
-	0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,
-	0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,
-	0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xe0,0xfe,0x0f,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,
+	0x0f,0x0f,0x0f,0x0f,0x07,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,
+	0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,
+	0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x5f,0x0f,0x0f,0x0f,
 /* index:60, [\] 0x5c, W: 15, H: 36, X:  0, Y: 10 */
-	0xf0,0x01,0xe0,0x01,0xc0,0x03,0x80,0x07,0x80,0x07,0x00,0x0e,0x00,0x1e,0x00,0x1c,
-	0x00,0x38,0x00,0x78,0x00,0x70,0x00,0xe0,0x01,0xe0,0x01,0xc0,0x03,0x80,0x07,0x80,
-	0x07,0x00,0x0e,0x00,0x1e,0x00,0x1c,0x00,0x38,0x00,0x78,0x00,0x70,0x00,0xe0,0x01,
-	0xe0,0x03,0xc0,0x03,0x80,0x07,0x00,0x0f,0x00,0x0e,0x00,0x1c,0x00,0x3c,0x00,0x38,
-	0x00,0x70,0x00,0xf0,
+	0x04,0xb4,0xc3,0xc3,0xc4,0xc3,0xc3,0xc4,0xc3,0xc3,0xc4,0xc3,0xc3,0xc4,0xc3,0xc3,
+	0xc4,0xc3,0xc3,0xc4,0xc3,0xc3,0xc4,0xc3,0xc3,0xc4,0xb4,0xc3,0xc3,0xc4,0xc3,0xc3,
+	0xc4,0xc3,0xc3,0xc4,
 /* index:61, []] 0x5d, W: 12, H: 46, X:  2, Y:  0 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xf0,0x7f,0x07,
-	0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xf0,
-	0x7f,0x07,0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xf0,0x7f,
-	0x07,0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xf0,0x7f,0x07,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,
+	0x0f,0x0f,0x0f,0x0f,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,
+	0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x57,
+	0x57,0x57,0x57,0x57,0x57,0x57,0x57,0x5f,0x0f,0x0f,0x0f,0x07,
 /* index:62, [^] 0x5e, W: 23, H: 21, X:  4, Y: 24 */
-	0x00,0xfe,0x00,0x01,0xfc,0x00,0x07,0xf8,0x00,0x0f,0xf8,0x00,0x1f,0xf0,0x00,0x7f,
-	0xf0,0x00,0xff,0xe0,0x03,0xf7,0xc0,0x07,0xef,0xc0,0x0f,0x8f,0x80,0x3f,0x1f,0x80,
-	0x7e,0x3f,0x00,0xf8,0x3e,0x03,0xf0,0x7e,0x07,0xc0,0x7c,0x1f,0x80,0xfc,0x3f,0x01,
-	0xf8,0x7c,0x01,0xf1,0xf8,0x03,0xf3,0xe0,0x03,0xef,0xc0,0x07,0xe0,
+	0x87,0xf0,0x17,0xf8,0xf9,0xe9,0xdb,0xcb,0xb6,0x15,0xb6,0x16,0xa5,0x35,0x96,0x36,
+	0x86,0x36,0x85,0x55,0x76,0x56,0x65,0x75,0x56,0x76,0x46,0x76,0x45,0x95,0x36,0x96,
+	0x25,0xb5,0x16,0xb6,
 /* index:63, [_] 0x5f, W: 30, H:  4, X:  0, Y:  0 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,
 /* index:64, [`] 0x60, W: 10, H:  8, X:  2, Y: 40 */
-	0xfc,0x1f,0x83,0xe0,0x7c,0x1f,0x03,0xe0,0x78,0x0f,
+	0x06,0x56,0x55,0x65,0x55,0x65,0x64,0x74,
 /* index:65, [a] 0x61, W: 25, H: 28, X:  3, Y: 10 */
-	0x03,0xff,0xc0,0x07,0xff,0xf8,0x07,0xff,0xfe,0x07,0xff,0xff,0x87,0xff,0xff,0xc3,
-	0xfe,0x1f,0xf1,0xfc,0x03,0xf8,0xfe,0x01,0xfc,0x00,0x00,0xfe,0x00,0x00,0xff,0x00,
-	0x01,0xff,0x80,0x1f,0xff,0xc0,0xff,0xff,0xe0,0xff,0xff,0xf0,0xff,0xfb,0xf8,0xff,
-	0xc1,0xfc,0x7f,0x00,0xfe,0x7f,0x00,0x7f,0x3f,0x80,0x3f,0x9f,0xc0,0x3f,0xcf,0xe0,
-	0x1f,0xe7,0xf8,0x1f,0xf3,0xff,0xff,0xf8,0xff,0xff,0xfc,0x7f,0xff,0xfe,0x1f,0xff,
-	0x7f,0x87,0xfe,0x1f,0xe0,0xfc,0x00,0x00,
+	0x6c,0xbf,0x01,0x8f,0x03,0x6f,0x05,0x4f,0x06,0x49,0x49,0x37,0x87,0x37,0x87,0xf0,
+	0x37,0xf0,0x28,0xfa,0xaf,0x6f,0x04,0x5f,0x05,0x4d,0x17,0x3a,0x57,0x37,0x87,0x27,
+	0x97,0x27,0x97,0x27,0x88,0x27,0x88,0x28,0x69,0x2f,0x08,0x3f,0x07,0x3f,0x07,0x4d,
+	0x18,0x4a,0x48,0x56,0x00,
 /* index:66, [b] 0x62, W: 26, H: 37, X:  4, Y:  9 */
-	0xfe,0x00,0x00,0x3f,0x80,0x00,0x0f,0xe0,0x00,0x03,0xf8,0x00,0x00,0xfe,0x00,0x00,
-	0x3f,0x80,0x00,0x0f,0xe0,0x00,0x03,0xf8,0x00,0x00,0xfe,0x00,0x00,0x3f,0x8f,0xf8,
-	0x0f,0xe7,0xff,0x83,0xfb,0xff,0xf0,0xff,0xff,0xfe,0x3f,0xff,0xff,0x8f,0xff,0x3f,
-	0xf3,0xff,0x03,0xfe,0xff,0x80,0x7f,0xbf,0xc0,0x0f,0xef,0xf0,0x03,0xff,0xf8,0x00,
-	0x7f,0xfe,0x00,0x1f,0xff,0x80,0x07,0xff,0xe0,0x01,0xff,0xf8,0x00,0x7f,0xfe,0x00,
-	0x1f,0xff,0x80,0x07,0xff,0xf0,0x03,0xff,0xfc,0x00,0xfe,0xff,0x00,0x3f,0xbf,0xe0,
-	0x1f,0xef,0xfe,0x1f,0xf3,0xff,0xff,0xfc,0xff,0xff,0xfe,0x3f,0xff,0xff,0x0f,0xef,
-	0xff,0x83,0xf9,0xff,0xc0,0x00,0x1f,0xc0,0x00,
+	0x07,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,
+	0x47,0xf0,0x47,0x39,0x77,0x2c,0x57,0x1e,0x4f,0x08,0x3f,0x08,0x3c,0x2a,0x2a,0x69,
+	0x19,0x88,0x18,0xa7,0x18,0xaf,0xce,0xce,0xce,0xce,0xce,0xce,0xcf,0xaf,0x01,0xa7,
+	0x18,0xa7,0x19,0x88,0x1b,0x49,0x2f,0x09,0x2f,0x08,0x3f,0x07,0x47,0x1d,0x57,0x2b,
+	0xf0,0x27,0x00,
 /* index:67, [c] 0x63, W: 24, H: 28, X:  3, Y: 10 */
-	0x01,0xff,0xc0,0x07,0xff,0xf0,0x0f,0xff,0xf8,0x1f,0xff,0xfc,0x3f,0xff,0xfe,0x3f,
-	0xe1,0xff,0x7f,0x80,0xff,0x7f,0x00,0x7f,0x7f,0x00,0x3f,0xff,0x00,0x00,0xfe,0x00,
-	0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,
-	0xfe,0x00,0x00,0xfe,0x00,0x00,0xff,0x00,0x3f,0x7f,0x00,0x7f,0x7f,0x80,0x7f,0x7f,
-	0xc0,0xff,0x3f,0xff,0xfe,0x1f,0xff,0xfe,0x0f,0xff,0xfc,0x07,0xff,0xf8,0x03,0xff,
-	0xe0,0x00,0x7f,0x80,
+	0x7b,0xbf,0x8f,0x02,0x6f,0x04,0x4f,0x06,0x39,0x49,0x18,0x78,0x17,0x97,0x17,0xae,
+	0xf0,0x17,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,
+	0xf0,0x28,0xa6,0x17,0x97,0x18,0x87,0x19,0x68,0x2f,0x06,0x4f,0x05,0x5f,0x03,0x7f,
+	0x01,0x9d,0xe8,0x00,
 /* index:68, [d] 0x64, W: 26, H: 37, X:  3, Y:  9 */
-	0x00,0x00,0x1f,0xc0,0x00,0x07,0xf0,0x00,0x01,0xfc,0x00,0x00,0x7f,0x00,0x00,0x1f,
-	0xc0,0x00,0x07,0xf0,0x00,0x01,0xfc,0x00,0x00,0x7f,0x00,0x00,0x1f,0xc0,0x7f,0xc7,
-	0xf0,0x7f,0xf9,0xfc,0x3f,0xff,0x7f,0x1f,0xff,0xff,0xc7,0xff,0xff,0xf3,0xff,0x3f,
-	0xfd,0xff,0x03,0xff,0x7f,0x80,0x7f,0xdf,0xc0,0x0f,0xff,0xf0,0x03,0xff,0xf8,0x00,
-	0x7f,0xfe,0x00,0x1f,0xff,0x80,0x07,0xff,0xe0,0x01,0xff,0xf8,0x00,0x7f,0xfe,0x00,
-	0x1f,0xff,0x80,0x07,0xff,0xf0,0x03,0xfd,0xfc,0x00,0xff,0x7f,0x80,0x3f,0xdf,0xe0,
-	0x1f,0xf3,0xfe,0x1f,0xfc,0xff,0xff,0xff,0x1f,0xff,0xff,0xc3,0xff,0xff,0xf0,0x7f,
-	0xfd,0xfc,0x0f,0xfe,0x7f,0x00,0xfe,0x00,0x00,
+	0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,
+	0xf0,0x47,0x79,0x37,0x5c,0x27,0x4e,0x17,0x3f,0x08,0x3f,0x08,0x2a,0x2c,0x19,0x6a,
+	0x18,0x89,0x17,0xaf,0x01,0xaf,0xce,0xce,0xce,0xce,0xce,0xce,0xcf,0xa8,0x17,0xa8,
+	0x18,0x98,0x18,0x89,0x29,0x4b,0x2f,0x09,0x3f,0x08,0x4f,0x07,0x5d,0x17,0x6b,0x27,
+	0x87,0x00,
 /* index:69, [e] 0x65, W: 25, H: 28, X:  3, Y: 10 */
-	0x01,0xff,0xc0,0x03,0xff,0xf0,0x03,0xff,0xfe,0x03,0xff,0xff,0x81,0xff,0xff,0xc1,
-	0xfe,0x0f,0xf1,0xfe,0x03,0xf8,0xfe,0x00,0xfe,0x7f,0x00,0x7f,0x3f,0x00,0x1f,0xbf,
-	0x80,0x0f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xfe,0x00,0x00,0x7f,0x00,0x00,0x3f,0x80,0x00,0x0f,0xe0,0x00,0x07,0xf0,
-	0x03,0xfb,0xfc,0x03,0xf8,0xff,0x87,0xfc,0x3f,0xff,0xfc,0x1f,0xff,0xfc,0x07,0xff,
-	0xfc,0x00,0xff,0xf8,0x00,0x1f,0xe0,0x00,
+	0x7b,0xce,0xaf,0x02,0x7f,0x04,0x6f,0x04,0x58,0x58,0x38,0x77,0x37,0x97,0x27,0x97,
+	0x26,0xb6,0x17,0xbf,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x04,0xf0,0x37,0xf0,
+	0x37,0xf0,0x47,0xf0,0x37,0xa7,0x18,0x87,0x39,0x49,0x4f,0x05,0x5f,0x04,0x7f,0x02,
+	0xad,0xe8,0x00,
 /* index:70, [f] 0x66, W: 14, H: 36, X:  3, Y: 10 */
-	0x01,0xfc,0x1f,0xf0,0xff,0xc7,0xff,0x1f,0xfc,0x7f,0x81,0xfc,0x07,0xf0,0x1f,0xc3,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf1,0xfc,0x07,0xf0,0x1f,0xc0,0x7f,0x01,
-	0xfc,0x07,0xf0,0x1f,0xc0,0x7f,0x01,0xfc,0x07,0xf0,0x1f,0xc0,0x7f,0x01,0xfc,0x07,
-	0xf0,0x1f,0xc0,0x7f,0x01,0xfc,0x07,0xf0,0x1f,0xc0,0x7f,0x01,0xfc,0x07,0xf0,
+	0x77,0x59,0x4a,0x3b,0x3b,0x38,0x67,0x77,0x77,0x4f,0x0f,0x0f,0x0f,0x0a,0x37,0x77,
+	0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,0x77,
+	0x77,0x77,0x77,0x77,0x00,
 /* index:71, [g] 0x67, W: 26, H: 37, X:  3, Y:  1 */
-	0x01,0xfe,0x1f,0xc1,0xff,0xe7,0xf0,0xff,0xfd,0xfc,0x7f,0xff,0xff,0x1f,0xff,0xff,
-	0xcf,0xfc,0xff,0xf7,0xfc,0x0f,0xfd,0xfe,0x01,0xff,0x7f,0x00,0x3f,0xff,0xc0,0x0f,
-	0xff,0xe0,0x01,0xff,0xf8,0x00,0x7f,0xfe,0x00,0x1f,0xff,0x80,0x07,0xff,0xe0,0x01,
-	0xff,0xf8,0x00,0x7f,0xfe,0x00,0x1f,0xff,0xc0,0x07,0xff,0xf0,0x03,0xfd,0xfc,0x00,
-	0xff,0x7f,0x80,0x7f,0xdf,0xf0,0x7f,0xf3,0xff,0xff,0xfc,0x7f,0xff,0xff,0x1f,0xff,
-	0xff,0xc3,0xff,0xf7,0xf0,0x3f,0xf1,0xfc,0x03,0xf0,0x7f,0x00,0x00,0x1f,0xc0,0x00,
-	0x07,0xf7,0xf0,0x03,0xfd,0xfe,0x01,0xfe,0x7f,0xc0,0xff,0x8f,0xff,0xff,0xc1,0xff,
-	0xff,0xe0,0x3f,0xff,0xf0,0x03,0xff,0xe0,0x00,
+	0x78,0x47,0x5c,0x27,0x4e,0x17,0x3f,0x08,0x3f,0x08,0x2a,0x2c,0x19,0x6a,0x18,0x89,
+	0x17,0xaf,0x01,0xaf,0xce,0xce,0xce,0xce,0xce,0xce,0xcf,0xbf,0xa8,0x17,0xa8,0x18,
+	0x89,0x19,0x5b,0x2f,0x09,0x3f,0x08,0x3f,0x08,0x4e,0x17,0x6a,0x37,0x86,0x57,0xf0,
+	0x47,0xf0,0x47,0x17,0xa8,0x18,0x88,0x29,0x69,0x3f,0x07,0x5f,0x05,0x7f,0x03,0xad,
+	0x00,
 /* index:72, [h] 0x68, W: 24, H: 36, X:  4, Y: 10 */
-	0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,
-	0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x1f,0xf0,0xfe,0x7f,
-	0xf8,0xfe,0xff,0xfc,0xff,0xff,0xfe,0xff,0xff,0xfe,0xff,0xf7,0xff,0xff,0x80,0xff,
-	0xff,0x00,0xff,0xff,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,
-	0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,
-	0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,
-	0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,
+	0x07,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,
+	0x27,0xf0,0x27,0x49,0x47,0x2c,0x37,0x1e,0x2f,0x08,0x1f,0x08,0x1c,0x1f,0x05,0x7f,
+	0x01,0x8f,0x01,0x9e,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,
+	0xae,0xae,0xae,0xae,0xae,0xa7,
 /* index:73, [i] 0x69, W:  7, H: 36, X:  5, Y: 10 */
-	0xff,0xff,0xff,0xff,0xff,0xc0,0x00,0x01,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,
+	0x0f,0x0f,0x0c,0xf0,0x6f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,
+	0x09,
 /* index:74, [j] 0x6a, W: 10, H: 46, X:  2, Y:  0 */
-	0x1f,0xc7,0xf1,0xfc,0x7f,0x1f,0xc7,0xf0,0x00,0x00,0x00,0x07,0xf1,0xfc,0x7f,0x1f,
-	0xc7,0xf1,0xfc,0x7f,0x1f,0xc7,0xf1,0xfc,0x7f,0x1f,0xc7,0xf1,0xfc,0x7f,0x1f,0xc7,
-	0xf1,0xfc,0x7f,0x1f,0xc7,0xf1,0xfc,0x7f,0x1f,0xc7,0xf1,0xfc,0x7f,0x1f,0xc7,0xf1,
-	0xfc,0x7f,0x3f,0xff,0xff,0xff,0xff,0xff,0xbf,0xc0,
+	0x37,0x37,0x37,0x37,0x37,0x37,0xf0,0xf0,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,
+	0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x37,
+	0x37,0x37,0x37,0x37,0x37,0x37,0x37,0x2f,0x0f,0x0f,0x02,0x18,0x00,
 /* index:75, [k] 0x6b, W: 24, H: 36, X:  4, Y: 10 */
-	0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,
-	0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x00,0x00,0xfe,0x01,0xfe,0xfe,0x01,
-	0xfe,0xfe,0x03,0xfc,0xfe,0x07,0xf8,0xfe,0x0f,0xf0,0xfe,0x1f,0xe0,0xfe,0x3f,0xc0,
-	0xfe,0x3f,0x80,0xfe,0x7f,0x00,0xfe,0xfe,0x00,0xff,0xfe,0x00,0xff,0xfe,0x00,0xff,
-	0xff,0x00,0xff,0xff,0x80,0xff,0xff,0x80,0xff,0xbf,0xc0,0xff,0x9f,0xc0,0xff,0x1f,
-	0xe0,0xfe,0x0f,0xf0,0xfe,0x0f,0xf0,0xfe,0x07,0xf8,0xfe,0x07,0xf8,0xfe,0x03,0xfc,
-	0xfe,0x03,0xfc,0xfe,0x01,0xfe,0xfe,0x01,0xff,0xfe,0x00,0xff,
+	0x07,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,0x27,0xf0,
+	0x27,0xf0,0x27,0x88,0x17,0x88,0x17,0x78,0x27,0x68,0x37,0x58,0x47,0x48,0x57,0x38,
+	0x67,0x37,0x77,0x27,0x87,0x17,0x9f,0x9f,0x9f,0x01,0x8f,0x02,0x7f,0x02,0x79,0x18,
+	0x69,0x27,0x68,0x38,0x57,0x58,0x47,0x58,0x47,0x68,0x37,0x68,0x37,0x78,0x27,0x78,
+	0x27,0x88,0x17,0x8f,0x01,0x98,
 /* index:76, [l] 0x6c, W:  7, H: 36, X:  4, Y: 10 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,
+	0x0c,
 /* index:77, [m] 0x6d, W: 38, H: 27, X:  4, Y: 11 */
-	0xfe,0x3f,0xe0,0x7f,0xc3,0xf9,0xff,0xe3,0xff,0xcf,0xef,0xff,0x9f,0xff,0x3f,0xff,
-	0xff,0xff,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0xbf,0xff,0xf8,0x1f,0xf8,
-	0x3f,0xff,0xc0,0x3f,0xc0,0x7f,0xfe,0x00,0xfe,0x01,0xff,0xf8,0x03,0xf8,0x07,0xff,
-	0xe0,0x0f,0xe0,0x1f,0xff,0x80,0x3f,0x80,0x7f,0xfe,0x00,0xfe,0x01,0xff,0xf8,0x03,
-	0xf8,0x07,0xff,0xe0,0x0f,0xe0,0x1f,0xff,0x80,0x3f,0x80,0x7f,0xfe,0x00,0xfe,0x01,
-	0xff,0xf8,0x03,0xf8,0x07,0xff,0xe0,0x0f,0xe0,0x1f,0xff,0x80,0x3f,0x80,0x7f,0xfe,
-	0x00,0xfe,0x01,0xff,0xf8,0x03,0xf8,0x07,0xff,0xe0,0x0f,0xe0,0x1f,0xff,0x80,0x3f,
-	0x80,0x7f,0xfe,0x00,0xfe,0x01,0xff,0xf8,0x03,0xf8,0x07,0xff,0xe0,0x0f,0xe0,0x1f,
-	0xc0,
+	0x07,0x39,0x69,0x47,0x2c,0x3c,0x27,0x1d,0x2d,0x2f,0x0f,0x07,0x1f,0x0f,0x0f,0x05,
+	0x1e,0x1f,0x04,0x6a,0x5f,0x01,0x88,0x7e,0x97,0x8e,0x97,0x8e,0x97,0x8e,0x97,0x8e,
+	0x97,0x8e,0x97,0x8e,0x97,0x8e,0x97,0x8e,0x97,0x8e,0x97,0x8e,0x97,0x8e,0x97,0x8e,
+	0x97,0x8e,0x97,0x8e,0x97,0x8e,0x97,0x8e,0x97,0x8e,0x97,0x8e,0x97,0x87,
 /* index:78, [n] 0x6e, W: 24, H: 27, X:  4, Y: 11 */
-	0xfe,0x1f,0xf0,0xfe,0x7f,0xf8,0xfe,0xff,0xfc,0xff,0xff,0xfe,0xff,0xff,0xfe,0xff,
-	0xf7,0xff,0xff,0x80,0xff,0xff,0x00,0xff,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,
-	0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,
-	0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,
-	0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,
-	0x7f,
+	0x07,0x49,0x47,0x2c,0x37,0x1e,0x2f,0x08,0x1f,0x08,0x1c,0x1f,0x05,0x7f,0x01,0x8f,
+	0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,
+	0xae,0xae,0xa7,
 /* index:79, [o] 0x6f, W: 27, H: 28, X:  3, Y: 10 */
-	0x00,0xff,0xe0,0x00,0x7f,0xff,0x00,0x3f,0xff,0xf8,0x0f,0xff,0xff,0x81,0xff,0xff,
-	0xf0,0x7f,0xe3,0xff,0x1f,0xf0,0x1f,0xf3,0xfc,0x01,0xfe,0x7f,0x00,0x1f,0xdf,0xe0,
-	0x03,0xff,0xf8,0x00,0x3f,0xff,0x00,0x07,0xff,0xe0,0x00,0xff,0xfc,0x00,0x1f,0xff,
-	0x80,0x03,0xff,0xf0,0x00,0x7f,0xfe,0x00,0x0f,0xff,0xe0,0x03,0xfd,0xfc,0x00,0x7f,
-	0xbf,0xc0,0x1f,0xe7,0xf8,0x03,0xfc,0x7f,0xc1,0xff,0x0f,0xff,0xff,0xe0,0xff,0xff,
-	0xf8,0x0f,0xff,0xfe,0x00,0xff,0xff,0x80,0x07,0xff,0xc0,0x00,0x3f,0xe0,0x00,
+	0x8b,0xef,0xaf,0x04,0x7f,0x06,0x6f,0x06,0x5a,0x3a,0x39,0x79,0x28,0x98,0x27,0xb7,
+	0x18,0xbf,0xde,0xde,0xde,0xde,0xde,0xde,0xdf,0xb8,0x17,0xb8,0x18,0x98,0x28,0x98,
+	0x39,0x59,0x4f,0x08,0x5f,0x06,0x7f,0x04,0x9f,0x02,0xcd,0xf0,0x19,0x00,
 /* index:80, [p] 0x70, W: 26, H: 37, X:  4, Y:  1 */
-	0xfe,0x3f,0xe0,0x3f,0x9f,0xfe,0x0f,0xef,0xff,0xc3,0xff,0xff,0xf8,0xff,0xff,0xfe,
-	0x3f,0xfc,0xff,0xcf,0xfc,0x0f,0xfb,0xfe,0x01,0xfe,0xff,0x00,0x3f,0xbf,0xc0,0x0f,
-	0xff,0xe0,0x01,0xff,0xf8,0x00,0x7f,0xfe,0x00,0x1f,0xff,0x80,0x07,0xff,0xe0,0x01,
-	0xff,0xf8,0x00,0x7f,0xfe,0x00,0x1f,0xff,0xc0,0x0f,0xff,0xf0,0x03,0xfb,0xfc,0x00,
-	0xfe,0xff,0x80,0x7f,0xbf,0xf8,0x7f,0xcf,0xff,0xff,0xf3,0xff,0xff,0xf8,0xfe,0xff,
-	0xfc,0x3f,0xbf,0xfe,0x0f,0xe3,0xff,0x03,0xf8,0x3f,0x00,0xfe,0x00,0x00,0x3f,0x80,
-	0x00,0x0f,0xe0,0x00,0x03,0xf8,0x00,0x00,0xfe,0x00,0x00,0x3f,0x80,0x00,0x0f,0xe0,
-	0x00,0x03,0xf8,0x00,0x00,0xfe,0x00,0x00,0x00,
+	0x07,0x39,0x77,0x2c,0x57,0x1e,0x4f,0x08,0x3f,0x08,0x3c,0x2a,0x2a,0x69,0x19,0x88,
+	0x18,0xa7,0x18,0xaf,0xce,0xce,0xce,0xce,0xce,0xce,0xcf,0xaf,0x01,0xa7,0x18,0xa7,
+	0x19,0x88,0x1b,0x49,0x2f,0x09,0x2f,0x08,0x37,0x1e,0x47,0x1d,0x57,0x3a,0x67,0x56,
+	0x87,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,
+	0x47,0x00,
 /* index:81, [q] 0x71, W: 26, H: 37, X:  3, Y:  1 */
-	0x01,0xff,0x1f,0xc1,0xff,0xe7,0xf0,0xff,0xfd,0xfc,0x7f,0xff,0xff,0x1f,0xff,0xff,
-	0xcf,0xfc,0xff,0xf7,0xfc,0x0f,0xfd,0xfe,0x01,0xff,0x7f,0x00,0x3f,0xff,0xc0,0x0f,
-	0xff,0xe0,0x01,0xff,0xf8,0x00,0x7f,0xfe,0x00,0x1f,0xff,0x80,0x07,0xff,0xe0,0x01,
-	0xff,0xf8,0x00,0x7f,0xfe,0x00,0x1f,0xff,0xc0,0x0f,0xf7,0xf0,0x03,0xfd,0xfc,0x00,
-	0xff,0x7f,0x80,0x7f,0xcf,0xf8,0x7f,0xf3,0xff,0xff,0xfc,0x7f,0xff,0xff,0x0f,0xff,
-	0xdf,0xc1,0xff,0xf7,0xf0,0x3f,0xf1,0xfc,0x03,0xf8,0x7f,0x00,0x00,0x1f,0xc0,0x00,
-	0x07,0xf0,0x00,0x01,0xfc,0x00,0x00,0x7f,0x00,0x00,0x1f,0xc0,0x00,0x07,0xf0,0x00,
-	0x01,0xfc,0x00,0x00,0x7f,0x00,0x00,0x1f,0xc0,
+	0x79,0x37,0x5c,0x27,0x4e,0x17,0x3f,0x08,0x3f,0x08,0x2a,0x2c,0x19,0x6a,0x18,0x89,
+	0x17,0xaf,0x01,0xaf,0xce,0xce,0xce,0xce,0xce,0xce,0xcf,0xa8,0x17,0xa8,0x17,0xa8,
+	0x18,0x89,0x29,0x4b,0x2f,0x09,0x3f,0x08,0x4e,0x17,0x5d,0x17,0x6a,0x37,0x87,0x47,
+	0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,0xf0,0x47,
+	0xf0,0x47,
 /* index:82, [r] 0x72, W: 15, H: 27, X:  4, Y: 11 */
-	0xfe,0x1f,0xfc,0xff,0xfb,0xff,0xf7,0xff,0xff,0xff,0xff,0xff,0xf0,0x7f,0xc0,0xff,
-	0x01,0xfc,0x03,0xf8,0x07,0xf0,0x0f,0xe0,0x1f,0xc0,0x3f,0x80,0x7f,0x00,0xfe,0x01,
-	0xfc,0x03,0xf8,0x07,0xf0,0x0f,0xe0,0x1f,0xc0,0x3f,0x80,0x7f,0x00,0xfe,0x01,0xfc,
-	0x03,0xf8,0x00,
+	0x07,0x4b,0x2d,0x1e,0x1f,0x0f,0x0f,0x02,0x59,0x68,0x77,0x87,0x87,0x87,0x87,0x87,
+	0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x00,
 /* index:83, [s] 0x73, W: 25, H: 28, X:  2, Y: 10 */
-	0x03,0xff,0xe0,0x03,0xff,0xfc,0x07,0xff,0xff,0x07,0xff,0xff,0xc3,0xff,0xff,0xe3,
-	0xfc,0x07,0xf9,0xfc,0x01,0xfc,0xfe,0x00,0xfe,0x7f,0x80,0x00,0x3f,0xf0,0x00,0x1f,
-	0xff,0x00,0x07,0xff,0xf8,0x03,0xff,0xff,0x80,0xff,0xff,0xf0,0x1f,0xff,0xfc,0x01,
-	0xff,0xfe,0x00,0x1f,0xff,0x80,0x00,0xff,0xc0,0x00,0x1f,0xe0,0x00,0x07,0xff,0xe0,
-	0x03,0xff,0xf8,0x03,0xfd,0xff,0x07,0xfc,0xff,0xff,0xfe,0x3f,0xff,0xfe,0x0f,0xff,
-	0xfe,0x03,0xff,0xfc,0x00,0x1f,0xf8,0x00,
+	0x6d,0xbf,0x01,0x7f,0x04,0x5f,0x06,0x4f,0x06,0x38,0x78,0x27,0x97,0x27,0x97,0x28,
+	0xf0,0x2a,0xfd,0xdf,0x01,0x9f,0x04,0x7f,0x05,0x7f,0x04,0x9f,0x01,0xce,0xfa,0xf0,
+	0x28,0xf0,0x3e,0xbf,0x98,0x19,0x59,0x2f,0x08,0x3f,0x06,0x5f,0x04,0x7f,0x01,0xda,
+	0x00,
 /* index:84, [t] 0x74, W: 13, H: 35, X:  3, Y:  9 */
-	0x1f,0xc0,0xfe,0x07,0xf0,0x3f,0x81,0xfc,0x0f,0xe0,0x7f,0x1f,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xf1,0xfc,0x0f,0xe0,0x7f,0x03,0xf8,0x1f,0xc0,0xfe,0x07,0xf0,0x3f,
-	0x81,0xfc,0x0f,0xe0,0x7f,0x03,0xf8,0x1f,0xc0,0xfe,0x07,0xf0,0x3f,0x81,0xfc,0x0f,
-	0xf0,0x7f,0xe3,0xff,0x0f,0xf8,0x3f,0xc0,0x7e,
+	0x37,0x67,0x67,0x67,0x67,0x67,0x67,0x3f,0x0f,0x0f,0x0f,0x05,0x37,0x67,0x67,0x67,
+	0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x67,0x68,0x5a,0x3a,
+	0x49,0x58,0x76,
 /* index:85, [u] 0x75, W: 24, H: 28, X:  4, Y:  9 */
-	0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,
-	0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,
-	0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,
-	0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0x7f,0xfe,0x00,0xff,0xff,0x00,0xff,0xff,
-	0x83,0xff,0x7f,0xff,0xff,0x7f,0xff,0xff,0x7f,0xff,0x7f,0x3f,0xff,0x7f,0x1f,0xfc,
-	0x7f,0x03,0xf0,0x00,
+	0x07,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,
+	0xae,0xae,0xae,0xae,0x9f,0x01,0x8f,0x02,0x5a,0x1f,0x08,0x1f,0x08,0x1f,0x17,0x2e,
+	0x17,0x3b,0x37,0x66,0x00,
 /* index:86, [v] 0x76, W: 25, H: 27, X:  2, Y: 10 */
-	0xfe,0x00,0x3f,0xff,0x00,0x1f,0xff,0xc0,0x1f,0xef,0xe0,0x0f,0xe7,0xf0,0x07,0xf3,
-	0xfc,0x03,0xf8,0xfe,0x03,0xf8,0x7f,0x01,0xfc,0x3f,0x80,0xfe,0x0f,0xe0,0x7e,0x07,
-	0xf0,0x7f,0x01,0xf8,0x3f,0x80,0xfe,0x1f,0x80,0x7f,0x1f,0xc0,0x1f,0x8f,0xe0,0x0f,
-	0xc7,0xe0,0x07,0xf3,0xf0,0x01,0xfb,0xf8,0x00,0xfd,0xf8,0x00,0x7f,0xfc,0x00,0x1f,
-	0xfe,0x00,0x0f,0xfe,0x00,0x07,0xff,0x00,0x01,0xff,0x80,0x00,0xff,0x80,0x00,0x7f,
-	0xc0,0x00,0x1f,0xc0,0x00,
+	0x07,0xbe,0xbf,0x98,0x17,0x97,0x27,0x97,0x28,0x87,0x37,0x77,0x47,0x77,0x47,0x77,
+	0x57,0x66,0x67,0x57,0x76,0x57,0x77,0x46,0x87,0x37,0x96,0x37,0x96,0x36,0xa7,0x26,
+	0xb6,0x17,0xb6,0x16,0xcd,0xdc,0xdb,0xeb,0xfa,0xf9,0xf0,0x19,0xf0,0x27,0x00,
 /* index:87, [w] 0x77, W: 37, H: 27, X:  2, Y: 10 */
-	0xfe,0x01,0xfc,0x03,0xff,0xf0,0x0f,0xe0,0x1f,0xff,0x80,0x7f,0x80,0xff,0xfe,0x07,
-	0xfc,0x0f,0xf7,0xf0,0x3f,0xe0,0x7f,0x3f,0x81,0xff,0x03,0xf9,0xfc,0x0f,0xf8,0x1f,
-	0xc7,0xe0,0x7f,0xe0,0xfc,0x3f,0x87,0xdf,0x0f,0xe1,0xfc,0x3e,0xf8,0x7f,0x0f,0xe1,
-	0xf7,0xc3,0xf8,0x3f,0x0f,0xbf,0x1f,0x81,0xfc,0xfc,0xf8,0xfc,0x0f,0xe7,0xc7,0xcf,
-	0xe0,0x3f,0x3e,0x3e,0x7e,0x01,0xf9,0xf1,0xf3,0xf0,0x0f,0xcf,0x8f,0xdf,0x80,0x7f,
-	0xf8,0x3f,0xfc,0x01,0xff,0xc1,0xff,0xc0,0x0f,0xfe,0x0f,0xfe,0x00,0x7f,0xf0,0x7f,
-	0xf0,0x01,0xff,0x83,0xff,0x00,0x0f,0xf8,0x0f,0xf8,0x00,0x7f,0xc0,0x7f,0xc0,0x03,
-	0xfe,0x03,0xfe,0x00,0x0f,0xf0,0x1f,0xe0,0x00,0x7f,0x00,0x7f,0x00,
+	0x07,0x87,0x8e,0x87,0x8e,0x88,0x7f,0x69,0x68,0x17,0x69,0x67,0x27,0x69,0x67,0x27,
+	0x69,0x67,0x36,0x6a,0x56,0x47,0x45,0x15,0x47,0x47,0x45,0x15,0x47,0x47,0x45,0x15,
+	0x47,0x56,0x45,0x16,0x36,0x67,0x26,0x25,0x36,0x67,0x25,0x35,0x27,0x76,0x25,0x35,
+	0x26,0x86,0x25,0x35,0x26,0x86,0x25,0x36,0x16,0x8c,0x5c,0x9b,0x5b,0xab,0x5b,0xab,
+	0x5b,0xba,0x5a,0xc9,0x79,0xc9,0x79,0xc9,0x79,0xd8,0x78,0xe7,0x97,0x00,
 /* index:88, [x] 0x78, W: 25, H: 27, X:  2, Y: 10 */
-	0xff,0x80,0x7f,0xbf,0xc0,0x7f,0xcf,0xf0,0x3f,0xc7,0xf8,0x3f,0xc1,0xfe,0x1f,0xe0,
-	0x7f,0x1f,0xe0,0x3f,0xcf,0xe0,0x0f,0xef,0xf0,0x03,0xff,0xf0,0x01,0xff,0xf0,0x00,
-	0x7f,0xf8,0x00,0x1f,0xf8,0x00,0x0f,0xf8,0x00,0x03,0xfc,0x00,0x03,0xfe,0x00,0x03,
-	0xff,0x80,0x01,0xff,0xe0,0x01,0xff,0xf0,0x01,0xff,0xfc,0x00,0xfe,0xff,0x00,0xff,
-	0x3f,0x80,0xff,0x1f,0xe0,0x7f,0x87,0xf8,0x7f,0x83,0xfc,0x7f,0xc0,0xff,0x3f,0xc0,
-	0x7f,0xff,0xc0,0x1f,0xe0,
+	0x09,0x88,0x18,0x79,0x28,0x68,0x38,0x58,0x58,0x48,0x67,0x38,0x78,0x27,0x97,0x18,
+	0xae,0xbd,0xdc,0xea,0xf9,0xf0,0x28,0xf0,0x19,0xfb,0xec,0xcd,0xbf,0xa7,0x18,0x88,
+	0x27,0x78,0x38,0x68,0x48,0x48,0x58,0x39,0x68,0x28,0x7f,0x02,0x98,
 /* index:89, [y] 0x79, W: 26, H: 37, X:  2, Y:  0 */
-	0xfe,0x00,0x1f,0xff,0xc0,0x0f,0xef,0xf0,0x03,0xf9,0xfc,0x00,0xfe,0x7f,0x80,0x7f,
-	0x0f,0xe0,0x1f,0xc3,0xf8,0x07,0xf0,0xff,0x01,0xf8,0x1f,0xc0,0xfe,0x07,0xf0,0x3f,
-	0x81,0xfc,0x0f,0xc0,0x3f,0x87,0xf0,0x0f,0xe1,0xfc,0x03,0xf8,0x7e,0x00,0x7f,0x1f,
-	0x80,0x1f,0xcf,0xc0,0x03,0xf3,0xf0,0x00,0xfe,0xfc,0x00,0x3f,0xfe,0x00,0x07,0xff,
-	0x80,0x01,0xff,0xe0,0x00,0x7f,0xf0,0x00,0x0f,0xfc,0x00,0x03,0xff,0x00,0x00,0xff,
-	0x80,0x00,0x1f,0xe0,0x00,0x07,0xf8,0x00,0x00,0xfc,0x00,0x00,0x7f,0x00,0x00,0x1f,
-	0xc0,0x00,0x07,0xe0,0x00,0x03,0xf8,0x00,0x1f,0xfe,0x00,0x07,0xff,0x00,0x01,0xff,
-	0xc0,0x00,0x7f,0xe0,0x00,0x1f,0xe0,0x00,0x00,
+	0x07,0xcf,0xa7,0x18,0xa7,0x27,0xa7,0x28,0x87,0x47,0x87,0x47,0x87,0x48,0x76,0x67,
+	0x67,0x67,0x67,0x67,0x66,0x87,0x47,0x87,0x47,0x87,0x46,0xa7,0x36,0xa7,0x26,0xc6,
+	0x26,0xc7,0x16,0xcd,0xec,0xec,0xeb,0xf0,0x1a,0xf0,0x1a,0xf0,0x19,0xf0,0x38,0xf0,
+	0x38,0xf0,0x46,0xf0,0x47,0xf0,0x47,0xf0,0x46,0xf0,0x47,0xec,0xeb,0xfb,0xfa,0xf0,
+	0x18,0x00,
 /* index:90, [z] 0x7a, W: 22, H: 27, X:  3, Y: 10 */
-	0xff,0xff,0xfb,0xff,0xff,0xef,0xff,0xff,0xbf,0xff,0xfe,0xff,0xff,0xfb,0xff,0xff,
-	0xe0,0x00,0xff,0x80,0x07,0xfc,0x00,0x3f,0xe0,0x00,0xff,0x00,0x07,0xf8,0x00,0x3f,
-	0xe0,0x01,0xff,0x00,0x0f,0xf8,0x00,0x7f,0xc0,0x03,0xfe,0x00,0x0f,0xf0,0x00,0x7f,
-	0x80,0x03,0xfe,0x00,0x1f,0xf0,0x00,0xff,0x80,0x03,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,
+	0x0f,0x06,0x1f,0x06,0x1f,0x06,0x1f,0x06,0x1f,0x06,0x1f,0x06,0xd9,0xc9,0xc9,0xd8,
+	0xd8,0xd9,0xc9,0xc9,0xc9,0xc9,0xd8,0xd8,0xd9,0xc9,0xc9,0xdf,0x0f,0x0f,0x0f,0x0f,
+	0x0f,0x0f,0x0f,0x0c,
 /* index:91, [{] 0x7b, W: 14, H: 46, X:  3, Y:  0 */
-	0x00,0xfc,0x0f,0xf0,0x7f,0xc1,0xff,0x0f,0xfc,0x3f,0x80,0xfc,0x03,0xf0,0x0f,0xc0,
-	0x3f,0x00,0xfc,0x03,0xf0,0x0f,0xc0,0x3f,0x00,0xfc,0x03,0xf0,0x0f,0xc0,0x3f,0x00,
-	0xfc,0x07,0xf0,0xff,0x83,0xfe,0x0f,0xc0,0x3f,0xc0,0xff,0x80,0x7e,0x00,0xfc,0x03,
-	0xf0,0x0f,0xc0,0x3f,0x00,0xfc,0x03,0xf0,0x0f,0xc0,0x3f,0x00,0xfc,0x03,0xf0,0x0f,
-	0xc0,0x3f,0x00,0xfc,0x03,0xf0,0x0f,0xe0,0x3f,0xf0,0x7f,0xc1,0xff,0x03,0xfc,0x03,
-	0xf0,
+	0x86,0x68,0x59,0x59,0x4a,0x47,0x76,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,
+	0x86,0x86,0x86,0x77,0x49,0x59,0x56,0x88,0x69,0x86,0x96,0x86,0x86,0x86,0x86,0x86,
+	0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x87,0x7a,0x59,0x59,0x68,0x86,
 /* index:92, [|] 0x7c, W:  4, H: 46, X:  6, Y:  0 */
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x0f,0x04,
 /* index:93, [}] 0x7d, W: 14, H: 46, X:  5, Y:  0 */
-	0xfc,0x03,0xfc,0x0f,0xf0,0x3f,0xe0,0xff,0x80,0x7f,0x00,0xfc,0x03,0xf0,0x0f,0xc0,
-	0x3f,0x00,0xfc,0x03,0xf0,0x0f,0xc0,0x3f,0x00,0xfc,0x03,0xf0,0x0f,0xc0,0x3f,0x00,
-	0xfc,0x03,0xf0,0x07,0xfc,0x1f,0xf0,0x0f,0xc0,0xff,0x07,0xfc,0x3f,0x80,0xfc,0x03,
-	0xf0,0x0f,0xc0,0x3f,0x00,0xfc,0x03,0xf0,0x0f,0xc0,0x3f,0x00,0xfc,0x03,0xf0,0x0f,
-	0xc0,0x3f,0x00,0xfc,0x03,0xf0,0x1f,0xc3,0xfe,0x0f,0xf8,0x3f,0xc0,0xff,0x03,0xf0,
-	0x00,
+	0x06,0x88,0x68,0x69,0x59,0x87,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,
+	0x86,0x86,0x86,0x86,0x99,0x59,0x86,0x68,0x59,0x47,0x76,0x86,0x86,0x86,0x86,0x86,
+	0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x86,0x77,0x49,0x59,0x58,0x68,0x66,0x00,
 /* index:94, [~] 0x7e, W: 23, H:  9, X:  2, Y: 17 */
-	0x0f,0x80,0x00,0x7f,0xc0,0x01,0xff,0xc0,0x7b,0xff,0xc0,0xff,0x8f,0xe3,0xfe,0x0f,
-	0xff,0xbc,0x07,0xff,0x00,0x07,0xfc,0x00,0x03,0xe0,
+	0x45,0xf0,0x19,0xdb,0x74,0x1c,0x69,0x37,0x39,0x5d,0x14,0x7b,0xd9,0xf0,0x15,0x00,
 };
 /* Font BIT DATA , MSB Left to Right (padded to byte alignment), Top Down */
 /* index:0, [ ] 0x20, W:  0, H:  0, X:  1, Y: 10 */
@@ -139,10 +139,425 @@ int32_t tft_abs_window(window *win, int16_t x, int16_t y, int16_t w, int16_t h)
 /// @return  bytes w * h after clipping, 0 on error
 int32_t tft_rel_window(window *win, int16_t x, int16_t y, int16_t w, int16_t h)
 {
+	// Terminal windows are rotated in GRAM by the hardware scroll offset
+	// Callers split rectangles that wrap, see tft_term_rows()
+	if((win->flags & VSCROLL) && y >= 0 && y < win->h)
+		y = (y + win->vsoff) % win->h;
+
 	// function tft_abs_window clips
 	return( tft_abs_window(win,x+win->x, y+win->y, w,h) );
 }
 
+/// ====================================
+/// @brief Hardware scrolled terminal windows
+/// ====================================
+
+/// @brief The panel has one vertical scrolling area, this window owns it
+static window *tft_term_win = NULL;
+
+/// @brief Set the hardware scroll offset of a terminal window
+/// Writes the Vertical Scrolling Start Address (0x37)
+/// @param[in] win*: window structure
+/// @param[in] off: window row shown at the top of the window
+/// @return  void
+static void tft_term_vsp(window *win, int16_t off)
+{
+	uint8_t data[2];
+	int16_t vsp;
+
+	win->vsoff = off;
+	vsp = win->y + off;
+	data[0] = vsp >> 8;
+	data[1] = vsp & 0xff;
+	tft_Cmd_Data_TX(0x37, data, 2);
+}
+
+/// @brief Use the panel hardware vertical scrolling for a text terminal window
+/// Scrolling becomes a single Vertical Scrolling Start Address (0x37) write
+/// The panel scrolls whole rows in rotation 0 only, so partial width windows,
+/// other rotations and frame buffer windows keep the software tft_Vscroll()
+/// The height is rounded down to whole text rows of the current font so
+/// character cells do not straddle the point where the scroll area wraps
+/// @param[in] win*: window structure, after tft_set_font()
+/// @return  1 when hardware scrolling is used, 0 for software scrolling
+MEMSPACE
+int tft_term_init(window *win)
+{
+	uint8_t data[6];
+	int16_t height, bfa;
+
+	if(tft_term_win && tft_term_win != win)
+		return(0);
+	if(win->fb || tft->rotation != 0 || win->x != tft->x || win->w != tft->w)
+		return(0);
+
+	height = font_H(win->font);
+	if(height > 0 && win->h >= height)
+		win->h -= win->h % height;
+
+	// Top fixed area, scroll area, bottom fixed area
+	bfa = tft->h - (win->y - tft->y) - win->h;
+	data[0] = win->y >> 8;
+	data[1] = win->y & 0xff;
+	data[2] = win->h >> 8;
+	data[3] = win->h & 0xff;
+	data[4] = bfa >> 8;
+	data[5] = bfa & 0xff;
+	tft_Cmd_Data_TX(0x33, data, 6);
+
+	win->flags |= VSCROLL;
+	tft_term_win = win;
+	tft_term_vsp(win, 0);
+	return(1);
+}
+
+/// @brief Stop hardware scrolling and restore the whole panel scroll area
+/// The window content stays rotated in GRAM, redraw the window after
+/// @param[in] win*: window structure
+/// @return  void
+MEMSPACE
+void tft_term_end(window *win)
+{
+	uint8_t data[6];
+
+	if(!(win->flags & VSCROLL))
+		return;
+
+	data[0] = 0;
+	data[1] = 0;
+	data[2] = TFT_H >> 8;
+	data[3] = TFT_H & 0xff;
+	data[4] = 0;
+	data[5] = 0;
+	tft_Cmd_Data_TX(0x33, data, 6);
+	data[0] = 0;
+	data[1] = 0;
+	tft_Cmd_Data_TX(0x37, data, 2);
+
+	win->flags &= ~VSCROLL;
+	win->vsoff = 0;
+	if(tft_term_win == win)
+		tft_term_win = NULL;
+}
+
+/// @brief Clip rows to a terminal window and find where the scroll area wraps
+/// A rectangle that wraps has to be sent as two parts
+/// @param[in] win*: window structure
+/// @param[in,out] *y: Y offset, clipped to the window
+/// @param[in,out] *h: Height, clipped to the window
+/// @return  rows before the wrap, *h if it does not wrap, 0 if nothing is visible
+int16_t tft_term_rows(window *win, int16_t *y, int16_t *h)
+{
+	int16_t rows;
+
+	if(!(win->flags & VSCROLL))
+		return(*h);
+
+	if(*y < 0)
+	{
+		*h += *y;
+		*y = 0;
+	}
+	if(*y + *h > win->h)
+		*h = win->h - *y;
+	if(*h <= 0)
+		return(0);
+
+	rows = win->h - (*y + win->vsoff) % win->h;
+	return(rows < *h ? rows : *h);
+}
+
+/// ====================================
+/// @brief Off-screen frame buffer windows
+/// ====================================
+
+/// @brief Attach an off-screen frame buffer to a window
+/// Once attached, all drawing functions render into RAM and tft_flush()
+/// sends only the dirty rectangles to the display.
+/// Call after tft_window_init() - the window size sets the buffer size
+/// @param[in] win*: window structure
+/// @param[in] *fb: buffer of win->w * win->h pixels, NULL allocates one
+/// @param[in] *palette: RGB565 palette for 8 bit pixels, NULL for 16 bit pixels
+/// @param[in] colors: palette size, 1..256
+/// @return  0 on success, -1 on error
+MEMSPACE
+int tft_fb_init(window *win, void *fb, uint16_t *palette, int colors)
+{
+	int32_t size;
+
+	if(palette && (colors < 1 || colors > 256))
+		return(-1);
+
+	size = win->w;
+	size *= win->h;
+	if(!palette)
+		size *= 2;
+	if(size <= 0)
+		return(-1);
+
+	win->flags &= ~FB_ALLOC;
+	if(!fb)
+	{
+		fb = calloc(size,1);
+		if(!fb)
+			return(-1);
+		win->flags |= FB_ALLOC;
+	}
+	win->fb = fb;
+	win->palette = palette;
+	win->colors = palette ? colors : 0;
+	win->dirty = 0;
+	return(0);
+}
+
+/// @brief Detach a frame buffer from a window, freeing it if we allocated it
+/// Pending dirty rectangles are discarded - call tft_flush() first
+/// @param[in] win*: window structure
+/// @return  void
+MEMSPACE
+void tft_fb_free(window *win)
+{
+	if(win->fb && (win->flags & FB_ALLOC))
+		free(win->fb);
+	win->flags &= ~FB_ALLOC;
+	win->fb = NULL;
+	win->palette = NULL;
+	win->colors = 0;
+	win->dirty = 0;
+}
+
+/// @brief Clip a window relative rectangle to the window
+/// @param[in] win*: window structure
+/// @param[in,out] *x: X offset
+/// @param[in,out] *y: Y offset
+/// @param[in,out] *w: Width
+/// @param[in,out] *h: Height
+/// @return  1 if anything is left to draw, 0 if not
+int tft_fb_clip(window *win, int16_t *x, int16_t *y, int16_t *w, int16_t *h)
+{
+	if(*x < 0)
+	{
+		*w += *x;
+		*x = 0;
+	}
+	if(*y < 0)
+	{
+		*h += *y;
+		*y = 0;
+	}
+	if(*x + *w > win->w)
+		*w = win->w - *x;
+	if(*y + *h > win->h)
+		*h = win->h - *y;
+	return(*w > 0 && *h > 0);
+}
+
+/// @brief Test if two rectangles overlap or touch
+/// @param[in] *a: rectangle
+/// @param[in] *b: rectangle
+/// @return  1 if they overlap or touch, 0 if not
+static int tft_rect_touch(rect_int16_t *a, rect_int16_t *b)
+{
+	return(a->x <= b->x + b->w && b->x <= a->x + a->w
+		&& a->y <= b->y + b->h && b->y <= a->y + a->h);
+}
+
+/// @brief Grow a rectangle to include a second rectangle
+/// @param[in,out] *a: rectangle to grow
+/// @param[in] *b: rectangle to include
+/// @return  void
+static void tft_rect_union(rect_int16_t *a, rect_int16_t *b)
+{
+	int16_t x0,y0;
+
+	x0 = MIN(a->x, b->x);
+	y0 = MIN(a->y, b->y);
+	a->w = MAX(a->x + a->w, b->x + b->w) - x0;
+	a->h = MAX(a->y + a->h, b->y + b->h) - y0;
+	a->x = x0;
+	a->y = y0;
+}
+
+/// @brief Add a clipped rectangle to the frame buffer dirty list
+/// Overlapping or touching rectangles are merged; when the list is full
+/// the rectangle is merged with the one whose area grows the least.
+/// @param[in] win*: window structure
+/// @param[in] x: X offset
+/// @param[in] y: Y offset
+/// @param[in] w: Width
+/// @param[in] h: Height
+/// @return  void
+void tft_fb_dirty(window *win, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	int i,j,best,merged;
+	int32_t grow,best_grow;
+	rect_int16_t n,u;
+
+	n.x = x;
+	n.y = y;
+	n.w = w;
+	n.h = h;
+
+	best = -1;
+	best_grow = 0;
+	for(i=0;i<win->dirty;++i)
+	{
+		if(tft_rect_touch(&win->rect[i], &n))
+		{
+			best = i;
+			break;
+		}
+		u = win->rect[i];
+		tft_rect_union(&u, &n);
+		grow = (int32_t) u.w * u.h - (int32_t) win->rect[i].w * win->rect[i].h;
+		if(best < 0 || grow < best_grow)
+		{
+			best = i;
+			best_grow = grow;
+		}
+	}
+
+	if(i == win->dirty && win->dirty < FB_DIRTY)
+	{
+		win->rect[win->dirty++] = n;
+		return;
+	}
+
+	tft_rect_union(&win->rect[best], &n);
+
+	// A grown rectangle may now touch others - merge until none do
+	do
+	{
+		merged = 0;
+		for(i=0;i<win->dirty;++i)
+		{
+			for(j=i+1;j<win->dirty;++j)
+			{
+				if(tft_rect_touch(&win->rect[i], &win->rect[j]))
+				{
+					tft_rect_union(&win->rect[i], &win->rect[j]);
+					win->rect[j--] = win->rect[--win->dirty];
+					merged = 1;
+				}
+			}
+		}
+	} while(merged);
+}
+
+/// @brief Find the palette index for an RGB565 color
+/// Exact matches are found first, otherwise the nearest color is used
+/// @param[in] win*: window structure
+/// @param[in] color: RGB565 color
+/// @return  palette index
+static uint8_t tft_fb_index(window *win, uint16_t color)
+{
+	int i;
+	uint8_t index = 0;
+	int32_t d,dr,dg,db,best_d;
+
+	best_d = 0x7fffffff;
+	for(i=0;i<win->colors;++i)
+	{
+		if(win->palette[i] == color)
+			return(i);
+		dr = (int32_t) ((win->palette[i] >> 11) & 0x1f) - ((color >> 11) & 0x1f);
+		dg = (int32_t) ((win->palette[i] >> 5) & 0x3f) - ((color >> 5) & 0x3f);
+		db = (int32_t) (win->palette[i] & 0x1f) - (color & 0x1f);
+		d = dr*dr*4 + dg*dg + db*db*4;
+		if(d < best_d)
+		{
+			best_d = d;
+			index = i;
+		}
+	}
+	return(index);
+}
+
+/// @brief Set a frame buffer pixel
+/// @param[in] win*: window structure
+/// @param[in] off: pixel offset y * win->w + x
+/// @param[in] color: RGB565 color
+/// @return  void
+static inline void tft_fb_set(window *win, int32_t off, uint16_t color)
+{
+	if(win->palette)
+		((uint8_t *) win->fb)[off] = tft_fb_index(win, color);
+	else
+		((uint16_t *) win->fb)[off] = color;
+}
+
+/// @brief Get a frame buffer pixel
+/// @param[in] win*: window structure
+/// @param[in] off: pixel offset y * win->w + x
+/// @return  RGB565 color
+static inline uint16_t tft_fb_get(window *win, int32_t off)
+{
+	if(win->palette)
+		return(win->palette[((uint8_t *) win->fb)[off]]);
+	return(((uint16_t *) win->fb)[off]);
+}
+
+/// @brief Send the dirty parts of a frame buffer window to the display
+/// Each dirty rectangle is sent with one window setup and one 0x2C write
+/// @param[in] win*: window structure
+/// @return  void
+void tft_flush(window *win)
+{
+	int i;
+	int xx,yy;
+	int ind;
+	int wdcount;
+	int32_t off;
+	uint16_t pixel;
+	rect_int16_t *r;
+	uint8_t buf[2*64];
+
+	if(!win->fb)
+		return;
+
+	for(i=0;i<win->dirty;++i)
+	{
+		r = &win->rect[i];
+		if(!tft_rel_window(win, r->x, r->y, r->w, r->h))
+			continue;
+
+		tft_spi_begin();
+
+		tft_Cmd(0x2c);
+
+		ind = 0;
+		wdcount = 0;
+		for(yy=0; yy < r->h; ++yy)
+		{
+			off = (int32_t) (r->y + yy) * win->w + r->x;
+			for(xx=0; xx < r->w; ++xx)
+			{
+				pixel = tft_fb_get(win, off++);
+				buf[ind++] = pixel >> 8;
+				buf[ind++] = pixel & 0xff;
+				if(ind >= sizeof(buf))
+				{
+					tft_spi_TX(buf,ind,0);
+					ind = 0;
+				}
+			}
+			wdcount += xx;
+			if(wdcount > 0x3ff)
+			{
+				optimistic_yield(1000);
+				wdcount = 0;
+			}
+		}
+		if(ind)
+		{
+			tft_spi_TX(buf,ind,0);
+		}
+
+		tft_spi_end();
+	}
+	win->dirty = 0;
+}
+
 ///  ======================================================================
 /// SPI
 
@@ -222,6 +637,88 @@ uint32_t tft_readId(void)
 /// @brief BLIT functions
 /// ====================================
 
+/// ====================================
+/// @brief Pixel streams
+/// ====================================
+
+/// @brief Pixel stream state for the tft_spi_TX_stream fill functions
+typedef struct {
+	int32_t pixels;		// pixels left to send
+	uint16_t *ptr;		// pixel array
+	uint8_t *bits;		// bit array
+	int32_t off;		// bit array row offset
+	int16_t xx;			// bit array column
+	int16_t w;			// bit array width
+	uint16_t fg,bg;		// bit array colors
+	int wdcount;
+} tft_stream_t;
+
+/// @brief Yield every 0x400 pixels of a stream
+/// @param[in] *s: stream state
+/// @param[in] count: pixels just prepared
+/// @return  void
+static void tft_stream_yield(tft_stream_t *s, int count)
+{
+	s->wdcount += count;
+	if(s->wdcount > 0x3ff)
+	{
+		s->wdcount = 0;
+		optimistic_yield(1000);
+	}
+}
+
+/// @brief Stream fill function for a pixel array
+/// @param[in] *arg: stream state
+/// @param[out] *buf: buffer to fill
+/// @param[in] bytes: buffer size
+/// @return  bytes written to buf, 0 when done
+static int tft_stream_pixels(void *arg, uint8_t *buf, int bytes)
+{
+	tft_stream_t *s = (tft_stream_t *) arg;
+	uint16_t pixel;
+	int ind = 0;
+
+	while(s->pixels > 0 && ind < bytes)
+	{
+		pixel = *s->ptr++;
+		buf[ind++] = pixel >> 8;
+		buf[ind++] = pixel & 0xff;
+		--s->pixels;
+	}
+	tft_stream_yield(s, ind/2);
+	return(ind);
+}
+
+/// @brief Stream fill function for a bit array
+/// @param[in] *arg: stream state
+/// @param[out] *buf: buffer to fill
+/// @param[in] bytes: buffer size
+/// @return  bytes written to buf, 0 when done
+static int tft_stream_bits(void *arg, uint8_t *buf, int bytes)
+{
+	tft_stream_t *s = (tft_stream_t *) arg;
+	uint16_t color;
+	int ind = 0;
+
+	while(s->pixels > 0 && ind < bytes)
+	{
+		if(bittestv(s->bits, s->xx + s->off))
+			color = s->fg;
+		else
+			color = s->bg;
+		buf[ind++] = color >> 8;
+		buf[ind++] = color & 0xff;
+		--s->pixels;
+		if(++s->xx >= s->w)
+		{
+			s->xx = 0;
+			s->off += s->w;
+		}
+	}
+	tft_stream_yield(s, ind/2);
+	return(ind);
+}
+
 /// @brief  BLIT a bit array to the display
 /// @param[in] win*: window structure
 /// @param[in] *ptr: bit array w * h in size
@@ -234,13 +731,46 @@ uint32_t tft_readId(void)
 void tft_bit_blit(window *win, uint8_t *ptr, int16_t x, int16_t y, int16_t w, int16_t h)
 {
 
-    uint16_t color;
     int xx,yy;
     int32_t off;
 	int32_t pixels;
-	int wdcount;
-	int ind;
-	uint8_t buf[2*64];
+	int16_t rows;
+	tft_stream_t stream;
+
+	if(win->fb)
+	{
+		int16_t cx = x, cy = y, cw = w, ch = h;
+
+		// Clipping offsets the bit array
+		if(!tft_fb_clip(win,&cx,&cy,&cw,&ch))
+			return;
+		// Look up the palette indexes once, not per pixel
+		if(win->palette)
+		{
+			uint8_t fg = tft_fb_index(win, win->fg);
+			uint8_t bg = tft_fb_index(win, win->bg);
+
+			for (yy=0; yy < ch; ++yy)
+			{
+				off = (int32_t) (cy - y + yy) * w + (cx - x);
+				pixels = (int32_t) (cy + yy) * win->w + cx;
+				for (xx=0;xx < cw; ++xx)
+					((uint8_t *) win->fb)[pixels++] = bittestv(ptr, xx + off) ? fg : bg;
+			}
+		}
+		else
+		{
+			for (yy=0; yy < ch; ++yy)
+			{
+				off = (int32_t) (cy - y + yy) * w + (cx - x);
+				pixels = (int32_t) (cy + yy) * win->w + cx;
+				for (xx=0;xx < cw; ++xx)
+					tft_fb_set(win, pixels++, bittestv(ptr, xx + off) ? win->fg : win->bg);
+			}
+		}
+		tft_fb_dirty(win,cx,cy,cw,ch);
+		return;
+	}
 
 	// FIXME - do we just want to constrain the values or ignore the request ???
 	if ( tft_window_clip_args(tft,&x,&y,&w,&h) )
@@ -252,57 +782,44 @@ void tft_bit_blit(window *win, uint8_t *ptr, int16_t x, int16_t y, int16_t w, in
 #if 1
 // BIT BLIT
 
-    pixels = tft_rel_window(win, x, y, w, h);
-	if(pixels == 0)
-		return;
-
 // FIXME now we should consider clipping the pixel array
 // Note: Clipping modifies offsets which in turn modifies blit array offsets
 // We could use tft_drawPixel, and it clips - but that the pixel function is very slow
 // For now we clip the arguments and use tft_rel_windows which also clips
 
-	
-	tft_spi_begin();
+	// Terminal windows wrap in GRAM, send each part separately
+	off = y;
+	rows = tft_term_rows(win, &y, &h);
+	off = (int32_t) (y - off) * w;
 
-    tft_Cmd(0x2c);
+	while(rows > 0)
+	{
+		pixels = tft_rel_window(win, x, y, w, rows);
+		if(pixels == 0)
+			return;
 
-    off = 0;
-	ind = 0;
-	wdcount = 0;
+		stream.pixels = pixels;
+		stream.bits = ptr;
+		stream.off = off;
+		stream.xx = 0;
+		stream.w = w;
+		stream.fg = win->fg;
+		stream.bg = win->bg;
+		stream.wdcount = 0;
 
-    for (yy=0; yy < h; ++yy)
-    {
-        for (xx=0;xx < w; ++xx)
-        {
-            if(bittestv(ptr, xx + off))
-                color = win->fg;
-            else
-                color = win->bg;
+		tft_spi_begin();
 
-			buf[ind++] = color >> 8;
-			buf[ind++] = color & 0xff;
+		tft_Cmd(0x2c);
 
-			if(ind >= sizeof(buf))
-			{
-				tft_spi_TX(buf,ind,0);
-				ind = 0;
-			}
-        }
-		wdcount += xx;
-		if(wdcount > 0x3ff)
-		{
-			optimistic_yield(1000);
-			//ets_wdt_disable();
-			wdcount = 0;
-		}
-        off += w;
-    }
-	if(ind)
-	{
-		tft_spi_TX(buf,ind,0);
-	}
+		tft_spi_TX_stream(tft_stream_bits, &stream);
 
-	tft_spi_end();
+		tft_spi_end();
+
+		off += (int32_t) rows * w;
+		y += rows;
+		h -= rows;
+		rows = h;
+	}
 #else
     off = 0;
     for (yy=0; yy < h; ++yy)
@@ -310,9 +827,9 @@ void tft_bit_blit(window *win, uint8_t *ptr, int16_t x, int16_t y, int16_t w, in
         for (xx=0;xx < w; ++xx)
         {
             if(bittestv(ptr, xx + off))
-                tft_drawPixel(win,x+xx,y+yy,fg);
+                tft_drawPixel(win,x+xx,y+yy,win->fg);
             else
-                tft_drawPixel(win,x+xx,y+yy,bg);
+                tft_drawPixel(win,x+xx,y+yy,win->bg);
         }
         off += w;
     }
@@ -337,163 +854,323 @@ void tft_fillWin(window *win, uint16_t color)
     tft_fillRectWH(win, 0,0, win->w, win->h, color);
 }
 
-/// @brief Flood fill
-/// @see https://en.wikipedia.org/wiki/Flood_fill
-/// This method can eat all your ram with "busy" images and could crash
-/// @param[in] win*: window structure
-/// @param[in] border: border color
-/// @param[in] fill: Fill color
-void tft_flood(window *win, int16_t x, int16_t y, uint16_t border, uint16_t fill)
+/// @brief Flood fill span stack size on the stack
+/// Larger fills move the span stack to the heap and double it as needed
+#ifndef FLOOD_STACK
+#define FLOOD_STACK 32
+#endif
+
+/// @brief Pixels read at a time past the open ends of a run
+#define FLOOD_CHUNK 16
+
+/// @brief Run ends not known to be closed by a non fillable pixel
+#define FLOOD_OPEN_L 1
+#define FLOOD_OPEN_R 2
+
+/// @brief Flood fill line buffer size, the widest window
+#define FLOOD_W MAX(TFT_W,TFT_H)
+
+/// @brief Flood fill row buffer
+/// Static rather than on the stack, flood fills are not reentrant
+static uint16_t tft_flood_line[FLOOD_W];
+
+/// @brief Flood fill seed, a run x .. xe of row y
+typedef struct {
+	int16_t x;
+	int16_t xe;
+	int16_t y;
+	uint8_t open;
+} tft_seed_t;
+
+/// @brief Flood fill state
+typedef struct {
+	window *win;
+	uint16_t border;
+	uint16_t fill;
+	tft_seed_t *seed;		// seed stack, FLOOD_STACK in tft_floodline() or heap
+	int size;				// seed stack entries
+	int ind;
+	uint8_t heap;			// seed stack was allocated
+	uint8_t overflow;		// seeds were dropped, out of memory
+	int32_t pixels;			// pixels filled
+	int wdcount;
+	uint16_t *line;			// row pixels, tft_flood_line
+} tft_flood_t;
+
+/// @brief Test if a pixel can be filled
+/// @param[in] *f: flood fill state
+/// @param[in] color: pixel color
+/// @return  1 if the pixel is neither border nor fill color
+static int tft_flood_test(tft_flood_t *f, uint16_t color)
 {
-	uint16_t current;
+	return(color != f->border && color != f->fill);
+}
 
-	if(x < 0 || x >= win->w)
-		return;
-	if(y < 0 || y >= win->h)
-		return;
+/// @brief Push a run of fillable pixels on the span stack
+/// @param[in] *f: flood fill state
+/// @param[in] x: first X
+/// @param[in] xe: last X
+/// @param[in] y: Y
+/// @param[in] open: FLOOD_OPEN_L and FLOOD_OPEN_R if the run may extend past x or xe
+/// @return  void
+static void tft_flood_push(tft_flood_t *f, int16_t x, int16_t xe, int16_t y, uint8_t open)
+{
+	tft_seed_t *seed;
 
-	current = tft_readPixel(win,x,y);
-	if(current == border || current == fill)
+	// Full, double the stack on the heap
+	if(f->ind >= f->size)
+	{
+		seed = calloc(f->size * 2, sizeof(tft_seed_t));
+		if(!seed)
+		{
+			f->overflow = 1;
+			return;
+		}
+		memcpy(seed, f->seed, f->size * sizeof(tft_seed_t));
+		if(f->heap)
+			free(f->seed);
+		f->seed = seed;
+		f->size *= 2;
+		f->heap = 1;
+	}
+	seed = &f->seed[f->ind++];
+	seed->x = x;
+	seed->xe = xe;
+	seed->y = y;
+	seed->open = open;
+}
+
+/// @brief Push each fillable run of a row that touches xl .. xr
+/// One pixel past each end is read so most runs have known ends
+/// @param[in] *f: flood fill state
+/// @param[in] xl: first X
+/// @param[in] xr: last X
+/// @param[in] y: row
+/// @return  void
+static void tft_flood_seeds(tft_flood_t *f, int16_t xl, int16_t xr, int16_t y)
+{
+	int16_t x, start = -1;
+	int16_t sl = xl, sr = xr;
+	uint8_t open;
+
+	if(y < 0 || y >= f->win->h)
 		return;
+	if(xl > 0)
+		--xl;
+	if(xr < f->win->w - 1)
+		++xr;
+
+	tft_readRect(f->win, xl, y, xr - xl + 1, 1, f->line);
+	for(x = xl; x <= xr + 1; ++x)
+	{
+		if(x <= xr && tft_flood_test(f, f->line[x - xl]))
+		{
+			if(start < 0)
+				start = x;
+		}
+		else if(start >= 0)
+		{
+			// Runs only touching the span diagonally are not connected
+			if(start > sr || x - 1 < sl)
+			{
+				start = -1;
+				continue;
+			}
+			// Runs that reach the ends of the read may continue
+			open = 0;
+			if(start == xl && xl > 0)
+				open |= FLOOD_OPEN_L;
+			if(x - 1 == xr && xr < f->win->w - 1)
+				open |= FLOOD_OPEN_R;
+			tft_flood_push(f, start, x - 1, y, open);
+			start = -1;
+		}
+	}
+}
+
+/// @brief Find the end of a span, reading the row a chunk at a time
+/// @param[in] *f: flood fill state
+/// @param[in] x: fillable pixel to start from
+/// @param[in] y: row
+/// @param[in] dir: -1 left, 1 right
+/// @return  last fillable pixel in direction dir
+static int16_t tft_flood_edge(tft_flood_t *f, int16_t x, int16_t y, int dir)
+{
+	int16_t i, n;
+
+	for(;;)
+	{
+		n = (dir < 0) ? x : f->win->w - 1 - x;
+		if(n > FLOOD_CHUNK)
+			n = FLOOD_CHUNK;
+		if(n <= 0)
+			return(x);
+		tft_readRect(f->win, (dir < 0) ? x - n : x + 1, y, n, 1, f->line);
+		for(i = 0; i < n; ++i)
+		{
+			if(!tft_flood_test(f, f->line[(dir < 0) ? n - 1 - i : i]))
+				return(x);
+			x += dir;
+		}
+	}
+}
 
-	tft_drawPixel(win,x,y,fill);
-	tft_flood(win,x+1,y,border,fill);
-	tft_flood(win,x,y+1,border,fill);
-	tft_flood(win,x-1,y,border,fill);
-	tft_flood(win,x,y-1,border,fill);
+/// @brief Fill every span reachable from the seeds on the stack
+/// Rows are read into RAM in bulk and each span is written with one fill
+/// @param[in] *f: flood fill state
+/// @return  void
+static void tft_flood_drain(tft_flood_t *f)
+{
+	window *win = f->win;
+	int16_t x,y,xl,xr;
+	int16_t i,n;
+	uint8_t open;
+
+	while(f->ind > 0)
+	{
+		f->ind--;
+		x = f->seed[f->ind].x;
+		xr = f->seed[f->ind].xe;
+		y = f->seed[f->ind].y;
+		open = f->seed[f->ind].open;
+
+		// A run is either still fillable or was filled by one span,
+		// so the seed pixel is read with the pixels to its left
+		n = 0;
+		if(open & FLOOD_OPEN_L)
+			n = (x > FLOOD_CHUNK) ? FLOOD_CHUNK : x;
+		tft_readRect(win, x - n, y, n + 1, 1, f->line);
+		if(!tft_flood_test(f, f->line[n]))
+			continue;
+		xl = x;
+		for(i = n; i > 0 && tft_flood_test(f, f->line[i-1]); --i)
+			--xl;
+		if(i == 0 && (open & FLOOD_OPEN_L))
+			xl = tft_flood_edge(f, xl, y, -1);
+		if(open & FLOOD_OPEN_R)
+			xr = tft_flood_edge(f, xr, y, 1);
+
+		tft_fillRectWH(win, xl, y, xr - xl + 1, 1, f->fill);
+		f->pixels += xr - xl + 1;
+
+		tft_flood_seeds(f, xl, xr, y - 1);
+		tft_flood_seeds(f, xl, xr, y + 1);
+
+		f->wdcount += xr - xl + 1;
+		if(f->wdcount >= 0x3ff)
+		{
+			optimistic_yield(1000);
+			f->wdcount = 0;
+		}
+	}
 }
 
-
-
-/// @brief X,Y point stack
-#define XYSTACK 64
-static struct {
-	int16_t x[XYSTACK+2];
-	int16_t y[XYSTACK+2];
-	int ind;
-} xy;
-
-/// @brief point push
-/// @param[in] x: X
-/// @param[in] y: Y
-/// @ return true on success, 0 of stack overflow
-int tft_push_xy(int16_t x, int16_t y)
+/// @brief Seed fillable pixels above or below a filled pixel again
+/// Only used when the span stack could not grow, every dropped seed was
+/// next to a span. This is a last resort, not an exact fill:
+/// Row pairs are compared FLOOD_CHUNK pixels at a time in small buffers,
+/// f->line is left to tft_flood_drain()
+/// areas already in the fill color that touch fillable pixels are joined
+/// @param[in] *f: flood fill state
+/// @return  void
+static void tft_flood_rescan(tft_flood_t *f)
 {
-	if(xy.ind >= XYSTACK)
+	window *win = f->win;
+	uint16_t cur[FLOOD_CHUNK];
+	uint16_t next[FLOOD_CHUNK];
+	int16_t x,y,i,n;
+	int above, below;
+
+	f->overflow = 0;
+	for(y = 0; y < win->h - 1; ++y)
 	{
-		printf("xy.ind stack >= %d\n",XYSTACK);
-		return(0);
+		above = below = 0;
+		for(x = 0; x < win->w; x += n)
+		{
+			n = win->w - x;
+			if(n > FLOOD_CHUNK)
+				n = FLOOD_CHUNK;
+			tft_readRect(win, x, y, n, 1, cur);
+			tft_readRect(win, x, y + 1, n, 1, next);
+			for(i = 0; i < n; ++i)
+			{
+				// One seed per run, as tft_flood_seeds() does
+				if(cur[i] == f->fill && tft_flood_test(f, next[i]))
+				{
+					if(!below)
+						tft_flood_push(f, x + i, x + i, y + 1, FLOOD_OPEN_L | FLOOD_OPEN_R);
+					below = 1;
+				}
+				else
+					below = 0;
+				if(next[i] == f->fill && tft_flood_test(f, cur[i]))
+				{
+					if(!above)
+						tft_flood_push(f, x + i, x + i, y, FLOOD_OPEN_L | FLOOD_OPEN_R);
+					above = 1;
+				}
+				else
+					above = 0;
+			}
+		}
+		tft_flood_drain(f);
 	}
-	xy.x[xy.ind] = x;
-	xy.y[xy.ind] = y;
-	xy.ind++;
-	return(1);
 }
 
-/// @brief point push
-/// @param[in] x: X
-/// @param[in] y: Y
-/// @ return true if data exists, 0 of none
-int tft_pop_xy(int16_t *x, int16_t *y)
+/// @brief Flood fill
+/// @see tft_floodline
+/// @param[in] win*: window structure
+/// @param[in] x: X position to fill from
+/// @param[in] y: Y position to fill from
+/// @param[in] border: border color
+/// @param[in] fill: Fill color
+void tft_flood(window *win, int16_t x, int16_t y, uint16_t border, uint16_t fill)
 {
-	if(xy.ind <= 0)
-		return(0);
-	xy.ind--;
-	*x = xy.x[xy.ind];
-	*y = xy.y[xy.ind];
-	return(1);
+	(void) tft_floodline(win, x, y, border, fill);
 }
 
-/// @brief Flood using line fill method
+/// @brief Flood using scanline fill method
 /// @see https://en.wikipedia.org/wiki/Flood_fill
-/// FIXME: not tested yet
+/// Row segments are read with one tft_readRect, spans are found in RAM
+/// and each span is written with one fill. Seeds are runs on a stack that
+/// grows on the heap, only if that fails the window is rescanned for
+/// dropped seeds, see tft_flood_rescan().
 /// @param[in] win*: window structure
 /// @param[in] x: X position to fill from
 /// @param[in] y: Y position to fill from
 /// @param[in] border: border color
 /// @param[in] fill: Fill color
-/// @ return true one success, 0 of stack overflow
-int tft_floodline(window *win, int16_t x, int16_t y, uint16_t border, uint16_t fill)
+/// @return pixels filled, 0 if x,y is outside the window or nothing to fill
+int32_t tft_floodline(window *win, int16_t x, int16_t y, uint16_t border, uint16_t fill)
 {
-	int lineAbove, lineBelow;
-	int16_t  xoff;
-	int count = 0;
-
-	// reset stack
-	xy.ind = 0;
+	tft_flood_t f;
+	tft_seed_t seed[FLOOD_STACK];
 
 	if(x < 0 || x >= win->w)
-	{
-		printf("tft_floodline: X out of range\n");
 		return(0);
-	}
 	if(y < 0 || y >= win->h)
-	{
-		printf("tft_floodline: Y out of range\n");
 		return(0);
-	}
-
-	// test for stack full
-	if(!tft_push_xy(x, y)) 
-		return(0);
-
-	// while we have stacked items
-	// FIXME we can bypass readpixel - read any entire line interruped by the color check
-	while(tft_pop_xy((int16_t *)&x, (int16_t *)&y))
-	{
-		if(x < 0 || x >= win->w)
-		{
-			printf("tft_floodline: X out of range\n");
-			return(0);
-		}
-		if(y < 0 || y >= win->h)
-		{
-			printf("tft_floodline: Y out of range\n");
-			return(0);
-		}
-		xoff = x;
-		while(xoff >= 0 && tft_readPixel(win,xoff,y) != border ) 
-			xoff--;
-		xoff++;
-
-		lineAbove = lineBelow = 0;
-
-		while(xoff < win->w && tft_readPixel(win,xoff,y) != border)
-		{
-			tft_drawPixel(win,xoff,y,fill);
-			if(++count >= 1000)
-			{
-				optimistic_yield(1000);
-				count = 0;
-			}
-
 
-			if(!lineAbove && y > 0 && tft_readPixel(win,xoff,y-1) != border)
-			{
-				// test for stack full
-				if(!tft_push_xy(xoff, y - 1)) 
-					return(0);
-				lineAbove = 1;
-			}
-			else if(lineAbove && y > 0 && tft_readPixel(win,xoff,y-1) == border )
-			{
-				lineAbove = 0;
-			}
-			if(!lineBelow && y < (win->h-1) && tft_readPixel(win,xoff,y+1) != border )
-			{
-				// test for stack full
-				if(!tft_push_xy(xoff, y + 1)) 
-					return(0);
-				lineBelow = 1;
-			}
-			else if(lineBelow && y < (win->h-1) && tft_readPixel(win,xoff,y+1) == border)
-			{
-				lineBelow = 0;
-			}
-			xoff++;
-		}
-	}
-	return(1);
+	f.win = win;
+	f.line = tft_flood_line;
+	f.border = border;
+	f.fill = fill;
+	f.seed = seed;
+	f.size = FLOOD_STACK;
+	f.ind = 0;
+	f.heap = 0;
+	f.overflow = 0;
+	f.pixels = 0;
+	f.wdcount = 0;
+
+	tft_flood_push(&f, x, x, y, FLOOD_OPEN_L | FLOOD_OPEN_R);
+	tft_flood_drain(&f);
+	while(f.overflow)
+		tft_flood_rescan(&f);
+	if(f.heap)
+		free(f.seed);
+
+	return(f.pixels);
 }
 
 
@@ -627,55 +1304,72 @@ int tft_FillPolyLine(window *win, int16_t x, int16_t y, int w, uint16_t color)
 void tft_fillRectWH(window *win, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
     int32_t pixels;
-    int32_t colors;
-	int wdcount;
-    int ind;
-    uint8_t buf[2*64];
+	int32_t count;
+	int16_t rows;
+	uint8_t data[2];
+
+	if(win->fb)
+	{
+		int xx,yy;
+		int32_t off;
+
+		if(!tft_fb_clip(win,&x,&y,&w,&h))
+			return;
+		// Look up the palette index once, rows are then plain byte fills
+		if(win->palette)
+		{
+			uint8_t index = tft_fb_index(win, color);
+
+			for(yy=0; yy < h; ++yy)
+				memset((uint8_t *) win->fb + (int32_t) (y + yy) * win->w + x, index, w);
+		}
+		else
+		{
+			for(yy=0; yy < h; ++yy)
+			{
+				off = (int32_t) (y + yy) * win->w + x;
+				for(xx=0; xx < w; ++xx)
+					tft_fb_set(win, off++, color);
+			}
+		}
+		tft_fb_dirty(win,x,y,w,h);
+		return;
+	}
+
+	// Terminal windows wrap in GRAM, fill each part separately
+	rows = tft_term_rows(win, &y, &h);
+	if(rows < h)
+	{
+		tft_fillRectWH(win, x, y, w, rows, color);
+		tft_fillRectWH(win, x, y + rows, w, h - rows, color);
+		return;
+	}
 
 	// tft_rel_window clips
 	pixels = tft_rel_window(win, x,y,w,h);
 	if(!pixels)
 		return;
 
-	wdcount = 0;
-
-    if(pixels > 0)
-    {
-		tft_spi_begin();
-
-        tft_Cmd(0x2c);
-
-		ind = 0;
-		//We are sending words
-		while(pixels > 0)
-		{
-			colors = pixels;
-			if(colors > sizeof(buf)/2)
-				colors = sizeof(buf)/2;
+	data[0] = color >> 8;
+	data[1] = color & 0xff;
 
-			pixels -= colors;
-			wdcount += colors;
+	tft_spi_begin();
 
-			if(!ind)
-			{
-				while(ind < sizeof(buf) && ind < colors*2)
-				{
-					buf[ind++] = color >> 8;
-					buf[ind++] = color & 0xff;
-				}
-			}
-			tft_spi_TX(buf,colors*2,0);
-			if(wdcount > 0x3ff)
-			{
-				wdcount = 0;
-				optimistic_yield(1000);
-				// ets_wdt_disable();
-			}
-		}
+	tft_Cmd(0x2c);
 
-		tft_spi_end();
-    } // if(pixels > 0)
+	// The FIFO is loaded once for each block of pixels
+	while(pixels > 0)
+	{
+		count = pixels;
+		if(count > 0x400)
+			count = 0x400;
+		tft_spi_repeat(data, 2, count);
+		pixels -= count;
+		if(pixels)
+			optimistic_yield(1000);
+	}
 
+	tft_spi_end();
 }
 
 /// @brief  Fill rectangle with color
@@ -716,7 +1410,7 @@ void tft_fillRectXY(window *win, int16_t x, int16_t y, int16_t xl, int16_t yl, u
 /// @return void
 void tft_drawPixel(window *win, int16_t x, int16_t y, int16_t color)
 {
-    uint8_t data[2];
+	tft_span_t s;
 
 // Clip pixel
     if(x < 0 || x >= win->w)
@@ -724,14 +1418,17 @@ void tft_drawPixel(window *win, int16_t x, int16_t y, int16_t color)
     if(y < 0 || y >= win->h)
         return;
 
-	// tft_rel_window() clips
-    if(! tft_rel_window(win, x,y,1,1))
+	if(win->fb)
+	{
+		tft_fb_set(win, (int32_t) y * win->w + x, color);
+		tft_fb_dirty(win,x,y,1,1);
 		return;
+	}
 
-    data[0] = color >>8;
-    data[1] = color;
-    tft_Cmd_Data_TX(0x2c, data, 2);
-
+	// One chip select for the window and the pixel
+	tft_span_begin(&s, win, color);
+	tft_span_pixel(&s, x, y);
+	tft_span_end(&s);
 }
 
 /// @brief  Write a rectangle pixel array
@@ -746,54 +1443,68 @@ void tft_writeRect(window *win, int16_t x, int16_t y, int16_t w, int16_t h, uint
 {
 
 	int32_t pixels;
-	uint16_t pixel;
 	int wdcount;
     int xx,yy;
-	int ind;
-	uint8_t buf[2*64];
+	tft_stream_t stream;
 
     if(!w || !h)
         return;
 
+	if(win->fb)
+	{
+		int16_t cx = x, cy = y, cw = w, ch = h;
+		int32_t off;
+		uint16_t *src;
+
+		// Clipping offsets the pixel array
+		if(!tft_fb_clip(win,&cx,&cy,&cw,&ch))
+			return;
+		for (yy=0; yy < ch; ++yy)
+		{
+			src = color + (int32_t) (cy - y + yy) * w + (cx - x);
+			off = (int32_t) (cy + yy) * win->w + cx;
+			for (xx=0;xx < cw; ++xx)
+				tft_fb_set(win, off++, *src++);
+		}
+		tft_fb_dirty(win,cx,cy,cw,ch);
+		return;
+	}
+
 // TODO CLIP window data - depends on blit array offset also
 // We could use tft_drawPixel, and it clips - but that is slow
 
+	// Terminal windows wrap in GRAM, write each part separately
+	if(win->flags & VSCROLL)
+	{
+		int16_t ty = y;
+		int16_t rows = tft_term_rows(win, &y, &h);
+
+		if(!rows)
+			return;
+		color += (int32_t) (y - ty) * w;
+		if(rows < h)
+		{
+			tft_writeRect(win, x, y, w, rows, color);
+			tft_writeRect(win, x, y + rows, w, h - rows, color + (int32_t) rows * w);
+			return;
+		}
+	}
+
 #if 1
     // tft_rel_window() clips limits
     pixels = tft_rel_window(win, x, y, w, h);
 	if(!pixels)
 		return;
 
+	stream.pixels = pixels;
+	stream.ptr = color;
+	stream.wdcount = 0;
+
 	tft_spi_begin();
 
     tft_Cmd(0x2c);
 
-	ind = 0;
-	wdcount = 0;
-
-	while(pixels-- > 0)
-	{
-		pixel = *color++;
-		buf[ind++]=pixel >> 8;
-		buf[ind++]=pixel & 0xff;
-		if(ind >= sizeof(buf))
-		{
-			tft_spi_TX(buf,ind,0);
-			wdcount += ind;
-			ind = 0;
-			if(wdcount > 0x3ff)
-			{
-				wdcount = 0;
-				optimistic_yield(1000);
-				//ets_wdt_disable();
-			}
-		}
-	}
-
-	if(ind)
-	{
-		tft_spi_TX(buf,ind,0);
-	}
+	tft_spi_TX_stream(tft_stream_pixels, &stream);
 
 	tft_spi_end();
 
@@ -839,11 +1550,38 @@ void tft_readRect(window *win, int16_t x, int16_t y, int16_t w, int16_t h, uint1
 	int32_t pixels;
 	int wdcount;
 	int rem;
+	int16_t rows;
 	uint8_t cmd;
 	uint8_t *ptr;
 	// Command and Pixel buffer
 	uint8_t data[64*3];
 
+	if(win->fb)
+	{
+		int xx,yy;
+		int32_t off;
+
+		// Return the clipped area, as the display does
+		if(!tft_fb_clip(win,&x,&y,&w,&h))
+			return;
+		for(yy=0; yy < h; ++yy)
+		{
+			off = (int32_t) (y + yy) * win->w + x;
+			for(xx=0; xx < w; ++xx)
+				*color++ = tft_fb_get(win, off++);
+		}
+		return;
+	}
+
+	// Terminal windows wrap in GRAM, read each part separately
+	rows = tft_term_rows(win, &y, &h);
+	if(rows < h)
+	{
+		tft_readRect(win, x, y, w, rows, color);
+		tft_readRect(win, x, y + rows, w, h - rows, color + (int32_t) rows * w);
+		return;
+	}
+
 	// tft_rel_window() clips
     pixels = tft_rel_window(win, x,y,w,h);
 	if(!pixels)
@@ -895,7 +1633,8 @@ void tft_readRect(window *win, int16_t x, int16_t y, int16_t w, int16_t h, uint1
 }
 
 /// @brief Scroll window up by dir lines
-/// We start at the top of the window and move down
+/// Terminal windows scroll with one panel register write, see tft_term_init()
+/// Other windows start at the top of the window and move down
 /// @param[in] win*: window structure
 /// @param[in] dir: direction and count
 /// TODO +/- scroll direction
@@ -919,6 +1658,24 @@ void tft_Vscroll(window *win, int dir)
 		tft_fillRectWH(win, 0, 0, win->w, win->h, win->bg);
 		return;
 	}
+	if(win->flags & VSCROLL)
+	{
+		// The rows scrolled off the top become the new bottom rows
+		tft_fillRectWH(win, 0, 0, win->w, dir, win->bg);
+		tft_term_vsp(win, (win->vsoff + dir) % win->h);
+		return;
+	}
+	if(win->fb)
+	{
+		int bpp = win->palette ? 1 : 2;
+		uint8_t *fb = (uint8_t *) win->fb;
+
+		memmove(fb, fb + (int32_t) dir * win->w * bpp, (int32_t) (win->h - dir) * win->w * bpp);
+		// fillRectWH marks its own area dirty, mark the rest
+		tft_fb_dirty(win, 0, 0, win->w, win->h - dir);
+		tft_fillRectWH(win, 0, win->h - dir, win->w, dir, win->bg);
+		return;
+	}
 	for(i=0; i < win->h;++i)
 	{
 		// source of scroll
@@ -926,7 +1683,7 @@ void tft_Vscroll(window *win, int dir)
 		// target of scroll
 		yto = i;
 
-		if(yfrom >= (win->h-1))
+		if(yfrom >= win->h)
 		{
 			// Clear to of window
 			tft_fillRectWH(win, 0, yto, win->w, 1, win->bg);
@@ -954,6 +1711,13 @@ uint16_t tft_readPixel(window *win, int16_t x, int16_t y)
     uint8_t data[3];
     uint16_t color;
 
+	if(win->fb)
+	{
+		if(x < 0 || x >= win->w || y < 0 || y >= win->h)
+			return(0);
+		return(tft_fb_get(win, (int32_t) y * win->w + x));
+	}
+
 	// set window, also clips
     if(!tft_rel_window(win, x,y,1,1))
 		return(0);
@@ -983,6 +1747,11 @@ void tft_setRotation(uint8_t m)
 {
 
     uint8_t data;
+
+	// The panel scroll area only works in rotation 0
+	if(tft_term_win)
+		tft_term_end(tft_term_win);
+
     tft->rotation = m & 3; // can't be higher than 3
     data = MADCTL_BGR;
     switch (tft->rotation)
@@ -1202,6 +1971,10 @@ void tft_window_init(window *win, int16_t x, int16_t y, int16_t w, int16_t h)
 
 	(void) tft_window_clip_args(tft,&x,&y,&w,&h);
 
+	// Release the panel scroll area if the window is reused
+	if(tft_term_win == win)
+		tft_term_end(win);
+
     win->xpos		= 0;                            // current X position
     win->ypos		= 0;                            // current Y position
     win->font		= 0;                            // current font size
@@ -1214,6 +1987,12 @@ void tft_window_init(window *win, int16_t x, int16_t y, int16_t w, int16_t h)
     win->tabstop   	= w/4;
     win->fg = 0xFFFF;
     win->bg = 0;
+	// Draw directly to the display, see tft_fb_init()
+	win->fb = NULL;
+	win->palette = NULL;
+	win->colors = 0;
+	win->dirty = 0;
+	win->vsoff = 0;
 }
 
 
@@ -1281,59 +2060,280 @@ void tft_font_fixed(window *win)
 }
 
 
-/// @brief  Set current font type to variable
-/// @param[in] win*: window structure
-/// return: void
-MEMSPACE
-void tft_font_var(window *win)
-{
-    win->flags |= FONT_VAR;
+/// @brief  Set current font type to variable
+/// @param[in] win*: window structure
+/// return: void
+MEMSPACE
+void tft_font_var(window *win)
+{
+    win->flags |= FONT_VAR;
+}
+
+/// @brief  Get font height
+/// @param[in] win*: window structure
+/// return: font Height or zero on error
+int tft_get_font_height(window *win)
+{
+	int ret;
+    _fontc f;
+    ret = font_attr(win, ' ', &f);
+    if(ret < 0)
+        return 0;
+	return(f.Height);
+}
+
+
+/// @brief  Fast virtical line drawing
+/// @param[in] *win: window structure
+/// @param[in] x: X offset
+/// @param[in] y: Y offset
+/// @param[in] h: Height of line
+/// @param[in] color: Color
+/// @return  void
+void tft_drawFastVLine(window *win,int16_t x, int16_t y,
+int16_t h, uint16_t color)
+{
+	// function clips
+	tft_fillRectWH(win, x,y ,1, h, color);
+}
+
+
+/// @brief  Fast virtical line drawing
+/// @param[in] *win: window structure
+/// @param[in] x: X offset
+/// @param[in] y: Y offset
+/// @param[in] w: Width of line
+/// @param[in] color: Color
+/// @return  void
+void tft_drawFastHLine(window *win, int16_t x, int16_t y,
+int16_t w, uint16_t color)
+{
+	// function clips
+	tft_fillRectWH(win, x,y ,w, 1, color);
+}
+
+
+/// ====================================
+/// @brief Span writer
+/// ====================================
+
+/// @brief Start a span writer
+/// Lines drawn with the span writer are collected into horizontal and
+/// vertical runs, each run is one window write
+/// @param[in] *s: span writer
+/// @param[in] win*: window structure
+/// @param[in] color: color to set
+/// @return void
+void tft_span_begin(tft_span_t *s, window *win, uint16_t color)
+{
+	s->win = win;
+	s->color = color;
+	s->pending = 0;
+	s->active = 0;
+	s->sc = -1;
+	s->ec = -1;
+	s->sp = -1;
+	s->ep = -1;
+	s->wdcount = 0;
+	s->mark = NULL;
+	s->skip = NULL;
+}
+
+/// @brief Send a CASET or PASET command only when the cached range can not be used
+/// Writes stop when the run is complete so the range end only has to
+/// cover the run, except across a vertical run where the column end must
+/// equal the start so the address wraps to the next row
+/// @param[in] cmd: 0x2A or 0x2B
+/// @param[in] start: start value
+/// @param[in] end: last value the run writes
+/// @param[in] limit: end value to send, end or the window edge
+/// @param[in,out] *cs: cached start value
+/// @param[in,out] *ce: cached end value
+/// @return void
+static void tft_span_addr(uint8_t cmd, int16_t start, int16_t end, int16_t limit, int16_t *cs, int16_t *ce)
+{
+	uint8_t tmp[4];
+
+	if(start == *cs && (end == limit ? end == *ce : end <= *ce))
+		return;
+	tmp[0] = start >> 8;
+	tmp[1] = start & 0xff;
+	tmp[2] = limit >> 8;
+	tmp[3] = limit & 0xff;
+	tft_spi_TX(&cmd, 1, 1);
+	tft_spi_TX(tmp, 4, 0);
+	*cs = start;
+	*ce = limit;
+}
+
+/// @brief Write the pending run of a span writer
+/// The run is clipped to the window
+/// @param[in] *s: span writer
+/// @return void
+void tft_span_flush(tft_span_t *s)
+{
+	window *win = s->win;
+	int16_t x,y,w,h;
+	int16_t rows;
+	int32_t pixels;
+	uint8_t data[2];
+
+	if(!s->pending)
+		return;
+	s->pending = 0;
+
+	x = s->x0;
+	y = s->y0;
+	w = s->x1 - s->x0 + 1;
+	h = s->y1 - s->y0 + 1;
+	if(!tft_fb_clip(win,&x,&y,&w,&h))
+		return;
+
+	if(win->fb)
+	{
+		tft_fillRectWH(win, x, y, w, h, s->color);
+		return;
+	}
+
+	// Terminal windows wrap in GRAM, write each part as its own run
+	rows = tft_term_rows(win, &y, &h);
+	if(rows < h)
+	{
+		s->x0 = x;
+		s->x1 = x + w - 1;
+		s->y0 = y;
+		s->y1 = y + rows - 1;
+		s->pending = 1;
+		tft_span_flush(s);
+		s->y0 = y + rows;
+		s->y1 = y + h - 1;
+		s->pending = 1;
+		tft_span_flush(s);
+		return;
+	}
+	if(win->flags & VSCROLL)
+		y = (y + win->vsoff) % win->h;
+
+	if(!s->active)
+	{
+		tft_spi_begin();
+		s->active = 1;
+	}
+
+	x += win->x;
+	y += win->y;
+	// Vertical runs need an exact column range, all others can use the window edge
+	if(h > 1)
+		tft_span_addr(0x2A, x, x, x, &s->sc, &s->ec);
+	else
+		tft_span_addr(0x2A, x, x + w - 1, win->x + win->w - 1, &s->sc, &s->ec);
+	tft_span_addr(0x2B, y, y + h - 1, win->y + win->h - 1, &s->sp, &s->ep);
+	tft_Cmd(0x2c);
+
+	pixels = w;
+	pixels *= h;
+	data[0] = s->color >> 8;
+	data[1] = s->color & 0xff;
+	if(pixels == 1)
+		tft_spi_TX(data,2,0);
+	else
+		tft_spi_repeat(data,2,pixels);
+
+	s->wdcount += w + h;
+	if(s->wdcount > 0x3ff)
+	{
+		optimistic_yield(1000);
+		s->wdcount = 0;
+	}
 }
 
-/// @brief  Get font height
-/// @param[in] win*: window structure
-/// return: font Height or zero on error
-int tft_get_font_height(window *win)
+/// @brief Finish a span writer, write any pending run and release the bus
+/// The span writer may be used again, for example after a yield,
+/// other code may then have changed the display window
+/// @param[in] *s: span writer
+/// @return void
+void tft_span_end(tft_span_t *s)
 {
-	int ret;
-    _fontc f;
-    ret = font_attr(win, ' ', &f);
-    if(ret < 0)
-        return 0;
-	return(f.Height);
+	tft_span_flush(s);
+	if(s->active)
+	{
+		tft_spi_end();
+		s->active = 0;
+	}
+	s->sc = -1;
+	s->ec = -1;
+	s->sp = -1;
+	s->ep = -1;
 }
 
-
-/// @brief  Fast virtical line drawing
-/// @param[in] *win: window structure
+/// @brief Add one pixel to a span writer
+/// Pixels that continue the pending horizontal or vertical run extend it,
+/// repeated pixels (line joints) are dropped, anything else starts a new run
+/// With mark or skip bitmaps, one bit per window pixel row by row, pixels
+/// are recorded in mark and pixels already set in skip are not written
+/// @param[in] *s: span writer
 /// @param[in] x: X offset
 /// @param[in] y: Y offset
-/// @param[in] h: Height of line
-/// @param[in] color: Color
-/// @return  void
-void tft_drawFastVLine(window *win,int16_t x, int16_t y,
-int16_t h, uint16_t color)
+/// @return void
+void tft_span_pixel(tft_span_t *s, int16_t x, int16_t y)
 {
-	// function clips
-	tft_fillRectWH(win, x,y ,1, h, color);
-}
+	if(s->mark || s->skip)
+	{
+		int32_t bit;
+		uint8_t mask;
 
+		// Outside pixels are clipped anyway
+		if(x < 0 || y < 0 || x >= s->win->w || y >= s->win->h)
+			return;
+		bit = (int32_t) y * s->win->w + x;
+		mask = 0x80 >> (bit & 7);
+		bit >>= 3;
+		if(s->mark)
+			s->mark[bit] |= mask;
+		if(s->skip && (s->skip[bit] & mask))
+			return;
+	}
 
-/// @brief  Fast virtical line drawing
-/// @param[in] *win: window structure
-/// @param[in] x: X offset
-/// @param[in] y: Y offset
-/// @param[in] w: Width of line
-/// @param[in] color: Color
-/// @return  void
-void tft_drawFastHLine(window *win, int16_t x, int16_t y,
-int16_t w, uint16_t color)
-{
-	// function clips
-	tft_fillRectWH(win, x,y ,w, 1, color);
+	if(s->pending)
+	{
+		// Already drawn
+		if(x >= s->x0 && x <= s->x1 && y >= s->y0 && y <= s->y1)
+			return;
+		// Horizontal run, or a single pixel
+		if(y == s->y0 && y == s->y1)
+		{
+			if(x == s->x1 + 1)
+			{
+				s->x1 = x;
+				return;
+			}
+			if(x == s->x0 - 1)
+			{
+				s->x0 = x;
+				return;
+			}
+		}
+		// Vertical run, or a single pixel
+		if(x == s->x0 && x == s->x1)
+		{
+			if(y == s->y1 + 1)
+			{
+				s->y1 = y;
+				return;
+			}
+			if(y == s->y0 - 1)
+			{
+				s->y0 = y;
+				return;
+			}
+		}
+		tft_span_flush(s);
+	}
+	s->x0 = s->x1 = x;
+	s->y0 = s->y1 = y;
+	s->pending = 1;
 }
 
-
 /// @brief Draw line
 /// From my blit test code testit.c 1984 - 1985 Mike Gore
 /// @param[in] win*: window structure
@@ -1377,20 +2377,16 @@ void tft_drawLine(window *win, int16_t x0, int16_t y0, int16_t x1, int16_t y1, u
 
 #else
 /// @brief Draw line
-/// Draw line from CERTS
+/// Bresenham walk from CERTS, pixels are coalesced into runs by tft_span_pixel
 /// https://github.com/CHERTS/esp8266-devkit/tree/master/Espressif/examples/esp8266_ili9341
-/// @param[in] win*: window structure
+/// @param[in] *s: span writer
 /// @param[in] x0: X Start
 /// @param[in] y0: Y Start
 /// @param[in] x1: X End
 /// @param[in] y1: Y End
-/// @param[in] color: color to set
 /// @return void
-void tft_drawLine(window *win, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+void tft_span_line(tft_span_t *s, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
-
-#define USE_OPTIMIZATION_DRAWLINE
-
     int16_t dx = ABS(x1 - x0);
     int16_t dy = -ABS(y1 - y0);
     int8_t sx = (x0 < x1) ? 1 : -1;
@@ -1398,25 +2394,9 @@ void tft_drawLine(window *win, int16_t x0, int16_t y0, int16_t x1, int16_t y1, u
     int16_t err = dx + dy;
     int16_t e2 = 0;
 
-#ifdef USE_OPTIMIZATION_DRAWLINE
-    uint16_t startX = x0;
-    uint16_t startY = y0;
-#endif
-
     for (;;)
     {
-#ifdef USE_OPTIMIZATION_DRAWLINE
-            // Require correction
-            if ((startX != x0) && (startY != y0)) // draw line and not draw point
-            {
-
-                tft_fillRectXY(win, startX, startY, x0 - sx, y0 - sy, color);
-                startX = x0;
-                startY = y0;
-            }
-#else
-            tft_drawPixel(win, x0, y0, color);
-#endif
+		tft_span_pixel(s, x0, y0);
 
         e2 = 2*err;
         if (e2 >= dy)
@@ -1432,16 +2412,489 @@ void tft_drawLine(window *win, int16_t x0, int16_t y0, int16_t x1, int16_t y1, u
             y0 += sy;
         }
     }
-#ifdef USE_OPTIMIZATION_DRAWLINE
-	// function clips
-    tft_fillRectXY(win, startX, startY, x0, y0, color);
+}
+
+/// @brief Draw line
+/// @param[in] win*: window structure
+/// @param[in] x0: X Start
+/// @param[in] y0: Y Start
+/// @param[in] x1: X End
+/// @param[in] y1: Y End
+/// @param[in] color: color to set
+/// @return void
+void tft_drawLine(window *win, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	tft_span_t s;
+
+	if(win->flags & (AA_BG | AA_READ))
+	{
+		tft_drawLineAA(win, x0, y0, x1, y1, color);
+		return;
+	}
+
+	tft_span_begin(&s, win, color);
+	tft_span_line(&s, x0, y0, x1, y1);
+	tft_span_end(&s);
+}
 #endif
+
+/// @brief Blend two colors
+/// Red, green and blue are spread out in 32 bits and scaled in one multiply
+/// @param[in] fg: color
+/// @param[in] bg: background color
+/// @param[in] alpha: weight of fg, 0 .. 255
+/// @return  color
+uint16_t tft_blend(uint16_t fg, uint16_t bg, uint8_t alpha)
+{
+	uint32_t f, b, a;
+
+	// 5 bit weight, 0 .. 32
+	a = ((uint32_t) alpha + 4) >> 3;
+	f = (fg | ((uint32_t) fg << 16)) & 0x07e0f81fUL;
+	b = (bg | ((uint32_t) bg << 16)) & 0x07e0f81fUL;
+	b = (b + (((f - b) * a) >> 5)) & 0x07e0f81fUL;
+	return((uint16_t) (b | (b >> 16)));
+}
+
+/// @brief Anti-aliased line pixel pairs with one minor axis position
+#define AA_RUN 32
+
+/// @brief Anti-aliased line run
+/// Each step along the major axis covers a pixel pair, the second pixel
+/// is below the first for shallow lines and right of it for steep lines
+typedef struct {
+	window *win;
+	uint16_t color;
+	uint8_t steep;
+	int16_t x;				// first pixel of the run, window relative
+	int16_t y;
+	int16_t n;				// pairs in the run
+	uint8_t cov[AA_RUN];	// coverage of the second pixel, the first has 255 - cov
+} tft_aa_t;
+
+/// @brief Write an anti-aliased line run
+/// The pairs of a run fill a 2 pixel wide rectangle, so pixels next to the
+/// line are never written. The rectangle is read back for AA_READ windows.
+/// @param[in] *a: run
+/// @return void
+static void tft_aa_flush(tft_aa_t *a)
+{
+	uint16_t buf[AA_RUN*2];
+	window *win = a->win;
+	int16_t s, e, lim, side, first, sides, w, h;
+	int i, k;
+	uint8_t alpha;
+
+	if(!a->n)
+		return;
+
+	// Clip the run along the major axis
+	lim = a->steep ? win->h - (a->y) : win->w - (a->x);
+	s = a->steep ? -a->y : -a->x;
+	if(s < 0)
+		s = 0;
+	e = MIN(a->n, lim);
+
+	// Clip the pair, a second pixel without coverage is not written
+	side = a->steep ? a->x : a->y;
+	lim = a->steep ? win->w : win->h;
+	first = (side >= 0 && side < lim) ? 0 : 1;
+	sides = (side + 1 >= 0 && side + 1 < lim) ? 2 : 1;
+	for(i=s;i<e && sides == 2;++i)
+		if(a->cov[i])
+			break;
+	if(i == e)
+		sides = 1;
+	a->n = 0;
+	if(s >= e || first >= sides)
+		return;
+
+	if(a->steep)
+	{
+		w = sides - first;
+		h = e - s;
+	}
+	else
+	{
+		w = e - s;
+		h = sides - first;
+	}
+
+	if(win->flags & AA_READ)
+		tft_readRect(win, a->steep ? a->x + first : a->x + s, a->steep ? a->y + s : a->y + first, w, h, buf);
+
+	for(i=s;i<e;++i)
+	{
+		for(k=first;k<sides;++k)
+		{
+			uint16_t *p = a->steep ? &buf[(i - s) * w + k - first] : &buf[(k - first) * w + i - s];
+
+			alpha = k ? a->cov[i] : 255 - a->cov[i];
+			*p = tft_blend(a->color, (win->flags & AA_READ) ? *p : win->bg, alpha);
+		}
+	}
+
+	tft_writeRect(win, a->steep ? a->x + first : a->x + s, a->steep ? a->y + s : a->y + first, w, h, buf);
+}
+
+/// @brief Draw an anti-aliased line
+/// Xiaolin Wu's line algorithm, two pixels are blended at each step
+/// The line is blended with win->bg, or with the display for AA_READ windows
+/// Runs of pairs with the same minor axis position are written together
+/// @param[in] win*: window structure
+/// @param[in] x0: X Start
+/// @param[in] y0: Y Start
+/// @param[in] x1: X End
+/// @param[in] y1: Y End
+/// @param[in] color: color to set
+/// @return void
+void tft_drawLineAA(window *win, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	tft_aa_t a;
+	int32_t grad, inter;
+	int16_t dx, dy, major, minor, end;
+	int wdcount = 0;
+
+	a.win = win;
+	a.color = color;
+	a.n = 0;
+	a.steep = ABS(y1 - y0) > ABS(x1 - x0);
+	if(a.steep)
+	{
+		SWAP(x0, y0);
+		SWAP(x1, y1);
+	}
+	// Walk in the positive major axis direction
+	if(x0 > x1)
+	{
+		SWAP(x0, x1);
+		SWAP(y0, y1);
+	}
+	dx = x1 - x0;
+	dy = y1 - y0;
+
+	// Minor axis position in 16.16 fixed point
+	grad = dx ? ((int32_t) dy << 16) / dx : 0;
+	inter = (int32_t) y0 << 16;
+
+	for(major = x0, end = x1; major <= end; ++major, inter += grad)
+	{
+		minor = inter >> 16;
+		if(a.n && (a.n == AA_RUN || minor != (a.steep ? a.x : a.y)))
+			tft_aa_flush(&a);
+		if(!a.n)
+		{
+			a.x = a.steep ? minor : major;
+			a.y = a.steep ? major : minor;
+		}
+		a.cov[a.n++] = (inter >> 8) & 0xff;
+
+		if(++wdcount >= 0x3ff)
+		{
+			optimistic_yield(1000);
+			wdcount = 0;
+		}
+	}
+	tft_aa_flush(&a);
+}
+
+/// @brief Select how a window draws lines
+/// tft_drawLine(), tft_drawPolyLine(), the Bezier curves and drawSVG()
+/// outlines all follow the mode
+/// A line drawn over win->bg is erased exactly by drawing it in win->bg
+/// with AA_BG, blending with the display again would leave a trace
+/// @param[in] win*: window structure
+/// @param[in] mode: 0 for aliased lines, AA_BG when the lines are drawn
+///  over win->bg, AA_READ to blend with the display contents
+/// @return void
+MEMSPACE
+void tft_antialias(window *win, int mode)
+{
+	win->flags &= ~(AA_BG | AA_READ);
+	win->flags |= mode & (AA_BG | AA_READ);
+}
+
+/// @brief Draw connected lines through a list of points
+/// All lines share one chip select and one span writer so runs merge
+/// across the joints and unchanged CASET/PASET values are not resent
+/// @param[in] win*: window structure
+/// @param[in] *pts: points
+/// @param[in] count: number of points
+/// @param[in] color: color to set
+/// @return void
+void tft_drawPolyLine(window *win, p2_int16_t *pts, int count, uint16_t color)
+{
+	int i;
+	tft_span_t s;
+
+	if(count < 1)
+		return;
+
+	if(win->flags & (AA_BG | AA_READ))
+	{
+		if(count == 1)
+			tft_drawLineAA(win, pts[0].X, pts[0].Y, pts[0].X, pts[0].Y, color);
+		for(i=1;i<count;++i)
+			tft_drawLineAA(win, pts[i-1].X, pts[i-1].Y, pts[i].X, pts[i].Y, color);
+		return;
+	}
+
+	tft_span_begin(&s, win, color);
+	if(count == 1)
+		tft_span_pixel(&s, pts[0].X, pts[0].Y);
+	for(i=1;i<count;++i)
+		tft_span_line(&s, pts[i-1].X, pts[i-1].Y, pts[i].X, pts[i].Y);
+	tft_span_end(&s);
 }
+
+/// @brief Polygon fill edges on the stack, larger polygons are rejected
+#ifndef POLY_EDGES
+#define POLY_EDGES 64
 #endif
+
+/// @brief Polygon fill edge
+/// x on the current row is x + num/den, stepped exactly by q + r/den per row
+typedef struct {
+	int16_t ystart;		// first row, clipped to the window
+	int16_t ymax;		// rows ystart .. ymax-1
+	int16_t x;
+	int16_t num;		// 0 .. den-1
+	int16_t den;		// edge height
+	int16_t q;
+	int16_t r;			// 0 .. den-1
+} tft_edge_t;
+
+/// @brief Floor division for a positive divisor
+/// @param[in] n: numerator
+/// @param[in] d: divisor, > 0
+/// @param[out] *rem: remainder, 0 .. d-1
+/// @return  floor(n/d)
+static int32_t tft_floordiv(int32_t n, int32_t d, int32_t *rem)
+{
+	int32_t q = n / d;
+	int32_t m = n - q * d;
+
+	if(m < 0)
+	{
+		--q;
+		m += d;
+	}
+	*rem = m;
+	return(q);
+}
+
+/// @brief First pixel at or right of an edge on the current row
+/// @param[in] *e: edge
+/// @return  ceil(x)
+static int16_t tft_edge_ceil(tft_edge_t *e)
+{
+	return(e->x + (e->num > 0));
+}
+
+/// @brief Fill a polygon with horizontal spans
+/// Edge table scanline fill with the even-odd rule and exact integer edge
+/// stepping. A pixel is filled when its center is inside, pixels on the
+/// right and bottom edges belong to the neighbouring shape so polygons that
+/// share edges, such as the faces of a mesh, are drawn without overlap.
+/// Each span is one run of a span writer, inside one chip select.
+/// @param[in] win*: window structure
+/// @param[in] *pts: vertices, the polygon is closed from the last to the first
+/// @param[in] count: number of vertices, up to POLY_EDGES
+/// @param[in] color: fill color
+/// @return  0 on success, -1 if there are too many vertices
+int tft_fillPolygon(window *win, p2_int16_t *pts, int count, uint16_t color)
+{
+	tft_edge_t e[POLY_EDGES];
+	tft_edge_t tmp;
+	uint8_t act[POLY_EDGES];
+	int n, na, next, i, j;
+	int16_t y, yend, x0, y0, x1, y1;
+	int32_t q, rem;
+	tft_span_t s;
+
+	if(count > POLY_EDGES)
+		return(-1);
+
+	// Edge table, edges of no height and outside the window are dropped
+	n = 0;
+	yend = 0;
+	for(i = 0; i < count; ++i)
+	{
+		x0 = pts[i].X;
+		y0 = pts[i].Y;
+		j = (i + 1 < count) ? i + 1 : 0;
+		x1 = pts[j].X;
+		y1 = pts[j].Y;
+		if(y0 == y1)
+			continue;
+		if(y0 > y1)
+		{
+			SWAP(x0, x1);
+			SWAP(y0, y1);
+		}
+		if(y1 <= 0 || y0 >= win->h)
+			continue;
+
+		e[n].ystart = (y0 < 0) ? 0 : y0;
+		e[n].ymax = (y1 > win->h) ? win->h : y1;
+		e[n].den = y1 - y0;
+		q = tft_floordiv(x1 - x0, e[n].den, &rem);
+		e[n].q = q;
+		e[n].r = rem;
+		q = tft_floordiv((int32_t) (e[n].ystart - y0) * (x1 - x0), e[n].den, &rem);
+		e[n].x = x0 + q;
+		e[n].num = rem;
+		if(e[n].ymax > yend)
+			yend = e[n].ymax;
+
+		// Keep the table sorted by first row
+		for(j = n; j > 0 && e[j-1].ystart > e[j].ystart; --j)
+		{
+			tmp = e[j];
+			e[j] = e[j-1];
+			e[j-1] = tmp;
+		}
+		++n;
+	}
+	if(n < 2)
+		return(0);
+
+	tft_span_begin(&s, win, color);
+	na = 0;
+	next = 0;
+	for(y = e[0].ystart; y < yend; ++y)
+	{
+		// Active edge table: add edges starting on this row, drop finished ones
+		while(next < n && e[next].ystart == y)
+			act[na++] = next++;
+		for(i = 0, j = 0; i < na; ++i)
+		{
+			if(e[act[i]].ymax > y)
+				act[j++] = act[i];
+		}
+		na = j;
+
+		// Sort by x, the order changes only where edges cross
+		for(i = 1; i < na; ++i)
+		{
+			uint8_t k = act[i];
+			int16_t xk = tft_edge_ceil(&e[k]);
+
+			for(j = i; j > 0 && tft_edge_ceil(&e[act[j-1]]) > xk; --j)
+				act[j] = act[j-1];
+			act[j] = k;
+		}
+
+		for(i = 0; i + 1 < na; i += 2)
+		{
+			x0 = tft_edge_ceil(&e[act[i]]);
+			x1 = tft_edge_ceil(&e[act[i+1]]) - 1;
+			if(x0 <= x1)
+				tft_span_line(&s, x0, y, x1, y);
+		}
+
+		for(i = 0; i < na; ++i)
+		{
+			tft_edge_t *p = &e[act[i]];
+
+			p->x += p->q;
+			p->num += p->r;
+			if(p->num >= p->den)
+			{
+				p->x++;
+				p->num -= p->den;
+			}
+		}
+	}
+	tft_span_end(&s);
+	return(0);
+}
+
 ///  ====================================
 /// Interpolation functions
 ///  ====================================
 
+/// @brief Most line segments along one Bezier curve, 2 ** BEZIER_SHIFT
+#define BEZIER_SHIFT 6
+
+/// @brief Draw a Bezier curve given as a polynomial
+/// 	B(t) = a*t*t*t + b*t*t + c*t + S, 0 <= t <= 1
+/// Points are found with forward differences at t = i / n, n = 2 ** k
+/// Differences are kept in units of 1 / (n*n*n) pixels, which makes them
+/// exact integers, so no error builds up along the curve
+/// The points are drawn as one polyline
+/// @param[in] *win: Window Structure of active window
+/// @param[in] S: Start
+/// @param[in] a: t*t*t coefficients
+/// @param[in] b: t*t coefficients
+/// @param[in] c: t coefficients
+/// @param[in] k: log2 of the line segments
+/// @param[in] color: Line color
+/// @return  count of line segments
+static int tft_bezier_poly(window *win, p2_int16_t S, int32_t *a, int32_t *b, int32_t *c, int k, uint16_t color)
+{
+	p2_int16_t pts[(1 << BEZIER_SHIFT) + 1];
+	int32_t P[2], D1[2], D2[2], D3[2];
+	int32_t half = (1L << (3 * k)) >> 1;
+	int n = 1 << k;
+	int i, j, count;
+
+	for(j=0;j<2;++j)
+	{
+		P[j] = 0;
+		D1[j] = a[j] + (b[j] << k) + (c[j] << (2 * k));
+		D2[j] = 6 * a[j] + (b[j] << (k + 1));
+		D3[j] = 6 * a[j];
+	}
+
+	pts[0] = S;
+	count = 1;
+	for(i=1;i<=n;++i)
+	{
+		for(j=0;j<2;++j)
+		{
+			P[j] += D1[j];
+			D1[j] += D2[j];
+			D2[j] += D3[j];
+		}
+		pts[count].X = S.X + ((P[0] + half) >> (3 * k));
+		pts[count].Y = S.Y + ((P[1] + half) >> (3 * k));
+		// Do not plot a line until we actually move
+		if(pts[count].X != pts[count-1].X || pts[count].Y != pts[count-1].Y)
+			++count;
+	}
+	tft_drawPolyLine(win, pts, count, color);
+	return(count - 1);
+}
+
+/// @brief Line segments for a Bezier curve, as log2
+/// The flatness bound of Wang: with n segments no point of the polyline
+/// is further than d*(d-1)/8 * M / (n*n) from the curve, d is the degree and
+/// M is the largest second difference of the control points
+/// We use half a pixel. Segments are not made shorter than about two
+/// pixels along the control polygon.
+/// @param[in] M8: d*(d-1) * M, in pixels
+/// @param[in] len: control polygon length
+/// @param[in] extent: largest control point offset from the start
+/// @param[in] steps: most line segments, 0 for no limit
+/// @return  log2 of the line segments
+static int tft_bezier_steps(int32_t M8, int32_t len, int32_t extent, int steps)
+{
+	int k = 0;
+
+	// d*(d-1)/8 * M / (n*n) <= 1/2
+	while(k < BEZIER_SHIFT && (4L << (2 * k)) < M8)
+		++k;
+	while(k > 0 && (2L << k) > len)
+		--k;
+	while(k > 0 && steps > 0 && (1 << k) > steps)
+		--k;
+	// Positions in units of 1 / (n*n*n) pixels fit in 32 bits
+	while(k > 0 && (extent << (3 * k)) >= (1L << 28))
+		--k;
+	return(k);
+}
+
 /**
    @brief Draw lines between points along Quadratic Bézier curve
    Quadratic Bézier with respect to t, see https://en.wikipedia.org/wiki/Bézier_curve
@@ -1466,48 +2919,33 @@ void tft_drawLine(window *win, int16_t x0, int16_t y0, int16_t x1, int16_t y1, u
    @param[in] S: Start 
    @param[in] C: Control 
    @param[in] T: Target 
-   @param[in] steps: line segments along curve (1..N) 
+   The curve is drawn as a polyline with forward differences in integer
+   arithmetic, the segments are picked so the polyline is within half a
+   pixel of the curve, see tft_bezier_steps()
+
+   @param[in] steps: most line segments along curve, 0 for no limit
    @param[in] color: Line color
    @return  count of line segments
 */
 
 int tft_Bezier2(window *win, p2_int16_t S, p2_int16_t C, p2_int16_t T, int steps, uint16_t color)
 {
-	float t, tinc, t1,p1,p2,p3;
-	p2_int16_t Last,Point;
-	int16_t X,Y;
-	int ind = 0;
-	int i;
-
-	Last = S;
-	t = 0;
-
-	if(steps < 1)
-		steps = 1;
-
-	// FIXME we should compute a step size based on the start to end point distances
-	tinc = 1.0 / (float) steps;	// steps = 1 will just draw one line
-
-	// Quadratic Bezier http://en.wikipedia.org/wiki/Bézier_curve
-	// B(t) = (1-t)(1-t)S + 2(1-t)tC + t*tT, 0 <= t <= 1
-	for (i = 0; i < steps; ++i)
-	{
-		t += tinc;
-
-		t1 = (1.0 - t);
-		p1 = t1 * t1;		/* (1.0 - t) (1.0 - t) */
-		p2 = 2.0 * t1 * t;  /* 2(1.0 - t) * t */
-		p3 = t * t;			/* t * t */
-
-		Point.X = (int16_t) (p1 * (float)S.X + p2 * (float)C.X + p3 * (float)T.X);
-		Point.Y = (int16_t) (p1 * (float)S.Y + p2 * (float)C.Y + p3 * (float)T.Y);
-		// Do not plot a line until we actually move
-		if(Last.X == Point.X && Last.Y == Point.Y)
-			continue;
-		tft_drawLine(win, Last.X, Last.Y, Point.X, Point.Y, color);
-		Last = Point;
-	}
-	return(ind);
+	int32_t a[2], b[2], c[2];
+	int32_t M8, len, extent;
+
+	// B(t) = (S - 2C + T)t*t + 2(C - S)t + S, no t*t*t term
+	a[0] = 0;
+	a[1] = 0;
+	b[0] = (int32_t) S.X - 2 * C.X + T.X;
+	b[1] = (int32_t) S.Y - 2 * C.Y + T.Y;
+	c[0] = 2 * ((int32_t) C.X - S.X);
+	c[1] = 2 * ((int32_t) C.Y - S.Y);
+
+	M8 = 2 * MAX(ABS(b[0]), ABS(b[1]));
+	len = MAX(ABS(C.X - S.X), ABS(C.Y - S.Y)) + MAX(ABS(T.X - C.X), ABS(T.Y - C.Y));
+	extent = MAX(MAX(ABS(C.X - S.X), ABS(C.Y - S.Y)), MAX(ABS(T.X - S.X), ABS(T.Y - S.Y)));
+
+	return(tft_bezier_poly(win, S, a, b, c, tft_bezier_steps(M8, len, extent, steps), color));
 }
 
 /**
@@ -1537,56 +2975,43 @@ int tft_Bezier2(window *win, p2_int16_t S, p2_int16_t C, p2_int16_t T, int steps
    @param[in] C1: Control 1 
    @param[in] C2: Control 2 
    @param[in] T: Target 
-   @param[in] steps: line segments along curve (1..N) 
+   The curve is drawn as a polyline with forward differences in integer
+   arithmetic, the segments are picked so the polyline is within half a
+   pixel of the curve, see tft_bezier_steps()
+
+   @param[in] steps: most line segments along curve, 0 for no limit
    @param[in] color: Line color
    @return  count of line segments
 */
 
 int tft_Bezier3(window *win, p2_int16_t S, p2_int16_t C1, p2_int16_t C2, p2_int16_t T, int steps, uint16_t color)
 {
-	float t, tinc, c0, t1,t2,p1,p2,p3,p4;
-	p2_int16_t Last,Point;
-	int16_t X,Y;
-	int i;
-	int ind;
-
-	Last = S;
-
-	if(steps < 1)
-		steps = 1;
-
-	ind = 0;
-
-	t = 0;
-	// FXIME we should compute a step size based on the start to end point distances
-	tinc = 1.0 / (float) steps;	// steps = 1 will just draw one line
-
-	// Quadratic Bezier http://en.wikipedia.org/wiki/Bézier_curve
-	// B(t) = (1-t)(1-t)*(1-t)*S + 3*(1-t)(1-t)*t*C1  + 3(1-t)*t*t*C2 + t*t*t*T, 0 <= t <= 1
-	for (i = 0; i < steps; ++i)
+	int32_t a[2], b[2], c[2];
+	int32_t d1[2], d2[2];
+	int32_t M8, len, extent;
+	int j;
+	int32_t s[2] = { S.X, S.Y };
+	int32_t c1[2] = { C1.X, C1.Y };
+	int32_t c2[2] = { C2.X, C2.Y };
+	int32_t t[2] = { T.X, T.Y };
+
+	// B(t) = (T - 3C2 + 3C1 - S)t*t*t + 3(C2 - 2C1 + S)t*t + 3(C1 - S)t + S
+	for(j=0;j<2;++j)
 	{
-		t += tinc;
-		t1 = (1.0 - t);
-		t2 = t1 * t1;		/* (1-t)(1-t) */
-
-		c0 = 3.0 * t1 * t;	/* 3(1-t) * t */
-
-		p1 = t2 * t1;		/* (1-t)(1-t)(1-t) */
-		p2 = c0 * t1;       /* 3(1-t)(1-t) * t */
-		p3 = c0 * t;		/* 3(1-t) * t * t */
-		p4 = t * t * t;		/* t * t * t */
+		a[j] = t[j] - 3 * c2[j] + 3 * c1[j] - s[j];
+		b[j] = 3 * (c2[j] - 2 * c1[j] + s[j]);
+		c[j] = 3 * (c1[j] - s[j]);
+		d1[j] = ABS(s[j] - 2 * c1[j] + c2[j]);
+		d2[j] = ABS(c1[j] - 2 * c2[j] + t[j]);
+	}
 
-		Point.X = (int16_t) (p1 * (float)S.X + p2 * (float)C1.X + p3 * (float) C2.X + p4 * (float)T.X);
-		Point.Y = (int16_t) (p3 * (float)S.Y + p2 * (float)C1.Y + p3 * (float) C2.Y + p4 * (float)T.Y);
+	M8 = 6 * MAX(MAX(d1[0], d1[1]), MAX(d2[0], d2[1]));
+	len = MAX(ABS(C1.X - S.X), ABS(C1.Y - S.Y)) + MAX(ABS(C2.X - C1.X), ABS(C2.Y - C1.Y))
+		+ MAX(ABS(T.X - C2.X), ABS(T.Y - C2.Y));
+	extent = MAX(MAX(ABS(C1.X - S.X), ABS(C1.Y - S.Y)), MAX(ABS(C2.X - S.X), ABS(C2.Y - S.Y)));
+	extent = MAX(extent, MAX(ABS(T.X - S.X), ABS(T.Y - S.Y)));
 
-		// Do not plot a line until we actually move
-		if(Last.X == X && Last.Y == Y)
-			continue;
-		tft_drawLine(win, Last.X, Last.Y, X, Y, color);
-		Last = Point;
-		++ind;
-	}
-	return(ind);
+	return(tft_bezier_poly(win, S, a, b, c, tft_bezier_steps(M8, len, extent, steps), color));
 }
 
 
@@ -1681,6 +3106,9 @@ void tft_putch(window *win, int c)
 	}
 	if(c == '\f')
 	{
+		// A cleared terminal window can start again from the top
+		if(win->flags & VSCROLL)
+			tft_term_vsp(win, 0);
 		tft_fillWin(win,win->bg);
 		win->xpos = 0;
 		win->ypos = 0;
@@ -31,6 +31,17 @@
 #ifndef _ILI9341_H_
 #define _ILI9341_H_
 
+///@brief Rectangle - window relative
+typedef struct {
+	int16_t x;
+	int16_t y;
+	int16_t w;
+	int16_t h;
+} rect_int16_t;
+
+///@brief Dirty rectangles kept for an off-screen frame buffer window
+#define FB_DIRTY 4
+
 typedef struct
 {
     int16_t xpos;       // x pos
@@ -45,8 +56,28 @@ typedef struct
     uint16_t bg;
     uint8_t rotation;
 	uint8_t tabstop;
+	void *fb;			// off-screen frame buffer, NULL draws to the display
+	uint16_t *palette;	// 8 bit frame buffer palette, NULL for RGB565
+	uint16_t colors;	// palette size
+	uint8_t dirty;		// dirty rectangles in use
+	rect_int16_t rect[FB_DIRTY]; // dirty rectangles
+	int16_t vsoff;		// hardware scroll offset of a terminal window, rows
 } window;
 
+///@brief Span writer - coalesces line pixels into horizontal and vertical runs
+/// Runs are written inside one chip select with the display window cached
+typedef struct {
+	window *win;
+	uint16_t color;
+	uint8_t pending;		// a run is pending
+	uint8_t active;			// chip select is asserted
+	int16_t x0,y0,x1,y1;	// pending run, window relative, inclusive
+	int16_t sc,ec,sp,ep;	// last CASET and PASET sent, -1 when unknown
+	int wdcount;
+	uint8_t *mark;			// optional window bitmap, pixels drawn are set
+	uint8_t *skip;			// optional window bitmap, pixels set are not drawn
+} tft_span_t;
+
 ///@brief 2D display point - display coordinates are int16
 typedef struct {
 	int16_t X;
@@ -79,6 +110,14 @@ typedef struct {
 #define WRAP_H	   2
 #define WRAP_V	   4
 #define WRAP	   (WRAP_H | WRAP_V)
+// Frame buffer was allocated by tft_fb_init
+#define FB_ALLOC   8
+// Terminal window scrolled by the panel, see tft_term_init()
+#define VSCROLL    16
+// Anti-aliased lines blended with win->bg, see tft_antialias()
+#define AA_BG      32
+// Anti-aliased lines blended with pixels read from the display
+#define AA_READ    64
 
 #define TFT_W (MAX_TFT_X-MIN_TFT_X+1)
 #define TFT_H (MAX_TFT_Y-MIN_TFT_Y+1)
@@ -94,6 +133,12 @@ typedef struct {
 
 #define SWAP(a, b) do { a ^= b; b ^= a; a ^= b; } while(0)
 #define ABS(x) ((x)<0 ? -(x) : (x))
+#ifndef MIN
+#define MIN(a,b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a,b) ((a) > (b) ? (a) : (b))
+#endif
 
 // ============================================================
 
@@ -102,11 +147,18 @@ int font_max ( void );
 int font_H ( int font );
 int font_W ( int font );
 int font_attr ( window *win , int c , _fontc *f );
+MEMSPACE void font_cache_flush ( void );
+MEMSPACE void font_cache_print ( void );
+void tft_drawChar ( window *win , uint8_t c );
+void tft_drawString ( window *win , char *str );
 
 // ============================================================
 /* vfont.c */
-int16_t sx ( float scale , int16_t xoff , int16_t X );
-int16_t sy ( float scale , int16_t yoff , int16_t Y );
+MEMSPACE void vfont_cache_flush ( void );
+MEMSPACE void vfont_cache_print ( void );
+int vfont_height ( float scale );
+int vfont_width ( char *str , float scale );
+int vfont_drawString ( window *win , int16_t x , int16_t y , char *str , float scale );
 void drawSVG ( window *win , int16_t x , int16_t y , int16_t c , float scale , uint16_t color, int16_t fill );
 
 // ============================================================
@@ -117,14 +169,20 @@ uint8_t tft_Data ( uint8_t data );
 void tft_Cmd_Data_TX ( uint8_t cmd , uint8_t *data , int bytes );
 int32_t tft_abs_window ( window *win , int16_t x , int16_t y , int16_t w , int16_t h );
 int32_t tft_rel_window ( window *win , int16_t x , int16_t y , int16_t w , int16_t h );
+MEMSPACE int tft_term_init ( window *win );
+MEMSPACE void tft_term_end ( window *win );
+int16_t tft_term_rows ( window *win , int16_t *y , int16_t *h );
+MEMSPACE int tft_fb_init ( window *win , void *fb , uint16_t *palette , int colors );
+MEMSPACE void tft_fb_free ( window *win );
+int tft_fb_clip ( window *win , int16_t *x , int16_t *y , int16_t *w , int16_t *h );
+void tft_fb_dirty ( window *win , int16_t x , int16_t y , int16_t w , int16_t h );
+void tft_flush ( window *win );
 MEMSPACE uint32_t tft_readRegister ( uint8_t command , uint8_t parameter );
 MEMSPACE uint32_t tft_readId ( void );
 void tft_bit_blit ( window *win , uint8_t *ptr , int16_t x , int16_t y , int16_t w , int16_t h );
 void tft_fillWin ( window *win , uint16_t color );
 void tft_flood ( window *win , int16_t x , int16_t y , uint16_t border , uint16_t fill );
-int tft_push_xy ( int16_t x , int16_t y );
-int tft_pop_xy ( int16_t *x , int16_t *y );
-int tft_floodline ( window *win , int16_t x , int16_t y , uint16_t border , uint16_t fill );
+int32_t tft_floodline ( window *win , int16_t x , int16_t y , uint16_t border , uint16_t fill );
 int tft_FillPolyLine ( window *win , int16_t x , int16_t y , int w , uint16_t color );
 void tft_fillRectWH ( window *win , int16_t x , int16_t y , int16_t w , int16_t h , uint16_t color );
 void tft_fillRectXY ( window *win , int16_t x , int16_t y , int16_t xl , int16_t yl , uint16_t color );
@@ -149,7 +207,17 @@ MEMSPACE void tft_font_var ( window *win );
 int tft_get_font_height ( window *win );
 void tft_drawFastVLine ( window *win , int16_t x , int16_t y , int16_t h , uint16_t color );
 void tft_drawFastHLine ( window *win , int16_t x , int16_t y , int16_t w , uint16_t color );
+void tft_span_begin ( tft_span_t *s , window *win , uint16_t color );
+void tft_span_flush ( tft_span_t *s );
+void tft_span_end ( tft_span_t *s );
+void tft_span_pixel ( tft_span_t *s , int16_t x , int16_t y );
+void tft_span_line ( tft_span_t *s , int16_t x0 , int16_t y0 , int16_t x1 , int16_t y1 );
 void tft_drawLine ( window *win , int16_t x0 , int16_t y0 , int16_t x1 , int16_t y1 , uint16_t color );
+uint16_t tft_blend ( uint16_t fg , uint16_t bg , uint8_t alpha );
+void tft_drawLineAA ( window *win , int16_t x0 , int16_t y0 , int16_t x1 , int16_t y1 , uint16_t color );
+MEMSPACE void tft_antialias ( window *win , int mode );
+void tft_drawPolyLine ( window *win , p2_int16_t *pts , int count , uint16_t color );
+int tft_fillPolygon ( window *win , p2_int16_t *pts , int count , uint16_t color );
 int tft_Bezier2 ( window *win , p2_int16_t S , p2_int16_t C , p2_int16_t T , int steps , uint16_t color );
 int tft_Bezier3 ( window *win , p2_int16_t S , p2_int16_t C1 , p2_int16_t C2 , p2_int16_t T , int steps , uint16_t color );
 MEMSPACE void tft_cleareol ( window *win );
@@ -166,6 +234,8 @@ void tft_reset_enable ( void );
 void tft_addr_init ( void );
 void tft_reset_disable ( void );
 void tft_spi_TX ( uint8_t *data , int bytes , uint8_t command );
+void tft_spi_TX_stream ( hspi_fill_t fill , void *arg );
+void tft_spi_repeat ( uint8_t *pattern , int bytes , int32_t count );
 void tft_spi_TXRX ( uint8_t *data , int bytes , uint8_t command );
 void tft_spi_RX ( uint8_t *data , int bytes , uint8_t command );
 MEMSPACE window *tft_init ( void );
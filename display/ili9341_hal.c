@@ -141,6 +141,31 @@ void tft_spi_TX(uint8_t *data, int bytes, uint8_t command)
 	spi_TX_buffer(data,bytes);
 }
 
+/// @brief  Transmit a data stream, the next chunk is prepared while the last is sent
+/// @see hspi_TX_stream
+/// @param[in] fill: fills up to HSPI_HALF_SIZE bytes, returns 0 when done
+/// @param[in] *arg: argument passed to fill
+/// return: void 
+void tft_spi_TX_stream(hspi_fill_t fill, void *arg)
+{
+	spi_waitReady();
+	TFT_DATA;
+	spi_TX_stream(fill, arg);
+}
+
+/// @brief  Transmit a data pattern count times, the FIFO is only loaded once
+/// @see hspi_TX_repeat
+/// @param[in] *pattern: pattern to send
+/// @param[in] bytes: pattern size 1 .. HSPI_FIFO_SIZE
+/// @param[in] count: number of times to send the pattern
+/// return: void 
+void tft_spi_repeat(uint8_t *pattern, int bytes, int32_t count)
+{
+	spi_waitReady();
+	TFT_DATA;
+	spi_TX_repeat(pattern, bytes, count);
+}
+
 /// @brief  Transmit and read 8 bit data array 
 /// @param[in] *data: data buffer to send 
 /// @param[in] bytes: data buffer size
@@ -31,19 +31,41 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "display/tft_printf.h"
 #include "printf/mathio.h"
 
-static void _putc_win(struct _printf_t *p, char ch)
+/// @brief Characters buffered by tft_printf before they are drawn
+#define TFT_PRINTF_RUN 64
+
+/// @brief tft_printf output buffer
+typedef struct
 {
-	p->sent++;
-	tft_putch((window *) p->buffer, ch);
+	window *win;
+	int ind;
+	char buf[TFT_PRINTF_RUN+1];
+} _tft_printf_buf;
+
+/// @brief Draw the buffered tft_printf output
+/// @param[in] *b: output buffer
+/// @return  void
+static void _flush_win(_tft_printf_buf *b)
+{
+	if(!b->ind)
+		return;
+	b->buf[b->ind] = 0;
+	tft_drawString(b->win, b->buf);
+	b->ind = 0;
 }
 
-static void _putc_win_len(struct _printf_t *p, char ch)
+static void _putc_win(struct _printf_t *p, char ch)
 {
+	_tft_printf_buf *b = (_tft_printf_buf *) p->buffer;
+
 	p->sent++;
-	tft_putch((window *) p->buffer, ch);
+	b->buf[b->ind++] = ch;
+	if(b->ind >= TFT_PRINTF_RUN)
+		_flush_win(b);
 }
 
 /// @brief tft_printf function
+/// Output is buffered so whole lines are drawn with tft_drawString
 /// @param[in] *win: Window Structure
 /// @param[in] fmt: printf forat string
 /// @param[in] ...: vararg list or arguments
@@ -51,12 +73,15 @@ static void _putc_win_len(struct _printf_t *p, char ch)
 MEMSPACE
 int tft_printf(window *win, const char *fmt, ... )
 {
-	_fontc f;
     printf_t fn;
+	_tft_printf_buf b;
+
+	b.win = win;
+	b.ind = 0;
 
     fn.put = _putc_win;
     fn.sent = 0;
-    fn.buffer = (void *) win;
+    fn.buffer = (void *) &b;
 
     va_list va;
     va_start(va, fmt);
@@ -65,8 +90,8 @@ int tft_printf(window *win, const char *fmt, ... )
 
     va_end(va);
 
+	_flush_win(&b);
+
 	return(fn.sent);
 
 }
-
-
@@ -43,47 +43,549 @@
 #include "display/vfont.h"
 #include "display/vfonts.h"
 
-#define BEZIER_STEPS 10
+/// @brief Outline cache, most recently used first
+static _vfont_cache_t *vfont_cache_list = NULL;
+/// @brief Outline cache statistics
+_vfont_cache_stats vfont_cache;
 
-void drawSVG(window *win, int16_t x, int16_t y, int16_t c, float scale, uint16_t color, int16_t fill) 
+/// @brief Font ascent and descent in font units, found on first use
+static int16_t vfont_ascent = -1;
+static int16_t vfont_descent = 0;
+
+/// @brief Outline being flattened
+typedef struct {
+	_vfont_edge_t *edge;    /* NULL to count edges only */
+	int count;
+	int16_t ymin, ymax;
+} _vfont_path_t;
+
+/// @brief Add an outline edge, horizontal edges never cross a sample row
+/// @param[in] *p: outline
+/// @param[in] x0: start X, 1/16 pixels
+/// @param[in] y0: start Y
+/// @param[in] x1: end X
+/// @param[in] y1: end Y
+/// @return void
+static void vfont_edge(_vfont_path_t *p, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+	_vfont_edge_t *e;
+	int8_t dir = 1;
+
+	if(y0 == y1)
+		return;
+	if(y0 > y1)
+	{
+		SWAP(x0, x1);
+		SWAP(y0, y1);
+		dir = -1;
+	}
+	if(p->edge)
+	{
+		e = &p->edge[p->count];
+		e->x0 = x0;
+		e->y0 = y0;
+		e->y1 = y1;
+		e->dir = dir;
+		e->dxdy = ((x1 - x0) * 65536) / (y1 - y0);
+	}
+	p->ymin = MIN(p->ymin, y0);
+	p->ymax = MAX(p->ymax, y1);
+	p->count++;
+}
+
+/// @brief Flatten a quadratic Bezier into edges
+/// Forward differences in units of 1 / (n*n), n = 2 ** k, are exact
+/// Segments are picked so the edges are within 1/4 pixel of the curve
+/// @param[in] *p: outline
+/// @param[in] *S: start, 1/16 pixels
+/// @param[in] *C: control
+/// @param[in] *T: target
+/// @return void
+static void vfont_quad(_vfont_path_t *p, int32_t *S, int32_t *C, int32_t *T)
+{
+	int32_t b[2], D1[2], P[2], L[2];
+	int32_t M, half;
+	int i, j, k, n;
+
+	for(j=0;j<2;++j)
+		b[j] = S[j] - 2 * C[j] + T[j];
+	// Wang: error <= M / (4*n*n), 4 is 1/4 pixel
+	M = MAX(ABS(b[0]), ABS(b[1]));
+	for(k=0;k<5 && (16L << (2 * k)) < M;++k)
+		;
+	n = 1 << k;
+	half = (1L << (2 * k)) >> 1;
+
+	for(j=0;j<2;++j)
+	{
+		P[j] = 0;
+		D1[j] = b[j] + ((2 * (C[j] - S[j])) << k);
+		L[j] = S[j];
+	}
+	for(i=1;i<=n;++i)
+	{
+		int32_t X, Y;
+
+		for(j=0;j<2;++j)
+		{
+			P[j] += D1[j];
+			D1[j] += 2 * b[j];
+		}
+		X = S[0] + ((P[0] + half) >> (2 * k));
+		Y = S[1] + ((P[1] + half) >> (2 * k));
+		vfont_edge(p, L[0], L[1], X, Y);
+		L[0] = X;
+		L[1] = Y;
+	}
+}
+
+/// @brief Flatten a glyph outline to edges
+/// The M, L, Q, Z and '.' commands of drawSVG() are used, contours are
+/// closed by the next M and at the end
+/// @param[in] *g: glyph
+/// @param[in] scale: pixels per font unit
+/// @param[in,out] *p: outline, p->edge NULL counts the edges only
+/// @return void
+static void vfont_flatten(path_t *g, float scale, _vfont_path_t *p)
 {
+	int32_t start[2], cur[2], ctl[2], pt[2];
+	int16_t *v = g->v;
+	float s = scale * 16;
+	int ind = 0;
+	char t;
 
+	p->count = 0;
+	p->ymin = 0;
+	p->ymax = 0;
+	cur[0] = start[0] = pt[0] = ctl[0] = 0;
+	cur[1] = start[1] = pt[1] = ctl[1] = 0;
+	while(1)
+	{
+		t = v[ind];
+		if(t == 'M' || t == 'Z' || t == '.')
+		{
+			vfont_edge(p, cur[0], cur[1], start[0], start[1]);
+			cur[0] = start[0];
+			cur[1] = start[1];
+		}
+		if(t == 'M' || t == 'L' || t == 'Q')
+		{
+			// Last point of the command, Y from the baseline
+			pt[0] = s * v[ind + ((t == 'Q') ? 3 : 1)];
+			pt[1] = s * (v[ind + ((t == 'Q') ? 4 : 2)] - g->h);
+		}
+		if(t == 'M')
+		{
+			start[0] = cur[0] = pt[0];
+			start[1] = cur[1] = pt[1];
+			ind += 3;
+		}
+		else if(t == 'L')
+		{
+			vfont_edge(p, cur[0], cur[1], pt[0], pt[1]);
+			cur[0] = pt[0];
+			cur[1] = pt[1];
+			ind += 3;
+		}
+		else if(t == 'Q')
+		{
+			ctl[0] = s * v[ind + 1];
+			ctl[1] = s * (v[ind + 2] - g->h);
+			vfont_quad(p, cur, ctl, pt);
+			cur[0] = pt[0];
+			cur[1] = pt[1];
+			ind += 5;
+		}
+		else if(t == 'Z')
+			ind += 1;
+		else
+			break;
+	}
+}
+
+/// @brief Sort edges by y0 so vfont_fill() can add them in order
+/// Shell sort, glyphs too large to cache are sorted on every draw
+/// @param[in,out] *edge: edges
+/// @param[in] n: edge count
+/// @return void
+static void vfont_sort(_vfont_edge_t *edge, int n)
+{
+	_vfont_edge_t t;
+	int gap, i, j;
+
+	for(gap = n / 2; gap > 0; gap /= 2)
+	{
+		for(i=gap;i<n;++i)
+		{
+			t = edge[i];
+			for(j=i; j>=gap && edge[j-gap].y0 > t.y0; j-=gap)
+				edge[j] = edge[j-gap];
+			edge[j] = t;
+		}
+	}
+}
+
+/// @brief Most edges crossing one pixel row, sampled at pixel centers
+/// The baseline is on a pixel boundary so rows are sampled at Y = 16k + 8
+/// @param[in] *e: glyph, edges sorted by y0
+/// @return crossings
+static uint16_t vfont_cross(_vfont_cache_t *e)
+{
+	int32_t Y;
+	uint16_t most = 0, n;
+	int i;
+
+	for(Y = ((e->ymin - 8 + 15) & ~15) + 8; Y < e->ymax; Y += 16)
+	{
+		n = 0;
+		for(i=0; i<e->edges && e->edge[i].y0 <= Y; ++i)
+		{
+			if(Y < e->edge[i].y1)
+				++n;
+		}
+		most = MAX(most, n);
+	}
+	return(most);
+}
+
+/// @brief Remove the least recently used glyph from the cache
+/// @return  void
+static void vfont_cache_evict()
+{
+	_vfont_cache_t *e, **prev;
+
+	if(!vfont_cache_list)
+		return;
+	for(prev = &vfont_cache_list; (*prev)->next != NULL; prev = &(*prev)->next)
+		;
+	e = *prev;
+	*prev = NULL;
+	vfont_cache.bytes -= sizeof(_vfont_cache_t) + e->edges * sizeof(_vfont_edge_t);
+	vfont_cache.entries--;
+	vfont_cache.evictions++;
+	free(e);
+}
+
+/// @brief Find a glyph outline at a scale, flattening it on a miss
+/// Outlines larger than 1/4 of the cache are returned without being cached
+/// and must be released with free()
+/// @param[in] c: character
+/// @param[in] scale: pixels per font unit
+/// @param[out] *cached: 1 if the entry is in the cache
+/// @return  entry or NULL
+static _vfont_cache_t *vfont_glyph(int c, float scale, int *cached)
+{
+	_vfont_cache_t *e, **prev;
+	_vfont_path_t p;
+	path_t *g;
+	int size;
+
+	*cached = 1;
+	for(prev = &vfont_cache_list; (e = *prev) != NULL; prev = &e->next)
+	{
+		if(e->c == c && e->scale == scale)
+		{
+			// Move to the front
+			*prev = e->next;
+			e->next = vfont_cache_list;
+			vfont_cache_list = e;
+			vfont_cache.hits++;
+			return(e);
+		}
+	}
+	vfont_cache.misses++;
+
+	if(c < 32 || c > 127 || vfont[c - 32] == NULL)
+		return(NULL);
+	g = vfont[c - 32];
+
+	p.edge = NULL;
+	vfont_flatten(g, scale, &p);
+	size = sizeof(_vfont_cache_t) + p.count * sizeof(_vfont_edge_t);
+	*cached = (size <= VFONT_CACHE_SIZE/4);
+	while(*cached && (vfont_cache.entries >= VFONT_CACHE_ENTRIES || vfont_cache.bytes + size > VFONT_CACHE_SIZE))
+		vfont_cache_evict();
+
+	e = (_vfont_cache_t *) calloc(size,1);
+	if(!e)
+		return(NULL);
+	p.edge = e->edge;
+	vfont_flatten(g, scale, &p);
+	e->c = c;
+	e->scale = scale;
+	e->xinc = g->xinc * scale * 16 + 0.5;
+	e->ymin = p.ymin;
+	e->ymax = p.ymax;
+	e->edges = p.count;
+	vfont_sort(e->edge, e->edges);
+	e->cross = vfont_cross(e);
+
+	if(*cached)
+	{
+		e->next = vfont_cache_list;
+		vfont_cache_list = e;
+		vfont_cache.bytes += size;
+		vfont_cache.entries++;
+	}
+	return(e);
+}
+
+/// @brief Empty the outline cache and free its memory
+/// Statistics are kept
+/// @return  void
+MEMSPACE
+void vfont_cache_flush()
+{
+	while(vfont_cache_list)
+		vfont_cache_evict();
+	vfont_cache.evictions = 0;
+}
+
+/// @brief Display outline cache statistics
+/// @return  void
+MEMSPACE
+void vfont_cache_print()
+{
+	printf("vfont cache: hits:%lu, misses:%lu, evictions:%lu, entries:%u, bytes:%lu of %lu\n",
+		(long) vfont_cache.hits, (long) vfont_cache.misses, (long) vfont_cache.evictions,
+		(unsigned) vfont_cache.entries, (long) vfont_cache.bytes, (long) VFONT_CACHE_SIZE);
+}
+
+/// @brief Find the font ascent and descent
+/// @return  void
+static void vfont_metrics()
+{
+	int i;
+
+	if(vfont_ascent >= 0)
+		return;
+	vfont_ascent = 0;
+	for(i=0;vfont[i] != NULL;++i)
+	{
+		vfont_ascent = MAX(vfont_ascent, vfont[i]->hby);
+		vfont_descent = MAX(vfont_descent, vfont[i]->h - vfont[i]->hby);
+	}
+}
+
+/// @brief Height of a line of vector text
+/// @param[in] scale: pixels per font unit
+/// @return  pixels
+int vfont_height(float scale)
+{
+	vfont_metrics();
+	return((int) ((vfont_ascent + vfont_descent) * scale + 0.5));
+}
+
+/// @brief Width of vector text
+/// @param[in] *str: string
+/// @param[in] scale: pixels per font unit
+/// @return  pixels
+int vfont_width(char *str, float scale)
+{
+	int32_t pen = 0;
+	int c;
+
+	while((c = *str++) != 0)
+	{
+		if(c >= 32 && c <= 127 && vfont[c - 32] != NULL)
+			pen += (int32_t) (vfont[c - 32]->xinc * scale * 16 + 0.5);
+	}
+	return((pen + 8) >> 4);
+}
+
+/// @brief Fill one glyph cell, rows are written a block at a time
+/// Pixels are sampled at their centers and set when the non-zero winding
+/// rule puts them inside the outline
+/// Edges are added in y0 order as the rows reach them and dropped past y1,
+/// the crossings stay sorted by X from row to row
+/// @param[in] *win: window
+/// @param[in] *e: glyph
+/// @param[in] x: cell left, pixels
+/// @param[in] y: cell top, pixels
+/// @param[in] w: cell width, pixels
+/// @param[in] h: cell height, pixels
+/// @param[in] base: X of the cell left pixel center from the glyph origin, 1/16 pixels
+/// @param[in] asc: baseline from the cell top, pixels
+/// @return void
+static void vfont_fill(window *win, _vfont_cache_t *e, int16_t x, int16_t y, int16_t w, int16_t h, int32_t base, int16_t asc)
+{
+	uint16_t buf[VFONT_BUF];
+	int32_t cross_x[VFONT_CROSS], *cx = cross_x;
+	uint16_t cross_e[VFONT_CROSS], *ce = cross_e;
+	int32_t Y, X;
+	_vfont_edge_t *E;
+	int rows, row, n, i, j, k, wind, j0, j1, next, skip;
+	uint16_t *line, a;
+
+	if(w > VFONT_BUF)
+		w = VFONT_BUF;
+	if(w <= 0 || h <= 0)
+		return;
+	rows = VFONT_BUF / w;
+
+	// Without room for every crossing of a row the cell is left as background
+	skip = 0;
+	if(e->cross > VFONT_CROSS)
+	{
+		cx = (int32_t *) calloc(e->cross, sizeof(int32_t));
+		ce = (uint16_t *) calloc(e->cross, sizeof(uint16_t));
+		skip = (!cx || !ce);
+	}
+
+	n = 0;
+	next = 0;
+	for(row=0; row<h; row+=rows)
+	{
+		if(rows > h - row)
+			rows = h - row;
+		for(i=0;i<rows*w;++i)
+			buf[i] = win->bg;
+
+		for(k=0;k<rows;++k)
+		{
+			// Pixel center from the baseline
+			Y = (int32_t) (row + k - asc) * 16 + 8;
+			if(skip || Y < e->ymin || Y >= e->ymax)
+				continue;
+			line = buf + k * w;
+
+			// Drop edges ending above this row
+			for(i=j=0;i<n;++i)
+			{
+				if(Y < e->edge[ce[i]].y1)
+					ce[j++] = ce[i];
+			}
+			n = j;
+			// Add edges starting above it
+			for(; next < e->edges && e->edge[next].y0 <= Y; ++next)
+			{
+				if(Y < e->edge[next].y1)
+					ce[n++] = next;
+			}
+
+			// Crossings sorted by X, the order from the last row is nearly right
+			for(i=0;i<n;++i)
+			{
+				a = ce[i];
+				E = &e->edge[a];
+				X = E->x0 + (((Y - E->y0) * E->dxdy) >> 16);
+				for(j=i; j>0 && cx[j-1] > X; --j)
+				{
+					cx[j] = cx[j-1];
+					ce[j] = ce[j-1];
+				}
+				cx[j] = X;
+				ce[j] = a;
+			}
+
+			wind = 0;
+			for(i=0;i<n-1;++i)
+			{
+				wind += e->edge[ce[i]].dir;
+				if(!wind)
+					continue;
+				// Pixels with centers in cx[i] .. cx[i+1]
+				j0 = (cx[i] - base + 15) >> 4;
+				j1 = (cx[i+1] - base + 15) >> 4;
+				if(j0 < 0)
+					j0 = 0;
+				if(j1 > w)
+					j1 = w;
+				for(j=j0;j<j1;++j)
+					line[j] = win->fg;
+			}
+		}
+		tft_writeRect(win, x, y + row, w, rows, buf);
+		optimistic_yield(1000);
+	}
+
+	if(cx != cross_x)
+		free(cx);
+	if(ce != cross_e)
+		free(ce);
+}
+
+/// @brief Draw a string of filled vector characters
+/// Glyphs are flattened once per scale and kept in the outline cache
+/// Character cells are filled with win->fg and win->bg, the pen advances
+/// in 1/16 pixels by xinc so spacing does not drift with rounding
+/// @param[in] *win: window
+/// @param[in] x: left, pixels
+/// @param[in] y: top of the line, see vfont_height()
+/// @param[in] *str: string
+/// @param[in] scale: pixels per font unit
+/// @return  width in pixels
+int vfont_drawString(window *win, int16_t x, int16_t y, char *str, float scale)
+{
+	_vfont_cache_t *e;
+	int32_t pen = 0;
+	int16_t c0, c1, asc, h;
+	int c, cached;
+
+	vfont_metrics();
+	asc = vfont_ascent * scale + 0.5;
+	h = vfont_height(scale);
+
+	while((c = *str++) != 0)
+	{
+		e = vfont_glyph(c, scale, &cached);
+		if(!e)
+			continue;
+		// Cell from the rounded pen positions
+		c0 = (pen + 8) >> 4;
+		c1 = (pen + e->xinc + 8) >> 4;
+		vfont_fill(win, e, x + c0, y, c1 - c0, h, (int32_t) c0 * 16 + 8 - pen, asc);
+		pen += e->xinc;
+		if(!cached)
+			free(e);
+	}
+	return((pen + 8) >> 4);
+}
+
+/// @brief Draw a vector character outline
+/// @param[in] *win: window
+/// @param[in] x: left, pixels
+/// @param[in] y: top, pixels
+/// @param[in] c: character
+/// @param[in] scale: pixels per font unit
+/// @param[in] color: color
+/// @param[in] fill: draw the character filled with vfont_drawString()
+/// @return void
+void drawSVG(window *win, int16_t x, int16_t y, int16_t c, float scale, uint16_t color, int16_t fill) 
+{
 	p2_int16_t Ctl,T;
 	p2_int16_t Cur;
 	p2_int16_t Move;
 	int16_t Xsize,Ysize;
-
-	int state;
-	p2_int16_t p[3];
-	p2_int16_t B[BEZIER_STEPS];
-
 	int ind;
-	int t;
-	int i,j,count;
-
 	int16_t *v;
 
-	if( c >= 32 && c <= 127)
-	{
-		c -= 32;
-		v = vfont[c]->v;
-		Xsize = (scale * vfont[c]->xinc);
-		Ysize = (scale * vfont[c]->yinc);
-		// CLear
-        tft_fillRectWH(win, x, y, Xsize, Ysize, win->bg);
+	if( c < 32 || c > 127)
+		return;
 
-	}
-	else
+	if(fill)
 	{
-		printf("DrawSVG: invalid character\n");
+		char str[2];
+		uint16_t fg = win->fg;
+
+		str[0] = c;
+		str[1] = 0;
+		win->fg = color;
+		vfont_drawString(win, x, y, str, scale);
+		win->fg = fg;
 		return;
 	}
-	
 
-	printf("DrawSVG:(%d,%d) scale:%e)\n", x,y,(double)scale);
+	c -= 32;
+	v = vfont[c]->v;
+	Xsize = (scale * vfont[c]->xinc);
+	Ysize = (scale * vfont[c]->yinc);
+	// CLear
+	tft_fillRectWH(win, x, y, Xsize, Ysize, win->bg);
 
+	Cur.X = Move.X = x;
+	Cur.Y = Move.Y = y;
 	ind = 0;
-	state = 0;
 	while(1)
 	{
 		char t = v[ind];
@@ -92,15 +594,8 @@ void drawSVG(window *win, int16_t x, int16_t y, int16_t c, float scale, uint16_t
 			// Move takes to move points
 			Move.X = x + (scale * v[ind + 1]);
 			Move.Y = y + (scale * v[ind + 2]);
-			//printf("M: Move.X:%d,Move.Y:%d\n", (int)Move.X,(int)Move.Y);
 			Cur.X = Move.X;
 			Cur.Y = Move.Y;
-			if(state < 3)
-			{
-				p[state].X = Cur.X;
-				p[state].Y = Cur.Y;
-				++state;
-			}
 			ind += 3;
 		}
 		else if (t == 'L' ) 
@@ -108,21 +603,11 @@ void drawSVG(window *win, int16_t x, int16_t y, int16_t c, float scale, uint16_t
 			// Line takes Cur.X,Cur.Y and to target points
 			T.X = x + (scale * v[ind + 1]);
 			T.Y = y + (scale * v[ind + 2]);
-			//printf("L: Curx:%d,Cury:%d,T.X:%d,T.Y:%d\n", (int)Cur.X,(int)Cur.Y,(int)T.X,(int)T.Y);
 			if(T.X != Cur.X || T.Y != Cur.Y)
-			{
 				tft_drawLine(win, Cur.X, Cur.Y, T.X, T.Y, color);
-				if(state < 3)
-				{
-					p[state].X = T.X;
-					p[state].Y = T.Y;
-					++state;
-				}
-			}
 			Cur.X = T.X;
 			Cur.Y = T.Y;
 			ind += 3;
-
 		}
 		else if (t == 'Q' ) 
 		{
@@ -131,80 +616,28 @@ void drawSVG(window *win, int16_t x, int16_t y, int16_t c, float scale, uint16_t
 			Ctl.Y =  y + (scale * v[ind + 2]);
 			T.X =  x + (scale * v[ind + 3]);
 			T.Y =  y + (scale * v[ind + 4]);
-			//printf("Q: Cur.X:%d,Cury:%d,Ctl.X:%d,Ctl.Y:%d,T.X:%d,T.Y:%d\n", (int)Cur.X,(int)Cur.Y,(int)Ctl.X,(int)Ctl.Y,(int)T.X,(int)T.Y);
+			// Segments are picked from the curve size
 			if(T.X != Cur.X || T.Y != Cur.Y)
-			{
-#if 1
-				count = tft_Bezier2(win, Cur, Ctl, T, BEZIER_STEPS, color);
-#else
-				if(T.X != Cur.X || T.Y != Cur.Y)
-					tft_drawLine(win, Cur.X, Cur.Y, T.X, T.Y, color);
-#endif
-				if(state < 3)
-				{
-					p[state].X = T.X;
-					p[state].Y = T.Y;
-					++state;
-				}
-			}
+				tft_Bezier2(win, Cur, Ctl, T, 0, color);
 			Cur.X = T.X;
 			Cur.Y = T.Y;
 			ind += 5;
-
 		}
 		else if (t == 'Z') 
 		{
 			// CLOSE takes no params
-			//printf("Z: Curx:%d,Cury:%d,Move.X:%d,Move.Y:%d\n", (int)Cur.X,(int)Cur.Y,(int)Move.X,(int)Move.Y);
 			if(Cur.X != Move.X || Cur.Y != Move.Y)
-			{
 				tft_drawLine(win, Cur.X, Cur.Y, Move.X, Move.Y, color);
-				if(state < 3)
-				{
-					p[state].X = T.X;
-					p[state].Y = T.Y;
-					++state;
-				}
-			}
 			Cur.X = Move.X;
 			Cur.Y = Move.Y;
 			ind += 1;
 		}
-		else if (t == '.') 
-		{
-			break;
-		}
 		else
 		{
-			printf("bad type:%c @ index:%d\n", (int)t, (int)ind);
+			// '.' or a bad command ends the outline
 			break;
 		}
 	}
-
-#if 1
-
-	if(state == 3)
-	{
-		int i;
-		printf("Fill\n");
-		for(i=0;i<3;++i)
-		{
-			printf("%d,%d\n", p[i].X, p[i].Y);
-		}
-
-	}
-		
-#else
-	if(fill)
-	{
-		for(i=0;i<Ysize;++i)
-		{
-			count = tft_FillPolyLine( win , x, y + i, Xsize, color );
-		   // optimistic_yield(1000);
-
-		}
-	}
-#endif
 }
 
 #endif //ifdef VFONTS
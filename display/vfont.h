@@ -48,4 +48,56 @@ typedef struct {
 	int16_t v[];    /* Data */
 } path_t;
 
+/// @brief Glyph outline cache RAM limit in bytes
+#ifndef VFONT_CACHE_SIZE
+#define VFONT_CACHE_SIZE 4096
+#endif
+/// @brief Maximum glyphs held in the outline cache
+#ifndef VFONT_CACHE_ENTRIES
+#define VFONT_CACHE_ENTRIES 16
+#endif
+/// @brief Edges crossing one row of a glyph held on the stack
+/// Glyphs with more crossings use a heap buffer sized from _vfont_cache_t.cross
+#ifndef VFONT_CROSS
+#define VFONT_CROSS 16
+#endif
+/// @brief Pixels written at a time, glyph cells wider than this are clipped
+#define VFONT_BUF 256
+
+/// @brief Outline edge in 1/16 pixels, relative to the glyph origin on the baseline
+typedef struct {
+	int16_t x0;     /* X at y0 */
+	int16_t y0;     /* Top, y0 < y1 */
+	int16_t y1;     /* Bottom */
+	int8_t dir;     /* Winding, +1 down, -1 up */
+	int32_t dxdy;   /* X change per 1/16 pixel of Y, Q16 */
+} _vfont_edge_t;
+
+/// @brief Outline cache entry - a glyph flattened to edges at one scale
+/// Entries are kept in most recently used order
+typedef struct _vfont_cache_t
+{
+	struct _vfont_cache_t *next;    /* next less recently used entry */
+	float scale;                    /* pixels per font unit */
+	uint8_t c;                      /* character */
+	int16_t xinc;                   /* advance, 1/16 pixels */
+	int16_t ymin;                   /* edge limits, 1/16 pixels */
+	int16_t ymax;
+	uint16_t edges;                 /* edge count, sorted by y0 */
+	uint16_t cross;                 /* most edges crossing one pixel row */
+	_vfont_edge_t edge[];
+} _vfont_cache_t;
+
+/// @brief Outline cache statistics
+typedef struct
+{
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t evictions;
+	uint32_t bytes;                 /* RAM in use */
+	uint16_t entries;               /* glyphs in use */
+} _vfont_cache_stats;
+
+extern _vfont_cache_stats vfont_cache;
+
 #endif                                            //_VFONT_H_
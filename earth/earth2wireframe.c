@@ -29,6 +29,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <ctype.h>
 #include <math.h>
 #include <time.h>
 #include <unistd.h>
@@ -44,6 +45,7 @@ typedef int int32_t;
 
 #define MEMSPACE /**/
 #include "../wire/wire_types.h"
+#include "../wire/wire_mesh.h"
 #include "../cordic/cordic2c_inc.h"
 #include "../cordic/cordic.h"
 
@@ -70,12 +72,513 @@ char *get_date()
 }
 
 
+/// @brief Growable byte buffer
+typedef struct
+{
+	uint8_t *data;
+	int len;
+	int size;
+} mesh_buf;
+
+/// @brief Points read from the source, WIRE_SEP between groups
+wire_p *points = NULL;
+int points_len = 0;
+int points_size = 0;
+
+/// @brief Save a point for the compact mesh
+/// @param[in] x: X
+/// @param[in] y: Y
+/// @param[in] z: Z
+/// @return void
+void add_point(int x, int y, int z)
+{
+	if(points_len >= points_size)
+	{
+		points_size += 1024;
+		points = realloc(points, points_size * sizeof(wire_p));
+		if(points == NULL)
+		{
+			fprintf(stderr,"Out of memory\n");
+			exit(1);
+		}
+	}
+	points[points_len].x = x;
+	points[points_len].y = y;
+	points[points_len].z = z;
+	++points_len;
+}
+
+/// @brief Edges read from an edge mesh source
+wire_e *edges = NULL;
+int edges_len = 0;
+int edges_size = 0;
+
+/// @brief Save an edge for the compact mesh
+/// @param[in] p1: first point
+/// @param[in] p2: second point
+/// @return void
+void add_edge(int p1, int p2)
+{
+	if(edges_len >= edges_size)
+	{
+		edges_size += 1024;
+		edges = realloc(edges, edges_size * sizeof(wire_e));
+		if(edges == NULL)
+		{
+			fprintf(stderr,"Out of memory\n");
+			exit(1);
+		}
+	}
+	edges[edges_len].p1 = p1;
+	edges[edges_len].p2 = p2;
+	++edges_len;
+}
+
+/// @brief Read an edge mesh source
+/// Lines are "v x y z", a point where 1.0 is WIRE_ONE, or "e p1 p2", an
+/// edge between points counted from 0, # are comments and ignored
+/// @param[in] *FI: source
+/// @param[in] *name: source file name
+/// @return void
+void read_edges(FILE *FI, char *name)
+{
+	char buff[256];
+	double x,y,z;
+	int p1,p2;
+	int line = 0;
+	int i;
+
+	while( fgets(buff, sizeof(buff)-2, FI))
+	{
+		++line;
+		if(*buff == '#' || *buff == '\n' || *buff == '\r' || *buff == 0)
+			continue;
+		if(sscanf(buff, "v %lf %lf %lf", &x, &y, &z) == 3)
+		{
+			add_point(lround(x * WIRE_ONE), lround(y * WIRE_ONE), lround(z * WIRE_ONE));
+			continue;
+		}
+		if(sscanf(buff, "e %d %d", &p1, &p2) == 2)
+		{
+			add_edge(p1, p2);
+			continue;
+		}
+		fprintf(stderr,"%s:%d: expected v x y z or e p1 p2\n", name, line);
+		exit(1);
+	}
+	for(i=0;i<edges_len;++i)
+	{
+		if(edges[i].p1 < 0 || edges[i].p1 >= points_len ||
+			edges[i].p2 < 0 || edges[i].p2 >= points_len)
+		{
+			fprintf(stderr,"%s: edge %d: no such point\n", name, i);
+			exit(1);
+		}
+	}
+}
+
+/// @brief Add a byte to a buffer
+/// @param[in] *b: buffer
+/// @param[in] c: byte
+/// @return void
+void put_byte(mesh_buf *b, int c)
+{
+	if(b->len >= b->size)
+	{
+		b->size += 4096;
+		b->data = realloc(b->data, b->size);
+		if(b->data == NULL)
+		{
+			fprintf(stderr,"Out of memory\n");
+			exit(1);
+		}
+	}
+	b->data[b->len++] = c;
+}
+
+/// @brief Add a little endian number to a buffer
+/// @param[in] *b: buffer
+/// @param[in] v: value
+/// @param[in] size: bytes
+/// @return void
+void put_le(mesh_buf *b, uint32_t v, int size)
+{
+	while(size--)
+	{
+		put_byte(b, v & 0xff);
+		v >>= 8;
+	}
+}
+
+/// @brief Add a varint to a buffer, 7 bits per byte low bits first
+/// @param[in] *b: buffer
+/// @param[in] v: value
+/// @return void
+void put_varint(mesh_buf *b, uint32_t v)
+{
+	while(v >= 0x80)
+	{
+		put_byte(b, (v & 0x7f) | 0x80);
+		v >>= 7;
+	}
+	put_byte(b, v);
+}
+
+/// @brief Add a zigzag varint to a buffer
+/// @param[in] *b: buffer
+/// @param[in] v: signed value
+/// @return void
+void put_delta(mesh_buf *b, int v)
+{
+	put_varint(b, ((uint32_t) v << 1) ^ (uint32_t) (v >> 31));
+}
+
+/// @brief Levels of detail in the compact mesh
+#define MESH_LEVELS 4
+/// @brief Level 1 tolerance is 1 << MESH_LOD, each further level doubles it
+/// 128 is one pixel when the earth is drawn with a scale of 128
+#define MESH_LOD 7
+
+/// @brief Distance from a point to a line segment
+/// @param[in] *p: point
+/// @param[in] *a: segment start
+/// @param[in] *b: segment end
+/// @return distance
+double segment_distance(wire_p *p, wire_p *a, wire_p *b)
+{
+	double dx = b->x - a->x, dy = b->y - a->y, dz = b->z - a->z;
+	double px = p->x - a->x, py = p->y - a->y, pz = p->z - a->z;
+	double len = dx * dx + dy * dy + dz * dz;
+	double t = 0;
+
+	if(len > 0)
+	{
+		t = (px * dx + py * dy + pz * dz) / len;
+		if(t < 0)
+			t = 0;
+		if(t > 1)
+			t = 1;
+	}
+	px -= t * dx;
+	py -= t * dy;
+	pz -= t * dz;
+	return(sqrt(px * px + py * py + pz * pz));
+}
+
+/// @brief Douglas-Peucker simplification of one polyline
+/// Marks the points to keep, the first and last are kept by the caller
+/// @param[in] *p: points
+/// @param[out] *keep: flags
+/// @param[in] first: first point
+/// @param[in] last: last point
+/// @param[in] tol: largest distance a point may move
+/// @return void
+void simplify(wire_p *p, uint8_t *keep, int first, int last, double tol)
+{
+	int i, far = -1;
+	double d, max = tol;
+
+	for(i=first+1;i<last;++i)
+	{
+		d = segment_distance(&p[i], &p[first], &p[last]);
+		if(d > max)
+		{
+			max = d;
+			far = i;
+		}
+	}
+	if(far < 0)
+		return;
+	keep[far] = 1;
+	simplify(p, keep, first, far, tol);
+	simplify(p, keep, far, last, tol);
+}
+
+/// @brief Encode the points as one compact line mesh level, see wire/wire_mesh.h
+/// Level 0 holds every point, coarser levels are keep flags over its points
+/// @param[out] *b: level data
+/// @param[in] tol: simplification tolerance, 0 keeps every point
+/// @param[out] *count: points
+/// @param[out] *lines: polylines
+/// @return void
+void encode_level(mesh_buf *b, double tol, int *count, int *lines)
+{
+	wire_p last = { 0, 0, 0 };
+	uint8_t *keep;
+	double d, size;
+	int i, k, n, kept;
+	int bits = 0, byte = 0;
+
+	keep = calloc(points_len + 1, 1);
+	if(keep == NULL)
+	{
+		fprintf(stderr,"Out of memory\n");
+		exit(1);
+	}
+	*lines = 0;
+	*count = 0;
+	for(i=0;i<points_len;)
+	{
+		if(points[i].x == WIRE_SEP)
+		{
+			++i;
+			continue;
+		}
+		for(n=0;i+n<points_len && points[i+n].x != WIRE_SEP;++n)
+			keep[i+n] = (tol == 0);
+		keep[i] = 1;
+		keep[i+n-1] = 1;
+		if(tol > 0)
+			simplify(points, keep, i, i+n-1, tol);
+
+		// Lines smaller than the tolerance are dropped
+		size = 0;
+		for(k=i;k<i+n;++k)
+		{
+			d = segment_distance(&points[k], &points[i], &points[i]);
+			if(d > size)
+				size = d;
+		}
+		if(tol > 0 && size <= tol)
+		{
+			for(k=i;k<i+n;++k)
+				keep[k] = 0;
+		}
+
+		// Keep flags, low bit first
+		if(tol > 0)
+		{
+			kept = 0;
+			for(k=i;k<i+n;++k)
+			{
+				if(keep[k])
+				{
+					byte |= 1 << bits;
+					++kept;
+				}
+				if(++bits == 8)
+				{
+					put_byte(b, byte);
+					bits = 0;
+					byte = 0;
+				}
+			}
+			*count += kept;
+			if(kept)
+				++*lines;
+			i += n;
+			continue;
+		}
+
+		kept = 0;
+		for(k=i;k<i+n;++k)
+			kept += keep[k];
+		put_varint(b, kept);
+		for(k=i;k<i+n;++k)
+		{
+			if(!keep[k])
+				continue;
+			put_delta(b, points[k].x - last.x);
+			put_delta(b, points[k].y - last.y);
+			put_delta(b, points[k].z - last.z);
+			last = points[k];
+			++*count;
+		}
+		++*lines;
+		i += n;
+	}
+	if(tol > 0)
+	{
+		if(bits)
+			put_byte(b, byte);
+	}
+	else
+		put_varint(b, 0);
+	free(keep);
+}
+
+/// @brief Encode the points and edges as one compact edge mesh level, see wire/wire_mesh.h
+/// @param[out] *b: level data
+/// @param[out] *count: points
+/// @param[out] *lines: edges
+/// @return void
+void encode_edges(mesh_buf *b, int *count, int *lines)
+{
+	wire_p last = { 0, 0, 0 };
+	int i, p1 = 0;
+
+	put_varint(b, points_len);
+	for(i=0;i<points_len;++i)
+	{
+		put_delta(b, points[i].x - last.x);
+		put_delta(b, points[i].y - last.y);
+		put_delta(b, points[i].z - last.z);
+		last = points[i];
+	}
+	put_varint(b, edges_len);
+	for(i=0;i<edges_len;++i)
+	{
+		put_delta(b, edges[i].p1 - p1);
+		put_delta(b, edges[i].p2 - edges[i].p1);
+		p1 = edges[i].p1;
+	}
+	*count = points_len;
+	*lines = edges_len;
+}
+
+/// @brief Encode the points as a compact mesh
+/// Line meshes get levels of detail, edge meshes are written as one level
+/// @param[out] *b: mesh
+/// @param[in] type: WIRE_MESH_LINES or WIRE_MESH_EDGES
+/// @return void
+void encode_mesh(mesh_buf *b, int type)
+{
+	mesh_buf level[MESH_LEVELS];
+	int count[MESH_LEVELS], lines[MESH_LEVELS];
+	uint32_t offset;
+	int i, l, levels, lod;
+
+	memset(level, 0, sizeof(level));
+	if(type == WIRE_MESH_EDGES)
+	{
+		levels = 1;
+		lod = 0;
+		encode_edges(&level[0], &count[0], &lines[0]);
+		fprintf(stderr,"edges: %d points, %d edges, %d bytes\n",
+			count[0], lines[0], level[0].len);
+	}
+	else
+	{
+		levels = MESH_LEVELS;
+		lod = MESH_LOD;
+		for(l=0;l<levels;++l)
+		{
+			encode_level(&level[l], l ? (double) (1L << (MESH_LOD + l - 1)) : 0, &count[l], &lines[l]);
+			fprintf(stderr,"level %d: %d points, %d lines, %d bytes\n",
+				l, count[l], lines[l], level[l].len);
+		}
+	}
+
+	// Header and level table
+	put_byte(b, 'W');
+	put_byte(b, 'M');
+	put_byte(b, 'S');
+	put_byte(b, 'H');
+	put_byte(b, WIRE_MESH_VERSION);
+	put_byte(b, type);
+	put_byte(b, levels);
+	put_byte(b, lod);
+	offset = WIRE_MESH_HEADER + WIRE_MESH_ENTRY * levels;
+	for(l=0;l<levels;++l)
+	{
+		put_le(b, offset, 4);
+		put_le(b, level[l].len, 4);
+		put_le(b, count[l], 2);
+		put_le(b, lines[l], 2);
+		offset += level[l].len;
+	}
+	for(l=0;l<levels;++l)
+	{
+		for(i=0;i<level[l].len;++i)
+			put_byte(b, level[l].data[i]);
+		free(level[l].data);
+	}
+}
+
+/// @brief Write the compact mesh as a C array
+/// The array is named after the output file, earth_mesh.h holds earth_mesh[]
+/// @param[in] *FO: output
+/// @param[in] *b: mesh
+/// @param[in] *oname: output file name
+/// @param[in] *name: source file name
+/// @param[in] *prog: program name
+/// @return void
+void write_mesh_c(FILE *FO, mesh_buf *b, char *oname, char *name, char *prog)
+{
+	char file[256], array[256], guard[256];
+	int i;
+
+	strncpy(file, oname, sizeof(file)-1);
+	file[sizeof(file)-1] = 0;
+	strcpy(file, basename(file));
+	strcpy(array, file);
+	for(i=0;array[i] && array[i] != '.';++i)
+		if(!isalnum((unsigned char) array[i]))
+			array[i] = '_';
+	array[i] = 0;
+	for(i=0;array[i];++i)
+		guard[i] = toupper((unsigned char) array[i]);
+	guard[i] = 0;
+
+	fprintf(FO,"#ifndef _%s_H_\n", guard);
+	fprintf(FO,"#define _%s_H_\n", guard);
+	fprintf(FO,"/**\n");
+	fprintf(FO," @file %s\n", file);
+	fprintf(FO," Generated by:[%s]\n", basename(prog));
+	fprintf(FO," On: %s\n", get_date());
+	fprintf(FO," By Mike Gore 2015, Wireframe compact mesh, see wire_mesh.h\n");
+	fprintf(FO," Source: %s\n", name);
+	fprintf(FO,"*/\n");
+	fprintf(FO,"MEMSPACE_RO uint8_t %s[%d] = {", array, b->len);
+	for(i=0;i<b->len;++i)
+	{
+		if((i % 16) == 0)
+			fprintf(FO,"\n\t");
+		fprintf(FO,"0x%02x,", b->data[i]);
+	}
+	fprintf(FO,"\n};\n");
+	fprintf(FO,"#else /* _%s_H_ */\n", guard);
+	fprintf(FO,"	extern MEMSPACE_RO uint8_t %s[];\n", array);
+	fprintf(FO,"#endif /* _%s_H_ */\n", guard);
+}
+
+/// @brief Write the compact mesh files
+/// @param[in] *mesh: mesh
+/// @param[in] *mname: binary mesh file name, or NULL
+/// @param[in] *cname: C array file name, or NULL
+/// @param[in] *name: source file name
+/// @param[in] *prog: program name
+/// @return void
+void write_mesh(mesh_buf *mesh, char *mname, char *cname, char *name, char *prog)
+{
+	FILE *FO;
+
+	if(mname)
+	{
+		FO = fopen(mname,"wb");
+		if(FO == NULL)
+		{
+			fprintf(stderr,"Can not open: [%s]\n", mname);
+			exit (1);
+		}
+		fwrite(mesh->data, 1, mesh->len, FO);
+		fclose(FO);
+	}
+	if(cname)
+	{
+		FO = fopen(cname,"w");
+		if(FO == NULL)
+		{
+			fprintf(stderr,"Can not open: [%s]\n", cname);
+			exit (1);
+		}
+		write_mesh_c(FO, mesh, cname, name, prog);
+		fclose(FO);
+	}
+}
+
 /// @brief Convert earth wireframe data to C structure
 ///		Usage: %s -f source -o result\n",argv[0]);
 ///		-f source is the lot,lat dataset pairs
 ///		-o result is the con=verted file into CORDIC fixed point format
+///		-m result is the compact mesh, for a file system
+///		-c result is the compact mesh as a C array
+///		-e source is points and edges, written as an edge mesh
 int main(int argc, char *argv[])
 {
+	mesh_buf mesh;
+	char *mname = NULL;
+	char *cname = NULL;
 	double xx,yy,zz;
 	double scale;
 	double lat,lon;
@@ -84,6 +587,7 @@ int main(int argc, char *argv[])
 	int i;
 	int len;
 	int prototype = 1;
+	int edge_mesh = 0;
 	char *p, *name, *oname;
 	FILE *FI,*FO;
 	char buff[256];
@@ -92,6 +596,7 @@ int main(int argc, char *argv[])
 	char cwd[512];
 
 	name = NULL;
+	oname = NULL;
 
 	getcwd(cwd, 510);
 
@@ -109,14 +614,32 @@ int main(int argc, char *argv[])
 		{
 			oname = argv[++i];
 		}
+		if(*p == 'm')
+		{
+			mname = argv[++i];
+		}
+		if(*p == 'c')
+		{
+			cname = argv[++i];
+		}
+		if(*p == 'e')
+		{
+			edge_mesh = 1;
+		}
 	}
-	if(!name || !oname)
+	if(!name || (!oname && !mname && !cname) || (edge_mesh && oname))
 	{
-		fprintf(stderr,"Usage: %s -f filename [-p]\n",argv[0]);
+		fprintf(stderr,"Usage: %s -f filename [-o result.h] [-m result.msh] [-c result.h]\n",argv[0]);
+		fprintf(stderr,"       %s -e -f filename [-m result.msh] [-c result.h]\n",argv[0]);
 		fprintf(stderr,"-f filename is the lot,lat dataset pairs\n");
+		fprintf(stderr,"-o result.h is the wire_p C table\n");
+		fprintf(stderr,"-m result.msh is the compact mesh\n");
+		fprintf(stderr,"-c result.h is the compact mesh as a C array\n");
+		fprintf(stderr,"-e filename has v x y z points and e p1 p2 edges, for an edge mesh\n");
 		exit(1);
 	}
-	if(strcmp(name,oname) == 0)
+	if((oname && strcmp(name,oname) == 0) || (mname && strcmp(name,mname) == 0) ||
+		(cname && strcmp(name,cname) == 0))
 	{
 		fprintf(stderr,"sorce and destination file can not be the same\n");
 		exit(1);
@@ -128,7 +651,21 @@ int main(int argc, char *argv[])
 		exit (1);
 	}
 
-	FO = fopen(oname,"w");
+	if(edge_mesh)
+	{
+		read_edges(FI, name);
+		fclose(FI);
+		memset(&mesh, 0, sizeof(mesh));
+		encode_mesh(&mesh, WIRE_MESH_EDGES);
+		write_mesh(&mesh, mname, cname, name, argv[0]);
+		fprintf(stderr,"%d points, %d edges, compact mesh %d bytes\n",
+			points_len, edges_len, mesh.len);
+		free(mesh.data);
+		return(0);
+	}
+
+	// The wire_p table is optional
+	FO = fopen(oname ? oname : "/dev/null","w");
 	if(FO == NULL)
 	{
 		fprintf(stderr,"Can not open: [%s]\n", oname);
@@ -137,7 +674,7 @@ int main(int argc, char *argv[])
 	fprintf(FO,"#ifndef _EARTH_DATA_H_\n");
 	fprintf(FO,"#define _EARTH_DATA_H_\n");
 	fprintf(FO,"/**\n");
-	fprintf(FO," @file %s\n", basename(oname));
+	fprintf(FO," @file %s\n", oname ? basename(oname) : "");
 	fprintf(FO," Generated by:[%s/%s]\n", cwd, basename(argv[0]));
 	fprintf(FO," On: %s\n", get_date());
 	fprintf(FO," By Mike Gore 2015, Earth Wireframe C Table\n");
@@ -197,6 +734,7 @@ int main(int argc, char *argv[])
 				(int)x ,(int)y ,(int)z 
 				);
             //printf("\t{%f,%f,%f},\n", x,y,z);
+			add_point(x,y,z);
         }
         else
         {
@@ -211,6 +749,7 @@ int main(int argc, char *argv[])
 				(int)x ,(int)y ,(int)z ,
 				lon, lat);
             //printf("\t{%f,%f,%f},\n", x,y,z);
+			add_point(x,y,z);
         }
     }
 	fclose(FI);
@@ -233,6 +772,13 @@ int main(int argc, char *argv[])
 	fprintf(FO,"	extern MEMSPACE_RO wire_p earth_data[];\n");
 	fprintf(FO,"#endif /* _EARTH_DATA_H_ */\n");
 	fclose(FO);
+
+	memset(&mesh, 0, sizeof(mesh));
+	encode_mesh(&mesh, WIRE_MESH_LINES);
+	write_mesh(&mesh, mname, cname, name, argv[0]);
+	fprintf(stderr,"%d wire_p entries, compact mesh %d bytes, wire_p table %d bytes\n",
+		points_len, mesh.len, (int) ((points_len + 1) * sizeof(wire_p)));
+	free(mesh.data);
 	return(0);
 }
 
@@ -0,0 +1,131 @@
+/**
+ @file emu_sup.c
+
+ @brief Linux host support functions for the emulator builds
+  Host versions of the ESP8266 flash access, yield and timing functions
+  used by the display, wireframe and file system code.
+
+ @par Copyright &copy; 2018 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "user_config.h"
+
+#include <sys/time.h>
+
+/// @brief  Read byte from "flash"
+/// The host has no alignment restrictions
+/// @param[in] *p: address to read
+/// @return  uint8_t
+uint8_t read_flash8(uint8_t *p)
+{
+	return(*p);
+}
+
+/// @brief  Copy data from "flash" to Ram
+/// @param[in] *src: address to read from
+/// @param[out] *dest: address to write to
+/// @param[in] size: number of bytes to copy
+/// @return  void
+void cpy_flash(uint8_t *src, uint8_t *dest, int size)
+{
+	memcpy(dest, src, size);
+}
+
+/// @brief 16 bits reads from "flash"
+/// @param[in] *p: address to read
+/// @return  uint16_t
+uint16_t read_flash16(uint8_t *p)
+{
+    uint16_t tmp;
+    cpy_flash(p,(uint8_t *)&tmp, 2);
+    return(tmp);
+}
+
+/// @brief 32 bits reads from "flash"
+/// @param[in] *p: address to read
+/// @return  uint32_t
+uint32_t read_flash32(uint8_t *p)
+{
+    uint32_t tmp;
+    cpy_flash(p,(uint8_t *)&tmp, 4);
+    return(tmp);
+}
+
+/// @brief 64 bits reads from "flash"
+/// @param[in] *p: address to read
+/// @return  uint64_t
+uint64_t read_flash64(uint8_t *p)
+{
+    uint64_t tmp;
+    cpy_flash(p,(uint8_t *)&tmp, 8);
+    return(tmp);
+}
+
+/// @brief Test bit in byte array
+/// @param[in] *ptr: byte array
+/// @param[in] off: bit offset to test
+/// @return  1 if bit is set, 0 if not
+int bittestv(unsigned char *ptr, int off)
+{
+    return( (ptr[off>>3] & (0x80 >> (off&7))) );
+}
+
+/// @brief Test bit in w * h size bit array usng x and y offsets
+/// @param[in] *ptr: byte array
+/// @param[in] x: bit x offset
+/// @param[in] y: bit y offset
+/// @param[in] w: bit array wide
+/// @param[in] h: bit array high
+/// @return  1 if bit is set, 0 if not
+int bittestxy(unsigned char *ptr, int x, int y, int w, int h)
+{
+    if(y < 0 || y > h)
+        return 0;
+    if(x < 0 || x > w)
+        return 0;
+    return(bittestv(ptr, y * w + x));
+}
+
+/// @brief Yield - nothing else to run on the host
+/// @param[in] interval_us: ignored
+/// @return  void
+void optimistic_yield(uint32_t interval_us)
+{
+}
+
+/// @brief Watchdog reset - no watchdog on the host
+/// @return  void
+void wdt_reset(void)
+{
+}
+
+/// @brief Delay - skipped on the host so benchmarks only measure code
+/// @param[in] us: ignored
+/// @return  void
+void os_delay_us(uint32_t us)
+{
+}
+
+/// @brief Microsecond time stamp, same units as the SDK system_get_time()
+/// @return  time in microseconds
+uint32_t system_get_time(void)
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return( (uint32_t) (tv.tv_sec * 1000000UL + tv.tv_usec) );
+}
@@ -0,0 +1,187 @@
+/**
+ @file fs/fs_emu.c
+
+ @brief Linux host support for the file system tests
+  The project defines its own open, read, write, time and stdio functions,
+  so host services are reached with syscall() and mmap() only.
+  - Disk image file mapped into memory and attached to the RAM disk.
+  - Console output for stdout and stderr.
+  - Microsecond time stamps and memory allocation.
+
+ @par Copyright &copy; 2018 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Host mmap, open flags and syscall numbers, built with -std=c99
+#define _DEFAULT_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#define MEMSPACE	/* */
+#include "fatfs/integer.h"
+#include "fatfs.hal/diskio.h"
+#include "fatfs.hal/ramdisk.h"
+
+long syscall(long number, ...);
+
+/// @brief Host clock ids, host <time.h> clashes with lib/time.h
+#define HOST_CLOCK_REALTIME 0
+#define HOST_CLOCK_MONOTONIC 1
+
+/// @brief Host struct timespec layout
+typedef struct {
+	long tv_sec;
+	long tv_nsec;
+} host_ts_t;
+
+static uint8_t *image;
+static size_t image_size;
+
+void disk_image_close ( void );
+
+/// @brief Map a disk image file and attach it to the RAM disk
+/// The file is created or resized to the given size
+/// @param[in] *name: image file name
+/// @param[in] sectors: image size in 512 byte sectors
+/// @return  0 on success, -1 on error
+int disk_image_open(char *name, uint32_t sectors)
+{
+	long fd;
+	size_t size = (size_t) sectors * RAMDISK_SS;
+
+	disk_image_close();
+
+	fd = syscall(SYS_openat, AT_FDCWD, name, O_RDWR | O_CREAT, 0644);
+	if(fd < 0)
+		return(-1);
+	if(syscall(SYS_ftruncate, fd, (long) size) < 0)
+	{
+		syscall(SYS_close, fd);
+		return(-1);
+	}
+	image = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, (int) fd, 0);
+	syscall(SYS_close, fd);
+	if(image == MAP_FAILED)
+	{
+		image = NULL;
+		return(-1);
+	}
+	image_size = size;
+	ram_disk_attach(image, sectors);
+	return(0);
+}
+
+/// @brief Write back and unmap the disk image
+/// @return  void
+void disk_image_close(void)
+{
+	if(!image)
+		return;
+	ram_disk_attach(NULL, 0);
+	msync(image, image_size, MS_SYNC);
+	munmap(image, image_size);
+	image = NULL;
+	image_size = 0;
+}
+
+/// @brief Console output, stdout and stderr are attached with fdevopen()
+/// @param[in] c: character
+/// @param[in] *f: stream, unused
+/// @return  character written
+int host_putc(char c, void *f)
+{
+	syscall(SYS_write, 1, &c, 1);
+	return(c);
+}
+
+/// @brief Console input
+/// @param[in] *f: stream, unused
+/// @return  character read, -1 at end of input
+int host_getc(void *f)
+{
+	unsigned char c;
+
+	if(syscall(SYS_read, 0, &c, 1) != 1)
+		return(-1);
+	return(c);
+}
+
+/// @brief Microsecond time stamp, same units as the SDK system_get_time()
+/// @return  time in microseconds
+uint32_t system_get_time(void)
+{
+	host_ts_t ts;
+
+	syscall(SYS_clock_gettime, HOST_CLOCK_MONOTONIC, &ts);
+	return( (uint32_t) (ts.tv_sec * 1000000UL + ts.tv_nsec / 1000) );
+}
+
+/// @brief Wall clock time for clock_gettime()
+/// @param[out] *sec: seconds since 1970
+/// @param[out] *nsec: nanoseconds
+/// @return  void
+void host_clock(uint32_t *sec, long *nsec)
+{
+	host_ts_t ts;
+
+	syscall(SYS_clock_gettime, HOST_CLOCK_REALTIME, &ts);
+	*sec = ts.tv_sec;
+	*nsec = ts.tv_nsec;
+}
+
+/// @brief Yield - nothing else to run on the host
+/// @param[in] interval_us: ignored
+/// @return  void
+void optimistic_yield(uint32_t interval_us)
+{
+}
+
+/// @brief Watchdog reset - no watchdog on the host
+/// @return  void
+void wdt_reset(void)
+{
+}
+
+/// @brief Allocate zeroed memory, same as esp8266/system.c
+/// @param[in] nmemb: number of elements
+/// @param[in] size: size of elements
+/// @return  memory or NULL
+void *safecalloc(size_t nmemb, size_t size)
+{
+	return(calloc(nmemb, size));
+}
+
+/// @brief Allocate zeroed memory, same as esp8266/system.c
+/// @param[in] size: size of buffer
+/// @return  memory or NULL
+void *safemalloc(size_t size)
+{
+	return(calloc(size, 1));
+}
+
+/// @brief Free memory if not NULL
+/// @param[in] *p: memory
+/// @return  void
+void safefree(void *p)
+{
+	if(p)
+		free(p);
+}
@@ -0,0 +1,563 @@
+/**
+ @file fs/test_fatfs.c
+
+ @brief FatFs and posix tests and disk benchmarks on a disk image
+  Formats a disk image file, runs the posix and fatfs layers on it and
+  reports the disk traffic each file operation generates.
+  Single and multiple sector transfers are the SD card CMD17/CMD24 and
+  CMD18/CMD25 equivalents; times are for the image, not an SD card.
+
+ @par Copyright &copy; 2018 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "user_config.h"
+
+#include "posix/posix_tests.h"
+
+/// @brief Disk image size, 8M in 512 byte sectors
+#define IMAGE_SECTORS 16384
+
+/// @brief Large file size for the transfer tests
+#define BIG_SIZE (64L * 1024L)
+
+/// @brief SD card cost model for the estimated time column
+/// Each command costs SD_CMD_US for the command, the card access time and
+/// busy wait, each sector SD_SECTOR_US for 514 bytes with SPI at 20MHz
+/// Multiple sector transfers add a CMD12 or stop token
+#define SD_CMD_US		400
+#define SD_SECTOR_US	210
+
+/// @brief Run code once and display the disk traffic it generated
+#define BENCH(name, code) do { \
+	uint32_t _t; \
+	disk_stats_clear(); \
+	_t = system_get_time(); \
+	code; \
+	bench_print(name, system_get_time() - _t); \
+} while(0)
+
+/* fs_emu.c */
+int host_putc ( char c , void *f );
+int host_getc ( void *f );
+void host_clock ( uint32_t *sec , long *nsec );
+
+int errors = 0;
+char *image = "fatfs.img";
+
+/// @brief Report a failed test
+/// @param[in] cond: test result
+/// @param[in] *msg: test name
+/// @return void
+void check(int cond, char *msg)
+{
+	if(!cond)
+	{
+		printf("FAIL: %s\n", msg);
+		++errors;
+	}
+}
+
+/// @brief Host version of clock_gettime() in lib/timer.c, wall clock time
+/// @param[in] clk_id: ignored
+/// @param[out] *ts: time
+/// @return 0
+int clock_gettime(clockid_t clk_id, struct timespec *ts)
+{
+	host_clock(&ts->tv_sec, &ts->tv_nsec);
+	return(0);
+}
+
+/// @brief Host version of clock_settime() in lib/timer.c, the host clock is not set
+/// @param[in] clk_id: ignored
+/// @param[in] *ts: ignored
+/// @return -1
+int clock_settime(clockid_t clk_id, const struct timespec *ts)
+{
+	return(-1);
+}
+
+/// @brief Mount the disk, host version of mmc_init() in fatfs.hal/mmc_hal.c
+/// @param[in] verbose: display the volume status
+/// @return FatFs result
+int mmc_init(int verbose)
+{
+	int rc;
+
+	rc = disk_initialize(0);
+	if(rc == RES_OK)
+		rc = f_mount(&Fatfs[0],"/", 1);
+	if(rc != RES_OK || verbose)
+		put_rc(rc);
+	if(rc == RES_OK && verbose)
+		fatfs_status("/");
+	return(rc);
+}
+
+/// @brief Run a shell command the way user_main.c does
+/// @param[in] *cmd: command line
+/// @return 1 if a command matched
+int run(char *cmd)
+{
+	char line[128];
+	char *argv[10];
+	int argc;
+
+	strncpy(line, cmd, sizeof(line)-1);
+	line[sizeof(line)-1] = 0;
+	argc = split_args(line, argv, 10);
+	if(fatfs_tests(argc,argv))
+		return(1);
+	if(posix_tests(argc,argv))
+		return(1);
+	return(0);
+}
+
+/// @brief Test pattern byte for a file offset
+/// @param[in] off: offset
+/// @return pattern byte
+uint8_t pattern(long off)
+{
+	return((off * 7 + (off >> 9)) & 0xff);
+}
+
+/// @brief Write a file of pattern bytes with fwrite
+/// @param[in] *name: file name
+/// @param[in] size: file size
+/// @param[in] chunk: bytes per fwrite, up to 4096
+/// @return bytes written
+long write_big(char *name, long size, int chunk)
+{
+	static uint8_t buf[4096];
+	FILE *fp;
+	long off = 0;
+	int i, n;
+
+	fp = fopen(name,"w");
+	if(!fp)
+		return(-1);
+	while(off < size)
+	{
+		n = (size - off) < chunk ? (size - off) : chunk;
+		for(i=0;i<n;++i)
+			buf[i] = pattern(off+i);
+		if(fwrite(buf, 1, n, fp) != n)
+			break;
+		off += n;
+	}
+	fclose(fp);
+	return(off);
+}
+
+/// @brief Read a file of pattern bytes with fread and verify it
+/// @param[in] *name: file name
+/// @param[in] chunk: bytes per fread, up to 4096
+/// @return bytes read, -1 on a mismatch or error
+long read_big(char *name, int chunk)
+{
+	static uint8_t buf[4096];
+	FILE *fp;
+	long off = 0;
+	int i, n;
+
+	fp = fopen(name,"r");
+	if(!fp)
+		return(-1);
+	while((n = fread(buf, 1, chunk, fp)) > 0)
+	{
+		for(i=0;i<n;++i)
+		{
+			if(buf[i] != pattern(off+i))
+			{
+				fclose(fp);
+				return(-1);
+			}
+		}
+		off += n;
+	}
+	fclose(fp);
+	return(off);
+}
+
+/// @brief Write a text file of numbered lines with fprintf
+/// @param[in] *name: file name
+/// @param[in] lines: line count
+/// @return 0 on success
+int write_lines(char *name, int lines)
+{
+	FILE *fp;
+	int i;
+
+	fp = fopen(name,"w");
+	if(!fp)
+		return(-1);
+	for(i=0;i<lines;++i)
+		fprintf(fp,"line %d of the test file\r\n", i);
+	fclose(fp);
+	return(0);
+}
+
+/// @brief Read a text file of numbered lines with fgets and verify it
+/// fgets() in posix.c removes the end of line
+/// @param[in] *name: file name
+/// @return lines read, -1 on a mismatch or error
+int read_lines(char *name)
+{
+	char line[80];
+	char expect[80];
+	FILE *fp;
+	int i = 0;
+
+	fp = fopen(name,"r");
+	if(!fp)
+		return(-1);
+	while(fgets(line, sizeof(line), fp) != NULL)
+	{
+		snprintf(expect, sizeof(expect), "line %d of the test file", i);
+		if(strcmp(line, expect) != 0)
+		{
+			fclose(fp);
+			return(-1);
+		}
+		++i;
+	}
+	fclose(fp);
+	return(i);
+}
+
+/// @brief Read a file with fgetc
+/// @param[in] *name: file name
+/// @return characters read
+long read_chars(char *name)
+{
+	FILE *fp;
+	long count = 0;
+
+	fp = fopen(name,"r");
+	if(!fp)
+		return(-1);
+	while(fgetc(fp) != EOF)
+		++count;
+	fclose(fp);
+	return(count);
+}
+
+/// @brief Open, read and close small files, like serving web pages
+/// @param[in] files: file count
+/// @return files read
+int read_small(int files)
+{
+	char name[32];
+	char buf[64];
+	FILE *fp;
+	int i, n = 0;
+
+	for(i=0;i<files;++i)
+	{
+		snprintf(name, sizeof(name), "/www/file%d.htm", i);
+		fp = fopen(name,"r");
+		if(!fp)
+			continue;
+		if(fread(buf, 1, sizeof(buf), fp) > 0)
+			++n;
+		fclose(fp);
+	}
+	return(n);
+}
+
+/// @brief Create small files
+/// @param[in] files: file count
+/// @return files created
+int write_small(int files)
+{
+	char name[32];
+	FILE *fp;
+	int i, n = 0;
+
+	mkdir("/www", 0777);
+	for(i=0;i<files;++i)
+	{
+		snprintf(name, sizeof(name), "/www/file%d.htm", i);
+		fp = fopen(name,"w");
+		if(!fp)
+			continue;
+		fprintf(fp,"<html><body>page %d</body></html>\n", i);
+		fclose(fp);
+		++n;
+	}
+	return(n);
+}
+
+/// @brief Display one benchmark result
+/// @param[in] *name: benchmark name
+/// @param[in] us: elapsed time
+/// @return void
+void bench_print(char *name, uint32_t us)
+{
+	DSTATS *d = &disk_stats;
+	long sd;
+
+	sd = (d->read_single + d->write_single) * SD_CMD_US
+		+ (d->read_multi + d->write_multi) * 2 * SD_CMD_US
+		+ (d->read_sectors + d->write_sectors) * SD_SECTOR_US;
+
+	printf("%-26s %6ld %8ld %6ld %6ld %6ld %6ld %6ld %6ld %6ld %6ld %6ld %6ld\n", name,
+		(long) us, sd,
+		(long) d->read_sectors, (long) d->read_single, (long) d->read_multi,
+		(long) d->write_sectors, (long) d->write_single, (long) d->write_multi,
+		(long) d->syncs,
+		(long) (d->reads ? d->read_us / d->reads : 0),
+		(long) (d->writes ? d->write_us / d->writes : 0),
+		(long) d->cache_hits);
+}
+
+/// @brief Verify the sector cache in diskio.c with raw sector transfers
+/// Uses free sectors at the end of the image
+/// @return 0
+int cache_tests()
+{
+	static uint8_t sec[512];
+	static uint8_t buf[512*3];
+	DWORD s = IMAGE_SECTORS - 16;
+	int i;
+
+	disk_cache_enable(1);
+	memset(sec, 0x5a, sizeof(sec));
+	disk_stats_clear();
+	check(disk_write(0, sec, s + 1, 1) == RES_OK, "cache write");
+	check(disk_stats.write_sectors == 0, "cache write back delayed");
+	check(disk_read(0, buf, s, 3) == RES_OK && memcmp(buf + 512, sec, 512) == 0,
+		"cache multiple sector read sees dirty sector");
+	check(disk_ioctl(0, CTRL_SYNC, NULL) == RES_OK && disk_stats.write_sectors == 1, "cache sync");
+	check(disk_stats.cache_writebacks == 1, "cache write back count");
+
+	disk_stats_clear();
+	check(disk_read(0, buf, s + 1, 1) == RES_OK && memcmp(buf, sec, 512) == 0, "cache read");
+	check(disk_stats.cache_hits == 1 && disk_stats.reads == 0, "cache hit");
+
+	// Multiple sector writes go to the drive and update cached copies
+	memset(buf, 0xa5, sizeof(buf));
+	check(disk_write(0, buf, s, 3) == RES_OK && disk_stats.write_multi == 1, "cache write through");
+	check(disk_read(0, sec, s + 1, 1) == RES_OK && sec[0] == 0xa5, "cache updated by write");
+
+	// Sequential misses read ahead
+	disk_cache_enable(1);
+	disk_stats_clear();
+	for(i=0;i<8;++i)
+		disk_read(0, sec, s + i, 1);
+	check(disk_stats.read_multi == 2 && disk_stats.cache_readahead == 6, "cache read ahead");
+	check(disk_stats.cache_hits == 5 && disk_stats.cache_misses == 3, "cache read ahead hits");
+
+	// Evicted dirty sectors are written back
+	disk_stats_clear();
+	for(i=0;i<DISK_CACHE_SECTORS+1;++i)
+		disk_write(0, buf, s + i, 1);
+	check(disk_stats.cache_writebacks == 1, "cache eviction write back");
+	disk_ioctl(0, CTRL_SYNC, NULL);
+	check(disk_stats.cache_writebacks == DISK_CACHE_SECTORS+1, "cache flush all");
+	return(0);
+}
+
+/// @brief Stream buffer position, flush and end of line tests
+/// @return 0 on success, else the number of the failed step
+int stdio_tests()
+{
+	FILE *fp;
+	char line[600];
+	int i;
+
+	fp = fopen("/stdio.txt","w+");
+	if(!fp)
+		return(1);
+	fputs("abc\r\ndef\rghi\n", fp);
+	if(ftell(fp) != 13)
+		return(2);
+	// Written data stays in the buffer until fflush
+	if(f_size(fileno_to_fatfs(fileno(fp))) != 0 || fflush(fp) != 0)
+		return(3);
+	if(f_size(fileno_to_fatfs(fileno(fp))) != 13)
+		return(4);
+
+	rewind(fp);
+	if(fgets(line, sizeof(line), fp) == NULL || strcmp(line, "abc") != 0 || ftell(fp) != 5)
+		return(5);
+	if(fgets(line, sizeof(line), fp) == NULL || strcmp(line, "def") != 0 || ftell(fp) != 9)
+		return(6);
+	// Seek into the middle of a CR LF pair
+	if(fseek(fp, 3, SEEK_SET) != 0 || fgetc(fp) != '\n' || fgetc(fp) != 'd')
+		return(7);
+	// Write after read replaces the byte at the read position
+	if(fputc('X', fp) != 'X' || ftell(fp) != 7)
+		return(8);
+	if(fseek(fp, -2, SEEK_CUR) != 0 || fgetc(fp) != 'd' || fgetc(fp) != 'X' || fgetc(fp) != 'f')
+		return(9);
+	// EOF is cleared by fseek
+	while(fgetc(fp) != EOF)
+		;
+	if(!feof(fp) || fseek(fp, -4, SEEK_END) != 0 || feof(fp) || fgetc(fp) != 'g')
+		return(10);
+	fclose(fp);
+
+	// CR as the last byte of a buffer block
+	fp = fopen("/stdio.txt","w");
+	if(!fp)
+		return(11);
+	for(i=0;i<POSIX_BUFSIZE-1;++i)
+		fputc('a', fp);
+	fputs("\r\nb", fp);
+	fclose(fp);
+	fp = fopen("/stdio.txt","r");
+	if(!fp)
+		return(12);
+	if(fgets(line, sizeof(line), fp) == NULL || strlen(line) != POSIX_BUFSIZE-1)
+		return(13);
+	if(fgets(line, sizeof(line), fp) == NULL || strcmp(line, "b") != 0)
+		return(14);
+	fclose(fp);
+
+	// Unbuffered streams read the same data
+	fp = fopen("/stdio.txt","r");
+	if(!fp)
+		return(15);
+	if(setvbuf(fp, NULL, _IONBF, 0) != 0 || fseek(fp, POSIX_BUFSIZE-2, SEEK_SET) != 0)
+		return(16);
+	if(fgetc(fp) != 'a' || fgetc(fp) != '\n' || fgetc(fp) != 'b' || fgetc(fp) != EOF)
+		return(17);
+	fclose(fp);
+	return(0);
+}
+
+/// @brief Format the image and verify the file system layers on it
+/// @return void
+void tests()
+{
+	static uint8_t work[_MAX_SS];
+	long size;
+
+	check(f_mkfs("0:", FM_ANY, 0, work, sizeof(work)) == FR_OK, "f_mkfs");
+	check(mmc_init(0) == RES_OK, "mount");
+
+	// Disk statistics follow the transfers
+	disk_stats_clear();
+	check(write_big("/big.bin", BIG_SIZE, 4096) == BIG_SIZE, "fwrite");
+	check(disk_stats.write_sectors >= BIG_SIZE / 512, "stats sectors written");
+	check(disk_stats.write_multi > 0, "stats multiple sector writes");
+	check(disk_stats.syncs > 0, "stats fclose syncs");
+	disk_stats_clear();
+	check(read_big("/big.bin", 4096) == BIG_SIZE, "fread");
+	check(disk_stats.read_sectors >= BIG_SIZE / 512, "stats sectors read");
+	check(disk_stats.read_multi > 0, "stats multiple sector reads");
+	check(disk_stats.errors == 0, "stats errors");
+
+	// Sector cache, single sector writes wait for CTRL_SYNC
+	check(cache_tests() == 0, "sector cache");
+
+	// Unaligned small transfers
+	check(write_big("/odd.bin", 3000, 17) == 3000, "fwrite small chunks");
+	check(read_big("/odd.bin", 13) == 3000, "fread small chunks");
+	check(read_chars("/odd.bin") == 3000, "fgetc");
+
+	// Text files, CR LF is folded to LF on reads
+	check(write_lines("/lines.txt", 100) == 0, "fprintf");
+	check(read_lines("/lines.txt") == 100, "fgets");
+	check(stdio_tests() == 0, "stream buffers");
+	check(run("posix bench /lines.txt") == 1, "posix bench command");
+
+	// Directories and shell commands
+	check(write_small(8) == 8, "small files");
+	check(read_small(8) == 8, "small file reads");
+	check(run("fatfs stats") == 1, "fatfs stats command");
+	check(run("fatfs stats clear") == 1 && disk_stats.reads == 0, "fatfs stats clear");
+	check(run("fatfs cache off") == 1 && read_small(8) == 8 && disk_stats.cache_hits == 0, "fatfs cache off");
+	check(run("fatfs cache on") == 1 && read_small(8) == 8 && disk_stats.cache_hits > 0, "fatfs cache on");
+	check(run("ls /www") == 1, "posix ls command");
+
+	// Data is in the image after it is closed and mapped again
+	disk_image_close();
+	check(disk_status(0) & STA_NOINIT, "image detached");
+	check(disk_image_open(image, IMAGE_SECTORS) == 0, "image reopen");
+	check(mmc_init(0) == RES_OK, "remount");
+	size = read_big("/big.bin", 4096);
+	check(size == BIG_SIZE, "image keeps data");
+}
+
+/// @brief File operation disk traffic and times
+/// @param[in] *title: table title
+/// @return void
+void bench_files(char *title)
+{
+	long n;
+
+	printf("%s\n", title);
+	printf("%-26s %6s %8s %6s %6s %6s %6s %6s %6s %6s %6s %6s %6s\n", "operation", "us", "SD us",
+		"rsect", "CMD17", "CMD18", "wsect", "CMD24", "CMD25", "sync", "rd us", "wr us", "hits");
+	BENCH("fwrite 64K by 4096", n = write_big("/big.bin", BIG_SIZE, 4096));
+	BENCH("fread 64K by 4096", n = read_big("/big.bin", 4096));
+	BENCH("fwrite 64K by 100", n = write_big("/big.bin", BIG_SIZE, 100));
+	BENCH("fread 64K by 100", n = read_big("/big.bin", 100));
+	BENCH("fgetc 64K", n = read_chars("/big.bin"));
+	BENCH("fprintf 1000 lines", n = write_lines("/lines.txt", 1000));
+	BENCH("fgets 1000 lines", n = read_lines("/lines.txt"));
+	BENCH("create 32 small files", n = write_small(32));
+	BENCH("read 32 small files", n = read_small(32));
+	BENCH("read 32 small files again", n = read_small(32));
+	(void) n;
+	disk_stats_print();
+}
+
+/// @brief File operation disk traffic with and without the sector cache
+/// @return void
+void benchmarks()
+{
+	disk_cache_enable(0);
+	bench_files("No sector cache");
+	disk_cache_enable(1);
+	bench_files("Sector cache");
+	printf("fgets 1000 lines\n");
+	run("posix bench /lines.txt");
+}
+
+int main(int argc, char *argv[])
+{
+	int i;
+
+	fdevopen((void *)host_putc, (void *)host_getc);
+
+	for(i=1;i<argc;++i)
+	{
+		if(strcmp(argv[i],"-i") == 0 && i+1 < argc)
+			image = argv[++i];
+	}
+
+	if(disk_image_open(image, IMAGE_SECTORS) != 0)
+	{
+		printf("Can not open disk image %s\n", image);
+		return(1);
+	}
+
+	printf("=======================\n");
+	printf("File system tests\n");
+	tests();
+	printf("%d errors\n", errors);
+	printf("=======================\n");
+	printf("File system benchmarks\n");
+	benchmarks();
+	printf("=======================\n");
+
+	disk_image_close();
+	return(errors ? 1 : 0);
+}
@@ -0,0 +1,72 @@
+/**
+ @file fs/user_config.h
+
+ @brief Master include file for Linux host builds of the file system
+  Replaces include/user_config.h when FatFs, posix and the file system
+  tests are compiled on Linux with a disk image in place of the SD card.
+  The project supplies its own stdio, time and string functions, so no
+  host stdio or time headers are included here.
+
+ @par Copyright &copy; 2018 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __USER_CONFIG_H__
+#define __USER_CONFIG_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+
+// Strict C99 host headers, the POSIX types and functions come from posix.h
+#include <string.h>
+#include <stdlib.h>
+
+// Named address spaces are meaningless on the host
+#define MEMSPACE		/* */
+#define MEMSPACE_RO		/* */
+#define ICACHE_FLASH_ATTR	/* */
+#define ICACHE_RODATA_ATTR	/* */
+#define LOCAL static
+
+/// @brief user task rate for software timers
+#define SYSTEM_TASK_HZ 1000L
+
+/// @brief macros to simplify filling buffers
+#define Mem_Clear(a) memset(a, 0, sizeof(a))
+#define Mem_Set(a,b) memset(a, (int) b, sizeof(a))
+
+// safecalloc and friends - host versions in fs_emu.c
+#include "esp8266/system.h"
+
+#include "lib/stringsup.h"
+
+// FATFS
+#include "fatfs.h"
+
+#include "posix.h"
+
+// scanf,printf and math i/o functions
+#include "printf/mathio.h"
+
+/* fs_emu.c */
+void optimistic_yield ( uint32_t interval_us );
+uint32_t system_get_time ( void );
+int disk_image_open ( char *name , uint32_t sectors );
+void disk_image_close ( void );
+
+#endif // __USER_CONFIG_H__
@@ -0,0 +1,606 @@
+/**
+ @file ili9341_emu.c
+
+ @brief ILI9341 emulator for Linux host builds
+  Replaces the SPI HAL in display/ili9341_hal.c with an in memory model
+  of the panel so the display code can be tested and benchmarked without hardware.
+  - Decodes CASET, PASET, RAMWR, RAMWRC, RAMRD, RAMRDC, MADCTL, VSCRDEF, VSCRSADD
+  - 240 x 320 RGB565 GRAM, snapshots written as PPM files
+  - Counts command bytes, data bytes, received bytes, chip selects and FIFO loads
+
+ @par Copyright &copy; 2018 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "user_config.h"
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+
+#include "display/font.h"
+#include "display/ili9341.h"
+#include "3rd_party/ili9341_adafruit.h"
+#include "ili9341_emu.h"
+
+// TFT master window definition
+extern window tftwin;
+extern window *tft;
+
+/// @brief cache of SPI clock devisor, same meaning as ili9341_hal.c
+uint32_t tft_clock = -1;
+
+uint16_t tft_ID;
+
+/// @brief SPI bus traffic counters
+tft_emu_stats_t tft_emu;
+
+/// @brief Panel GRAM [row][column]
+static uint16_t gram[EMU_TFT_H][EMU_TFT_W];
+
+/// @brief Panel controller state
+static struct
+{
+	uint8_t cmd;		// last command
+	int count;			// parameter bytes received for the last command
+	uint8_t par[8];		// parameter bytes
+	uint16_t sc,ec;		// CASET start and end column
+	uint16_t sp,ep;		// PASET start and end page
+	uint16_t col,page;	// current memory address
+	int hi;				// pending high byte of a pixel, -1 if none
+	uint8_t madctl;		// memory access control
+	uint8_t invert;		// display inversion
+	uint16_t tfa,vsa,bfa;	// vertical scrolling definition
+	uint16_t vsp;		// vertical scrolling start address
+	uint8_t reading;	// memory read in progress
+	uint8_t dummy;		// memory read dummy byte pending
+	uint8_t rgb[3];		// memory read pixel
+	int rgb_ind;		// next memory read pixel byte
+	uint8_t reg;		// 0xd9 register read parameter
+	uint8_t cs;			// chip select asserted
+} emu;
+
+/// @brief Read ID4 parameters returned by command 0xd3
+static uint8_t emu_id4[4] = { 0x00, 0x00, 0x93, 0x41 };
+
+/// @brief Clear SPI bus traffic counters
+/// @return void
+void tft_emu_clear_stats()
+{
+	memset(&tft_emu, 0, sizeof(tft_emu));
+}
+
+/// @brief SPI clock frequency for the current tft_clock prescale
+/// Matches hspi_init(), prescale 0 is the 80MHz system clock
+/// otherwise the clock is 80MHz / (prescale * 2)
+/// @return clock in HZ
+uint32_t tft_emu_spi_hz()
+{
+	if(tft_clock == 0 || tft_clock == (uint32_t) -1)
+		return(80000000UL);
+	return(80000000UL / (tft_clock * 2));
+}
+
+/// @brief Time the SPI bus is busy for the counted bytes
+/// Full duplex transfers are only counted once
+/// @param[in] *s: SPI bus traffic counters
+/// @return microseconds
+uint32_t tft_emu_bus_us(tft_emu_stats_t *s)
+{
+	double bits = ((double) s->cmd + s->data + s->rx) * 8.0;
+	return( (uint32_t) (bits * 1000000.0 / (double) tft_emu_spi_hz()) );
+}
+
+/// @brief Display the SPI bus traffic counters averaged per call
+/// @param[in] *name: test name
+/// @param[in] calls: number of calls the counters cover
+/// @return void
+void tft_emu_print_stats(char *name, int calls)
+{
+	double n = calls > 0 ? calls : 1;
+
+	printf("%-20s %6d cmd:%9.1f data:%10.1f rx:%9.1f cs:%7.1f fifo:%8.1f win:%7.1f bus:%10.1fus\n",
+		name, calls,
+		tft_emu.cmd / n, tft_emu.data / n, tft_emu.rx / n,
+		tft_emu.cs / n, tft_emu.fifo / n, tft_emu.windows / n,
+		tft_emu_bus_us(&tft_emu) / n);
+}
+
+/// @brief Map controller column and page address to GRAM row and column
+/// @param[in] col: column address
+/// @param[in] page: page address
+/// @param[out] *row: GRAM row
+/// @param[out] *k: GRAM column
+/// @return 1 if address is inside the panel, 0 if not
+static int emu_map(uint16_t col, uint16_t page, int *row, int *k)
+{
+	int x,y;
+
+	if(emu.madctl & MADCTL_MV)
+	{
+		x = page;
+		y = col;
+	}
+	else
+	{
+		x = col;
+		y = page;
+	}
+	if(x >= EMU_TFT_W || y >= EMU_TFT_H)
+		return(0);
+	if(emu.madctl & MADCTL_MX)
+		x = EMU_TFT_W - 1 - x;
+	if(emu.madctl & MADCTL_MY)
+		y = EMU_TFT_H - 1 - y;
+	*row = y;
+	*k = x;
+	return(1);
+}
+
+/// @brief Advance memory address inside the CASET/PASET window
+/// @return void
+static void emu_next()
+{
+	if(++emu.col > emu.ec)
+	{
+		emu.col = emu.sc;
+		if(++emu.page > emu.ep)
+			emu.page = emu.sp;
+	}
+}
+
+/// @brief Write pixel at current memory address
+/// @param[in] color: 565 color
+/// @return void
+static void emu_write(uint16_t color)
+{
+	int row,k;
+
+	if(emu_map(emu.col, emu.page, &row, &k))
+		gram[row][k] = color;
+	tft_emu.wr++;
+	emu_next();
+}
+
+/// @brief Read next byte of 18bit pixel data at the current memory address
+/// @return byte
+static uint8_t emu_read()
+{
+	int row,k;
+	uint16_t color = 0;
+
+	if(emu.dummy)
+	{
+		emu.dummy = 0;
+		return(0);
+	}
+	if(emu.rgb_ind >= 3)
+	{
+		if(emu_map(emu.col, emu.page, &row, &k))
+			color = gram[row][k];
+		tft_565toRGB(color, &emu.rgb[0], &emu.rgb[1], &emu.rgb[2]);
+		emu.rgb_ind = 0;
+		tft_emu.rd++;
+		emu_next();
+	}
+	return(emu.rgb[emu.rgb_ind++]);
+}
+
+/// @brief Process command byte
+/// @param[in] cmd: command
+/// @return void
+static void emu_cmd(uint8_t cmd)
+{
+	// NOP does not end a memory read, it clocks out the dummy byte
+	if(cmd == ILI9341_NOP)
+		return;
+
+	emu.cmd = cmd;
+	emu.count = 0;
+	emu.reading = 0;
+
+	switch(cmd)
+	{
+		case ILI9341_CASET:
+		case ILI9341_PASET:
+			tft_emu.windows++;
+			break;
+		case ILI9341_RAMWR:
+			emu.col = emu.sc;
+			emu.page = emu.sp;
+			emu.hi = -1;
+			break;
+		case 0x3c:	// Memory Write Continue
+			emu.hi = -1;
+			break;
+		case ILI9341_RAMRD:
+			emu.col = emu.sc;
+			emu.page = emu.sp;
+			// fall through
+		case 0x3e:	// Memory Read Continue
+			emu.reading = 1;
+			emu.dummy = 1;
+			emu.rgb_ind = 3;
+			break;
+		case ILI9341_INVOFF:
+			emu.invert = 0;
+			break;
+		case ILI9341_INVON:
+			emu.invert = 1;
+			break;
+	}
+}
+
+/// @brief Process data byte
+/// @param[in] data: data
+/// @return byte read back
+static uint8_t emu_data(uint8_t data)
+{
+	uint8_t *p = emu.par;
+
+	if(emu.count < sizeof(emu.par))
+		emu.par[emu.count] = data;
+	emu.count++;
+
+	switch(emu.cmd)
+	{
+		case ILI9341_CASET:
+			if(emu.count == 4)
+			{
+				emu.sc = (p[0] << 8) | p[1];
+				emu.ec = (p[2] << 8) | p[3];
+			}
+			break;
+		case ILI9341_PASET:
+			if(emu.count == 4)
+			{
+				emu.sp = (p[0] << 8) | p[1];
+				emu.ep = (p[2] << 8) | p[3];
+			}
+			break;
+		case ILI9341_RAMWR:
+		case 0x3c:
+			if(emu.hi < 0)
+			{
+				emu.hi = data;
+			}
+			else
+			{
+				emu_write((emu.hi << 8) | data);
+				emu.hi = -1;
+			}
+			break;
+		case 0x33:	// Vertical Scrolling Definition
+			if(emu.count == 6)
+			{
+				emu.tfa = (p[0] << 8) | p[1];
+				emu.vsa = (p[2] << 8) | p[3];
+				emu.bfa = (p[4] << 8) | p[5];
+			}
+			break;
+		case 0x37:	// Vertical Scrolling Start Address
+			if(emu.count == 2)
+				emu.vsp = (p[0] << 8) | p[1];
+			break;
+		case ILI9341_MADCTL:
+			emu.madctl = data;
+			break;
+		case 0xd9:	// Undocumented register read parameter select
+			emu.reg = data - 0x10;
+			break;
+		case 0xd3:	// Read ID4
+			return(emu_id4[emu.reg & 3]);
+	}
+	return(0);
+}
+
+/// @brief Clock one byte over the SPI bus
+/// @param[in] data: byte to send
+/// @param[in] command: 1 = command, 0 = data
+/// @return byte received
+static uint8_t emu_byte(uint8_t data, uint8_t command)
+{
+	uint8_t rx;
+
+	// The panel drives MISO during a memory read regardless of D/C
+	if(emu.reading)
+	{
+		rx = emu_read();
+		if(command && data != ILI9341_NOP)
+			emu_cmd(data);
+		return(rx);
+	}
+	if(command)
+	{
+		emu_cmd(data);
+		return(0);
+	}
+	return(emu_data(data));
+}
+
+/// @brief GRAM pixel by physical row and column
+/// @param[in] col: GRAM column
+/// @param[in] row: GRAM row
+/// @return 565 color
+uint16_t tft_emu_gram(int16_t col, int16_t row)
+{
+	if(col < 0 || col >= EMU_TFT_W || row < 0 || row >= EMU_TFT_H)
+		return(0);
+	return(gram[row][col]);
+}
+
+/// @brief GRAM pixel by controller address, using the current rotation
+/// Does not touch the SPI bus or the counters
+/// @param[in] x: column address - absolute X
+/// @param[in] y: page address - absolute Y
+/// @return 565 color
+uint16_t tft_emu_pixel(int16_t x, int16_t y)
+{
+	int row,k;
+
+	if(x < 0 || y < 0 || !emu_map(x, y, &row, &k))
+		return(0);
+	return(gram[row][k]);
+}
+
+/// @brief Pixel as seen on the glass, portrait orientation
+/// The panel is mounted mirrored in X so MADCTL_MX gives an upright image
+/// Applies the vertical scrolling start address and display inversion
+/// @param[in] x: 0 .. EMU_TFT_W-1
+/// @param[in] y: 0 .. EMU_TFT_H-1
+/// @return 565 color
+uint16_t tft_emu_view(int16_t x, int16_t y)
+{
+	int row = y;
+	uint16_t color;
+
+	if(emu.vsa && y >= emu.tfa && y < emu.tfa + emu.vsa)
+		row = emu.tfa + ((emu.vsp - emu.tfa) + (y - emu.tfa)) % emu.vsa;
+
+	color = tft_emu_gram(EMU_TFT_W - 1 - x, row);
+	if(emu.invert)
+		color = ~color;
+	return(color);
+}
+
+/// @brief Save the panel as seen on the glass to a PPM file
+/// @param[in] *name: file name
+/// @return 0 on success, -1 on error
+int tft_emu_ppm(char *name)
+{
+	FILE *fp;
+	int x,y;
+	uint8_t r,g,b;
+	uint16_t color;
+
+	fp = fopen(name,"wb");
+	if(fp == NULL)
+	{
+		printf("tft_emu_ppm: Can not open: [%s]\n", name);
+		return(-1);
+	}
+	fprintf(fp,"P6\n%d %d\n255\n", EMU_TFT_W, EMU_TFT_H);
+	for(y=0;y<EMU_TFT_H;++y)
+	{
+		for(x=0;x<EMU_TFT_W;++x)
+		{
+			color = tft_emu_view(x,y);
+			tft_565toRGB(color, &r, &g, &b);
+			// replicate the high bits into the low bits for full range
+			fputc(r | (r >> 5), fp);
+			fputc(g | (g >> 6), fp);
+			fputc(b | (b >> 5), fp);
+		}
+	}
+	fclose(fp);
+	return(0);
+}
+
+/// =============================================================
+/// =============================================================
+/// Emulated SPI Hardware Abstraction Layer
+/// Same interface as display/ili9341_hal.c
+
+/// @brief  Initialize TFT SPI clock speed for slow speed
+/// return: void
+void tft_spi_init_slow()
+{
+	tft_clock = 2;
+}
+
+/// @brief  Initialize TFT SPI clock speed for normal speed
+/// return: void
+void tft_spi_init_fast()
+{
+	tft_clock = 1;
+}
+
+/// @brief  Assert chip select
+/// return: void
+void tft_spi_begin()
+{
+	if(!emu.cs)
+		tft_emu.cs++;
+	emu.cs = 1;
+}
+
+/// @brief  Deassert chip select
+/// A memory read is aborted when chip select goes high
+/// return: void
+void tft_spi_end()
+{
+	emu.cs = 0;
+	emu.reading = 0;
+}
+
+/// @brief  Initialize ILI9341 reset GPIO
+/// return: void
+void tft_reset_init()
+{
+}
+
+/// @brief  Enable ILI9341 reset - resets the panel model
+/// return: void
+void tft_reset_enable()
+{
+	memset(&emu, 0, sizeof(emu));
+	emu.hi = -1;
+	emu.ec = EMU_TFT_W - 1;
+	emu.ep = EMU_TFT_H - 1;
+	emu.vsa = EMU_TFT_H;
+}
+
+/// @brief  Initialize ILI9341 command/data GPIO
+/// return: void
+void tft_addr_init()
+{
+}
+
+/// @brief  Disable ILI9341 reset
+/// return: void
+void tft_reset_disable()
+{
+}
+
+/// @brief  Transmit 8 bit data array
+/// @param[in] *data: data buffer to send
+/// @param[in] bytes: data buffer size
+/// @param[in] command: 1 = command, 0 = data
+/// return: void
+void tft_spi_TX(uint8_t *data, int bytes, uint8_t command)
+{
+	if(bytes <= 0)
+		return;
+	tft_emu.fifo += (bytes + HSPI_FIFO_SIZE - 1) / HSPI_FIFO_SIZE;
+	if(command)
+		tft_emu.cmd += bytes;
+	else
+		tft_emu.data += bytes;
+	while(bytes--)
+		(void) emu_byte(*data++, command);
+}
+
+/// @brief  Transmit a data stream in FIFO half size chunks
+/// Each chunk counts as one FIFO load
+/// @param[in] fill: fills up to HSPI_HALF_SIZE bytes, returns 0 when done
+/// @param[in] *arg: argument passed to fill
+/// return: void
+void tft_spi_TX_stream(hspi_fill_t fill, void *arg)
+{
+	uint8_t buf[HSPI_HALF_SIZE];
+	int bytes;
+
+	while((bytes = fill(arg, buf, sizeof(buf))) > 0)
+		tft_spi_TX(buf, bytes, 0);
+}
+
+/// @brief  Transmit a data pattern count times
+/// The FIFO is loaded once, each restart is not a FIFO load
+/// @param[in] *pattern: pattern to send
+/// @param[in] bytes: pattern size 1 .. HSPI_FIFO_SIZE
+/// @param[in] count: number of times to send the pattern
+/// return: void
+void tft_spi_repeat(uint8_t *pattern, int bytes, int32_t count)
+{
+	int i;
+
+	if(bytes < 1 || bytes > HSPI_FIFO_SIZE || count < 1)
+		return;
+	tft_emu.fifo++;
+	tft_emu.data += count * bytes;
+	while(count-- > 0)
+	{
+		for(i=0;i<bytes;++i)
+			(void) emu_byte(pattern[i], 0);
+	}
+}
+
+/// @brief  Transmit and read 8 bit data array
+/// @param[in] *data: data buffer to send, overwritten with the result
+/// @param[in] bytes: data buffer size
+/// @param[in] command: 1 = command, 0 = data
+/// return: void
+void tft_spi_TXRX(uint8_t * data, int bytes, uint8_t command)
+{
+	if(bytes <= 0)
+		return;
+	tft_emu.fifo += (bytes + HSPI_FIFO_SIZE - 1) / HSPI_FIFO_SIZE;
+	if(command)
+		tft_emu.cmd += bytes;
+	else
+		tft_emu.data += bytes;
+	while(bytes--)
+	{
+		*data = emu_byte(*data, command);
+		++data;
+	}
+}
+
+/// @brief  Read 8 bit data array
+/// @param[in] *data: receive buffer
+/// @param[in] bytes: data buffer size
+/// @param[in] command: 1 = command, 0 = data
+/// return: void
+void tft_spi_RX(uint8_t *data, int bytes, uint8_t command)
+{
+	if(bytes <= 0)
+		return;
+	tft_emu.fifo += (bytes + HSPI_FIFO_SIZE - 1) / HSPI_FIFO_SIZE;
+	tft_emu.rx += bytes;
+	// hspi_RX() sends 0xff while reading
+	while(bytes--)
+	{
+		if(emu.reading)
+			*data++ = emu_read();
+		else
+			*data++ = 0xff;
+	}
+}
+
+/// @brief Initialize TFT, same sequence as display/ili9341_hal.c
+/// @return master window
+window *tft_init(void)
+{
+	tft_addr_init();
+	tft_spi_init_slow();
+
+	// reset display
+	tft_reset_init();
+    tft_reset_enable();
+    tft_reset_disable();
+
+	/* Adafruit 9341 TFT Display Initialization */
+    tft_configRegister();
+
+	/* Read the TFT ID value */
+    tft_ID = tft_readId();
+
+	// fast SPI
+	tft_spi_init_fast();
+
+	/* Setup the master window */
+    tft_window_init(tft, TFT_XOFF, TFT_YOFF, TFT_W, TFT_H);
+    tft_setRotation(0);
+    tft_fillWin(tft, tft->bg);
+
+    return (tft);
+}
+
+/// End of emulated SPI HAL interface
+/// =============================================================
+/// =============================================================
@@ -0,0 +1,74 @@
+/**
+ @file ili9341_emu.h
+
+ @brief ILI9341 emulator for Linux host builds
+  Replaces display/ili9341_hal.c with an in memory model of the panel.
+
+ @par Copyright &copy; 2018 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _ILI9341_EMU_H_
+#define _ILI9341_EMU_H_
+
+/// @brief Physical panel size, GRAM is 240 columns by 320 rows
+#define EMU_TFT_W 240
+#define EMU_TFT_H 320
+
+/// @brief SPI bus traffic counters
+/// Every byte that crosses the bus is counted exactly once
+typedef struct
+{
+	uint32_t cmd;		// bytes sent with D/C low
+	uint32_t data;		// bytes sent with D/C high
+	uint32_t rx;		// bytes received from the panel
+	uint32_t cs;		// chip select assertions
+	uint32_t fifo;		// HSPI FIFO loads, 64 bytes maximum each
+	uint32_t windows;	// CASET and PASET commands
+	uint32_t wr;		// pixels written to GRAM
+	uint32_t rd;		// pixels read from GRAM
+} tft_emu_stats_t;
+
+extern tft_emu_stats_t tft_emu;
+extern uint16_t tft_ID;
+extern uint32_t tft_clock;
+
+/* ili9341_emu.c */
+void tft_emu_clear_stats ( void );
+uint32_t tft_emu_spi_hz ( void );
+uint32_t tft_emu_bus_us ( tft_emu_stats_t *s );
+void tft_emu_print_stats ( char *name , int calls );
+uint16_t tft_emu_gram ( int16_t col , int16_t row );
+uint16_t tft_emu_pixel ( int16_t x , int16_t y );
+uint16_t tft_emu_view ( int16_t x , int16_t y );
+int tft_emu_ppm ( char *name );
+void tft_spi_init_slow ( void );
+void tft_spi_init_fast ( void );
+void tft_spi_begin ( void );
+void tft_spi_end ( void );
+void tft_reset_init ( void );
+void tft_reset_enable ( void );
+void tft_addr_init ( void );
+void tft_reset_disable ( void );
+void tft_spi_TX ( uint8_t *data , int bytes , uint8_t command );
+void tft_spi_TX_stream ( hspi_fill_t fill , void *arg );
+void tft_spi_repeat ( uint8_t *pattern , int bytes , int32_t count );
+void tft_spi_TXRX ( uint8_t *data , int bytes , uint8_t command );
+void tft_spi_RX ( uint8_t *data , int bytes , uint8_t command );
+window *tft_init ( void );
+
+#endif // _ILI9341_EMU_H_
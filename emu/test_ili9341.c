@@ -0,0 +1,2272 @@
+/**
+ @file test_ili9341.c
+
+ @brief ILI9341 display driver tests and SPI benchmarks on the emulated panel
+  Verifies the display primitives against the emulated GRAM and reports
+  the SPI bus traffic each primitive generates.
+
+ @par Copyright &copy; 2018 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "user_config.h"
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+
+#include "display/font.h"
+#include "display/ili9341.h"
+#include "display/tft_printf.h"
+#include "display/vfont.h"
+#include "3rd_party/ili9341_adafruit.h"
+#include "cordic/cordic.h"
+#include "cordic/fixed3d.h"
+#include "wire/wire_types.h"
+#include "wire/wire.h"
+#include "wire/earth_data.h"
+#include "wire/earth_mesh.h"
+#include "wire/cube_data.h"
+#include "wire/cube_mesh.h"
+#include "ili9341_emu.h"
+
+extern window *tft;
+extern _font *allfonts[];
+
+/// @brief Run code calls times and display the SPI traffic per call
+/// The code can use the loop counter i
+#define BENCH(name, calls, code) do { \
+	tft_emu_clear_stats(); \
+	for(i=0;i<(calls);++i) { code; } \
+	tft_emu_print_stats(name, calls); \
+} while(0)
+
+int errors = 0;
+
+/// @brief Report a failed test
+/// @param[in] cond: test result
+/// @param[in] *msg: test name
+/// @return void
+void check(int cond, char *msg)
+{
+	if(!cond)
+	{
+		printf("FAIL: %s\n", msg);
+		++errors;
+	}
+}
+
+/// @brief Verify off-screen frame buffer windows
+/// Nothing reaches the display until tft_flush()
+/// @return void
+void fb_tests()
+{
+	int i;
+	uint16_t wbuf[8*8];
+	uint16_t rbuf[8*8];
+	uint16_t palette[4] = { ILI9341_BLACK, ILI9341_RED, ILI9341_GREEN, ILI9341_WHITE };
+	window _win, *win = &_win;
+
+	tft_fillWin(tft, ILI9341_BLACK);
+	tft_window_init(win, 100, 150, 40, 30);
+	check(tft_fb_init(win, NULL, NULL, 0) == 0, "tft_fb_init");
+
+	tft_fillWin(win, ILI9341_BLUE);
+	tft_drawPixel(win, 5, 6, ILI9341_RED);
+	tft_drawLine(win, 0, 29, 39, 0, ILI9341_GREEN);
+	check(tft_emu_pixel(100,150) == ILI9341_BLACK, "fb draws off-screen");
+	check(tft_readPixel(win, 5, 6) == ILI9341_RED, "fb tft_readPixel");
+
+	tft_emu_clear_stats();
+	tft_flush(win);
+	check(tft_emu.windows == 2, "fb flush merges dirty rectangles");
+	check(tft_emu.wr == 40*30, "fb flush pixels");
+	check(tft_emu_pixel(100,150) == ILI9341_BLUE, "fb flush start");
+	check(tft_emu_pixel(105,156) == ILI9341_RED, "fb flush pixel");
+	check(tft_emu_pixel(100,179) == ILI9341_GREEN, "fb flush line");
+	check(tft_emu_pixel(140,150) == ILI9341_BLACK, "fb flush clip");
+
+	// Two separate small updates send two small rectangles
+	tft_drawPixel(win, 1, 1, ILI9341_WHITE);
+	tft_fillRectWH(win, 30, 20, 4, 4, ILI9341_WHITE);
+	tft_emu_clear_stats();
+	tft_flush(win);
+	check(tft_emu.windows == 4 && tft_emu.wr == 1 + 4*4, "fb flush dirty only");
+	check(tft_emu_pixel(101,151) == ILI9341_WHITE, "fb dirty pixel");
+	check(tft_emu_pixel(133,173) == ILI9341_WHITE, "fb dirty rect");
+	tft_emu_clear_stats();
+	tft_flush(win);
+	check(tft_emu.cmd == 0, "fb flush clean");
+
+	// Clipped writes keep the source array offsets
+	for(i=0;i<8*8;++i)
+		wbuf[i] = i * 0x0421;
+	tft_writeRect(win, -2, -3, 8, 8, wbuf);
+	tft_readRect(win, 0, 0, 6, 5, rbuf);
+	check(rbuf[0] == wbuf[3*8+2] && rbuf[6*5-1] == wbuf[7*8+7], "fb clipped tft_writeRect");
+	tft_fb_free(win);
+
+	// 8 bit palette buffer
+	tft_window_init(win, 0, 0, 16, 16);
+	check(tft_fb_init(win, NULL, palette, 4) == 0, "tft_fb_init palette");
+	tft_fillWin(win, ILI9341_GREEN);
+	tft_drawPixel(win, 3, 3, ILI9341_RED);
+	tft_flush(win);
+	check(tft_emu_pixel(0,0) == ILI9341_GREEN, "fb palette fill");
+	check(tft_emu_pixel(3,3) == ILI9341_RED, "fb palette pixel");
+	// Palette edited in place: colors map to their new indexes
+	palette[1] = ILI9341_GREEN;
+	palette[2] = ILI9341_RED;
+	tft_drawPixel(win, 4, 4, ILI9341_RED);
+	tft_flush(win);
+	check(tft_emu_pixel(4,4) == ILI9341_RED, "fb palette change");
+	tft_fb_free(win);
+	check(win->fb == NULL, "tft_fb_free");
+}
+
+/// @brief Flood fill test window size
+#define FLOOD_TW 200
+#define FLOOD_TH 200
+
+/// @brief Flood fill test shape: circle outline
+/// @param[in] *win: window
+/// @return void
+void shape_circle(window *win)
+{
+	tft_drawCircle(win, 100, 100, 90, ILI9341_WHITE);
+}
+
+/// @brief Flood fill test shape: comb, many runs per row
+/// @param[in] *win: window
+/// @return void
+void shape_comb(window *win)
+{
+	int x;
+
+	tft_drawRect(win, 0, 0, win->w, win->h, ILI9341_WHITE);
+	for(x = 4; x < win->w - 4; x += 4)
+	{
+		if(x & 4)
+			tft_drawFastVLine(win, x, 0, win->h - 10, ILI9341_WHITE);
+		else
+			tft_drawFastVLine(win, x, 10, win->h - 10, ILI9341_WHITE);
+	}
+}
+
+/// @brief Flood fill test shape: nested boxes joined by gaps, a spiral like maze
+/// @param[in] *win: window
+/// @return void
+void shape_maze(window *win)
+{
+	int i;
+
+	for(i = 0; i < win->w / 2 - 4; i += 6)
+	{
+		tft_drawRect(win, i, i, win->w - 2*i, win->h - 2*i, ILI9341_WHITE);
+		// open one side of each box
+		tft_fillRectWH(win, (i / 6 & 1) ? i : win->w - i - 1, win->h / 2, 1, 3, ILI9341_BLACK);
+	}
+}
+
+/// @brief Flood fill test shape: rows of dots, more runs per row than FLOOD_STACK
+/// @param[in] *win: window
+/// @return void
+void shape_dots(window *win)
+{
+	int x,y;
+
+	for(y = 2; y < win->h; y += 4)
+		for(x = (y & 4) ? 1 : 3; x < win->w; x += 4)
+			tft_fillRectWH(win, x, y, 2, 2, ILI9341_WHITE);
+}
+
+/// @brief Flood fill test shape: rows of dots around a closed box
+/// The box already holds fill colored pixels, it is not connected to the
+/// outside and must not be filled
+/// @param[in] *win: window
+/// @return void
+void shape_island(window *win)
+{
+	shape_dots(win);
+	tft_fillRectWH(win, 60, 60, 80, 80, ILI9341_BLACK);
+	tft_drawRect(win, 60, 60, 80, 80, ILI9341_WHITE);
+	tft_fillRectWH(win, 90, 90, 4, 4, ILI9341_RED);
+	tft_drawPixel(win, 61, 100, ILI9341_RED);
+}
+
+/// @brief Reference 4 way flood fill of a window snapshot in RAM
+/// @param[in] *img: window pixels
+/// @param[in] x: X position to fill from
+/// @param[in] y: Y position to fill from
+/// @param[in] border: border color
+/// @param[in] fill: Fill color
+/// @return pixels filled
+int32_t ref_flood(uint16_t *img, int x, int y, uint16_t border, uint16_t fill)
+{
+	static int stack[FLOOD_TW * FLOOD_TH];
+	int ind = 0;
+	int32_t pixels = 0;
+	int p;
+
+	stack[ind++] = y * FLOOD_TW + x;
+	img[y * FLOOD_TW + x] = fill;
+	while(ind > 0)
+	{
+		p = stack[--ind];
+		++pixels;
+		x = p % FLOOD_TW;
+		y = p / FLOOD_TW;
+#define REF_VISIT(c, n) if((c) && img[n] != border && img[n] != fill) { img[n] = fill; stack[ind++] = n; }
+		REF_VISIT(x > 0, p - 1);
+		REF_VISIT(x < FLOOD_TW - 1, p + 1);
+		REF_VISIT(y > 0, p - FLOOD_TW);
+		REF_VISIT(y < FLOOD_TH - 1, p + FLOOD_TW);
+#undef REF_VISIT
+	}
+	return(pixels);
+}
+
+/// @brief 4 way flood fill one pixel at a time with tft_readPixel and tft_drawPixel
+/// Same SPI traffic per pixel as a recursive flood fill
+/// @param[in] *win: window
+/// @param[in] x: X position to fill from
+/// @param[in] y: Y position to fill from
+/// @param[in] border: border color
+/// @param[in] fill: Fill color
+/// @return pixels filled
+int32_t pixel_flood(window *win, int x, int y, uint16_t border, uint16_t fill)
+{
+	static int16_t sx[FLOOD_TW * FLOOD_TH * 4];
+	static int16_t sy[FLOOD_TW * FLOOD_TH * 4];
+	int ind = 0;
+	int32_t pixels = 0;
+	uint16_t c;
+
+	sx[ind] = x;
+	sy[ind++] = y;
+	while(ind > 0)
+	{
+		--ind;
+		x = sx[ind];
+		y = sy[ind];
+		if(x < 0 || x >= win->w || y < 0 || y >= win->h)
+			continue;
+		c = tft_readPixel(win, x, y);
+		if(c == border || c == fill)
+			continue;
+		tft_drawPixel(win, x, y, fill);
+		++pixels;
+		sx[ind] = x + 1; sy[ind++] = y;
+		sx[ind] = x - 1; sy[ind++] = y;
+		sx[ind] = x; sy[ind++] = y + 1;
+		sx[ind] = x; sy[ind++] = y - 1;
+	}
+	return(pixels);
+}
+
+/// @brief Compare tft_floodline with the reference fill for one shape
+/// @param[in] *win: window
+/// @param[in] shape: draw the shape
+/// @param[in] x: X position to fill from
+/// @param[in] y: Y position to fill from
+/// @param[in] *msg: test name
+/// @return void
+void flood_test(window *win, void (*shape)(window *), int x, int y, char *msg)
+{
+	static uint16_t img[FLOOD_TW * FLOOD_TH];
+	int32_t pixels, expect;
+	int i;
+
+	tft_fillWin(win, ILI9341_BLACK);
+	shape(win);
+	for(i=0;i<FLOOD_TW * FLOOD_TH;++i)
+		img[i] = tft_emu_pixel(win->x + i % FLOOD_TW, win->y + i / FLOOD_TW);
+	expect = ref_flood(img, x, y, ILI9341_WHITE, ILI9341_RED);
+	pixels = tft_floodline(win, x, y, ILI9341_WHITE, ILI9341_RED);
+	for(i=0;i<FLOOD_TW * FLOOD_TH;++i)
+		if(img[i] != tft_emu_pixel(win->x + i % FLOOD_TW, win->y + i / FLOOD_TW))
+			break;
+	check(i == FLOOD_TW * FLOOD_TH && pixels == expect, msg);
+}
+
+/// @brief Verify the scanline flood fill against a reference fill
+/// @return void
+void flood_tests()
+{
+	window _win, *win = &_win;
+
+	tft_window_init(win, 20, 60, FLOOD_TW, FLOOD_TH);
+	flood_test(win, shape_circle, 100, 100, "tft_floodline circle");
+	flood_test(win, shape_comb, 2, win->h - 3, "tft_floodline comb");
+	flood_test(win, shape_maze, win->w / 2, win->h / 2, "tft_floodline maze");
+	flood_test(win, shape_dots, 0, 0, "tft_floodline stack overflow");
+	flood_test(win, shape_island, 0, 0, "tft_floodline island");
+	// Outside the shape up to the window edges
+	flood_test(win, shape_circle, 0, 0, "tft_floodline outside");
+	check(tft_floodline(win, -1, 0, ILI9341_WHITE, ILI9341_RED) == 0, "tft_floodline range");
+}
+
+/// @brief Flood fill a test shape and report fill rates
+/// @param[in] *win: window
+/// @param[in] *name: shape name
+/// @param[in] shape: draw the shape
+/// @param[in] x: X position to fill from
+/// @param[in] y: Y position to fill from
+/// @return void
+void flood_bench(window *win, char *name, void (*shape)(window *), int x, int y)
+{
+	char label[32];
+	int32_t pixels;
+
+	tft_fillWin(win, ILI9341_BLACK);
+	shape(win);
+	tft_emu_clear_stats();
+	pixels = pixel_flood(win, x, y, ILI9341_WHITE, ILI9341_RED);
+	snprintf(label, sizeof(label), "flood pixel %s", name);
+	tft_emu_print_stats(label, 1);
+	printf("%-20s %6ld pixels %8.1f Kpixels/s\n", label, (long) pixels,
+		pixels * 1000.0 / tft_emu_bus_us(&tft_emu));
+
+	tft_fillWin(win, ILI9341_BLACK);
+	shape(win);
+	tft_emu_clear_stats();
+	pixels = tft_floodline(win, x, y, ILI9341_WHITE, ILI9341_RED);
+	snprintf(label, sizeof(label), "flood scan %s", name);
+	tft_emu_print_stats(label, 1);
+	printf("%-20s %6ld pixels %8.1f Kpixels/s\n", label, (long) pixels,
+		pixels * 1000.0 / tft_emu_bus_us(&tft_emu));
+}
+
+/// @brief Reference even-odd polygon test at a pixel center, exact integer math
+/// Edges cover rows y0 .. y1-1, a pixel on a crossing is inside
+/// @param[in] *pts: vertices
+/// @param[in] count: number of vertices
+/// @param[in] x: X
+/// @param[in] y: Y
+/// @return 1 if inside
+int ref_inside(p2_int16_t *pts, int count, int x, int y)
+{
+	int i, inside = 0;
+	int32_t x0,y0,x1,y1,t;
+
+	for(i=0;i<count;++i)
+	{
+		x0 = pts[i].X;
+		y0 = pts[i].Y;
+		x1 = pts[(i+1) % count].X;
+		y1 = pts[(i+1) % count].Y;
+		if(y0 > y1)
+		{
+			t = x0; x0 = x1; x1 = t;
+			t = y0; y0 = y1; y1 = t;
+		}
+		if(y < y0 || y >= y1)
+			continue;
+		if((x - x0) * (y1 - y0) >= (y - y0) * (x1 - x0))
+			inside ^= 1;
+	}
+	return(inside);
+}
+
+/// @brief Compare tft_fillPolygon with the reference for one polygon
+/// @param[in] *win: window
+/// @param[in] *pts: vertices
+/// @param[in] count: number of vertices
+/// @param[in] *msg: test name
+/// @return void
+void poly_test(window *win, p2_int16_t *pts, int count, char *msg)
+{
+	int x,y,bad = 0;
+	uint16_t expect;
+
+	tft_fillWin(win, ILI9341_BLACK);
+	check(tft_fillPolygon(win, pts, count, ILI9341_RED) == 0, msg);
+	for(y=0;y<win->h;++y)
+	{
+		for(x=0;x<win->w;++x)
+		{
+			expect = ref_inside(pts, count, x, y) ? ILI9341_RED : ILI9341_BLACK;
+			if(tft_emu_pixel(win->x + x, win->y + y) != expect)
+				++bad;
+		}
+	}
+	check(bad == 0, msg);
+}
+
+/// @brief Gauge segment: ring between radius r0 and r1 from angle a0 to a1
+/// @param[out] *pts: 2*(steps+1) vertices
+/// @param[in] cx: center X
+/// @param[in] cy: center Y
+/// @param[in] r0: inner radius
+/// @param[in] r1: outer radius
+/// @param[in] a0: start angle, radians
+/// @param[in] a1: end angle, radians
+/// @param[in] steps: segments per arc
+/// @return number of vertices
+int gauge_points(p2_int16_t *pts, int cx, int cy, int r0, int r1, double a0, double a1, int steps)
+{
+	int i, n = 0;
+	double a;
+
+	for(i=0;i<=steps;++i)
+	{
+		a = a0 + (a1 - a0) * i / steps;
+		pts[n].X = cx + lround(r1 * cos(a));
+		pts[n++].Y = cy - lround(r1 * sin(a));
+	}
+	for(i=steps;i>=0;--i)
+	{
+		a = a0 + (a1 - a0) * i / steps;
+		pts[n].X = cx + lround(r0 * cos(a));
+		pts[n++].Y = cy - lround(r0 * sin(a));
+	}
+	return(n);
+}
+
+/// @brief Verify the polygon filler against the reference
+/// @return void
+void poly_tests()
+{
+	window _win, *win = &_win;
+	p2_int16_t tri[3] = { {10,10}, {190,60}, {70,180} };
+	p2_int16_t star[5] = { {100,5}, {160,190}, {5,70}, {195,70}, {40,190} };
+	p2_int16_t arrow[7] = { {10,80}, {120,80}, {120,20}, {190,100}, {120,180}, {120,120}, {10,120} };
+	p2_int16_t clip[4] = { {-60,-20}, {260,40}, {150,300}, {-10,150} };
+	p2_int16_t quad[4] = { {30,30}, {170,50}, {150,170}, {40,140} };
+	p2_int16_t half[3];
+	p2_int16_t gauge[2*17];
+	int n, x, y, bad;
+
+	tft_window_init(win, 20, 60, 200, 200);
+	poly_test(win, tri, 3, "tft_fillPolygon triangle");
+	poly_test(win, star, 5, "tft_fillPolygon star even-odd");
+	poly_test(win, arrow, 7, "tft_fillPolygon concave");
+	poly_test(win, clip, 4, "tft_fillPolygon clipped");
+	n = gauge_points(gauge, 100, 110, 60, 90, M_PI * 1.25, M_PI * -0.25, 16);
+	poly_test(win, gauge, n, "tft_fillPolygon gauge");
+
+	// Two triangles sharing an edge cover a quad once, without gaps
+	tft_fillWin(win, ILI9341_BLACK);
+	half[0] = quad[0]; half[1] = quad[1]; half[2] = quad[2];
+	tft_fillPolygon(win, half, 3, ILI9341_RED);
+	half[0] = quad[0]; half[1] = quad[2]; half[2] = quad[3];
+	tft_fillPolygon(win, half, 3, ILI9341_GREEN);
+	bad = 0;
+	for(y=0;y<win->h;++y)
+	{
+		for(x=0;x<win->w;++x)
+		{
+			uint16_t c = tft_emu_pixel(win->x + x, win->y + y);
+			if((c != ILI9341_BLACK) != ref_inside(quad, 4, x, y))
+				++bad;
+			if(c == ILI9341_GREEN && ref_inside(half, 3, x, y) == 0)
+				++bad;
+		}
+	}
+	check(bad == 0, "tft_fillPolygon shared edge");
+	check(tft_fillPolygon(win, gauge, 1000, ILI9341_RED) == -1, "tft_fillPolygon too many edges");
+}
+
+/// @brief Compare the fixed point vector and matrix code with the double precision path
+/// @return void
+void fixed3d_tests()
+{
+	point views[4] = { {-90,-90,-90}, {0,0,0}, {30,-45,60}, {123,17,-200} };
+	fx_mat3 M;
+	fx_vec3 V, A, B;
+	point P;
+	int16_t X, Y;
+	q15_t fs, fc;
+	double d, s, c, err, max;
+	int v, i, k;
+
+	// Sin and Cos over several turns in both directions
+	max = 0;
+	for(d=-720;d<=720;d+=0.7)
+	{
+		fx_sincos(FX_DEG(d), &fs, &fc);
+		s = sin(d * M_PI / 180.0);
+		c = cos(d * M_PI / 180.0);
+		err = fabs(fs / 32768.0 - s);
+		if(fabs(fc / 32768.0 - c) > err)
+			err = fabs(fc / 32768.0 - c);
+		if(err > max)
+			max = err;
+	}
+	check(max <= 2.0 / 32768, "fx_sincos accuracy");
+
+	// Rotation matrix columns are rotate() of the unit vectors
+	max = 0;
+	for(v=0;v<4;++v)
+	{
+		fx_mat3_rotate(&M, FX_DEG(views[v].x), FX_DEG(views[v].y), FX_DEG(views[v].z));
+		for(k=0;k<3;++k)
+		{
+			P.x = (k == 0);
+			P.y = (k == 1);
+			P.z = (k == 2);
+			rotate(&P, &views[v]);
+			err = fabs(M.m[0][k] / 32768.0 - P.x);
+			if(fabs(M.m[1][k] / 32768.0 - P.y) > err)
+				err = fabs(M.m[1][k] / 32768.0 - P.y);
+			if(fabs(M.m[2][k] / 32768.0 - P.z) > err)
+				err = fabs(M.m[2][k] / 32768.0 - P.z);
+			if(err > max)
+				max = err;
+		}
+	}
+	check(max <= 4.0 / 32768, "fx_mat3_rotate accuracy");
+
+	// Rotate and project every earth vertex, screen error in pixels
+	max = 0;
+	for(v=0;v<4;++v)
+	{
+		fx_mat3_rotate(&M, FX_DEG(views[v].x), FX_DEG(views[v].y), FX_DEG(views[v].z));
+		for(i=0;earth_data[i].x != WIRE_END;++i)
+		{
+			if(earth_data[i].x == WIRE_SEP)
+				continue;
+			wire2fp((wire_p *) &earth_data[i], &P);
+			rotate(&P, &views[v]);
+			PerspectiveProjection(&P, 200, 120, 160);
+			V.x = earth_data[i].x;
+			V.y = earth_data[i].y;
+			V.z = earth_data[i].z;
+			fx_mat3_apply(&M, &V, &V);
+			fx_project(&V, FX_Q16(200), 120, 160, &X, &Y);
+			err = fabs(P.x - X);
+			if(fabs(P.y - Y) > err)
+				err = fabs(P.y - Y);
+			if(err > max)
+				max = err;
+		}
+	}
+	check(max <= 1.0, "fx_mat3_apply fx_project accuracy");
+
+	// Normalized vectors have length 1.0 and keep their direction
+	max = 0;
+	for(i=1;i<1000;++i)
+	{
+		V.x = (i * 7919) % 32767 - 16383;
+		V.y = (i * 104729) % 32767 - 16383;
+		V.z = (i * 1299709) % 32767 - 16383;
+		A = V;
+		if(fx_normalize(&A) < 0)
+			continue;
+		d = sqrt((double) V.x * V.x + (double) V.y * V.y + (double) V.z * V.z);
+		err = fabs(A.x / 16384.0 - V.x / d);
+		if(fabs(A.y / 16384.0 - V.y / d) > err)
+			err = fabs(A.y / 16384.0 - V.y / d);
+		if(fabs(A.z / 16384.0 - V.z / d) > err)
+			err = fabs(A.z / 16384.0 - V.z / d);
+		if(err > max)
+			max = err;
+	}
+	check(max <= 2.0 / 16384, "fx_normalize accuracy");
+	V.x = V.y = V.z = 0;
+	check(fx_normalize(&V) == -1, "fx_normalize zero");
+
+	check(fx_sqrt(0) == 0 && fx_sqrt(99) == 9 && fx_sqrt(100) == 10, "fx_sqrt");
+	check(fx_sqrt(0xffffffffUL) == 65535, "fx_sqrt max");
+	check(fx_mul_q15(16384, -16384) == -8192, "fx_mul_q15");
+
+	A.x = FX_Q14_ONE; A.y = 0; A.z = 0;
+	B.x = 0; B.y = FX_Q14_ONE; B.z = 0;
+	fx_cross(&A, &B, &V);
+	check(V.x == 0 && V.y == 0 && V.z == FX_Q14_ONE, "fx_cross");
+	check(fx_dot(&A, &B) == 0 && fx_dot(&A, &A) == (1L << 28), "fx_dot");
+}
+
+/// @brief Compare the fixed point view transform with the double precision path
+/// @return void
+void wire_tests()
+{
+	point views[4] = { {-90,-90,-90}, {0,0,0}, {30,-45,60}, {123,17,-200} };
+	wire_view_t M;
+	wire_p W;
+	point P;
+	p3_int16_t S;
+	int v, i, bad = 0;
+	double err, max = 0;
+
+	for(v=0;v<4;++v)
+	{
+		wire_view(&M, &views[v], 200, 120, 160);
+		for(i=0;earth_data[i].x != WIRE_END;++i)
+		{
+			W = earth_data[i];
+			if(W.x == WIRE_SEP)
+				continue;
+			wire2fp(&W, &P);
+			rotate(&P, &views[v]);
+			wire_project(&M, &W, &S);
+			if(fabs(P.z * WIRE_ONE - S.Z) > 1)
+				++bad;
+			PerspectiveProjection(&P, 200, 120, 160);
+			err = fabs(P.x - S.X);
+			if(fabs(P.y - S.Y) > err)
+				err = fabs(P.y - S.Y);
+			if(err > max)
+				max = err;
+		}
+	}
+	check(max <= 0.6, "wire_project accuracy");
+	check(bad == 0, "wire_project depth");
+}
+
+/// @brief Frames drawn by the wireframe animator match a full redraw
+/// @return void
+void anim_tests()
+{
+	window _win, *win = &_win;
+	window _ref, *ref = &_ref;
+	wire_anim_t A;
+	point V;
+	int f, x, y, bad = 0;
+
+	tft_fillWin(tft, ILI9341_BLACK);
+	tft_window_init(win, 0, 0, 120, 140);
+	tft_window_init(ref, 120, 0, 120, 140);
+	tft_setTextColor(win, ILI9341_WHITE, ILI9341_BLUE);
+	tft_setTextColor(ref, ILI9341_WHITE, ILI9341_BLUE);
+	tft_fillWin(win, win->bg);
+
+	memset(&A, 0, sizeof(A));
+	check(wire_anim_init(&A, win, ILI9341_WHITE) == 1, "wire_anim_init");
+	for(f=0;f<20;++f)
+	{
+		V.x = V.y = V.z = f * 4;
+		wire_anim_draw(&A, cube_points, cube_edges, NULL, &V, 60, 70, 60 - f, 0);
+		tft_fillWin(ref, ref->bg);
+		wire_draw(ref, cube_points, cube_edges, &V, 60, 70, 60 - f, ILI9341_WHITE);
+		for(y=0;y<140;++y)
+			for(x=0;x<120;++x)
+				if(tft_emu_pixel(x, y) != tft_emu_pixel(120 + x, y))
+					++bad;
+	}
+	check(bad == 0, "wire_anim_draw frames");
+
+	// Erase leaves an empty window
+	wire_anim_erase(&A);
+	for(y=0;y<140;++y)
+		for(x=0;x<120;++x)
+			if(tft_emu_pixel(x, y) != ILI9341_BLUE)
+				++bad;
+	check(bad == 0, "wire_anim_erase");
+
+	// Started again after the erase
+	wire_anim_draw(&A, cube_points, cube_edges, NULL, &V, 60, 70, 40, 0);
+	check(A.drawn == 1, "wire_anim_draw after erase");
+	wire_anim_free(&A);
+}
+
+/// @brief Count pixels of a color in a window sized area of the display
+/// @param[in] x: display X
+/// @param[in] y: display Y
+/// @param[in] w: width
+/// @param[in] h: height
+/// @param[in] color: color to count
+/// @return  pixel count
+int32_t count_color(int x, int y, int w, int h, uint16_t color)
+{
+	int32_t count = 0;
+	int i,k;
+
+	for(i=0;i<h;++i)
+		for(k=0;k<w;++k)
+			if(tft_emu_pixel(x + k, y + i) == color)
+				++count;
+	return(count);
+}
+
+/// @brief tft_fillTriangle fills inclusively and covers its own outline
+/// @return void
+void fill_triangle_tests()
+{
+	window _win, *win = &_win;
+	int16_t tri[3][6] = {
+		{ 10,10, 20,10, 10,20 },
+		{ 10,10, 190,60, 70,180 },
+		{ 150,20, 30,90, 120,170 }
+	};
+	int i;
+
+	tft_window_init(win, 0, 0, 200, 200);
+	tft_fillWin(win, ILI9341_BLACK);
+	tft_fillTriangle(win, 10,10, 20,10, 15,10, ILI9341_RED);
+	check(count_color(0, 0, 200, 200, ILI9341_RED) == 11, "tft_fillTriangle flat");
+
+	tft_fillWin(win, ILI9341_BLACK);
+	tft_fillTriangle(win, 10,10, 20,10, 10,20, ILI9341_RED);
+	check(count_color(0, 0, 200, 200, ILI9341_RED) == 66, "tft_fillTriangle right angle");
+
+	// Fill after the outline: no outline pixel may survive
+	for(i=0;i<3;++i)
+	{
+		tft_fillWin(win, ILI9341_BLACK);
+		tft_drawTriangle(win, tri[i][0], tri[i][1], tri[i][2], tri[i][3], tri[i][4], tri[i][5], ILI9341_WHITE);
+		tft_fillTriangle(win, tri[i][0], tri[i][1], tri[i][2], tri[i][3], tri[i][4], tri[i][5], ILI9341_RED);
+		check(count_color(0, 0, 200, 200, ILI9341_WHITE) == 0, "tft_fillTriangle covers outline");
+	}
+}
+
+/// @brief Count white pixels at (x,y) with no white pixel near (x+120,y)
+/// Lines drawn in the other direction or split may step one pixel away
+/// @return  pixel count
+int32_t off_lines()
+{
+	int32_t bad = 0;
+	int x, y, dx, dy;
+
+	for(y=1;y<139;++y)
+		for(x=1;x<119;++x)
+		{
+			if(tft_emu_pixel(x, y) != ILI9341_WHITE)
+				continue;
+			for(dy=-1;dy<=1;++dy)
+				for(dx=-1;dx<=1;++dx)
+					if(tft_emu_pixel(120 + x + dx, y + dy) == ILI9341_WHITE)
+						goto found;
+			++bad;
+		found:
+			;
+		}
+	return(bad);
+}
+
+/// @brief Cube with each face split into SPLIT x SPLIT quads
+#define SPLIT 4
+wire_p split_points[6 * (SPLIT+1) * (SPLIT+1)];
+wire_f split_faces[6 * SPLIT * SPLIT + 1];
+
+/// @brief Build the split cube from cube_faces, more than WIRE_CACHE faces and points
+/// Faces keep the order of cube_faces, so -y comes after WIRE_CACHE
+/// @return void
+void split_cube()
+{
+	wire_p C[4];
+	int f, i, j, n = 0, base;
+
+	for(f=0;f<6;++f)
+	{
+		C[0] = cube_points[cube_faces[f].p1];
+		C[1] = cube_points[cube_faces[f].p2];
+		C[2] = cube_points[cube_faces[f].p3];
+		C[3] = cube_points[cube_faces[f].p4];
+		base = f * (SPLIT+1) * (SPLIT+1);
+		for(j=0;j<=SPLIT;++j)
+			for(i=0;i<=SPLIT;++i)
+			{
+				// Bilinear, C[0] to C[1] along i, C[0] to C[3] along j
+				split_points[base + j * (SPLIT+1) + i].x = (C[0].x * (SPLIT-i) * (SPLIT-j) + C[1].x * i * (SPLIT-j) + C[2].x * i * j + C[3].x * (SPLIT-i) * j) / (SPLIT * SPLIT);
+				split_points[base + j * (SPLIT+1) + i].y = (C[0].y * (SPLIT-i) * (SPLIT-j) + C[1].y * i * (SPLIT-j) + C[2].y * i * j + C[3].y * (SPLIT-i) * j) / (SPLIT * SPLIT);
+				split_points[base + j * (SPLIT+1) + i].z = (C[0].z * (SPLIT-i) * (SPLIT-j) + C[1].z * i * (SPLIT-j) + C[2].z * i * j + C[3].z * (SPLIT-i) * j) / (SPLIT * SPLIT);
+			}
+		for(j=0;j<SPLIT;++j)
+			for(i=0;i<SPLIT;++i)
+			{
+				split_faces[n].p1 = base + j * (SPLIT+1) + i;
+				split_faces[n].p2 = base + j * (SPLIT+1) + i + 1;
+				split_faces[n].p3 = base + (j+1) * (SPLIT+1) + i + 1;
+				split_faces[n].p4 = base + (j+1) * (SPLIT+1) + i;
+				++n;
+			}
+	}
+	split_faces[n].p1 = split_faces[n].p2 = split_faces[n].p3 = split_faces[n].p4 = -1;
+}
+
+/// @brief Horizon and back face culling
+/// @return void
+void cull_tests()
+{
+	window _win, *win = &_win;
+	window _ref, *ref = &_ref;
+	point V = { 0, 0, 0 };
+	int32_t full, front, bad;
+	int v, i, hidden;
+	wire_view_t M;
+	p3_int16_t P;
+	point views[3] = { {-90,-90,-90}, {30,-45,60}, {123,17,-200} };
+
+	tft_fillWin(tft, ILI9341_BLACK);
+	tft_window_init(win, 0, 0, 120, 140);
+	tft_window_init(ref, 120, 0, 120, 140);
+	tft_setTextColor(win, ILI9341_WHITE, ILI9341_BLACK);
+	tft_setTextColor(ref, ILI9341_WHITE, ILI9341_BLACK);
+
+	// Axis aligned cube, the faces toward -x, +y and +z are hidden
+	// Their shared corner (-0.5,0.5,0.5) is at (-0.25,0.25) * scale
+	tft_fillWin(win, win->bg);
+	wire_draw_cull(win, cube_points, cube_edges, cube_faces, &V, 60, 70, 80, ILI9341_WHITE, WIRE_CULL_BACK);
+	check(tft_emu_pixel(60 - 20, 70 + 20) == ILI9341_BLACK, "wire_draw_cull back corner");
+	check(tft_emu_pixel(60 + 20, 70 - 60) == ILI9341_WHITE, "wire_draw_cull front corner");
+	tft_fillWin(ref, ref->bg);
+	wire_draw(ref, cube_points, cube_edges, &V, 60, 70, 80, ILI9341_WHITE);
+	check(tft_emu_pixel(120 + 60 - 20, 70 + 20) == ILI9341_WHITE, "wire_draw back corner");
+
+	// Front face lines are also drawn without culling
+	bad = 0;
+	for(v=0;v<3;++v)
+	{
+		tft_fillWin(win, win->bg);
+		tft_fillWin(ref, ref->bg);
+		wire_draw_cull(win, cube_points, cube_edges, cube_faces, &views[v], 60, 70, 60, ILI9341_WHITE, WIRE_CULL_BACK);
+		wire_draw(ref, cube_points, cube_edges, &views[v], 60, 70, 60, ILI9341_WHITE);
+		bad += off_lines();
+		// At least one face is hidden
+		if(count_color(0, 0, 120, 140, ILI9341_WHITE) >= count_color(120, 0, 120, 140, ILI9341_WHITE))
+			++bad;
+	}
+	check(bad == 0, "wire_draw_cull back subset");
+
+	// Faces and points past WIRE_CACHE are culled too, the split cube draws
+	// every line of the culled cube
+	split_cube();
+	bad = 0;
+	for(v=0;v<3;++v)
+	{
+		tft_fillWin(win, win->bg);
+		tft_fillWin(ref, ref->bg);
+		wire_draw_cull(win, cube_points, cube_edges, cube_faces, &views[v], 60, 70, 60, ILI9341_WHITE, WIRE_CULL_BACK);
+		wire_draw_cull(ref, split_points, NULL, split_faces, &views[v], 60, 70, 60, ILI9341_WHITE, WIRE_CULL_BACK);
+		bad += off_lines();
+	}
+	// A corner only back faces touch is drawn with the faces turned around
+	// views[0] looks along a diagonal, the far corner is behind the near one
+	for(v=1;v<3;++v)
+	{
+		wire_view(&M, &views[v], 60, 60, 70);
+		tft_fillWin(win, win->bg);
+		tft_fillWin(ref, ref->bg);
+		wire_draw_cull(ref, split_points, NULL, split_faces, &views[v], 60, 70, 60, ILI9341_WHITE, WIRE_CULL_BACK);
+		for(i=0;split_faces[i].p1 != -1;++i)
+			SWAP(split_faces[i].p2, split_faces[i].p4);
+		wire_draw_cull(win, split_points, NULL, split_faces, &views[v], 60, 70, 60, ILI9341_WHITE, WIRE_CULL_BACK);
+		for(i=0;split_faces[i].p1 != -1;++i)
+			SWAP(split_faces[i].p2, split_faces[i].p4);
+		hidden = 0;
+		for(i=0;i<8;++i)
+		{
+			wire_project(&M, &cube_points[i], &P);
+			if(tft_emu_pixel(P.X, P.Y) == ILI9341_WHITE && tft_emu_pixel(120 + P.X, P.Y) == ILI9341_BLACK)
+				++hidden;
+		}
+		if(!hidden)
+			++bad;
+	}
+	check(bad == 0, "wire_draw_cull back past WIRE_CACHE");
+
+	// The earth keeps about half of its lines
+	bad = 0;
+	for(v=0;v<3;++v)
+	{
+		tft_fillWin(win, win->bg);
+		tft_fillWin(ref, ref->bg);
+		wire_draw_cull(win, earth_data, NULL, NULL, &views[v], 60, 70, 110, ILI9341_WHITE, WIRE_CULL_HORIZON);
+		wire_draw(ref, earth_data, NULL, &views[v], 60, 70, 110, ILI9341_WHITE);
+		front = count_color(0, 0, 120, 140, ILI9341_WHITE);
+		full = count_color(120, 0, 120, 140, ILI9341_WHITE);
+		if(front < full * 3 / 10 || front > full * 7 / 10)
+			++bad;
+		bad += off_lines();
+	}
+	check(bad == 0, "wire_draw_cull horizon");
+}
+
+/// @brief Three points and three edges, encoded by hand as an edge mesh
+uint8_t tri_mesh[] = {
+	'W','M','S','H', WIRE_MESH_VERSION, WIRE_MESH_EDGES, 1, 0,
+	20,0,0,0, 18,0,0,0, 3,0, 3,0,
+	// 0,0,0  100,0,0  100,-50,0
+	3, 0,0,0, 0xc8,0x01,0,0, 0,0x63,0,
+	// 0-1 1-2 2-0
+	3, 0,2, 2,2, 2,3
+};
+
+/// @brief Add a varint to a mesh under construction
+/// @param[in,out] *p: mesh
+/// @param[in] v: value
+/// @return next byte
+uint8_t *mesh_varint(uint8_t *p, uint32_t v)
+{
+	while(v >= 0x80)
+	{
+		*p++ = (v & 0x7f) | 0x80;
+		v >>= 7;
+	}
+	*p++ = v;
+	return(p);
+}
+
+/// @brief Add a zigzag varint to a mesh under construction
+/// @param[in,out] *p: mesh
+/// @param[in] v: signed value
+/// @return next byte
+uint8_t *mesh_delta(uint8_t *p, int32_t v)
+{
+	return(mesh_varint(p, ((uint32_t) v << 1) ^ (uint32_t) (v >> 31)));
+}
+
+/// @brief Pixels of two windows side by side that differ
+/// @return count
+int32_t diff_pixels(int x, int y, int w, int h)
+{
+	int32_t count = 0;
+	int i, j;
+
+	for(j=y;j<y+h;++j)
+		for(i=x;i<x+w;++i)
+			if(tft_emu_pixel(i, j) != tft_emu_pixel(i + w, j))
+				++count;
+	return(count);
+}
+
+/// @brief Compact meshes decode to the C tables and draw the same pixels
+/// @return void
+void mesh_tests()
+{
+	window _win, *win = &_win;
+	window _ref, *ref = &_ref;
+	point V = { -90, -90, -90 };
+	point views[3] = { {-90,-90,-90}, {30,-45,60}, {123,17,-200} };
+	wire_mesh_t m;
+	wire_p W, *wire;
+	wire_e E, *edge;
+	uint8_t cube[256], *p;
+	FILE *fp;
+	int i, j, v, ret, bad;
+
+	// Built in earth mesh gives the earth_data points in order
+	check(wire_mesh_open(&m, wire_mesh_flash_read, earth_mesh, 0) == 0, "wire_mesh_open");
+	check(m.type == WIRE_MESH_LINES && m.levels >= 1, "wire_mesh_open header");
+	bad = 0;
+	j = 0;
+	while((ret = wire_mesh_point(&m, &W)) > 0)
+	{
+		if(W.x == WIRE_SEP)
+			continue;
+		while(earth_data[j].x == WIRE_SEP)
+			++j;
+		if(earth_data[j].x != W.x || earth_data[j].y != W.y || earth_data[j].z != W.z)
+			++bad;
+		++j;
+	}
+	while(earth_data[j].x == WIRE_SEP)
+		++j;
+	check(ret == 0 && bad == 0 && earth_data[j].x == WIRE_END, "wire_mesh_point earth");
+	check(sizeof(earth_mesh) < sizeof(earth_data), "earth_mesh size");
+
+	// Streaming from flash draws the same pixels as the table
+	tft_fillWin(tft, ILI9341_BLACK);
+	tft_window_init(win, 0, 0, 120, 140);
+	tft_window_init(ref, 120, 0, 120, 140);
+	tft_setTextColor(win, ILI9341_WHITE, ILI9341_BLACK);
+	tft_setTextColor(ref, ILI9341_WHITE, ILI9341_BLACK);
+	bad = 0;
+	for(v=0;v<3;++v)
+	{
+		tft_fillWin(win, win->bg);
+		tft_fillWin(ref, ref->bg);
+		wire_draw_mesh(win, &m, &views[v], 60, 70, 110, ILI9341_WHITE, WIRE_CULL_HORIZON);
+		wire_draw_cull(ref, earth_data, NULL, NULL, &views[v], 60, 70, 110, ILI9341_WHITE, WIRE_CULL_HORIZON);
+		bad += diff_pixels(0, 0, 120, 140);
+	}
+	check(bad == 0, "wire_draw_mesh earth");
+
+	// Levels of detail, one pixel is WIRE_ONE / scale
+	check(wire_mesh_lod(&m, 200) == 0 && wire_mesh_lod(&m, 110) == 1 &&
+		wire_mesh_lod(&m, 50) == 2 && wire_mesh_lod(&m, 20) == 3, "wire_mesh_lod");
+	// Coarse levels are keep flags over level 0, the counts match the table
+	bad = 0;
+	for(v=1;v<m.levels;++v)
+	{
+		int points = 0, lines = 0;
+
+		wire_mesh_level(&m, v);
+		while((ret = wire_mesh_point(&m, &W)) > 0)
+		{
+			if(W.x == WIRE_SEP)
+				++lines;
+			else
+				++points;
+		}
+		if(ret != 0 || points != m.points || lines != m.lines)
+			++bad;
+	}
+	check(bad == 0, "wire_mesh_point levels");
+	check(wire_mesh_open(&m, wire_mesh_flash_read, earth_mesh, WIRE_MESH_AUTO) == 0, "wire_mesh_open auto");
+	for(v=0;v<3;++v)
+	{
+		double scales[3] = { 110, 50, 25 };
+
+		tft_fillWin(win, win->bg);
+		tft_fillWin(ref, ref->bg);
+		wire_draw_mesh(win, &m, &V, 60, 70, scales[v], ILI9341_WHITE, WIRE_CULL_HORIZON);
+		check(m.level == v + 1, "wire_draw_mesh level");
+		wire_draw_cull(ref, earth_data, NULL, NULL, &V, 60, 70, scales[v], ILI9341_WHITE, WIRE_CULL_HORIZON);
+		// Simplified lines stay within about a pixel of the full detail ones
+		check(off_lines() * 20 <= count_color(0, 0, 120, 140, ILI9341_WHITE), "wire_draw_mesh lod");
+	}
+
+	// Hand encoded edge mesh
+	check(wire_mesh_open(&m, wire_mesh_flash_read, tri_mesh, 0) == 0, "wire_mesh_open edges");
+	check(m.points == 3 && m.lines == 3, "wire_mesh_open counts");
+	check(wire_mesh_edge(&m, &E) == 1 && E.p1 == 0 && E.p2 == 1, "wire_mesh_edge skips points");
+	check(wire_mesh_load(&m, &wire, &edge) == 0, "wire_mesh_load");
+	if(wire && edge)
+	{
+		check(wire[1].x == 100 && wire[2].y == -50 && wire[3].x == WIRE_END, "wire_mesh_load points");
+		check(edge[1].p1 == 1 && edge[1].p2 == 2 && edge[2].p2 == 0 && edge[3].p1 == -1, "wire_mesh_load edges");
+		free(wire);
+		free(edge);
+	}
+
+	// The same mesh from a file
+	fp = tmpfile();
+	if(fp)
+	{
+		fwrite(tri_mesh, 1, sizeof(tri_mesh), fp);
+		check(wire_mesh_open(&m, wire_mesh_file_read, fp, 2) == 0 && m.level == 0, "wire_mesh_file_read");
+		check(wire_mesh_load(&m, &wire, &edge) == 0 && edge[2].p1 == 2, "wire_mesh_load file");
+		free(wire);
+		free(edge);
+		fclose(fp);
+	}
+
+	// Bad meshes are rejected
+	tri_mesh[0] = 'X';
+	check(wire_mesh_open(&m, wire_mesh_flash_read, tri_mesh, 0) < 0, "wire_mesh_open magic");
+	tri_mesh[0] = 'W';
+	tri_mesh[12] = 15;
+	wire_mesh_open(&m, wire_mesh_flash_read, tri_mesh, 0);
+	check(wire_mesh_load(&m, &wire, &edge) < 0 && wire == NULL, "wire_mesh_load truncated");
+	tri_mesh[12] = 18;
+	tri_mesh[sizeof(tri_mesh) - 1] = 5;
+	wire_mesh_open(&m, wire_mesh_flash_read, tri_mesh, 0);
+	check(wire_mesh_load(&m, &wire, &edge) < 0, "wire_mesh_load index");
+	tri_mesh[sizeof(tri_mesh) - 1] = 3;
+
+	// Cube as an edge mesh draws the same pixels as the tables
+	memset(cube, 0, sizeof(cube));
+	memcpy(cube, "WMSH\2\1\1", 7);
+	cube[8] = 20;
+	cube[16] = 8;
+	cube[18] = 12;
+	p = mesh_varint(cube + 20, 8);
+	for(i=0;i<8;++i)
+	{
+		p = mesh_delta(p, cube_points[i].x - (i ? cube_points[i-1].x : 0));
+		p = mesh_delta(p, cube_points[i].y - (i ? cube_points[i-1].y : 0));
+		p = mesh_delta(p, cube_points[i].z - (i ? cube_points[i-1].z : 0));
+	}
+	p = mesh_varint(p, 12);
+	for(i=0;i<12;++i)
+	{
+		p = mesh_delta(p, cube_edges[i].p1 - (i ? cube_edges[i-1].p1 : 0));
+		p = mesh_delta(p, cube_edges[i].p2 - cube_edges[i].p1);
+	}
+	cube[12] = p - cube - 20;
+	check(wire_mesh_open(&m, wire_mesh_flash_read, cube, 0) == 0, "wire_mesh_open cube");
+	tft_fillWin(win, win->bg);
+	tft_fillWin(ref, ref->bg);
+	ret = wire_draw_mesh(win, &m, &V, 60, 70, 80, ILI9341_WHITE, 0);
+	wire_draw(ref, cube_points, cube_edges, &V, 60, 70, 80, ILI9341_WHITE);
+	check(ret == 0 && diff_pixels(0, 0, 120, 140) == 0, "wire_draw_mesh cube");
+
+	// earth2wireframe -e output, from earth/data/cube.dat
+	check((int) sizeof(cube_mesh) == p - cube && memcmp(cube, cube_mesh, sizeof(cube_mesh)) == 0, "earth2wireframe cube");
+	check(wire_mesh_open(&m, wire_mesh_flash_read, cube_mesh, 0) == 0 && m.type == WIRE_MESH_EDGES, "wire_mesh_open cube_mesh");
+	tft_fillWin(win, win->bg);
+	ret = wire_draw_mesh(win, &m, &V, 60, 70, 80, ILI9341_WHITE, 0);
+	check(ret == 0 && diff_pixels(0, 0, 120, 140) == 0, "wire_draw_mesh cube_mesh");
+}
+
+/// @brief Largest red, green or blue difference of two colors
+/// @param[in] a: color
+/// @param[in] b: color
+/// @return  difference in 8 bit units
+int color_diff(uint16_t a, uint16_t b)
+{
+	uint8_t r[2], g[2], bl[2];
+	int d, max;
+
+	tft_565toRGB(a, &r[0], &g[0], &bl[0]);
+	tft_565toRGB(b, &r[1], &g[1], &bl[1]);
+	max = abs(r[0] - r[1]);
+	d = abs(g[0] - g[1]);
+	if(d > max)
+		max = d;
+	d = abs(bl[0] - bl[1]);
+	if(d > max)
+		max = d;
+	return(max);
+}
+
+/// @brief Anti-aliased lines
+/// @return void
+void aa_tests()
+{
+	window _win, *win = &_win;
+	uint16_t c, exact;
+	uint8_t r[2], g[2], b[2];
+	int i, x, y, bad, max;
+	double w, sum;
+
+	// tft_blend against floating point
+	max = 0;
+	for(i=0;i<=255;i+=5)
+	{
+		c = tft_blend(ILI9341_YELLOW, 0x1234, i);
+		tft_565toRGB(ILI9341_YELLOW, &r[0], &g[0], &b[0]);
+		tft_565toRGB(0x1234, &r[1], &g[1], &b[1]);
+		w = i / 255.0;
+		exact = tft_RGBto565((int) (r[0] * w + r[1] * (1 - w) + 0.5),
+			(int) (g[0] * w + g[1] * (1 - w) + 0.5),
+			(int) (b[0] * w + b[1] * (1 - w) + 0.5));
+		if(color_diff(c, exact) > max)
+			max = color_diff(c, exact);
+	}
+	check(max <= 12, "tft_blend accuracy");
+	check(tft_blend(ILI9341_RED, ILI9341_BLUE, 255) == ILI9341_RED && tft_blend(ILI9341_RED, ILI9341_BLUE, 0) == ILI9341_BLUE, "tft_blend limits");
+
+	tft_fillWin(tft, ILI9341_BLACK);
+	tft_window_init(win, 0, 0, 120, 120);
+	tft_setTextColor(win, ILI9341_WHITE, ILI9341_BLACK);
+	tft_antialias(win, AA_BG);
+
+	// Horizontal, vertical and diagonal lines are solid
+	tft_drawLine(win, 10, 10, 50, 10, ILI9341_WHITE);
+	tft_drawLine(win, 10, 20, 10, 60, ILI9341_WHITE);
+	tft_drawLine(win, 20, 20, 60, 60, ILI9341_WHITE);
+	check(count_color(0, 0, 120, 120, ILI9341_WHITE) == 41 * 3 && count_color(0, 0, 120, 120, ILI9341_BLACK) == 120 * 120 - 41 * 3, "tft_drawLineAA solid");
+
+	// The pair of pixels at each X adds up to the line color
+	tft_fillWin(win, win->bg);
+	tft_drawLine(win, 100, 100, 10, 70, ILI9341_WHITE);
+	bad = 0;
+	for(x=10;x<=100;++x)
+	{
+		sum = 0;
+		for(y=60;y<110;++y)
+		{
+			tft_565toRGB(tft_emu_pixel(x, y), &r[0], &g[0], &b[0]);
+			sum += g[0] / 252.0;
+		}
+		if(sum < 0.9 || sum > 1.1)
+			++bad;
+	}
+	check(bad == 0, "tft_drawLineAA coverage");
+	check(tft_emu_pixel(10, 70) == ILI9341_WHITE && tft_emu_pixel(100, 100) == ILI9341_WHITE, "tft_drawLineAA ends");
+	check(tft_emu_pixel(55, 85) == ILI9341_WHITE && tft_emu_pixel(55, 84) == ILI9341_BLACK, "tft_drawLineAA middle");
+
+	// Read back blends with what is on the display and keeps the rest
+	tft_fillWin(win, win->bg);
+	for(y=0;y<120;y+=2)
+		tft_drawFastHLine(win, 0, y, 120, ILI9341_BLUE);
+	tft_antialias(win, AA_READ);
+	tft_drawLine(win, 5, 7, 115, 40, ILI9341_RED);
+	tft_drawLine(win, -20, 100, 200, 90, ILI9341_RED);
+	bad = 0;
+	for(y=0;y<120;++y)
+	{
+		for(x=0;x<120;++x)
+		{
+			c = tft_emu_pixel(x, y);
+			// Pixels are red, the background, or a blend of the two
+			tft_565toRGB(c, &r[0], &g[0], &b[0]);
+			if(g[0] != 0 || (c != ILI9341_RED && c != ((y & 1) ? ILI9341_BLACK : ILI9341_BLUE) && r[0] + b[0] > 255 + 8))
+				++bad;
+		}
+	}
+	check(bad == 0, "tft_drawLineAA read back");
+	check(count_color(0, 50, 120, 30, ILI9341_RED) == 0 && count_color(0, 0, 120, 5, ILI9341_RED) == 0, "tft_drawLineAA bounds");
+	// Every column of the clipped line has a mostly red pixel
+	bad = 0;
+	for(x=0;x<120;++x)
+	{
+		for(y=88;y<102;++y)
+		{
+			tft_565toRGB(tft_emu_pixel(x, y), &r[0], &g[0], &b[0]);
+			if(r[0] >= 120)
+				break;
+		}
+		if(y == 102)
+			++bad;
+	}
+	check(bad == 0, "tft_drawLineAA clipped");
+
+	// Mode off draws the aliased line
+	tft_antialias(win, 0);
+	tft_fillWin(win, win->bg);
+	tft_drawLine(win, 100, 100, 10, 70, ILI9341_WHITE);
+	check(count_color(0, 0, 120, 120, ILI9341_WHITE) == 91, "tft_antialias off");
+}
+
+/// @brief Cubic Bezier point in floating point
+/// @param[in] *p: S, C1, C2, T
+/// @param[in] t: 0 .. 1
+/// @param[out] *x: X
+/// @param[out] *y: Y
+/// @return void
+void bezier_point(p2_int16_t *p, double t, double *x, double *y)
+{
+	double t1 = 1.0 - t;
+
+	*x = t1*t1*t1 * p[0].X + 3*t1*t1*t * p[1].X + 3*t1*t*t * p[2].X + t*t*t * p[3].X;
+	*y = t1*t1*t1 * p[0].Y + 3*t1*t1*t * p[1].Y + 3*t1*t*t * p[2].Y + t*t*t * p[3].Y;
+}
+
+/// @brief Float Bezier with a fixed segment count, as drawn before
+/// @param[in] *win: window
+/// @param[in] *p: S, C1, C2, T
+/// @param[in] steps: line segments
+/// @param[in] color: color
+/// @return void
+void ref_bezier3(window *win, p2_int16_t *p, int steps, uint16_t color)
+{
+	float t, t1, t2, c0;
+	p2_int16_t Last, Point;
+	int i;
+
+	Last = p[0];
+	for(i=1;i<=steps;++i)
+	{
+		t = (float) i / steps;
+		t1 = 1.0 - t;
+		t2 = t1 * t1;
+		c0 = 3.0 * t1 * t;
+		Point.X = (int16_t) (t2 * t1 * p[0].X + c0 * t1 * p[1].X + c0 * t * p[2].X + t * t * t * p[3].X);
+		Point.Y = (int16_t) (t2 * t1 * p[0].Y + c0 * t1 * p[1].Y + c0 * t * p[2].Y + t * t * t * p[3].Y);
+		if(Last.X == Point.X && Last.Y == Point.Y)
+			continue;
+		tft_drawLine(win, Last.X, Last.Y, Point.X, Point.Y, color);
+		Last = Point;
+	}
+}
+
+/// @brief Curve pixels against the exact curve
+/// @param[in] *p: S, C1, C2, T, a quadratic uses S, C1 and T
+/// @param[in] quad: 1 for a quadratic curve
+/// @return  pixels further than 1.25 from the curve plus curve points with no pixel near
+int bezier_check(p2_int16_t *p, int quad)
+{
+	p2_int16_t q[4];
+	double x, y, d, min;
+	int i, px, py, bad = 0;
+	int found;
+
+	q[0] = p[0];
+	q[3] = p[3];
+	q[1] = p[1];
+	q[2] = p[2];
+	for(py=0;py<200;++py)
+	{
+		for(px=0;px<200;++px)
+		{
+			if(tft_emu_pixel(px, py) != ILI9341_WHITE)
+				continue;
+			min = 1e9;
+			for(i=0;i<=1000;++i)
+			{
+				if(quad)
+				{
+					double t = i / 1000.0, t1 = 1.0 - t;
+					x = t1*t1*p[0].X + 2*t1*t*p[1].X + t*t*p[3].X;
+					y = t1*t1*p[0].Y + 2*t1*t*p[1].Y + t*t*p[3].Y;
+				}
+				else
+					bezier_point(q, i / 1000.0, &x, &y);
+				d = (x - px) * (x - px) + (y - py) * (y - py);
+				if(d < min)
+					min = d;
+			}
+			if(min > 1.25 * 1.25)
+				++bad;
+		}
+	}
+	// No gaps
+	for(i=0;i<=100;++i)
+	{
+		if(quad)
+		{
+			double t = i / 100.0, t1 = 1.0 - t;
+			x = t1*t1*p[0].X + 2*t1*t*p[1].X + t*t*p[3].X;
+			y = t1*t1*p[0].Y + 2*t1*t*p[1].Y + t*t*p[3].Y;
+		}
+		else
+			bezier_point(q, i / 100.0, &x, &y);
+		found = 0;
+		for(py=(int) y - 1;py<=(int) y + 2;++py)
+			for(px=(int) x - 1;px<=(int) x + 2;++px)
+				if(tft_emu_pixel(px, py) == ILI9341_WHITE)
+					found = 1;
+		if(!found)
+			++bad;
+	}
+	return(bad);
+}
+
+/// @brief Integer Bezier curves stay within a pixel of the exact curve
+/// @return void
+void bezier_tests()
+{
+	p2_int16_t curves[4][4] = {
+		{ {10,10}, {190,20}, {20,190}, {190,190} },
+		{ {100,10}, {190,100}, {100,190}, {10,100} },
+		{ {20,180}, {60,20}, {140,20}, {180,180} },
+		{ {5,100}, {100,5}, {100,195}, {195,100} }
+	};
+	int i, n, bad;
+
+	tft_window_init(tft, 0, 0, tft->w, tft->h);
+	bad = 0;
+	for(i=0;i<4;++i)
+	{
+		tft_fillWin(tft, ILI9341_BLACK);
+		n = tft_Bezier3(tft, curves[i][0], curves[i][1], curves[i][2], curves[i][3], 0, ILI9341_WHITE);
+		if(n < 2 || n > 64)
+			++bad;
+		bad += bezier_check(curves[i], 0);
+		if(tft_emu_pixel(curves[i][0].X, curves[i][0].Y) != ILI9341_WHITE ||
+			tft_emu_pixel(curves[i][3].X, curves[i][3].Y) != ILI9341_WHITE)
+			++bad;
+	}
+	check(bad == 0, "tft_Bezier3");
+
+	bad = 0;
+	for(i=0;i<4;++i)
+	{
+		tft_fillWin(tft, ILI9341_BLACK);
+		n = tft_Bezier2(tft, curves[i][0], curves[i][1], curves[i][3], 0, ILI9341_WHITE);
+		if(n < 2 || n > 64)
+			++bad;
+		bad += bezier_check(curves[i], 1);
+	}
+	check(bad == 0, "tft_Bezier2");
+
+	// Segments follow the size of the curve and the limit
+	{
+		p2_int16_t S = {50,50}, C = {52,48}, T = {53,50};
+		p2_int16_t S2 = {0,0}, C2 = {100,0}, T2 = {100,100};
+
+		tft_fillWin(tft, ILI9341_BLACK);
+		check(tft_Bezier2(tft, S, C, T, 0, ILI9341_WHITE) <= 2, "tft_Bezier2 small");
+		check(tft_Bezier2(tft, S2, C2, T2, 4, ILI9341_WHITE) <= 4, "tft_Bezier2 steps");
+	}
+	tft_fillWin(tft, ILI9341_BLACK);
+}
+
+extern path_t *vfont[];
+
+/// @brief Glyph area from its outline in floating point
+/// Contours are closed like vfont_flatten() closes them, holes run the
+/// other way so their area is subtracted
+/// @param[in] c: character
+/// @param[in] scale: pixels per font unit
+/// @return  area in pixels
+double vfont_area(int c, float scale)
+{
+	int16_t *v = vfont[c - 32]->v;
+	double sx = 0, sy = 0, cx = 0, cy = 0, px, py, t, qx, qy;
+	double area = 0;
+	int ind = 0, i;
+	char k;
+
+	while(1)
+	{
+		k = v[ind];
+		if(k == 'M' || k == 'Z' || k == '.')
+		{
+			area += cx * sy - sx * cy;
+			cx = sx;
+			cy = sy;
+		}
+		if(k == 'M')
+		{
+			sx = cx = v[ind+1];
+			sy = cy = v[ind+2];
+			ind += 3;
+		}
+		else if(k == 'L')
+		{
+			area += cx * v[ind+2] - v[ind+1] * cy;
+			cx = v[ind+1];
+			cy = v[ind+2];
+			ind += 3;
+		}
+		else if(k == 'Q')
+		{
+			for(i=1;i<=64;++i)
+			{
+				t = i / 64.0;
+				qx = (1-t)*(1-t)*cx + 2*(1-t)*t*v[ind+1] + t*t*v[ind+3];
+				qy = (1-t)*(1-t)*cy + 2*(1-t)*t*v[ind+2] + t*t*v[ind+4];
+				if(i == 1)
+				{
+					px = cx;
+					py = cy;
+				}
+				area += px * qy - qx * py;
+				px = qx;
+				py = qy;
+			}
+			cx = v[ind+3];
+			cy = v[ind+4];
+			ind += 5;
+		}
+		else if(k == 'Z')
+			ind += 1;
+		else
+			break;
+	}
+	return(fabs(area) / 2 * scale * scale);
+}
+
+/// @brief Filled vector characters
+/// @return void
+void vfont_tests()
+{
+	window _win, *win = &_win;
+	char *digits = "0123456789B%";
+	char str[2];
+	float scale = 0.12;
+	int i, w, h, bad;
+	int32_t count;
+	double area;
+
+	tft_fillWin(tft, ILI9341_BLACK);
+	tft_window_init(win, 0, 0, 240, 200);
+	tft_setTextColor(win, ILI9341_WHITE, ILI9341_BLACK);
+	vfont_cache_flush();
+
+	// Filled area matches the outline area, holes included
+	h = vfont_height(scale);
+	bad = 0;
+	str[1] = 0;
+	for(i=0;digits[i];++i)
+	{
+		str[0] = digits[i];
+		tft_fillWin(win, ILI9341_BLUE);
+		w = vfont_drawString(win, 10, 10, str, scale);
+		count = count_color(10, 10, w, h, ILI9341_WHITE);
+		area = vfont_area(digits[i], scale);
+		if(fabs(count - area) > area * 0.03 + 4)
+		{
+			printf("%c: pixels %ld, area %.1f\n", digits[i], (long) count, area);
+			++bad;
+		}
+		// The cell is written, the rest is not
+		if(count_color(10, 10, w, h, ILI9341_BLUE) != 0 || count_color(10 + w, 10, 10, h, ILI9341_BLUE) != 10 * h)
+			++bad;
+	}
+	check(bad == 0, "vfont_drawString area");
+
+	// The hole of the 0 is background
+	tft_fillWin(win, win->bg);
+	vfont_drawString(win, 0, 0, "0", scale);
+	check(tft_emu_pixel(vfont_width("0", scale) / 2, h * 6 / 10) == ILI9341_BLACK &&
+		tft_emu_pixel(vfont_width("0", scale) / 2, h / 2) == ILI9341_BLACK, "vfont_drawString hole");
+
+	// Pen advances in 1/16 pixels
+	w = vfont_drawString(win, 0, 0, "11111111", scale);
+	check(w == vfont_width("11111111", scale) &&
+		w == (int) (8 * (int) (vfont[0x31 - 32]->xinc * scale * 16 + 0.5) + 8) / 16, "vfont_drawString advance");
+
+	// Outlines are flattened once
+	vfont_cache_flush();
+	vfont_cache.hits = 0;
+	vfont_cache.misses = 0;
+	vfont_drawString(win, 0, 0, "12:12", scale);
+	check(vfont_cache.misses == 3 && vfont_cache.hits == 2 && vfont_cache.entries == 3, "vfont cache");
+	vfont_drawString(win, 0, 0, "12:12", scale * 2);
+	check(vfont_cache.misses == 6 && vfont_cache.entries == 6, "vfont cache scale");
+	vfont_cache_flush();
+	check(vfont_cache.entries == 0 && vfont_cache.bytes == 0, "vfont_cache_flush");
+}
+
+/// @brief Verify display primitives against the emulated GRAM
+/// @return void
+/// @brief Bit array copy of a run length encoded font, decoded here
+/// independently of the driver
+/// @param[in] *z: run length encoded font
+/// @param[out] *b: bit array font
+/// @param[out] *specs: glyph specs for b
+/// @param[out] *bits: bit arrays for b
+/// @param[in] size: size of bits
+/// @return 0 on success, -1 on a bad encoding
+int font_unrle(_font *z, _font *b, _fontspecs *specs, uint8_t *bits, int size)
+{
+	int i,n,x,c;
+	int pixels;
+	int offset = 0;
+	uint8_t *ptr;
+
+	*b = *z;
+	b->Rle = 0;
+	b->bitmap = bits;
+	b->specs = specs;
+	memset(bits, 0, size);
+	for(i=0;i<z->Glyphs;++i)
+	{
+		specs[i] = z->specs[i];
+		specs[i].Offset = offset;
+		pixels = specs[i].Width * specs[i].Height;
+		ptr = z->bitmap + z->specs[i].Offset;
+		offset += (pixels + 7) / 8;
+		if(offset > size)
+			return(-1);
+		for(x = 0; x < pixels; )
+		{
+			c = *ptr++;
+			if(c == FONT_RLE_END)
+				break;
+			x += (c >> 4);
+			for(n = c & 15; n > 0; --n, ++x)
+				if(x < pixels)
+					bits[specs[i].Offset + x / 8] |= 0x80 >> (x & 7);
+		}
+		if(x > pixels)
+			return(-1);
+	}
+	b->Bytes = offset;
+	return(0);
+}
+
+/// @brief Run length encoded fonts draw the same pixels as their bit arrays
+void font_rle_tests()
+{
+	static _fontspecs specs[MAXGLYPHS];
+	static uint8_t bits[16384];
+	window _w1, *w1 = &_w1;
+	window _w2, *w2 = &_w2;
+	char *str = "Quick 0123 %&@ gjy";
+	_font *z, b;
+	int i,n,x,y;
+	int fonts = 0;
+	char msg[64];
+
+	for(n=0;allfonts[n];++n)
+	{
+		z = allfonts[n];
+		if(!z->Rle)
+			continue;
+		fonts++;
+		sprintf(msg, "font %d rle decode", n);
+		check(font_unrle(z, &b, specs, bits, sizeof(bits)) == 0, msg);
+
+		tft_window_init(w1, 0, 0, 200, 150);
+		tft_window_init(w2, 0, 160, 200, 150);
+		tft_set_font(w1, n);
+		tft_set_font(w2, n);
+		tft_font_var(w1);
+		tft_font_var(w2);
+		tft_setTextColor(w1, ILI9341_WHITE, ILI9341_BLUE);
+		tft_setTextColor(w2, ILI9341_WHITE, ILI9341_BLUE);
+		font_cache_flush();
+
+		// Strings wrap, so both the run and single character paths are used
+		tft_fillWin(w1, ILI9341_BLACK);
+		tft_setpos(w1, 0, 0);
+		tft_drawString(w1, str);
+		allfonts[n] = &b;
+		font_cache_flush();
+		tft_fillWin(w2, ILI9341_BLACK);
+		tft_setpos(w2, 0, 0);
+		tft_drawString(w2, str);
+		allfonts[n] = z;
+		for(i=0;i<200*150;++i)
+		{
+			x = i % 200;
+			y = i / 200;
+			if(tft_emu_pixel(x, y) != tft_emu_pixel(x, 160 + y))
+				break;
+		}
+		sprintf(msg, "font %d rle tft_drawString", n);
+		check(i == 200*150, msg);
+
+		tft_fillWin(w1, ILI9341_BLACK);
+		tft_setpos(w1, 0, 0);
+		for(i=0;str[i];++i)
+			tft_drawChar(w1, str[i]);
+		for(i=0;i<200*150;++i)
+		{
+			x = i % 200;
+			y = i / 200;
+			if(tft_emu_pixel(x, y) != tft_emu_pixel(x, 160 + y))
+				break;
+		}
+		sprintf(msg, "font %d rle tft_drawChar", n);
+		check(i == 200*150, msg);
+		sprintf(msg, "font %d rle is smaller", n);
+		check(z->Bytes < b.Bytes, msg);
+	}
+	check(fonts > 0, "fonts.h has run length encoded fonts");
+	font_cache_flush();
+}
+
+void tests()
+{
+	int i;
+	uint16_t wbuf[8*8];
+	uint16_t rbuf[8*8];
+	window _win, *win = &_win;
+
+	check(tft_ID == 0x9341, "tft_readId");
+
+	tft_fillWin(tft, ILI9341_BLACK);
+	tft_fillRectWH(tft, 10, 20, 30, 40, ILI9341_RED);
+	check(tft_emu_pixel(10,20) == ILI9341_RED, "tft_fillRectWH start");
+	check(tft_emu_pixel(39,59) == ILI9341_RED, "tft_fillRectWH end");
+	check(tft_emu_pixel(40,59) == ILI9341_BLACK, "tft_fillRectWH right edge");
+	check(tft_emu_pixel(39,60) == ILI9341_BLACK, "tft_fillRectWH bottom edge");
+	check(tft_readPixel(tft, 15, 25) == ILI9341_RED, "tft_readPixel");
+
+	for(i=0;i<8*8;++i)
+		wbuf[i] = i * 0x0421;
+	tft_writeRect(tft, 100, 100, 8, 8, wbuf);
+	memset(rbuf, 0, sizeof(rbuf));
+	tft_readRect(tft, 100, 100, 8, 8, rbuf);
+	check(memcmp(wbuf, rbuf, sizeof(rbuf)) == 0, "tft_writeRect/tft_readRect");
+
+	// Bit arrays span several FIFO half loads
+	{
+		uint8_t bits[20*20/8];
+
+		for(i=0;i<sizeof(bits);++i)
+			bits[i] = 0x81;
+		tft_setTextColor(tft, ILI9341_WHITE, ILI9341_BLUE);
+		tft_bit_blit(tft, bits, 150, 20, 20, 20);
+		check(tft_emu_pixel(150,20) == ILI9341_WHITE, "tft_bit_blit fg");
+		check(tft_emu_pixel(151,20) == ILI9341_BLUE, "tft_bit_blit bg");
+		// bit 399 is the last bit of 0x81
+		check(tft_emu_pixel(169,39) == ILI9341_WHITE, "tft_bit_blit end");
+		check(tft_emu_pixel(170,39) == ILI9341_BLACK, "tft_bit_blit edge");
+		tft_setTextColor(tft, ILI9341_WHITE, ILI9341_BLACK);
+	}
+
+	tft_drawLine(tft, 5, 200, 105, 250, ILI9341_GREEN);
+	check(tft_emu_pixel(5,200) == ILI9341_GREEN, "tft_drawLine start");
+	check(tft_emu_pixel(105,250) == ILI9341_GREEN, "tft_drawLine end");
+
+	tft_drawPixel(tft, 200, 300, ILI9341_BLUE);
+	check(tft_emu_pixel(200,300) == ILI9341_BLUE, "tft_drawPixel");
+	check(tft_emu_pixel(201,300) == ILI9341_BLACK, "tft_drawPixel neighbour");
+
+	// Polylines draw the same pixels as separate lines
+	{
+		p2_int16_t pts[4] = { {10,10}, {60,10}, {60,40}, {20,70} };
+
+		tft_fillWin(tft, ILI9341_BLACK);
+		for(i=1;i<4;++i)
+			tft_drawLine(tft, pts[i-1].X, pts[i-1].Y, pts[i].X, pts[i].Y, ILI9341_WHITE);
+		tft_drawPolyLine(tft, pts, 4, ILI9341_RED);
+		check(tft_emu_pixel(10,10) == ILI9341_RED, "tft_drawPolyLine start");
+		check(tft_emu_pixel(60,40) == ILI9341_RED, "tft_drawPolyLine joint");
+		check(tft_emu_pixel(20,70) == ILI9341_RED, "tft_drawPolyLine end");
+		for(i=0;i<80*80;++i)
+			if(tft_emu_pixel(i%80,i/80) == ILI9341_WHITE)
+				break;
+		check(i == 80*80, "tft_drawPolyLine matches tft_drawLine");
+	}
+
+	// Lines are clipped per run, not dropped
+	tft_window_init(win, 50, 60, 40, 30);
+	tft_fillWin(win, ILI9341_BLACK);
+	tft_drawLine(win, -10, 5, 50, 5, ILI9341_CYAN);
+	check(tft_emu_pixel(50,65) == ILI9341_CYAN, "tft_drawLine clip start");
+	check(tft_emu_pixel(89,65) == ILI9341_CYAN, "tft_drawLine clip end");
+	check(tft_emu_pixel(90,65) != ILI9341_CYAN, "tft_drawLine clip");
+
+	// Cached glyphs draw the same pixels as a cleared cell and a bit array
+	tft_window_init(win, 0, 0, 120, 40);
+	tft_set_font(win, 1);
+	tft_font_var(win);
+	tft_setTextColor(win, ILI9341_WHITE, ILI9341_BLUE);
+	font_cache_flush();
+	tft_fillWin(win, ILI9341_BLACK);
+	tft_setpos(win, 0, 0);
+	tft_printf(win, "4242");
+	check(font_cache.entries == 2, "font cache entries");
+	check(font_cache.hits >= 2, "font cache hits");
+	{
+		_fontc f;
+		int x,y;
+
+		font_attr(win, '4', &f);
+		tft_fillRectWH(win, 60, 0, f.skip, f.Height, win->bg);
+		tft_bit_blit(win, f.ptr, 60 + f.x, f.Height - (f.y+f.h), f.w, f.h);
+		for(i=0;i<f.skip*f.Height;++i)
+		{
+			x = i % f.skip;
+			y = i / f.skip;
+			if(tft_emu_pixel(x, y) != tft_emu_pixel(60 + x, y))
+				break;
+		}
+		check(i == f.skip*f.Height, "font cache pixels");
+	}
+	// Colors are part of the key
+	tft_setTextColor(win, ILI9341_WHITE, ILI9341_RED);
+	tft_setpos(win, 0, 0);
+	tft_printf(win, "4");
+	check(font_cache.entries == 3, "font cache color key");
+	font_cache_flush();
+	check(font_cache.entries == 0 && font_cache.bytes == 0, "font_cache_flush");
+
+	// Strings draw the same pixels as single characters, including wrapping
+	{
+		window _w2, *w2 = &_w2;
+		char *str = "Hello, World! 0123456789";
+		int x,y;
+
+		tft_window_init(win, 0, 100, 100, 40);
+		tft_window_init(w2, 120, 100, 100, 40);
+		tft_set_font(win, 0);
+		tft_set_font(w2, 0);
+		tft_font_var(win);
+		tft_font_var(w2);
+		tft_setTextColor(win, ILI9341_YELLOW, ILI9341_NAVY);
+		tft_setTextColor(w2, ILI9341_YELLOW, ILI9341_NAVY);
+		tft_fillWin(win, ILI9341_BLACK);
+		tft_fillWin(w2, ILI9341_BLACK);
+		tft_setpos(win, 0, 0);
+		for(i=0;str[i];++i)
+			tft_drawChar(win, str[i]);
+		tft_setpos(w2, 0, 0);
+		tft_emu_clear_stats();
+		tft_drawString(w2, str);
+		check(tft_emu.windows == 4, "tft_drawString one window per line");
+		check(win->xpos == w2->xpos && win->ypos == w2->ypos, "tft_drawString position");
+		for(i=0;i<100*40;++i)
+		{
+			x = i % 100;
+			y = 100 + i / 100;
+			if(tft_emu_pixel(x, y) != tft_emu_pixel(120 + x, y))
+				break;
+		}
+		check(i == 100*40, "tft_drawString pixels");
+	}
+
+	// Terminal windows scroll in hardware and look the same as software scrolling
+	{
+		static uint16_t view[EMU_TFT_W * 100];
+		window _t, *t = &_t;
+		int x,y,h;
+
+		tft_window_init(t, 0, 100, 120, 100);
+		tft_set_font(t, 0);
+		check(tft_term_init(t) == 0, "tft_term_init partial width");
+
+		tft_window_init(t, 0, 100, tft->w, 100);
+		tft_set_font(t, 0);
+		tft_font_var(t);
+		tft_setTextColor(t, ILI9341_WHITE, ILI9341_BLUE);
+		tft_fillWin(t, t->bg);
+		check(tft_term_init(t) == 1, "tft_term_init");
+		check(t->h % font_H(0) == 0, "tft_term_init whole text rows");
+		h = t->h;
+		tft_emu_clear_stats();
+		for(i=0;i<25;++i)
+			tft_printf(t, "log line %d\n", i);
+		check(tft_emu.rx == 0, "terminal scroll reads nothing");
+		// Lines and rectangles across the scroll wrap
+		tft_drawLine(t, 0, 0, t->w - 1, t->h - 1, ILI9341_RED);
+		tft_fillRectWH(t, 200, 10, 20, t->h - 20, ILI9341_GREEN);
+		tft_bit_blit(t, (uint8_t *) wbuf, 180, 0, 16, 32);
+		for(y=0;y<h;++y)
+			for(x=0;x<EMU_TFT_W;++x)
+				view[y * EMU_TFT_W + x] = tft_emu_view(x, 100 + y);
+		check(tft_readPixel(t, 210, 10) == ILI9341_GREEN, "terminal tft_readPixel");
+		tft_term_end(t);
+		check(!(t->flags & VSCROLL), "tft_term_end");
+
+		tft_window_init(t, 0, 100, tft->w, h);
+		tft_set_font(t, 0);
+		tft_font_var(t);
+		tft_setTextColor(t, ILI9341_WHITE, ILI9341_BLUE);
+		tft_fillWin(t, t->bg);
+		for(i=0;i<25;++i)
+			tft_printf(t, "log line %d\n", i);
+		tft_drawLine(t, 0, 0, t->w - 1, t->h - 1, ILI9341_RED);
+		tft_fillRectWH(t, 200, 10, 20, t->h - 20, ILI9341_GREEN);
+		tft_bit_blit(t, (uint8_t *) wbuf, 180, 0, 16, 32);
+		for(i=0;i<h * EMU_TFT_W;++i)
+			if(view[i] != tft_emu_view(i % EMU_TFT_W, 100 + i / EMU_TFT_W))
+				break;
+		check(i == h * EMU_TFT_W, "terminal matches software scroll");
+	}
+
+	// Windows are relative to the master window
+	tft_window_init(win, 50, 60, 40, 30);
+	tft_fillWin(win, ILI9341_YELLOW);
+	check(tft_emu_pixel(50,60) == ILI9341_YELLOW, "window fill start");
+	check(tft_emu_pixel(89,89) == ILI9341_YELLOW, "window fill end");
+	check(tft_emu_pixel(90,89) != ILI9341_YELLOW, "window fill clip");
+
+	// Rotation exchanges X and Y
+	tft_setRotation(1);
+	tft_fillWin(tft, ILI9341_BLACK);
+	tft_fillRectWH(tft, 300, 10, 5, 5, ILI9341_WHITE);
+	check(tft_emu_pixel(302,12) == ILI9341_WHITE, "rotation 1 fill");
+	check(tft_readPixel(tft, 304, 14) == ILI9341_WHITE, "rotation 1 read");
+	tft_setRotation(0);
+
+	fb_tests();
+	flood_tests();
+	poly_tests();
+	fill_triangle_tests();
+	fixed3d_tests();
+	wire_tests();
+	anim_tests();
+	cull_tests();
+	mesh_tests();
+	aa_tests();
+	bezier_tests();
+	vfont_tests();
+	font_rle_tests();
+}
+
+/// @brief Bitmap size and drawing time of every font in fonts.h
+/// Run length encoded fonts are also timed as bit arrays
+/// @return void
+void font_rle_report()
+{
+	static _fontspecs specs[MAXGLYPHS];
+	static uint8_t bits[16384];
+	window _win, *win = &_win;
+	char *str = "12:34 Hello";
+	_font *z, b;
+	uint32_t t;
+	double us, bits_us;
+	int i,n;
+
+	tft_window_init(win, 0, 0, tft->w, 100);
+	tft_font_var(win);
+	tft_setTextColor(win, ILI9341_WHITE, ILI9341_BLACK);
+	printf("font  size   format flash   bits    cpu/string   bits cpu/string\n");
+	for(n=0;allfonts[n];++n)
+	{
+		z = allfonts[n];
+		tft_set_font(win, n);
+		t = system_get_time();
+		for(i=0;i<20;++i)
+		{
+			font_cache_flush();
+			tft_setpos(win, 0, 0);
+			tft_drawString(win, str);
+		}
+		us = (system_get_time() - t) / 20.0;
+		printf("%-4d %2dx%-2d  %-5s %6d", n, z->Width, z->Height, z->Rle ? "rle" : "bits", z->Bytes);
+		if(!z->Rle || font_unrle(z, &b, specs, bits, sizeof(bits)) < 0)
+		{
+			printf("        %8.1fus\n", us);
+			continue;
+		}
+		allfonts[n] = &b;
+		t = system_get_time();
+		for(i=0;i<20;++i)
+		{
+			font_cache_flush();
+			tft_setpos(win, 0, 0);
+			tft_drawString(win, str);
+		}
+		bits_us = (system_get_time() - t) / 20.0;
+		allfonts[n] = z;
+		printf(" %6d %8.1fus   %8.1fus\n", b.Bytes, us, bits_us);
+	}
+	font_cache_flush();
+}
+
+/// @brief SPI traffic per call for the display primitives
+/// @return void
+void benchmarks()
+{
+	int i;
+	uint16_t buf[32*32];
+	uint8_t bits[32*32/8];
+	window _win, *win = &_win;
+
+	for(i=0;i<32*32;++i)
+		buf[i] = i;
+	for(i=0;i<sizeof(bits);++i)
+		bits[i] = 0x5a;
+
+	tft_window_init(win, 0, 0, tft->w, tft->h);
+	tft_set_font(win, 0);
+	tft_font_var(win);
+	tft_setTextColor(win, ILI9341_WHITE, ILI9341_BLUE);
+
+	printf("SPI clock %ld HZ, per call averages\n", (long) tft_emu_spi_hz());
+	BENCH("tft_fillWin", 10, tft_fillWin(tft, i));
+	BENCH("tft_fillRectWH 10x10", 100, tft_fillRectWH(tft, i, i, 10, 10, i));
+	BENCH("tft_drawPixel", 1000, tft_drawPixel(tft, i % tft->w, i / tft->w, i));
+	BENCH("tft_drawLine 100x50", 100, tft_drawLine(tft, 10, 10, 110, 60, i));
+	BENCH("tft_drawLine 45deg", 100, tft_drawLine(tft, 10, 10, 110, 110, i));
+	{
+		// Large numerals, the first string flattens the outlines
+		uint32_t t;
+
+		vfont_cache_flush();
+		BENCH("vfont 12:34 first", 1, vfont_drawString(tft, 0, 0, "12:34", 0.12));
+		BENCH("vfont 12:34 cached", 10, vfont_drawString(tft, 0, 0, "12:34", 0.12));
+		t = system_get_time();
+		for(i=0;i<100;++i)
+		{
+			vfont_cache_flush();
+			vfont_drawString(tft, 0, 0, "12:34", 0.12);
+		}
+		printf("%-20s %6d cpu: %8.1fus\n", "vfont 12:34 first", 100, (system_get_time() - t) / 100.0);
+		t = system_get_time();
+		for(i=0;i<100;++i)
+			vfont_drawString(tft, 0, 0, "12:34", 0.12);
+		printf("%-20s %6d cpu: %8.1fus\n", "vfont 12:34 cached", 100, (system_get_time() - t) / 100.0);
+		BENCH("drawSVG outlines", 1, {
+			drawSVG(tft, 0, 0, '1', 0.12, ILI9341_WHITE, 0);
+			drawSVG(tft, 60, 0, '2', 0.12, ILI9341_WHITE, 0);
+			drawSVG(tft, 120, 0, ':', 0.12, ILI9341_WHITE, 0);
+			drawSVG(tft, 140, 0, '3', 0.12, ILI9341_WHITE, 0);
+			drawSVG(tft, 200, 0, '4', 0.12, ILI9341_WHITE, 0);
+		});
+	}
+	{
+		// Glyph sized and screen sized curves, the float version used 10 steps
+		p2_int16_t small[4] = { {10,10}, {30,12}, {12,30}, {30,30} };
+		p2_int16_t large[4] = { {10,10}, {230,20}, {20,300}, {230,300} };
+		uint32_t t;
+
+		BENCH("tft_Bezier3 20px", 100, tft_Bezier3(tft, small[0], small[1], small[2], small[3], 0, i));
+		BENCH("float Bezier3 20px", 100, ref_bezier3(tft, small, 10, i));
+		BENCH("tft_Bezier3 300px", 100, tft_Bezier3(tft, large[0], large[1], large[2], large[3], 0, i));
+		BENCH("float Bezier3 300px", 100, ref_bezier3(tft, large, 10, i));
+		t = system_get_time();
+		for(i=0;i<1000;++i)
+			tft_Bezier3(tft, small[0], small[1], small[2], small[3], 0, i);
+		printf("%-20s %6d cpu: %8.1fus\n", "tft_Bezier3 20px", 1000, (system_get_time() - t) / 1000.0);
+		t = system_get_time();
+		for(i=0;i<1000;++i)
+			ref_bezier3(tft, small, 10, i);
+		printf("%-20s %6d cpu: %8.1fus\n", "float Bezier3 20px", 1000, (system_get_time() - t) / 1000.0);
+	}
+	{
+		// Gauge needle, 60 pixels, erased and drawn at a new angle each frame
+		window _g, *g = &_g;
+		int16_t nx[37], ny[37];
+		uint32_t t;
+		int mode;
+		int modes[3] = { 0, AA_BG, AA_READ };
+		char *names[3] = { "needle aliased", "needle AA_BG", "needle AA_READ" };
+
+		for(i=0;i<37;++i)
+		{
+			nx[i] = 60 + 60 * cos(i * M_PI / 36);
+			ny[i] = 60 - 60 * sin(i * M_PI / 36);
+		}
+		tft_window_init(g, 0, 0, 121, 61);
+		tft_setTextColor(g, ILI9341_WHITE, ILI9341_BLACK);
+		for(mode=0;mode<3;++mode)
+		{
+			tft_antialias(g, modes[mode]);
+			tft_fillWin(g, g->bg);
+			// Lines over win->bg are erased exactly with AA_BG
+			BENCH(names[mode], 36, {
+				tft_antialias(g, modes[mode] ? AA_BG : 0);
+				tft_drawLine(g, 60, 60, nx[i], ny[i], g->bg);
+				tft_antialias(g, modes[mode]);
+				tft_drawLine(g, 60, 60, nx[i+1], ny[i+1], ILI9341_WHITE);
+			});
+			t = system_get_time();
+			for(i=0;i<3600;++i)
+				tft_drawLine(g, 60, 60, nx[i % 36], ny[i % 36], ILI9341_WHITE);
+			printf("%-20s %6d cpu: %8.1fus\n", names[mode], 3600, (system_get_time() - t) / 3600.0);
+		}
+	}
+	{
+		p2_int16_t pts[33];
+		for(i=0;i<33;++i)
+		{
+			pts[i].X = 120 + 60 * cos(i * M_PI / 16);
+			pts[i].Y = 160 + 60 * sin(i * M_PI / 16);
+		}
+		BENCH("tft_drawLine 32gon", 10, {
+			int j;
+			for(j=1;j<33;++j)
+				tft_drawLine(tft, pts[j-1].X, pts[j-1].Y, pts[j].X, pts[j].Y, i);
+		});
+		BENCH("tft_drawPolyLine 32gon", 10, tft_drawPolyLine(tft, pts, 33, i));
+	}
+	{
+		point V = { -90, -90, -90 };
+		wire_view_t M;
+		wire_p W;
+		point P;
+		p3_int16_t S;
+		uint32_t t;
+		int j;
+		// Keeps the transforms from being optimized away
+		volatile long sum = 0;
+
+		BENCH("wire_draw earth 200", 1, wire_draw(tft, earth_data, NULL, &V, 120, 160, 200, ILI9341_WHITE));
+		BENCH("wire_draw earth horizon", 1, wire_draw_cull(tft, earth_data, NULL, NULL, &V, 120, 160, 200, ILI9341_WHITE, WIRE_CULL_HORIZON));
+		t = system_get_time();
+		for(i=0;i<100;++i)
+			wire_draw(tft, earth_data, NULL, &V, 120, 160, 200, ILI9341_WHITE);
+		printf("%-20s %6d cpu: %8.1fus\n", "earth wire_draw", 100, (system_get_time() - t) / 100.0);
+		t = system_get_time();
+		for(i=0;i<100;++i)
+			wire_draw_cull(tft, earth_data, NULL, NULL, &V, 120, 160, 200, ILI9341_WHITE, WIRE_CULL_HORIZON);
+		printf("%-20s %6d cpu: %8.1fus\n", "earth horizon cull", 100, (system_get_time() - t) / 100.0);
+		{
+			wire_mesh_t m, lod;
+			double scales[4] = { 200, 100, 50, 25 };
+			char name[32];
+
+			wire_mesh_open(&m, wire_mesh_flash_read, earth_mesh, 0);
+			wire_mesh_open(&lod, wire_mesh_flash_read, earth_mesh, WIRE_MESH_AUTO);
+			BENCH("wire_draw_mesh earth horizon", 1, wire_draw_mesh(tft, &m, &V, 120, 160, 200, ILI9341_WHITE, WIRE_CULL_HORIZON));
+			t = system_get_time();
+			for(i=0;i<100;++i)
+				wire_draw_mesh(tft, &m, &V, 120, 160, 200, ILI9341_WHITE, WIRE_CULL_HORIZON);
+			printf("%-20s %6d cpu: %8.1fus\n", "earth mesh horizon", 100, (system_get_time() - t) / 100.0);
+			printf("%-20s %6d bytes, level 0 %d bytes, wire_p table %d bytes\n", "earth_mesh",
+				(int) sizeof(earth_mesh), (int) (m.end - m.start), (int) sizeof(earth_data));
+
+			// Frame time with and without levels of detail by size on the display
+			for(j=0;j<4;++j)
+			{
+				sprintf(name, "earth full %d", (int) scales[j]);
+				BENCH(name, 1, wire_draw_mesh(tft, &m, &V, 120, 160, scales[j], ILI9341_WHITE, WIRE_CULL_HORIZON));
+				sprintf(name, "earth lod %d", (int) scales[j]);
+				BENCH(name, 1, wire_draw_mesh(tft, &lod, &V, 120, 160, scales[j], ILI9341_WHITE, WIRE_CULL_HORIZON));
+				t = system_get_time();
+				for(i=0;i<100;++i)
+					wire_draw_mesh(tft, &m, &V, 120, 160, scales[j], ILI9341_WHITE, WIRE_CULL_HORIZON);
+				sprintf(name, "earth full %d", (int) scales[j]);
+				printf("%-20s %6d cpu: %8.1fus\n", name, 100, (system_get_time() - t) / 100.0);
+				t = system_get_time();
+				for(i=0;i<100;++i)
+					wire_draw_mesh(tft, &lod, &V, 120, 160, scales[j], ILI9341_WHITE, WIRE_CULL_HORIZON);
+				sprintf(name, "earth lod %d", (int) scales[j]);
+				printf("%-20s %6d cpu: %8.1fus\n", name, 100, (system_get_time() - t) / 100.0);
+			}
+		}
+
+		// CPU time to transform the earth, the display is not used
+		t = system_get_time();
+		for(i=0;i<100;++i)
+		{
+			for(j=0;earth_data[j].x != WIRE_END;++j)
+			{
+				if(earth_data[j].x == WIRE_SEP)
+					continue;
+				wire2fp((wire_p *) &earth_data[j], &P);
+				rotate(&P, &V);
+				PerspectiveProjection(&P, 200, 120, 160);
+				sum += P.x;
+			}
+		}
+		printf("%-20s %6d cpu: %8.1fus\n", "earth rotate double", 100, (system_get_time() - t) / 100.0);
+		t = system_get_time();
+		for(i=0;i<100;++i)
+		{
+			wire_view(&M, &V, 200, 120, 160);
+			for(j=0;earth_data[j].x != WIRE_END;++j)
+			{
+				W = earth_data[j];
+				if(W.x == WIRE_SEP)
+					continue;
+				wire_project(&M, &W, &S);
+				sum += S.X;
+			}
+		}
+		printf("%-20s %6d cpu: %8.1fus\n", "earth wire_project", 100, (system_get_time() - t) / 100.0);
+		t = system_get_time();
+		for(i=0;i<100;++i)
+		{
+			fx_mat3 R;
+			fx_vec3 F;
+			int16_t X, Y;
+
+			fx_mat3_rotate(&R, FX_DEG(V.x), FX_DEG(V.y), FX_DEG(V.z));
+			for(j=0;earth_data[j].x != WIRE_END;++j)
+			{
+				if(earth_data[j].x == WIRE_SEP)
+					continue;
+				F.x = earth_data[j].x;
+				F.y = earth_data[j].y;
+				F.z = earth_data[j].z;
+				fx_mat3_apply(&R, &F, &F);
+				fx_project(&F, FX_Q16(200), 120, 160, &X, &Y);
+				sum += X;
+			}
+		}
+		printf("%-20s %6d cpu: %8.1fus\n", "earth fx_mat3_apply", 100, (system_get_time() - t) / 100.0);
+
+		// Per frame setup, three double rotations versus the fixed point matrix
+		t = system_get_time();
+		for(i=0;i<1000;++i)
+		{
+			for(j=0;j<3;++j)
+			{
+				P.x = (j == 0);
+				P.y = (j == 1);
+				P.z = (j == 2);
+				V.z = i;
+				rotate(&P, &V);
+				sum += P.x;
+			}
+		}
+		printf("%-20s %6d cpu: %8.2fus\n", "view rotate double", 1000, (system_get_time() - t) / 1000.0);
+		t = system_get_time();
+		for(i=0;i<1000;++i)
+		{
+			V.z = i;
+			wire_view(&M, &V, 200, 120, 160);
+			sum += M.m[0][0];
+		}
+		printf("%-20s %6d cpu: %8.2fus\n", "view wire_view", 1000, (system_get_time() - t) / 1000.0);
+	}
+	{
+		window _win, *win = &_win;
+		wire_anim_t A;
+		point V;
+
+		tft_window_init(win, 120, 100, 120, 140);
+		tft_setTextColor(win, ILI9341_WHITE, ILI9341_BLUE);
+		tft_fillWin(win, win->bg);
+		memset(&A, 0, sizeof(A));
+		(void) wire_anim_init(&A, win, ILI9341_WHITE);
+		// Same steps as the cube demo in user_loop()
+		BENCH("cube erase+draw", 20, {
+			V.x = V.y = V.z = i * 4;
+			wire_draw(win, cube_points, cube_edges, &V, 60, 70, 60, win->bg);
+			V.x = V.y = V.z = (i + 1) * 4;
+			wire_draw(win, cube_points, cube_edges, &V, 60, 70, 60, ILI9341_WHITE);
+		});
+		tft_fillWin(win, win->bg);
+		BENCH("cube wire_anim_draw", 20, {
+			V.x = V.y = V.z = (i + 1) * 4;
+			wire_anim_draw(&A, cube_points, cube_edges, NULL, &V, 60, 70, 60, 0);
+		});
+		// Slow rotation, most pixels stay
+		BENCH("cube 1deg erase+draw", 20, {
+			V.x = V.y = V.z = i;
+			wire_draw(win, cube_points, cube_edges, &V, 60, 70, 60, win->bg);
+			V.x = V.y = V.z = i + 1;
+			wire_draw(win, cube_points, cube_edges, &V, 60, 70, 60, ILI9341_WHITE);
+		});
+		wire_anim_erase(&A);
+		tft_fillWin(win, win->bg);
+		BENCH("cube 1deg wire_anim_draw", 20, {
+			V.x = V.y = V.z = i + 1;
+			wire_anim_draw(&A, cube_points, cube_edges, NULL, &V, 60, 70, 60, 0);
+		});
+		wire_anim_free(&A);
+	}
+	BENCH("tft_drawFastHLine", 100, tft_drawFastHLine(tft, 0, i, 100, i));
+	BENCH("tft_drawCircle r50", 10, tft_drawCircle(tft, 120, 160, 50, i));
+	BENCH("tft_fillCircle r50", 10, tft_fillCircle(tft, 120, 160, 50, i));
+	{
+		p2_int16_t pts[2*17];
+		int n;
+
+		for(n=0;n<32;++n)
+		{
+			pts[n].X = 120 + lround(50 * cos(n * M_PI / 16));
+			pts[n].Y = 160 + lround(50 * sin(n * M_PI / 16));
+		}
+		BENCH("tft_fillPolygon 32gon r50", 10, tft_fillPolygon(tft, pts, 32, i));
+		BENCH("tft_fillTriangle 100", 10, tft_fillTriangle(tft, 20, 20, 120, 40, 60, 120, i));
+		n = gauge_points(pts, 120, 160, 60, 90, M_PI * 1.25, M_PI * -0.25, 16);
+		BENCH("tft_fillPolygon gauge", 10, tft_fillPolygon(tft, pts, n, i));
+	}
+	BENCH("tft_writeRect 32x32", 100, tft_writeRect(tft, 20, 20, 32, 32, buf));
+	BENCH("tft_readRect 32x32", 100, tft_readRect(tft, 20, 20, 32, 32, buf));
+	BENCH("tft_bit_blit 32x32", 100, tft_bit_blit(tft, bits, 20, 20, 32, 32));
+	BENCH("tft_readPixel", 1000, tft_readPixel(tft, i % tft->w, i / tft->w));
+	{
+		window _fw, *fw = &_fw;
+
+		tft_window_init(fw, 20, 60, FLOOD_TW, FLOOD_TH);
+		flood_bench(fw, "circle", shape_circle, 100, 100);
+		flood_bench(fw, "comb", shape_comb, 2, fw->h - 3);
+		flood_bench(fw, "maze", shape_maze, fw->w / 2, fw->h / 2);
+	}
+	font_cache_flush();
+	BENCH("tft_drawChar miss", 95, (tft_setpos(win, 0, 0), tft_drawChar(win, ' ' + i)));
+	BENCH("tft_drawChar hit", 95, (tft_setpos(win, 0, 0), tft_drawChar(win, '0' + i % 10)));
+	BENCH("tft_drawString 40 chars", 10,
+		(tft_setpos(win, 0, 0), tft_drawString(win, "0123456789012345678901234567890123456789")));
+	BENCH("tft_printf 40 chars", 10,
+		(tft_setpos(win, 0, 0), tft_printf(win, "0123456789012345678901234567890123456789")));
+	BENCH("tft_Vscroll 13 lines", 10, tft_Vscroll(win, 13));
+	tft_setpos(win, 0, win->h - font_H(0));
+	BENCH("log console line", 20, tft_printf(win, "log line %d\n", i));
+	tft_term_init(win);
+	BENCH("tft_Vscroll 13 lines terminal", 10, tft_Vscroll(win, 13));
+	tft_setpos(win, 0, win->h - font_H(0));
+	BENCH("log console line terminal", 20, tft_printf(win, "log line %d\n", i));
+	tft_term_end(win);
+	font_cache_print();
+
+	// Status panel redraw: direct versus frame buffer and flush
+	tft_window_init(win, 0, 0, 160, 40);
+	tft_set_font(win, 0);
+	tft_font_var(win);
+	tft_setTextColor(win, ILI9341_WHITE, ILI9341_BLUE);
+	BENCH("status panel direct", 10,
+		(tft_fillWin(win, ILI9341_BLUE), tft_setpos(win, 0, 0),
+		tft_printf(win, "Time %d\nHeap 12345", i)));
+	tft_fb_init(win, NULL, NULL, 0);
+	BENCH("status panel fb+flush", 10,
+		(tft_fillWin(win, ILI9341_BLUE), tft_setpos(win, 0, 0),
+		tft_printf(win, "Time %d\nHeap 12345", i), tft_flush(win)));
+	BENCH("tft_Vscroll 13 fb+flush", 10, (tft_Vscroll(win, 13), tft_flush(win)));
+	tft_fb_free(win);
+
+	font_rle_report();
+}
+
+/// @brief main display emulator test program
+/// Usage: test_ili9341 [-p snapshot.ppm]
+/// @return 0 on success, 1 on test failure
+int main(int argc, char *argv[])
+{
+	int i;
+	char *ppm = NULL;
+
+	for(i=1;i<argc;++i)
+	{
+		if(strcmp(argv[i],"-p") == 0 && i+1 < argc)
+			ppm = argv[++i];
+	}
+
+	tft_init();
+
+	printf("=======================\n");
+	printf("Display tests\n");
+	tests();
+	printf("%d errors\n", errors);
+	printf("=======================\n");
+	printf("Display benchmarks\n");
+	benchmarks();
+	printf("=======================\n");
+
+	if(ppm)
+		tft_emu_ppm(ppm);
+
+	return(errors ? 1 : 0);
+}
@@ -0,0 +1,59 @@
+/**
+ @file user_config.h
+
+ @brief Master include file for Linux host builds
+  Replaces include/user_config.h when project code is compiled on Linux
+  for the display emulator, benchmarks and standalone tests.
+  Only the headers and stubs that project code needs are provided here.
+
+ @par Copyright &copy; 2018 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __USER_CONFIG_H__
+#define __USER_CONFIG_H__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+
+// Named address spaces are meaningless on the host
+#define MEMSPACE		/* */
+#define MEMSPACE_RO		/* */
+#define MEMSPACE_FONT	/* */
+#define ICACHE_FLASH_ATTR	/* */
+#define ICACHE_RODATA_ATTR	/* */
+#define LOCAL static
+
+/// @brief macros to simplify filling buffers
+#define Mem_Clear(a) memset(a, 0, sizeof(a))
+#define Mem_Set(a,b) memset(a, (int) b, sizeof(a))
+
+// HSPI FIFO size and prototypes - constants only, hspi.c is not used
+#include "esp8266/hspi.h"
+// Flash read and bit test functions - host versions in emu_sup.c
+#include "esp8266/flash.h"
+
+/* emu_sup.c */
+void optimistic_yield ( uint32_t interval_us );
+void wdt_reset ( void );
+void os_delay_us ( uint32_t us );
+uint32_t system_get_time ( void );
+
+#endif // __USER_CONFIG_H__
@@ -421,6 +421,42 @@ void spi_TX_buffer(const uint8_t *data, int count)
 #endif
 }
 
+/// @brief SPI streamed write
+/// @see hspi_TX_stream
+/// @param[in] fill: fills up to HSPI_HALF_SIZE bytes, returns 0 when done
+/// @param[in] *arg: argument passed to fill
+/// @return  void
+void spi_TX_stream(hspi_fill_t fill, void *arg)
+{
+#ifdef ESP8266
+    hspi_TX_stream(fill, arg);
+#endif
+#ifdef AVR
+	uint8_t buf[HSPI_HALF_SIZE];
+	int bytes;
+
+	while((bytes = fill(arg, buf, sizeof(buf))) > 0)
+		SPI0_TX(buf,bytes);
+#endif
+}
+
+/// @brief SPI write of a repeated pattern
+/// @see hspi_TX_repeat
+/// @param[in] *pattern: pattern to send
+/// @param[in] bytes: pattern size 1 .. HSPI_FIFO_SIZE
+/// @param[in] count: number of times to send the pattern
+/// @return  void
+void spi_TX_repeat(uint8_t *pattern, int bytes, int32_t count)
+{
+#ifdef ESP8266
+    hspi_TX_repeat(pattern, bytes, count);
+#endif
+#ifdef AVR
+	while(count-- > 0)
+		SPI0_TX(pattern,bytes);
+#endif
+}
+
 /// @brief SPI read buffer
 /// @param[in] *data: transmit buffer
 /// @param[in] count: number of bytes to write
@@ -210,6 +210,8 @@ void spi_begin ( uint32_t clock , int pin );
 void spi_end ( uint8_t pin );
 uint8_t spi_chip_select_status ( void );
 void spi_TX_buffer ( const uint8_t *data , int count );
+void spi_TX_stream ( hspi_fill_t fill , void *arg );
+void spi_TX_repeat ( uint8_t *pattern , int bytes , int32_t count );
 void spi_RX_buffer ( const uint8_t *data , int count );
 void spi_TXRX_buffer ( const uint8_t *data , int count );
 uint8_t spi_RX ( void );
@@ -284,6 +284,90 @@ void hspi_TX(uint8_t *data, int count)
 	}
 }
 
+/// @brief HSPI streamed write using both FIFO halves
+/// The next chunk is prepared by fill() and loaded into one half of the
+/// FIFO while the other half is shifting out, so the CPU and bus overlap.
+/// Returns once the last byte has been sent.
+/// @param[in] fill: fills up to HSPI_HALF_SIZE bytes, returns 0 when done
+/// @param[in] *arg: argument passed to fill
+/// @return  void
+void hspi_TX_stream(hspi_fill_t fill, void *arg)
+{
+	uint32_t buf[HSPI_HALF_SIZE/4];
+	uint32_t user;
+	int bytes;
+	int half;
+	int i;
+
+	hspi_config(CONFIG_FOR_TX);   // Does hspi_waitReady(); first
+	user = READ_PERI_REG(SPI_FLASH_USER(HSPI));
+
+	half = 0;
+	bytes = fill(arg, (uint8_t *) buf, HSPI_HALF_SIZE);
+	while(bytes > 0)
+	{
+		// The other half may still be shifting out
+		for(i=0; i < (bytes+3)/4; ++i)
+			((uint32_t *)SPI_FLASH_C0(HSPI)) [i + half * (HSPI_HALF_SIZE/4)] = buf[i];
+
+		hspi_waitReady();
+		if(half)
+			WRITE_PERI_REG(SPI_FLASH_USER(HSPI), user | SPI_USR_DOUT_HIGHPART);
+		else
+			WRITE_PERI_REG(SPI_FLASH_USER(HSPI), user);
+		hspi_setBits(bytes);
+		hspi_startSend();
+
+		half ^= 1;
+		// Prepare the next chunk while this one is sent
+		bytes = fill(arg, (uint8_t *) buf, HSPI_HALF_SIZE);
+	}
+
+	// Other functions use the low FIFO half
+	hspi_waitReady();
+	WRITE_PERI_REG(SPI_FLASH_USER(HSPI), user);
+}
+
+/// @brief HSPI write of a repeated pattern
+/// The FIFO is loaded once with as many copies of the pattern as fit,
+/// then the send is restarted until count copies have been sent.
+/// Transmit only transfers do not modify the FIFO.
+/// @param[in] *pattern: pattern to send
+/// @param[in] bytes: pattern size 1 .. HSPI_FIFO_SIZE
+/// @param[in] count: number of times to send the pattern
+/// @return  void
+void hspi_TX_repeat(uint8_t *pattern, int bytes, int32_t count)
+{
+	uint32_t buf[HSPI_FIFO_SIZE/4];
+	uint8_t *ptr = (uint8_t *) buf;
+	int per;
+	int i;
+
+	if(bytes < 1 || bytes > HSPI_FIFO_SIZE || count < 1)
+		return;
+
+	// Copies of the pattern per FIFO load
+	per = HSPI_FIFO_SIZE / bytes;
+	for(i=0;i<per*bytes;++i)
+		ptr[i] = pattern[i % bytes];
+
+	hspi_config(CONFIG_FOR_TX);   // Does hspi_waitReady(); first
+	hspi_writeFIFO(ptr, per*bytes);
+
+	while(count >= per)
+	{
+		hspi_startSend();
+		hspi_waitReady();
+		count -= per;
+	}
+	if(count)
+	{
+		hspi_setBits(count*bytes);
+		hspi_startSend();
+		hspi_waitReady();
+	}
+}
+
 /// @brief HSPI write and read using FIFO
 /// @param[in] *data: transmit / receive buffer
 /// @param[in] count: number of bytes to write / read
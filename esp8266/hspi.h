@@ -15,11 +15,20 @@
 #define CONFIG_FOR_TX           1
 #define CONFIG_FOR_RX_TX        2
 
+// Streamed transmit alternates between the two FIFO halves
+#define HSPI_HALF_SIZE  (HSPI_FIFO_SIZE/2)
+
+/// @brief Streamed transmit fill function
+/// Writes up to bytes into buf and returns the count written, 0 when done
+typedef int (*hspi_fill_t)(void *arg, uint8_t *buf, int bytes);
+
 /* hspi.c */
 void hspi_init ( uint32_t prescale , int hwcs );
 void hspi_waitReady ( void );
 void hspi_TX ( uint8_t *data , int count );
 void hspi_TXRX ( uint8_t *data , int count );
 void hspi_RX ( uint8_t *data , int count );
+void hspi_TX_stream ( hspi_fill_t fill , void *arg );
+void hspi_TX_repeat ( uint8_t *pattern , int bytes , int32_t count );
 
 #endif                                            /* INCLUDE_HSPI_H_ */
@@ -7,7 +7,11 @@
 /* storage control modules to the FatFs module with a defined API.       */
 /*-----------------------------------------------------------------------*/
 
+#ifdef RAMDISK
+#define DRV_RAM 0	/* RAM disk or host disk image in place of the SD card */
+#else
 #define DRV_MMC 0
+#endif
 
 /* mmc.c */
 #include "user_config.h"
@@ -22,6 +26,88 @@
 #ifdef DRV_MMC
 #include "mmc.h"		/* Header file of existing SD control module */
 #endif
+#ifdef DRV_RAM
+#include "ramdisk.h"	/* Header file of the RAM disk module */
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/* Disk Statistics                                                       */
+/*-----------------------------------------------------------------------*/
+/* Single and multiple sector transfers are counted separately, on the   */
+/* SD card they are CMD17/CMD24 and CMD18/CMD25 with a CMD12 stop.       */
+
+/// @brief Disk statistics for all drives
+DSTATS disk_stats;
+
+#if DISK_CACHE_SECTORS > 0 && _USE_WRITE
+/// @brief Sector cache enable, see disk_cache_enable()
+static BYTE dc_enabled = 1;
+static DRESULT dc_flush (BYTE pdrv);
+static void dc_invalidate (BYTE pdrv);
+#endif
+
+/// @brief Add one transfer to the statistics
+/// @param[in] count: sectors transferred
+/// @param[in] res: transfer result
+/// @param[in] start: system_get_time() at the start of the transfer
+/// @param[in] write: 1 for writes, 0 for reads
+/// @return void
+static void disk_stats_add(UINT count, DRESULT res, uint32_t start, int write)
+{
+	DWORD us = system_get_time() - start;
+
+	if (res != RES_OK) {
+		disk_stats.errors++;
+		return;
+	}
+	if (write) {
+		disk_stats.writes++;
+		if (count == 1) disk_stats.write_single++;
+		else disk_stats.write_multi++;
+		disk_stats.write_sectors += count;
+		disk_stats.write_us += us;
+		if (us > disk_stats.write_max_us) disk_stats.write_max_us = us;
+	} else {
+		disk_stats.reads++;
+		if (count == 1) disk_stats.read_single++;
+		else disk_stats.read_multi++;
+		disk_stats.read_sectors += count;
+		disk_stats.read_us += us;
+		if (us > disk_stats.read_max_us) disk_stats.read_max_us = us;
+	}
+}
+
+/// @brief Clear the disk statistics
+/// @return void
+MEMSPACE
+void disk_stats_clear (void)
+{
+	memset(&disk_stats, 0, sizeof(disk_stats));
+}
+
+/// @brief Display the disk statistics
+/// @return void
+MEMSPACE
+void disk_stats_print (void)
+{
+	DSTATS *d = &disk_stats;
+
+	printf("Disk reads:  %8ld calls, %8ld sectors, single(CMD17) %ld, multi(CMD18) %ld\n",
+		(long) d->reads, (long) d->read_sectors, (long) d->read_single, (long) d->read_multi);
+	printf("Disk writes: %8ld calls, %8ld sectors, single(CMD24) %ld, multi(CMD25) %ld\n",
+		(long) d->writes, (long) d->write_sectors, (long) d->write_single, (long) d->write_multi);
+	printf("Disk syncs:  %8ld, errors: %ld\n", (long) d->syncs, (long) d->errors);
+#if DISK_CACHE_SECTORS > 0 && _USE_WRITE
+	printf("Cache: %d sectors, hits %ld, misses %ld, read ahead %ld, write backs %ld%s\n",
+		DISK_CACHE_SECTORS, (long) d->cache_hits, (long) d->cache_misses,
+		(long) d->cache_readahead, (long) d->cache_writebacks, dc_enabled ? "" : ", off");
+#endif
+	printf("Read  time: %8ld us, avg %ld us, max %ld us\n", (long) d->read_us,
+		(long) (d->reads ? d->read_us / d->reads : 0), (long) d->read_max_us);
+	printf("Write time: %8ld us, avg %ld us, max %ld us\n", (long) d->write_us,
+		(long) (d->writes ? d->write_us / d->writes : 0), (long) d->write_max_us);
+}
 
 
 /*-----------------------------------------------------------------------*/
@@ -40,6 +126,10 @@ DSTATUS disk_status (
 #ifdef DRV_MMC
 	case DRV_MMC :
 		return mmc_disk_status();
+#endif
+#ifdef DRV_RAM
+	case DRV_RAM :
+		return ram_disk_status();
 #endif
 	}
 	return STA_NOINIT;
@@ -55,6 +145,13 @@ DSTATUS disk_initialize (
 	BYTE pdrv				/* Physical drive nmuber to identify the drive */
 )
 {
+#if DISK_CACHE_SECTORS > 0 && _USE_WRITE
+	/* The card may have been changed, keep nothing from before */
+	if (!(disk_status(pdrv) & STA_NOINIT))
+		dc_flush(pdrv);
+	dc_invalidate(pdrv);
+#endif
+
 	switch (pdrv) {
 #ifdef DRV_CFC
 	case DRV_CFC :
@@ -63,6 +160,10 @@ DSTATUS disk_initialize (
 #ifdef DRV_MMC
 	case DRV_MMC :
 		return mmc_disk_initialize();
+#endif
+#ifdef DRV_RAM
+	case DRV_RAM :
+		return ram_disk_initialize();
 #endif
 	}
 	return STA_NOINIT;
@@ -71,54 +172,418 @@ DSTATUS disk_initialize (
 
 
 /*-----------------------------------------------------------------------*/
-/* Read Sector(s)                                                        */
+/* Read Sector(s) from the drive                                         */
 /*-----------------------------------------------------------------------*/
 
-DRESULT disk_read (
+static DRESULT drive_read (
 	BYTE pdrv,		/* Physical drive nmuber to identify the drive */
 	BYTE *buff,		/* Data buffer to store read data */
 	DWORD sector,	/* Sector address in LBA */
 	UINT count		/* Number of sectors to read */
 )
 {
+	DRESULT res = RES_PARERR;
+	uint32_t start = system_get_time();
+
 	switch (pdrv) {
 #ifdef DRV_CFC
 	case DRV_CFC :
-		return cf_disk_read(buff, sector, count);
+		res = cf_disk_read(buff, sector, count);
+		break;
 #endif
 #ifdef DRV_MMC
 	case DRV_MMC :
-		return mmc_disk_read(buff, sector, count);
+		res = mmc_disk_read(buff, sector, count);
+		break;
+#endif
+#ifdef DRV_RAM
+	case DRV_RAM :
+		res = ram_disk_read(buff, sector, count);
+		break;
 #endif
 	}
-	return RES_PARERR;
+	disk_stats_add(count, res, start, 0);
+	return res;
 }
 
 
 
 /*-----------------------------------------------------------------------*/
-/* Write Sector(s)                                                       */
+/* Write Sector(s) to the drive                                          */
 /*-----------------------------------------------------------------------*/
 
 #if _USE_WRITE
-DRESULT disk_write (
+static DRESULT drive_write (
 	BYTE pdrv,			/* Physical drive nmuber to identify the drive */
 	const BYTE *buff,	/* Data to be written */
 	DWORD sector,		/* Sector address in LBA */
 	UINT count			/* Number of sectors to write */
 )
 {
+	DRESULT res = RES_PARERR;
+	uint32_t start = system_get_time();
+
 	switch (pdrv) {
 #ifdef DRV_CFC
 	case DRV_CFC :
-		return cf_disk_write(buff, sector, count);
+		res = cf_disk_write(buff, sector, count);
+		break;
 #endif
 #ifdef DRV_MMC
 	case DRV_MMC :
-		return mmc_disk_write(buff, sector, count);
+		res = mmc_disk_write(buff, sector, count);
+		break;
+#endif
+#ifdef DRV_RAM
+	case DRV_RAM :
+		res = ram_disk_write(buff, sector, count);
+		break;
 #endif
 	}
-	return RES_PARERR;
+	disk_stats_add(count, res, start, 1);
+	return res;
+}
+#endif
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Sector Cache                                                          */
+/*-----------------------------------------------------------------------*/
+/* DISK_CACHE_SECTORS sectors shared by all drives, least recently used  */
+/* sectors are replaced. FatFs reads FAT and directory sectors one at a  */
+/* time, so single sector reads and writes go through the cache and      */
+/* multiple sector file transfers go straight to the drive.              */
+/* A second miss on the next sector reads DISK_READ_AHEAD sectors with   */
+/* one multiple sector read (CMD18). Writes stay in the cache until they */
+/* are replaced or CTRL_SYNC, which FatFs issues from f_sync and f_close. */
+
+#if DISK_CACHE_SECTORS > 0 && _USE_WRITE
+
+#define DC_VALID	0x01	/* Entry holds a sector */
+#define DC_DIRTY	0x02	/* Entry is newer than the drive */
+
+/// @brief Sector cache entry
+typedef struct {
+	DWORD	sector;		/* Sector address in LBA */
+	DWORD	used;		/* Last use, larger is more recent */
+	BYTE	pdrv;		/* Physical drive */
+	BYTE	flags;		/* DC_VALID, DC_DIRTY */
+} DCENTRY;
+
+static DCENTRY dc_entry[DISK_CACHE_SECTORS];
+static BYTE dc_data[DISK_CACHE_SECTORS][_MAX_SS];
+static DWORD dc_clock;			/* Use counter for LRU */
+static DWORD dc_next = 0xFFFFFFFF;	/* Sector after the last miss */
+static BYTE dc_next_drv;
+
+
+/// @brief Find a cached sector
+/// @param[in] pdrv: physical drive
+/// @param[in] sector: sector address
+/// @return entry index or -1
+static int dc_find (BYTE pdrv, DWORD sector)
+{
+	int i;
+
+	for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+		if ((dc_entry[i].flags & DC_VALID) && dc_entry[i].sector == sector && dc_entry[i].pdrv == pdrv)
+			return i;
+	}
+	return -1;
+}
+
+
+/// @brief Write a dirty entry to the drive
+/// @param[in] i: entry index
+/// @return result
+static DRESULT dc_clean (int i)
+{
+	DRESULT res;
+
+	if (!(dc_entry[i].flags & DC_DIRTY))
+		return RES_OK;
+	res = drive_write(dc_entry[i].pdrv, dc_data[i], dc_entry[i].sector, 1);
+	if (res == RES_OK) {
+		dc_entry[i].flags &= ~DC_DIRTY;
+		disk_stats.cache_writebacks++;
+	}
+	return res;
+}
+
+
+/// @brief Free count consecutive entries, least recently used first
+/// Dirty entries are written back
+/// @param[in] count: entries wanted, 1 .. DISK_CACHE_SECTORS
+/// @return first entry index or -1 on a write error
+static int dc_alloc (UINT count)
+{
+	int i, k, best = 0;
+	DWORD age, best_age = 0xFFFFFFFF;
+
+	/* The run whose newest entry is oldest, empty entries are oldest */
+	for (i = 0; i + count <= DISK_CACHE_SECTORS; i++) {
+		age = 0;
+		for (k = i; k < i + count; k++) {
+			if ((dc_entry[k].flags & DC_VALID) && dc_entry[k].used > age)
+				age = dc_entry[k].used;
+		}
+		if (age < best_age) {
+			best_age = age;
+			best = i;
+			if (!age) break;
+		}
+	}
+	for (k = best; k < best + count; k++) {
+		if (dc_clean(k) != RES_OK)
+			return -1;
+		dc_entry[k].flags = 0;
+	}
+	return best;
+}
+
+
+/// @brief Write back the dirty sectors of a drive, lowest sector first
+/// @param[in] pdrv: physical drive
+/// @return result
+static DRESULT dc_flush (BYTE pdrv)
+{
+	int i, low;
+	DRESULT res;
+
+	for (;;) {
+		low = -1;
+		for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+			if ((dc_entry[i].flags & DC_DIRTY) && dc_entry[i].pdrv == pdrv
+				&& (low < 0 || dc_entry[i].sector < dc_entry[low].sector))
+				low = i;
+		}
+		if (low < 0)
+			return RES_OK;
+		res = dc_clean(low);
+		if (res != RES_OK)
+			return res;
+	}
+}
+
+
+/// @brief Forget the cached sectors of a drive, dirty sectors are lost
+/// @param[in] pdrv: physical drive
+/// @return void
+static void dc_invalidate (BYTE pdrv)
+{
+	int i;
+
+	for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+		if (dc_entry[i].pdrv == pdrv)
+			dc_entry[i].flags = 0;
+	}
+	dc_next = 0xFFFFFFFF;
+}
+
+
+/// @brief Read one sector through the cache
+/// @param[in] pdrv: physical drive
+/// @param[out] *buff: data buffer
+/// @param[in] sector: sector address
+/// @return result
+static DRESULT dc_read (BYTE pdrv, BYTE *buff, DWORD sector)
+{
+	int i, k;
+	UINT n;
+	DRESULT res;
+
+	i = dc_find(pdrv, sector);
+	if (i >= 0) {
+		disk_stats.cache_hits++;
+	} else {
+		disk_stats.cache_misses++;
+
+		/* Sequential misses read ahead, up to the next cached sector */
+		n = 1;
+		if (pdrv == dc_next_drv && sector == dc_next) {
+			while (n < DISK_READ_AHEAD && dc_find(pdrv, sector + n) < 0)
+				n++;
+		}
+		dc_next = sector + 1;
+		dc_next_drv = pdrv;
+
+		i = dc_alloc(n);
+		if (i < 0)
+			return RES_ERROR;
+		res = drive_read(pdrv, dc_data[i], sector, n);
+		if (res != RES_OK && n > 1) {	/* Past the end of the drive ? */
+			n = 1;
+			res = drive_read(pdrv, dc_data[i], sector, 1);
+		}
+		if (res != RES_OK)
+			return res;
+		for (k = 0; k < n; k++) {
+			dc_entry[i + k].sector = sector + k;
+			dc_entry[i + k].pdrv = pdrv;
+			dc_entry[i + k].flags = DC_VALID;
+			dc_entry[i + k].used = 0;	/* Oldest until used */
+		}
+		disk_stats.cache_readahead += n - 1;
+		if (n > 1)
+			dc_next = sector + n;
+	}
+	dc_entry[i].used = ++dc_clock;
+	memcpy(buff, dc_data[i], _MAX_SS);
+	return RES_OK;
+}
+
+
+/// @brief Write one sector into the cache
+/// @param[in] pdrv: physical drive
+/// @param[in] *buff: data
+/// @param[in] sector: sector address
+/// @return result
+static DRESULT dc_write (BYTE pdrv, const BYTE *buff, DWORD sector)
+{
+	int i;
+
+	i = dc_find(pdrv, sector);
+	if (i < 0) {
+		i = dc_alloc(1);
+		if (i < 0)
+			return RES_ERROR;
+		dc_entry[i].sector = sector;
+		dc_entry[i].pdrv = pdrv;
+	}
+	memcpy(dc_data[i], buff, _MAX_SS);
+	dc_entry[i].flags = DC_VALID | DC_DIRTY;
+	dc_entry[i].used = ++dc_clock;
+	return RES_OK;
+}
+
+
+/// @brief Copy cached sectors over a multiple sector read from the drive
+/// @param[in] pdrv: physical drive
+/// @param[in,out] *buff: data read from the drive
+/// @param[in] sector: first sector
+/// @param[in] count: number of sectors
+/// @return void
+static void dc_merge (BYTE pdrv, BYTE *buff, DWORD sector, UINT count)
+{
+	int i;
+
+	for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+		if ((dc_entry[i].flags & DC_DIRTY) && dc_entry[i].pdrv == pdrv
+			&& dc_entry[i].sector - sector < count)
+			memcpy(buff + (dc_entry[i].sector - sector) * _MAX_SS, dc_data[i], _MAX_SS);
+	}
+}
+
+
+/// @brief Update cached sectors after a multiple sector write to the drive
+/// @param[in] pdrv: physical drive
+/// @param[in] *buff: data written
+/// @param[in] sector: first sector
+/// @param[in] count: number of sectors
+/// @return void
+static void dc_update (BYTE pdrv, const BYTE *buff, DWORD sector, UINT count)
+{
+	int i;
+
+	for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+		if ((dc_entry[i].flags & DC_VALID) && dc_entry[i].pdrv == pdrv
+			&& dc_entry[i].sector - sector < count) {
+			memcpy(dc_data[i], buff + (dc_entry[i].sector - sector) * _MAX_SS, _MAX_SS);
+			dc_entry[i].flags = DC_VALID;
+		}
+	}
+}
+
+
+/// @brief Turn the sector cache on or off
+/// Dirty sectors are written back and the cache is emptied
+/// @param[in] on: 1 on, 0 off
+/// @return result of the write back
+MEMSPACE
+DRESULT disk_cache_enable (int on)
+{
+	int i;
+	DRESULT res = RES_OK;
+
+	for (i = 0; i < DISK_CACHE_SECTORS; i++) {
+		if (dc_clean(i) != RES_OK)
+			res = RES_ERROR;
+		dc_entry[i].flags = 0;
+	}
+	dc_next = 0xFFFFFFFF;
+	dc_enabled = on ? 1 : 0;
+	return res;
+}
+
+#else
+
+/// @brief The sector cache is not configured
+/// @param[in] on: ignored
+/// @return RES_OK
+MEMSPACE
+DRESULT disk_cache_enable (int on)
+{
+	return RES_OK;
+}
+
+#endif // DISK_CACHE_SECTORS
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Read Sector(s)                                                        */
+/*-----------------------------------------------------------------------*/
+
+DRESULT disk_read (
+	BYTE pdrv,		/* Physical drive nmuber to identify the drive */
+	BYTE *buff,		/* Data buffer to store read data */
+	DWORD sector,	/* Sector address in LBA */
+	UINT count		/* Number of sectors to read */
+)
+{
+#if DISK_CACHE_SECTORS > 0 && _USE_WRITE
+	DRESULT res;
+
+	if (dc_enabled) {
+		if (count == 1)
+			return dc_read(pdrv, buff, sector);
+		res = drive_read(pdrv, buff, sector, count);
+		if (res == RES_OK)
+			dc_merge(pdrv, buff, sector, count);
+		return res;
+	}
+#endif
+	return drive_read(pdrv, buff, sector, count);
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Write Sector(s)                                                       */
+/*-----------------------------------------------------------------------*/
+
+#if _USE_WRITE
+DRESULT disk_write (
+	BYTE pdrv,			/* Physical drive nmuber to identify the drive */
+	const BYTE *buff,	/* Data to be written */
+	DWORD sector,		/* Sector address in LBA */
+	UINT count			/* Number of sectors to write */
+)
+{
+#if DISK_CACHE_SECTORS > 0
+	DRESULT res;
+
+	if (dc_enabled) {
+		if (count == 1)
+			return dc_write(pdrv, buff, sector);
+		res = drive_write(pdrv, buff, sector, count);
+		if (res == RES_OK)
+			dc_update(pdrv, buff, sector, count);
+		return res;
+	}
+#endif
+	return drive_write(pdrv, buff, sector, count);
 }
 #endif
 
@@ -134,6 +599,18 @@ DRESULT disk_ioctl (
 	void *buff		/* Buffer to send/receive control data */
 )
 {
+	if (cmd == CTRL_SYNC)
+		disk_stats.syncs++;
+
+#if DISK_CACHE_SECTORS > 0 && _USE_WRITE
+	if (cmd == CTRL_SYNC || cmd == CTRL_POWER_OFF || cmd == CTRL_EJECT) {
+		if (dc_flush(pdrv) != RES_OK)
+			return RES_ERROR;
+		if (cmd != CTRL_SYNC)
+			dc_invalidate(pdrv);
+	}
+#endif
+
 	switch (pdrv) {
 #ifdef DRV_CFC
 	case DRV_CFC :
@@ -142,6 +619,10 @@ DRESULT disk_ioctl (
 #ifdef DRV_MMC
 	case DRV_MMC :
 		return mmc_disk_ioctl(cmd, buff);
+#endif
+#ifdef DRV_RAM
+	case DRV_RAM :
+		return ram_disk_ioctl(cmd, buff);
 #endif
 	}
 	return RES_PARERR;
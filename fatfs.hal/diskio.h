@@ -13,6 +13,16 @@ extern "C" {
 #define _USE_IOCTL	1	/* 1: Enable disk_ioctl fucntion */
 #define _USE_ISDIO	1	/* 1: Enable iSDIO controls via disk_ioctl */
 
+#ifndef DISK_CACHE_SECTORS
+#define DISK_CACHE_SECTORS	8	/* Sector cache size, 0: no cache */
+#endif
+#ifndef DISK_READ_AHEAD
+#define DISK_READ_AHEAD		4	/* Sectors read on a sequential cache miss */
+#endif
+#if DISK_READ_AHEAD < 1 || (DISK_CACHE_SECTORS > 0 && DISK_READ_AHEAD > DISK_CACHE_SECTORS)
+#error DISK_READ_AHEAD must be 1 .. DISK_CACHE_SECTORS
+#endif
+
 #include "integer.h"
 
 
@@ -37,6 +47,31 @@ typedef struct {
 } SDIO_CTRL;
 
 
+/* Disk statistics, see disk_stats_print() */
+typedef struct {
+	DWORD	reads;			/* Successful disk_read calls */
+	DWORD	read_single;	/* One sector reads, MMC CMD17 */
+	DWORD	read_multi;		/* Multiple sector reads, MMC CMD18 */
+	DWORD	read_sectors;	/* Sectors read */
+	DWORD	writes;			/* Successful disk_write calls */
+	DWORD	write_single;	/* One sector writes, MMC CMD24 */
+	DWORD	write_multi;	/* Multiple sector writes, MMC CMD25 */
+	DWORD	write_sectors;	/* Sectors written */
+	DWORD	syncs;			/* CTRL_SYNC requests */
+	DWORD	errors;			/* Failed reads and writes */
+	DWORD	read_us;		/* Total read time in microseconds */
+	DWORD	read_max_us;	/* Longest read */
+	DWORD	write_us;		/* Total write time in microseconds */
+	DWORD	write_max_us;	/* Longest write */
+	DWORD	cache_hits;		/* Sectors read from the cache */
+	DWORD	cache_misses;	/* Sectors read from the drive */
+	DWORD	cache_readahead;	/* Extra sectors read on misses */
+	DWORD	cache_writebacks;	/* Dirty sectors written to the drive */
+} DSTATS;
+
+extern DSTATS disk_stats;
+
+
 /*---------------------------------------*/
 /* Prototypes for disk control functions */
 
@@ -47,6 +82,9 @@ DRESULT disk_read (BYTE pdrv, BYTE* buff, DWORD sector, UINT count);
 DRESULT disk_write (BYTE pdrv, const BYTE* buff, DWORD sector, UINT count);
 DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
 void disk_timerproc (void);
+void disk_stats_clear (void);
+void disk_stats_print (void);
+DRESULT disk_cache_enable (int on);
 
 
 /* Disk Status Bits (DSTATUS) */
@@ -0,0 +1,195 @@
+/**
+ @file fatfs.hal/ramdisk.c
+
+ @brief RAM disk lower level interface to FatFS
+   - Serves 512 byte sectors from a memory array.
+   - With RAMDISK_SECTORS set the array is allocated from the heap by the
+     first ram_disk_initialize(), the disk is missing if that fails.
+   - Host builds attach a disk image file mapped into memory instead.
+   - Lets the file system run without an SD card for tests and benchmarks.
+
+ @par Copyright &copy; 2018 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "user_config.h"
+#include "fatfs.sup/fatfs.h"
+#include "ramdisk.h"
+
+#ifdef RAMDISK
+
+static BYTE *ram_disk = NULL;
+static DWORD ram_disk_sectors = 0;
+#if RAMDISK_SECTORS > 0
+/// @brief Default disk memory is allocated, not static, see ram_disk_initialize()
+static uint8_t ram_disk_attached = 0;
+#endif
+
+static DSTATUS RamStat = STA_NOINIT;	/* <Disk status */
+
+
+/// @brief Use a memory array or a mapped disk image as the disk
+/// The previous contents of the disk are forgotten
+/// @param[in] *mem: disk memory, sectors * RAMDISK_SS bytes
+/// @param[in] sectors: disk size in sectors
+/// @return void
+MEMSPACE
+void ram_disk_attach(BYTE *mem, DWORD sectors)
+{
+	ram_disk = mem;
+	ram_disk_sectors = mem ? sectors : 0;
+	RamStat = STA_NOINIT;
+#if RAMDISK_SECTORS > 0
+	ram_disk_attached = 1;
+#endif
+}
+
+
+/*-----------------------------------------------------------------------*/
+/* Initialize Disk Drive                                                 */
+/*-----------------------------------------------------------------------*/
+
+/// @brief Initialize the RAM disk
+/// Allocates the RAMDISK_SECTORS default disk the first time
+/// @return disk status, STA_NODISK if no memory is attached
+MEMSPACE
+DSTATUS ram_disk_initialize (void)
+{
+#if RAMDISK_SECTORS > 0
+	if (!ram_disk && !ram_disk_attached)
+	{
+		ram_disk = safecalloc(RAMDISK_SECTORS, RAMDISK_SS);
+		ram_disk_sectors = ram_disk ? RAMDISK_SECTORS : 0;
+		// Do not retry on every call
+		ram_disk_attached = 1;
+#if FATFS_DEBUG > 0
+		if (!ram_disk)
+			printf("ram_disk_initialize: %d sectors do not fit in the heap\n", RAMDISK_SECTORS);
+#endif
+	}
+#endif
+	if (!ram_disk || !ram_disk_sectors)
+		RamStat = STA_NOINIT | STA_NODISK;
+	else
+		RamStat = 0;
+	return RamStat;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/* Get Disk Status                                                       */
+/*-----------------------------------------------------------------------*/
+
+/// @brief RAM disk status
+/// @return disk status
+MEMSPACE
+DSTATUS ram_disk_status (void)
+{
+	return RamStat;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/* Read Sector(s)                                                        */
+/*-----------------------------------------------------------------------*/
+
+/// @brief Read sectors
+/// @param[out] *buff: data buffer
+/// @param[in] sector: start sector in LBA
+/// @param[in] count: number of sectors
+/// @return result
+DRESULT ram_disk_read (
+	BYTE *buff,			/* Pointer to the data buffer to store read data */
+	DWORD sector,		/* Start sector number (LBA) */
+	UINT count			/* Sector count (1..128) */
+)
+{
+	if (!count) return RES_PARERR;
+	if (RamStat & STA_NOINIT) return RES_NOTRDY;
+	if (sector >= ram_disk_sectors || count > ram_disk_sectors - sector)
+		return RES_PARERR;
+
+	memcpy(buff, ram_disk + sector * RAMDISK_SS, count * RAMDISK_SS);
+	return RES_OK;
+}
+
+
+/*-----------------------------------------------------------------------*/
+/* Write Sector(s)                                                       */
+/*-----------------------------------------------------------------------*/
+
+/// @brief Write sectors
+/// @param[in] *buff: data to write
+/// @param[in] sector: start sector in LBA
+/// @param[in] count: number of sectors
+/// @return result
+#if _USE_WRITE
+DRESULT ram_disk_write (
+	const BYTE *buff,	/* Pointer to the data to be written */
+	DWORD sector,		/* Start sector number (LBA) */
+	UINT count			/* Sector count (1..128) */
+)
+{
+	if (!count) return RES_PARERR;
+	if (RamStat & STA_NOINIT) return RES_NOTRDY;
+	if (sector >= ram_disk_sectors || count > ram_disk_sectors - sector)
+		return RES_PARERR;
+
+	memcpy(ram_disk + sector * RAMDISK_SS, buff, count * RAMDISK_SS);
+	return RES_OK;
+}
+#endif
+
+
+/*-----------------------------------------------------------------------*/
+/* Miscellaneous Functions                                               */
+/*-----------------------------------------------------------------------*/
+
+/// @brief Disk control functions used by FatFs
+/// @param[in] cmd: control code
+/// @param[in,out] *buff: control data
+/// @return result
+#if _USE_IOCTL
+MEMSPACE
+DRESULT ram_disk_ioctl (
+	BYTE cmd,		/* Control code */
+	void *buff		/* Buffer to send/receive control data */
+)
+{
+	if (RamStat & STA_NOINIT) return RES_NOTRDY;
+
+	switch (cmd) {
+	case CTRL_SYNC :		/* Writes go straight to memory */
+		return RES_OK;
+
+	case GET_SECTOR_COUNT :	/* Get number of sectors on the disk (DWORD) */
+		*(DWORD*)buff = ram_disk_sectors;
+		return RES_OK;
+
+	case GET_SECTOR_SIZE :	/* Get sector size (WORD) */
+		*(WORD*)buff = RAMDISK_SS;
+		return RES_OK;
+
+	case GET_BLOCK_SIZE :	/* Get erase block size in unit of sector (DWORD) */
+		*(DWORD*)buff = 1;
+		return RES_OK;
+	}
+	return RES_PARERR;
+}
+#endif
+
+#endif // RAMDISK
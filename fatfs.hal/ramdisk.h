@@ -0,0 +1,46 @@
+/**
+ @file fatfs.hal/ramdisk.h
+
+ @brief RAM disk lower level interface to FatFS
+
+ @par Copyright &copy; 2018 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _RAMDISK_H_
+#define _RAMDISK_H_
+
+/// @brief RAM disk sector size
+#define RAMDISK_SS 512
+
+/// @brief Size of the built in RAM disk, 0 when memory is always attached
+/// Allocated from the heap by the first ram_disk_initialize()
+/// FatFs needs at least 128 sectors to format a FAT12 volume, more than the
+/// ESP8266 heap holds, so a formatted RAM disk is for host builds and tests
+#ifndef RAMDISK_SECTORS
+#define RAMDISK_SECTORS 0
+#endif
+
+/* ramdisk.c */
+MEMSPACE void ram_disk_attach ( BYTE *mem , DWORD sectors );
+MEMSPACE DSTATUS ram_disk_initialize ( void );
+MEMSPACE DSTATUS ram_disk_status ( void );
+DRESULT ram_disk_read ( BYTE *buff , DWORD sector , UINT count );
+DRESULT ram_disk_write ( const BYTE *buff , DWORD sector , UINT count );
+MEMSPACE DRESULT ram_disk_ioctl ( BYTE cmd , void *buff );
+
+#endif                                            // _RAMDISK_H_
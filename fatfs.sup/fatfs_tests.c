@@ -65,6 +65,8 @@ void fatfs_help( int full)
 #endif
         "fatfs mmc_test\n"
         "fatfs mmc_init\n"
+        "fatfs stats [clear]\n"
+        "fatfs cache on|off\n"
         "fatfs ls dir\n"
 
 #ifdef FATFS_UTILS_FULL
@@ -158,6 +160,21 @@ int fatfs_tests(int argc,char *argv[])
         return(1);
     }
 
+    if (MATCHARGS(ptr,"stats",(ind+0),argc))
+    {
+        disk_stats_print();
+        if(ind < argc && MATCH(argv[ind],"clear"))
+            disk_stats_clear();
+        return(1);
+    }
+
+    if (MATCHARGS(ptr,"cache",(ind+1),argc))
+    {
+        if(disk_cache_enable(MATCH(argv[ind],"on")) != RES_OK)
+            printf("cache write back failed\n");
+        return(1);
+    }
+
     if (MATCHARGS(ptr,"status", (ind + 1), argc))
     {
         fatfs_status(argv[ind]);
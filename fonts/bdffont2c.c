@@ -67,6 +67,8 @@ void usage(char *prog)
 	printf(" -f convert any font to fixed size bitmap - everything inside font bounding box\n");
 	printf(" -s Compact font to smallest bounding box\n");
 	printf("    Notes: modifies or creates font specs\n");
+	printf(" -r Run length encode fonts that get smaller\n");
+	printf("    Notes: creates font specs\n");
 	printf(" bdf files...: One of more BDF format font files\n");
 
 }
@@ -85,6 +87,8 @@ void usage(char *prog)
  -f convert any font to fixed size bitmap - everything inside font bounding box
  -s Compact font to smallest bounding box
     Notes: modifies or creates font specs
+ -r Run length encode fonts that get smaller
+    Notes: creates font specs
  bdf files...: One of more BDF format font files
 */
 
@@ -98,6 +102,10 @@ int main(int argc, char *const argv[])
 	int font_preview = 0;
 	int font_adjust_full = 0;
 	int font_adjust_small = 0;
+	// Run length encode fonts that get smaller
+	int font_rle = 0;
+	int rle;
+	_font rx;
 	// Glyph code of first font to process - we ignore fonts less then this
 	int lower_bound = 32;
 	// Glyph code of last font to process - we ignore fonts greater then this 
@@ -188,6 +196,12 @@ int main(int argc, char *const argv[])
 				font_adjust_small = 1;
 				continue;
 			}
+			if(*ptr == 'r')
+			{
+				++ptr;
+				font_rle = 1;
+				continue;
+			}
 		}
 		else
 		{
@@ -283,6 +297,16 @@ int main(int argc, char *const argv[])
 		BDFnames[bdfind].structname = stralloc(fx.info->STRUCT_NAME);
 
 		ComputeGapSize(&fx);
+
+		rle = 0;
+		if(font_rle)
+		{
+			rle = FontEncodeRle(&fx, &rx);
+			fprintf(stderr,"%s: bits:%d bytes, rle:%d bytes%s\n",
+				fx.info->STRUCT_NAME, fx.Bytes, rx.Bytes, rle ? "" : ", using bits");
+			if(rle)
+				fontspecs_f = 1;
+		}
 		
 		FontHeaderInfo(FO, &fx, argv[0], cfonts);
 
@@ -299,8 +323,10 @@ int main(int argc, char *const argv[])
 			fprintf(FO,"#endif\n");
 		}
 
-		Convert_Font2c(FO, &fx);
+		Convert_Font2c(FO, rle ? &rx : &fx);
 		WriteFontBitsPreview ( FO, &fx, font_preview);
+		if(font_rle)
+			FreeFontCopy(&rx);
 		FreeFont(&fx);
 		++bdfind;
 	}
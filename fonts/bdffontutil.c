@@ -419,10 +419,11 @@ void Convert_Font2c(FILE *out, _font *font)
 		fprintf(out,"\tNULL, /* font->specs */\n");
 		fprintf(out,"#endif\n");
 		fprintf(out,"#ifdef FONTINFO\n");
-		fprintf(out,"\t%s_info\n", font->info->STRUCT_NAME);
+		fprintf(out,"\t%s_info,\n", font->info->STRUCT_NAME);
 		fprintf(out,"#else\n");
-		fprintf(out,"\tNULL /* font->info */\n");
+		fprintf(out,"\tNULL, /* font->info */\n");
 		fprintf(out,"#endif\n");
+		emit_number(out,"Run Length Encoded Bitmap", font->Rle);
 	}
 
 	fprintf(out,"};\n\n");
@@ -534,6 +535,7 @@ void InitFonts(_font *font)
 	font->Decent = 0;
 	font->gap = 0;
 	font->Bytes = 0;
+	font->Rle = 0;
 	font->bitmap = NULL;
 	font->specs = db_calloc(sizeof(_fontspecs) * MAXGLYPHS);
 	for(i=0;i<MAXGLYPHS;++i)
@@ -632,7 +634,10 @@ void WriteFontBits(FILE * out, _font *font)
 {
 	int i;
 	int c;
-	fprintf(out, "/* Font BIT DATA , MSB Left to Right (padded to byte alignment), Top Down */\n");
+	if(font->Rle)
+		fprintf(out, "/* Font RLE DATA , background run high nibble, foreground run low nibble, Left to Right, Top Down, 0x00 ends */\n");
+	else
+		fprintf(out, "/* Font BIT DATA , MSB Left to Right (padded to byte alignment), Top Down */\n");
 
 	if(font->info)
 	{
@@ -742,6 +747,8 @@ void WriteCharacterBits(FILE * out, _font *font, int num)
         yoff = font->specs[num].Y;
         bytes = ((w * h) + 7)/8;
         ptr += offset;
+		if(font->Rle)
+			bytes = RleGlyphBytes(ptr, w * h);
     }
     else
     {
@@ -1513,6 +1520,164 @@ void FontAdjustSmall(_font *font)
 }
 // ======================================================
 
+/**
+ @brief Run length encode one glyph bit array
+ @see FONT_RLE_END in font.h for the format
+ @param[in] *bits: glyph bit array
+ @param[in] pixels: glyph width * height
+ @param[out] *out: encoded glyph, at most pixels + 1 bytes
+ @return: encoded size in bytes
+*/
+int RleEncodeGlyph(unsigned char *bits, int pixels, unsigned char *out)
+{
+	int i = 0;
+	int bytes = 0;
+	int bg,fg;
+
+	while(i < pixels)
+	{
+		for(bg = 0; i < pixels && !btestv(bits, i); ++i)
+			++bg;
+		if(i >= pixels)
+		{
+			// Trailing background
+			out[bytes++] = FONT_RLE_END;
+			break;
+		}
+		for(fg = 0; i < pixels && btestv(bits, i); ++i)
+			++fg;
+		while(bg > 15)
+		{
+			out[bytes++] = 0xf0;
+			bg -= 15;
+		}
+		// fg stays 1 .. 15 so no pair is FONT_RLE_END
+		while(fg > 15)
+		{
+			out[bytes++] = (bg << 4) | 15;
+			bg = 0;
+			fg -= 15;
+		}
+		out[bytes++] = (bg << 4) | fg;
+	}
+	return(bytes);
+}
+
+/**
+ @brief Size of one run length encoded glyph
+ @param[in] *ptr: encoded glyph
+ @param[in] pixels: glyph width * height
+ @return: encoded size in bytes
+*/
+int RleGlyphBytes(unsigned char *ptr, int pixels)
+{
+	int bytes = 0;
+	int c;
+
+	while(pixels > 0)
+	{
+		c = ptr[bytes++];
+		if(c == FONT_RLE_END)
+			break;
+		pixels -= (c >> 4) + (c & 15);
+	}
+	return(bytes);
+}
+
+/**
+ @brief Make a run length encoded copy of a font
+  Long runs of background and foreground take fewer bytes then bits
+  so large fonts get smaller, small fonts usually get larger
+ @param[in] *font: Font pointer, bit arrays
+ @param[out] *rle: run length encoded copy, sharing font->info
+ @return: 1 if the copy is smaller then the font, 0 if not
+*/
+int FontEncodeRle(_font *font, _font *rle)
+{
+	int i;
+	int pixels;
+	int size = 0;
+	int offset = 0;
+
+	*rle = *font;
+	rle->Rle = 1;
+	rle->specs = db_calloc(sizeof(_fontspecs) * MAXGLYPHS);
+	memcpy(rle->specs, font->specs, sizeof(_fontspecs) * MAXGLYPHS);
+
+	for(i=0;i<font->Glyphs;++i)
+		size += font->specs[i].Width * font->specs[i].Height + 1;
+	rle->bitmap = db_calloc(size);
+
+	for(i=0;i<font->Glyphs;++i)
+	{
+		pixels = font->specs[i].Width * font->specs[i].Height;
+		rle->specs[i].Offset = offset;
+		offset += RleEncodeGlyph(font->bitmap + font->specs[i].Offset, pixels, rle->bitmap + offset);
+	}
+	rle->Bytes = offset;
+	return(rle->Bytes < font->Bytes);
+}
+
+/**
+ @brief Make a bit array copy of a run length encoded font
+ @param[in] *rle: run length encoded font
+ @param[out] *font: bit array copy, sharing rle->info
+ @return: void
+*/
+void FontDecodeRle(_font *rle, _font *font)
+{
+	int i;
+	int x;
+	int c,n;
+	int pixels;
+	int offset = 0;
+	unsigned char *ptr;
+
+	*font = *rle;
+	font->Rle = 0;
+	font->specs = db_calloc(sizeof(_fontspecs) * MAXGLYPHS);
+	memcpy(font->specs, rle->specs, sizeof(_fontspecs) * rle->Glyphs);
+
+	for(i=0;i<rle->Glyphs;++i)
+		offset += (rle->specs[i].Width * rle->specs[i].Height + 7) / 8;
+	font->bitmap = db_calloc(offset);
+
+	offset = 0;
+	for(i=0;i<rle->Glyphs;++i)
+	{
+		pixels = rle->specs[i].Width * rle->specs[i].Height;
+		ptr = rle->bitmap + rle->specs[i].Offset;
+		font->specs[i].Offset = offset;
+		x = 0;
+		while(x < pixels)
+		{
+			c = *ptr++;
+			if(c == FONT_RLE_END)
+				break;
+			x += c >> 4;
+			for(n = c & 15; n > 0 && x < pixels; --n)
+				bsetv(font->bitmap + offset, x++);
+		}
+		offset += (pixels + 7) / 8;
+	}
+	font->Bytes = offset;
+}
+
+/**
+ @brief Free the bitmap and specs of a font copy
+  The copy shares font->info with the original
+ @param[in] *font: Font pointer
+ @return: void
+*/
+void FreeFontCopy(_font *font)
+{
+	db_free(font->bitmap);
+	db_free(font->specs);
+	font->bitmap = NULL;
+	font->specs = NULL;
+}
+// ======================================================
+
 /**
  @brief Find a good gap size (inter-character spacing) for any font
   Currently we searching for the smallest width feature in a font set and use it as the gap
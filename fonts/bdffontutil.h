@@ -69,6 +69,11 @@ int ReadBdf ( char *name , _font *font , int lower , int upper );
 void AdjustFontTable ( _font *font );
 void FontAdjustFull ( _font *font );
 void FontAdjustSmall ( _font *font );
+int RleEncodeGlyph ( unsigned char *bits , int pixels , unsigned char *out );
+int RleGlyphBytes ( unsigned char *ptr , int pixels );
+int FontEncodeRle ( _font *font , _font *rle );
+void FontDecodeRle ( _font *rle , _font *font );
+void FreeFontCopy ( _font *font );
 void ComputeGapSize ( _font *font );
 void bsetv ( unsigned char *ptr , int addr );
 void bclrv ( unsigned char *ptr , int addr );
@@ -64,6 +64,7 @@ int main(int argc, char *argv[])
 	int ccode = 0;
 
 	_font *p;
+	_font bitfont;
 
 	for(numfonts=0;allfonts[numfonts] != NULL;++numfonts)
 		;
@@ -163,7 +164,15 @@ int main(int argc, char *argv[])
 		WriteFontTable ( stdout, p);
 
     if(preview)
+	{
+		// The previews need bit arrays
+		if(p->Rle)
+		{
+			FontDecodeRle(p, &bitfont);
+			p = &bitfont;
+		}
 		WriteFontBitsPreview(stdout, p,preview);
+	}
 
 	return(0);
 }
@@ -61,6 +61,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
         - truncate
         - write
         - fclose
+        - fflush
+        - setvbuf
 
    - POSIX file information functions
         - dump_stat - NOT POSIX
@@ -97,6 +99,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
         - fdevopen  - NOT POSIX
 
    - FatFS to POSIX bridge functions - NOT POSIX
+        - fatfs_flush
+        - fatfs_fill
         - fatfs_getc
         - fatfs_putc
         - fatfs_to_errno
@@ -138,6 +142,10 @@ int errno;
 /// - __iob[2] = stderr.
 FILE *__iob[MAX_FILES];
 
+// FatFs stream buffer functions
+static int fatfs_flush ( FILE *stream , FIL *fh );
+static int fatfs_fill ( FILE *stream , FIL *fh );
+
 /// @brief POSIX error messages for each errno value.
 ///
 /// - man page errno (3)
@@ -597,6 +605,11 @@ long ftell(FILE *stream)
         return(-1);
     }
 
+    // Account for data held in the stream buffer
+    if(stream->bmode == __SRD)
+        return( fh->fptr - (stream->cnt - stream->pos) );
+    if(stream->bmode == __SWR)
+        return( fh->fptr + stream->pos );
     return( fh->fptr );
 }
 
@@ -634,7 +647,10 @@ off_t lseek(int fileno, off_t position, int whence)
     
 
     stream = fileno_to_stream(fileno);
-    stream->flags |= __SUNGET;
+    // Write or drop buffered data so fh->fptr is the stream position
+    if(fatfs_flush(stream, fh) < 0)
+        return(-1);
+    stream->flags &= ~(__SUNGET | __SEOF);
 
     if(whence == SEEK_END)
         position += f_size(fh);
@@ -687,6 +703,7 @@ int close(int fileno)
     FILE *stream;
     FIL *fh;
     int res;
+    int ret;
 
     errno = 0;
 
@@ -703,6 +720,7 @@ int close(int fileno)
     {
         return(-1);
     }
+    ret = fatfs_flush(stream, fh);
     res = f_close(fh);
     free_file_descriptor(fileno);
     if (res != FR_OK)
@@ -710,7 +728,7 @@ int close(int fileno)
         errno = fatfs_to_errno(res);
         return(-1);
     }
-    return(0);
+    return(ret);
 }
 
 /// @brief Convert POSIX stream pointer to POSIX fileno (index of __iob[])
@@ -838,6 +856,8 @@ int ftruncate(int fd, off_t length)
     {
         return(-1);
     }
+    if(fatfs_flush(fileno_to_stream(fd), fh) < 0)
+        return(-1);
     rc = f_lseek(fh, length);
     if (rc != FR_OK)
     {
@@ -989,6 +1009,10 @@ int open(const char *pathname, int flags)
         stream->flags = _FDEV_SETUP_WRITE;
     }
 
+    // Stream buffer, without one every character is a FatFs call
+    // Run unbuffered if there is no memory for it
+    (void) setvbuf(stream, NULL, _IOFBF, POSIX_BUFSIZE);
+
     return(fileno);
 }
 
@@ -1050,6 +1074,52 @@ ssize_t read(int fd, const void *buf, size_t count)
         return(-1);
     }
 
+    if(stream->buf != NULL)
+    {
+        char *ptr = (char *) buf;
+        size_t len = 0;
+        int n;
+
+        // Start with read data left in the stream buffer
+        if(stream->bmode == __SRD)
+        {
+            n = stream->cnt - stream->pos;
+            if((size_t) n > count)
+                n = count;
+            memcpy(ptr, stream->buf + stream->pos, n);
+            stream->pos += n;
+            ptr += n;
+            len += n;
+            count -= n;
+        }
+        else if(fatfs_flush(stream, fh) < 0)
+            return(-1);
+
+        if(count == 0)
+            return((ssize_t) len);
+
+        // Large reads go directly to the caller
+        if(count >= (size_t) stream->size)
+        {
+            res = f_read(fh, ptr, count, &size);
+            if(res != FR_OK)
+            {
+                errno = fatfs_to_errno(res);
+                return(len ? (ssize_t) len : -1);
+            }
+            return((ssize_t) (len + size));
+        }
+
+        n = fatfs_fill(stream, fh);
+        if(n < 0)
+            return(len ? (ssize_t) len : -1);
+        if((size_t) n > count)
+            n = count;
+        memcpy(ptr, stream->buf, n);
+        stream->pos = n;
+        return((ssize_t) (len + n));
+    }
+
     res = f_read(fh, (void *) buf, bytes, &size);
     if(res != FR_OK)
     {
@@ -1106,10 +1176,6 @@ int syncfs(int fd)
         errno = EBADF;
         return(-1);
     }
-    stream = fileno_to_stream(fd);
-    // reset unget on sync
-    stream->flags |= __SUNGET;
-
     // fileno_to_fatfs checks for fd out of bounds
     fh = fileno_to_fatfs(fd);
     if(fh == NULL)
@@ -1118,6 +1184,13 @@ int syncfs(int fd)
         return(-1);
     }
 
+    stream = fileno_to_stream(fd);
+    // reset unget on sync
+    stream->flags &= ~__SUNGET;
+
+    if(fatfs_flush(stream, fh) < 0)
+        return(-1);
+
     res  = f_sync ( fh );
     if (res != FR_OK)
     {
@@ -1217,6 +1290,24 @@ ssize_t write(int fd, const void *buf, size_t count)
         return(-1);
     }
 
+    if(stream->buf != NULL)
+    {
+        // Make room, read data in the buffer is dropped
+        if(stream->bmode != __SWR || stream->pos + count > (size_t) stream->size)
+        {
+            if(fatfs_flush(stream, fh) < 0)
+                return(-1);
+        }
+        // Large writes go directly to the file
+        if(count < (size_t) stream->size)
+        {
+            memcpy(stream->buf + stream->pos, buf, count);
+            stream->pos += count;
+            stream->bmode = __SWR;
+            return((ssize_t) count);
+        }
+    }
+
     res = f_write(fh, buf, bytes, &size);
     if(res != FR_OK)
     {
@@ -1245,6 +1336,122 @@ int fclose(FILE *stream)
     return( close(fn) );
 }
 
+/// @brief POSIX flush a file stream.
+///
+/// - man page fflush (3).
+/// - Writes data waiting in the stream buffer.
+/// - Read data not yet used is dropped and the file position moved back to match ftell().
+/// - TTY streams are not buffered.
+///
+/// @param[in] stream: POSIX stream pointer, NULL flushes all streams.
+///
+/// @return  0 on sucess.
+/// @return  EOF on error with errno set.
+MEMSPACE
+int fflush(FILE *stream)
+{
+    FIL *fh;
+    int fn;
+    int ret = 0;
+
+    if(stream == NULL)
+    {
+        for(fn=0;fn<MAX_FILES;++fn)
+        {
+            if(isatty(fn) || __iob[fn] == NULL)
+                continue;
+            if(fflush(__iob[fn]) == EOF)
+                ret = EOF;
+        }
+        return(ret);
+    }
+
+    fn = fileno(stream);
+    if(fn < 0)
+        return(EOF);
+    if(isatty(fn))
+        return(0);
+
+    // fileno_to_fatfs checks for fn out of bounds
+    fh = fileno_to_fatfs(fn);
+    if(fh == NULL)
+        return(EOF);
+
+    if(fatfs_flush(stream, fh) < 0)
+        return(EOF);
+    return(0);
+}
+
+/// @brief POSIX set file stream buffering.
+///
+/// - man page setvbuf (3).
+/// - open() allocates a POSIX_BUFSIZE buffer for every file.
+/// - Only FatFs streams are buffered, _IOLBF is the same as _IOFBF.
+///
+/// @param[in] stream: POSIX stream pointer.
+/// @param[in] buf: buffer to use, NULL allocates one.
+/// @param[in] mode: _IOFBF, _IOLBF or _IONBF.
+/// @param[in] size: buffer size, 0 uses POSIX_BUFSIZE.
+///
+/// @return  0 on sucess.
+/// @return  -1 on error with errno set, the stream is then unbuffered.
+MEMSPACE
+int setvbuf(FILE *stream, char *buf, int mode, size_t size)
+{
+    FIL *fh;
+    int fn;
+
+    errno = 0;
+
+    fn = fileno(stream);
+    if(fn < 0 || isatty(fn))
+    {
+        errno = EBADF;
+        return(-1);
+    }
+
+    // fileno_to_fatfs checks for fn out of bounds
+    fh = fileno_to_fatfs(fn);
+    if(fh == NULL)
+        return(-1);
+
+    if(fatfs_flush(stream, fh) < 0)
+        return(-1);
+
+    if(stream->buf != NULL && stream->flags & __SMALLOC)
+        safefree(stream->buf);
+    stream->buf = NULL;
+    stream->size = 0;
+    stream->flags &= ~__SMALLOC;
+
+    if(mode == _IONBF)
+        return(0);
+    if(mode != _IOFBF && mode != _IOLBF)
+    {
+        errno = EINVAL;
+        return(-1);
+    }
+
+    if(size == 0)
+        size = POSIX_BUFSIZE;
+    if(size == 0)
+        return(0);
+
+    if(buf == NULL)
+    {
+        buf = safecalloc(size, 1);
+        if(buf == NULL)
+        {
+            errno = ENOMEM;
+            return(-1);
+        }
+        stream->flags |= __SMALLOC;
+    }
+    stream->buf = buf;
+    stream->size = size;
+    return(0);
+}
+
 // =============================================
 // =============================================
 ///  - POSIX file information functions
@@ -1916,6 +2123,87 @@ fdevopen(int (*put)(char, FILE *), int (*get)(FILE *))
 // =============================================
 // =============================================
 
+/// @brief Private FatFs function to empty a stream buffer
+/// NOT POSIX
+///
+/// - Writes data waiting in the buffer.
+/// - Moves the FatFs file pointer back over read data not yet used.
+/// - Afterwards fh->fptr is the stream position, see ftell().
+///
+/// @param[in] stream: POSIX stream pointer.
+/// @param[in] fh: FatFs file pointer.
+///
+/// @return 0 on sucess.
+/// @return -1 on error with errno set, buffered write data is lost.
+MEMSPACE
+static int fatfs_flush(FILE *stream, FIL *fh)
+{
+    UINT size;
+    int res = FR_OK;
+    int pos = stream->pos;
+    int cnt = stream->cnt;
+    uint8_t bmode = stream->bmode;
+
+    stream->pos = 0;
+    stream->cnt = 0;
+    stream->bmode = 0;
+
+    if(bmode == __SWR && pos)
+    {
+        res = f_write(fh, stream->buf, pos, &size);
+        if(res == FR_OK && size != (UINT) pos)
+        {
+            errno = ENOSPC;
+            stream->flags |= __SERR;
+            return(-1);
+        }
+    }
+    else if(bmode == __SRD && pos < cnt)
+    {
+        res = f_lseek(fh, f_tell(fh) - (cnt - pos));
+    }
+
+    if(res != FR_OK)
+    {
+        errno = fatfs_to_errno(res);
+        stream->flags |= __SERR;
+        return(-1);
+    }
+    return(0);
+}
+
+/// @brief Private FatFs function to read the next block of a file into a stream buffer
+/// NOT POSIX
+///
+/// - Call only when read data in the buffer has all been used.
+///
+/// @param[in] stream: POSIX stream pointer.
+/// @param[in] fh: FatFs file pointer.
+///
+/// @return bytes read, 0 at EOF.
+/// @return -1 on error with errno set.
+MEMSPACE
+static int fatfs_fill(FILE *stream, FIL *fh)
+{
+    UINT size;
+    int res;
+
+    if(fatfs_flush(stream, fh) < 0)
+        return(-1);
+
+    res = f_read(fh, stream->buf, stream->size, &size);
+    if(res != FR_OK)
+    {
+        errno = fatfs_to_errno(res);
+        stream->flags |= __SERR;
+        return(-1);
+    }
+    stream->cnt = size;
+    if(size)
+        stream->bmode = __SRD;
+    return((int) size);
+}
+
 /// @brief Formt SD card
 /// @param[in] *name: device name
 /// @retrun void
@@ -1975,6 +2263,7 @@ int mkfs(char *name)
 ///
 /// - man page fgetc (3).
 /// - Notes: fgetc does all tests prior to caling us, including ungetc.
+/// - Reads from the stream buffer when open() allocated one, see setvbuf().
 ///
 /// @param[in] stream: POSIX stream pointer.
 ///
@@ -2004,6 +2293,30 @@ int  fatfs_getc(FILE *stream)
         return(EOF);
     }
 
+    // Buffered stream, same end of line handling as below without the FatFs calls
+    if(stream->buf != NULL)
+    {
+        if(stream->bmode != __SRD || stream->pos >= stream->cnt)
+        {
+            if(fatfs_fill(stream, fh) <= 0)
+            {
+                stream->flags |= __SEOF;
+                return(EOF);
+            }
+        }
+        c = stream->buf[stream->pos++];
+        if(c == '\r')
+        {
+            // PEEK forward 1 character, '\r' with EOF implies '\n'
+            if(stream->pos >= stream->cnt && fatfs_fill(stream, fh) <= 0)
+                return('\n');
+            if(stream->buf[stream->pos] == '\n')
+                stream->pos++;
+            c = '\n';
+        }
+        return(c & 0xff);
+    }
+
     res = f_read(fh, &c, 1, (UINT *) &size);
     if( res != FR_OK || size != 1)
     {
@@ -2064,6 +2377,7 @@ int  fatfs_getc(FILE *stream)
 ///
 /// - man page fputc (3).
 /// - Notes: fputc does all tests prior to caling us.
+/// - Writes to the stream buffer when open() allocated one, see fflush().
 ///
 /// @param[in] c: character.
 /// @param[in] stream: POSIX stream pointer.
@@ -2091,6 +2405,18 @@ int fatfs_putc(char c, FILE *stream)
         return(EOF);
     }
 
+    // Buffered stream, write when the buffer is full
+    if(stream->buf != NULL)
+    {
+        if(stream->bmode != __SWR && fatfs_flush(stream, fh) < 0)
+            return(EOF);
+        stream->buf[stream->pos++] = c;
+        stream->bmode = __SWR;
+        if(stream->pos >= stream->size && fatfs_flush(stream, fh) < 0)
+            return(EOF);
+        return(c & 0xff);
+    }
+
     res = f_write(fh, &c, 1, (UINT *)  &size);
     if( res != FR_OK || size != 1)
     {
@@ -2098,7 +2424,7 @@ int fatfs_putc(char c, FILE *stream)
         stream->flags |= __SEOF;
         return(EOF);
     }
-    return(c);
+    return(c & 0xff);
 }
 
 /// @brief Convert FafFs error result to POSIX errno.
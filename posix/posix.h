@@ -174,6 +174,9 @@ struct __file {
 #endif
     int size;       /* size of buffer */
     int len;        /* characters read or written so far */
+    int pos;        /* FatFs files: next byte in buf, or bytes waiting to be written */
+    int cnt;        /* FatFs files: bytes read into buf */
+    uint8_t bmode;  /* FatFs files: __SRD buf holds read data, __SWR buf holds write data */
     int (*put)(char, struct __file *);                  /* write one char to device */
     int (*get)(struct __file *);                        /* read one char from device */
 // FIXME add all low level functions here like _open, _close, ... like newlib does
@@ -260,6 +263,16 @@ typedef struct __file FILE;
 #define MAX_FILES 16
 extern FILE *__iob[MAX_FILES];
 
+///@brief FatFs stream buffer size allocated by open(), 0 for unbuffered streams
+#ifndef POSIX_BUFSIZE
+#define POSIX_BUFSIZE 512
+#endif
+
+///@brief setvbuf() modes
+#define _IOFBF 0    /*< Fully buffered */
+#define _IOLBF 1    /*< Line buffered, treated as fully buffered */
+#define _IONBF 2    /*< Unbuffered */
+
 ///@brief define stdin, stdout and stderr
 #undef stdin
 #undef stdout
@@ -340,6 +353,8 @@ MEMSPACE int syncfs ( int fd );
 MEMSPACE int truncate ( const char *path , off_t length );
 MEMSPACE ssize_t write ( int fd , const void *buf , size_t count );
 MEMSPACE int fclose ( FILE *stream );
+MEMSPACE int fflush ( FILE *stream );
+MEMSPACE int setvbuf ( FILE *stream , char *buf , int mode , size_t size );
 MEMSPACE void dump_stat ( struct stat *sp );
 
 #if 0
@@ -52,6 +52,7 @@ void posix_help(int full)
 #ifdef POSIX_TESTS
             "posix prefix is optional\n"
 #endif
+        "posix bench file\n"
         "posix chmod file NNN\n"
         "posix cat file [-p]\n"
         "posix cd dir\n"
@@ -102,6 +103,12 @@ int posix_tests(int argc,char *argv[])
         }
     }
 
+    if (MATCHARGS(ptr,"bench", (ind + 1), argc))
+    {
+        bench(argv[ind]);
+        return(1);
+    }
+
     if (MATCHARGS(ptr,"cat", (ind + 1), argc))
     {
         int i;
@@ -251,6 +258,51 @@ int posix_tests(int argc,char *argv[])
     return(0);
 }
 
+/// @brief  Line read throughput of a file without and with the stream buffer
+/// @param[in] name: file name.
+/// @return  lines read, -1 on error.
+MEMSPACE
+long bench(char *name)
+{
+    FILE *fp;
+    int pass;
+    long lines = 0;
+    long size;
+    uint32_t t;
+    char line[256];
+
+    for(pass=0;pass<2;++pass)
+    {
+        fp = fopen(name,"rb");
+        if (!fp)
+        {
+            printf("Can't open: %s\n", name);
+            return(-1);
+        }
+        // First pass reads the way fgets() did before stream buffers
+        if(pass == 0)
+            setvbuf(fp, NULL, _IONBF, 0);
+
+        lines = 0;
+        size = 0;
+        t = system_get_time();
+        while(fgets(line,sizeof(line)-2,fp) != NULL)
+        {
+            size += strlen(line);
+            ++lines;
+#ifdef ESP8266
+            optimistic_yield(1000);
+            wdt_reset();
+#endif
+        }
+        t = system_get_time() - t;
+        fclose(fp);
+        printf("%-10s %6ld lines %8ld bytes %10lu us\n",
+            pass ? "buffered" : "unbuffered", lines, size, (unsigned long) t);
+    }
+    return(lines);
+}
+
 /// @brief  Display the contents of a file
 /// @param[in] name: file name.
 /// @param[in] option: --p page display
@@ -30,6 +30,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 /* posix_tests.c */
 MEMSPACE void posix_help ( int full );
 MEMSPACE int posix_tests ( int argc , char *argv []);
+MEMSPACE long bench ( char *name );
 MEMSPACE long cat ( char *name , int dopage );
 MEMSPACE long copy ( char *from , char *to );
 MEMSPACE int hexdump ( char *name , int dopage );
@@ -55,7 +55,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 	#ifdef EARTH
 		#include "cordic/cordic.h"
 		#include "wire.h"
-		#include "earth_data.h"
+		#include "earth_mesh.h"
+		/// @brief Earth mesh on the SD card, used instead of the built in one when present
+		#define EARTH_MESH_FILE "/earth.msh"
 	#endif
 	
 	#ifdef XPT2046
@@ -100,6 +102,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 	window _wincube;
 	window *wincube = &_wincube;
 
+	#ifdef WIRECUBE
+		// Cube frame on the display
+		wire_anim_t cube_anim;
+	#endif
+
 	// Rotation angle
 	LOCAL double degree = 0.0;
 	// Rotation increment
@@ -429,16 +436,6 @@ void user_loop(void)
 		// RGB 
 	#endif
 
-	// reset cube to background
-	#ifdef WIRECUBE
-		V.x = degree;
-		V.y = degree;
-		V.z = degree;
-		// Cube points were defined with sides of 1.0 
-		// We want a scale of +/- w/2
-		wire_draw(wincube, cube_points, cube_edges, &V, wincube->w/2, wincube->h/2, dscale, wincube->bg);
-	#endif
-
 	degree += deg_inc;
 	dscale += dscale_inc;
 
@@ -460,7 +457,10 @@ void user_loop(void)
 		V.x = degree;
 		V.y = degree;
 		V.z = degree;
-		wire_draw(wincube, cube_points, cube_edges, &V, wincube->w/2, wincube->h/2, dscale, ILI9341_WHITE);
+		// Cube points were defined with sides of 1.0 
+		// We want a scale of +/- w/2
+		// Only the pixels that differ from the last frame are written
+		wire_anim_draw(&cube_anim, cube_points, cube_edges, NULL, &V, wincube->w/2, wincube->h/2, dscale, 0);
 	#endif
 
 	#ifdef CIRCLE
@@ -585,6 +585,71 @@ void loop()
 	}
 	#endif
 
+	/// @brief Report one display SPI benchmark result
+	/// @param[in] *name: benchmark name
+	/// @param[in] bytes: bytes sent
+	/// @param[in] us: elapsed time in microseconds
+	/// @param[in] hz: SPI clock
+	/// @return  void
+	MEMSPACE
+	void spi_bench_report(char *name, uint32_t bytes, uint32_t us, uint32_t hz)
+	{
+		double mbs = (double) bytes / (double) us;
+		double max = (double) hz / 8000000.0;
+		printf("%-16s %8lu bytes %8lu us %6.2f MB/s %5.1f%%\n",
+			name, (long) bytes, (long) us, mbs, 100.0 * mbs / max);
+	}
+
+	/// @brief Display SPI throughput versus the theoretical SPI clock
+	/// @param[in] *win: window structure
+	/// @return  void
+	MEMSPACE
+	void spi_bench(window *win)
+	{
+		extern uint32_t tft_clock;
+		uint32_t hz,start,bytes;
+		uint16_t buf[16*16];
+		uint8_t bits[16*16/8];
+		int i,x,y;
+
+		hz = tft_clock ? 80000000UL / (2 * tft_clock) : 80000000UL;
+		printf("SPI clock: %lu HZ, %6.2f MB/s maximum\n", (long) hz, (double) hz / 8000000.0);
+
+		for(i=0;i<16*16;++i)
+			buf[i] = i * 0x0421;
+		for(i=0;i<sizeof(bits);++i)
+			bits[i] = 0x5a;
+
+		start = system_get_time();
+		for(i=0;i<4;++i)
+			tft_fillWin(win, i * 0x1111);
+		spi_bench_report("tft_fillRectWH", 4UL * win->w * win->h * 2,
+			system_get_time() - start, hz);
+
+		bytes = 0;
+		start = system_get_time();
+		for(y=0;y + 16 <= win->h;y += 16)
+		{
+			for(x=0;x + 16 <= win->w;x += 16)
+			{
+				tft_writeRect(win, x, y, 16, 16, buf);
+				bytes += 16*16*2;
+			}
+		}
+		spi_bench_report("tft_writeRect", bytes, system_get_time() - start, hz);
+
+		bytes = 0;
+		start = system_get_time();
+		for(y=0;y + 16 <= win->h;y += 16)
+		{
+			for(x=0;x + 16 <= win->w;x += 16)
+			{
+				tft_bit_blit(win, bits, x, y, 16, 16);
+				bytes += 16*16*2;
+			}
+		}
+		spi_bench_report("tft_bit_blit", bytes, system_get_time() - start, hz);
+	}
 
 #endif	//DISPLAY
 
@@ -607,9 +672,11 @@ void user_help()
         "calibrate_test N\n"
 		"display_clock\n"
         "draw C[1]\n"
+        "vtext SCALE text\n"
         "mem\n"
 		"pixel\n"
         "rotate N\n"
+		"spibench\n"
 		"setdate YYYY MM DD HH:MM:SS\n"
 		"time\n"
 		"timetest\n"
@@ -738,7 +805,21 @@ int user_tests(int argc, char *argv[])
 			drawSVG(winmsg, 8, 24, c, 0.08, ILI9341_WHITE, 0);
 		return(1);
     }
+    if (MATCHARGS(ptr,"vtext", (ind + 2) ,argc))
+    {
+		float scale = atof(argv[ind++]);
+		tft_fillWin(winmsg, winmsg->bg);
+		vfont_drawString(winmsg, 0, 0, argv[ind++], scale);
+		vfont_cache_print();
+		return(1);
+    }
 #endif
+    if (MATCHARGS(ptr,"spibench", (ind + 0) ,argc))
+    {
+		spi_bench(master);
+		setup_windows(master->rotation,0);
+		return(1);
+    }
     if (MATCHARGS(ptr,"pixel", (ind + 0) ,argc))
     {
 		int c;
@@ -892,6 +973,8 @@ setup_windows(int rotation, int debug)
 	tft_set_font(winmsg,0);
 	tft_font_var(winmsg);
 	tft_set_textpos(winmsg, 0,0);
+	// Log messages scroll in hardware when the window is full width
+	(void) tft_term_init(winmsg);
 
 	// CUBE setup
 #ifdef WIRECUBE
@@ -900,6 +983,7 @@ setup_windows(int rotation, int debug)
 		tft_window_init(wincube, winmsg->w, wintop->h, master->w - winmsg->w, winmsg->h);
 		tft_setTextColor(wincube, ILI9341_WHITE,ILI9341_BLUE);
 		tft_fillWin(wincube, wincube->bg);
+		(void) wire_anim_init(&cube_anim, wincube, ILI9341_WHITE);
 #endif
 
 #ifdef DEBUG_STATS
@@ -957,7 +1041,24 @@ setup_windows(int rotation, int debug)
 		V.z = -90;
 		// draw earth
 	// Earth points were defined over with a scale of -0.5/+0.5 scale - so scale must be 1 or less
-		wire_draw(winearth, earth_data, NULL, &V, winearth->w/2, winearth->h/2, tscale_max, winearth->fg);
+		// Only the side facing the viewer
+		// A mesh file can replace the built in mesh without reflashing
+		wire_mesh_t earth;
+		FILE *fp = NULL;
+	#ifdef FATFS_SUPPORT
+		fp = fopen(EARTH_MESH_FILE, "rb");
+		if(fp != NULL && wire_mesh_open(&earth, wire_mesh_file_read, fp, WIRE_MESH_AUTO) < 0)
+		{
+			printf("Bad mesh: %s\n", EARTH_MESH_FILE);
+			fclose(fp);
+			fp = NULL;
+		}
+	#endif
+		if(fp == NULL)
+			wire_mesh_open(&earth, wire_mesh_flash_read, (void *) earth_mesh, WIRE_MESH_AUTO);
+		wire_draw_mesh(winearth, &earth, &V, winearth->w/2, winearth->h/2, tscale_max, winearth->fg, WIRE_CULL_HORIZON);
+		if(fp != NULL)
+			fclose(fp);
 #endif
 
 }
@@ -38,9 +38,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define MAX_MSG 1024 
 /// @brief max size of  CGI token
 #define CGI_TOKEN_SIZE 128
+/// @brief room kept in the write buffer for a CGI token result
+#define CGI_RESULT_SIZE 256
+/// @brief text file read size when replacing CGI tokens
+#define READBUFFSIZE 512
 /// @brief max size of read/write socket buffers
 /// Note: reducing this size below 1500 will slow down transfer a great deal
 #define BUFFER_SIZE 1000
+/// @brief size of write socket buffers, room for a whole static file chunk
+#define WBUF_SIZE (WEB_SEND_CHUNK > BUFFER_SIZE ? WEB_SEND_CHUNK : BUFFER_SIZE)
 
 int connections;
 
@@ -332,6 +338,7 @@ int write_flush(rwbuf_t *p)
 /**
   @brief Write a byte (buffered) using the rwbuf_t socket buffers for this connection
   If the buffers are full the socket is written using write_flush
+  With p->wlimit set bytes past it are dropped instead, without waiting
   @param[in] *p: rwbuf_t pointer for this socket buffer
   @param[in] 1 on success 0 on fail
 */
@@ -352,6 +359,10 @@ int write_byte(rwbuf_t *p, int c)
         return(0);
     }
 
+    // Bounded output, see write_text(), the buffer is full
+    if(p->wlimit && p->wind >= p->wlimit)
+        return(0);
+
     p->wbuf[p->wind++] = c;
  	if(p->wind >= p->wsize)
 	{
@@ -361,6 +372,240 @@ int write_byte(rwbuf_t *p, int c)
 	return(1);
 }
 
+/**
+  @brief Open a file to send with write_file()
+  @param[in] *p: rwbuf_t pointer for this socket buffer
+  @param[in] *name: file name
+  @return 1 on success 0 on fail
+*/
+MEMSPACE
+int write_file_open(rwbuf_t *p, char *name)
+{
+	FIL *fh;
+	int res;
+
+	write_file_close(p);
+
+	fh = safecalloc(sizeof(FIL),1);
+	if(!fh)
+	{
+#if WEB_DEBUG & 1
+		printf("write_file_open: calloc failed\n");
+#endif
+		return(0);
+	}
+	res = f_open(fh, name, FA_READ);
+	if(res != FR_OK)
+	{
+#if WEB_DEBUG & 32
+		printf("write_file_open: %s error:%d\n", name, res);
+#endif
+		safefree(fh);
+		return(0);
+	}
+	p->file = fh;
+	return(1);
+}
+
+/**
+  @brief Close the file opened by write_file_open()
+  @param[in] *p: rwbuf_t pointer for this socket buffer
+  @return void
+*/
+MEMSPACE
+void write_file_close(rwbuf_t *p)
+{
+	if(!p || !p->file)
+		return;
+	f_close(p->file);
+	safefree(p->file);
+	p->file = NULL;
+}
+
+/**
+  @brief Send the next chunk of the file opened by write_file_open()
+  Does not wait, returns at once if the last send has not finished.
+  The sent callback clears p->send and web_task() calls us again.
+  Whole sectors are read into the write buffer after any buffered data,
+  the file position stays sector aligned so FatFs reads them straight
+  into the buffer without copying them through its own sector buffer.
+  The file is closed once the last chunk has been sent.
+  @param[in] *p: rwbuf_t pointer for this socket buffer
+  @return 1 while sending, 0 when done, -1 on error
+*/
+MEMSPACE
+int write_file(rwbuf_t *p)
+{
+	UINT size;
+	int len;
+	int res;
+
+ 	if(!p || !p->conn || !p->wbuf || !p->file)
+		return(-1);
+
+	if(p->delete)
+	{
+		write_file_close(p);
+		return(-1);
+	}
+
+	// Backpressure, the last chunk is still being sent
+	if(p->send)
+		return(1);
+
+	if(f_eof(p->file) && !p->wind)
+	{
+		write_file_close(p);
+		return(0);
+	}
+
+	// Room for whole sectors
+	len = (p->wsize - p->wind) & ~511;
+	if(len > 0)
+	{
+		res = f_read(p->file, p->wbuf + p->wind, len, &size);
+		if(res != FR_OK)
+		{
+#if WEB_DEBUG & 1
+			printf("write_file: f_read error:%d\n", res);
+#endif
+			write_file_close(p);
+			return(-1);
+		}
+		p->wind += size;
+	}
+
+	if(write_buffer(p) == -1)
+	{
+		write_file_close(p);
+		return(-1);
+	}
+	return(1);
+}
+
+/**
+  @brief Send the next chunk of a text file opened by write_file_open()
+  CGI tokens in the file are replaced by their result, see rewrite_cgi_token().
+  Fills the write buffer, less room for one CGI token result, then sends it.
+  Token results are cut at CGI_RESULT_SIZE so they never flush the buffer,
+  a flush would wait for the send inside web_task().
+  Does not wait, returns at once if the last send has not finished.
+  The file is closed once the last chunk has been sent.
+  @param[in] *p: rwbuf_t pointer for this socket buffer
+  @return 1 while sending, 0 when done, -1 on error
+*/
+MEMSPACE
+int write_text(rwbuf_t *p)
+{
+	char buff[READBUFFSIZE+4];
+	UINT len;
+	DWORD pos;
+	int room;
+	int ind,size;
+	int res;
+
+ 	if(!p || !p->conn || !p->wbuf || !p->file)
+		return(-1);
+
+	if(p->delete)
+	{
+		write_file_close(p);
+		return(-1);
+	}
+
+	// Backpressure, the last chunk is still being sent
+	if(p->send)
+		return(1);
+
+	if(f_eof(p->file) && !p->wind)
+	{
+		write_file_close(p);
+		return(0);
+	}
+
+	// Any token must fit in the read so it is never split
+	while( !f_eof(p->file) && 
+		(room = p->wsize - p->wind - CGI_RESULT_SIZE) >= CGI_TOKEN_SIZE )
+	{
+		if(room > READBUFFSIZE)
+			room = READBUFFSIZE;
+
+		// keep track of file position
+		pos = f_tell(p->file);
+		res = f_read(p->file, buff, room, &len);
+		if(res != FR_OK)
+		{
+#if WEB_DEBUG & 1
+			printf("write_text: f_read error:%d\n", res);
+#endif
+			write_file_close(p);
+			return(-1);
+		}
+		if(len == 0)
+			break;
+
+		// make sure that string operations stop at end of read data
+		buff[len] = 0;
+
+		// Seach for a CGI token
+		ind = find_cgitoken_start(buff);
+
+		if(ind < 0) // NOT FOUND
+		{
+			// Keep a trailing '@', it may start a token in the next read
+			if(len > 1 && buff[len-1] == '@' && !f_eof(p->file))
+			{
+				--len;
+				f_lseek(p->file, pos + len);
+			}
+			// Write all data in buffer
+			write_len(p, buff, len);
+			continue;
+		}
+
+		if(ind > 0)	// FOUND a token start header ahead of this position
+		{
+			// Write all data up to token start header
+			write_len(p, buff, ind);
+			// Reposition CGI token to start of buffer and reread
+			f_lseek(p->file, pos + ind);
+			continue;
+		}
+
+		// FOUND CGI token at this position
+		size = is_cgitoken(buff);
+
+		if(size > 0)
+		{
+			buff[size] = 0;
+#if WEB_DEBUG & 8
+			printf("CGI: ind:%d, len:%d, size:%d [%s]\n", ind, len, size, buff);
+#endif
+			// TODO CGI actions go here
+			p->wlimit = p->wind + CGI_RESULT_SIZE;
+			rewrite_cgi_token(p, buff);	
+			p->wlimit = 0;
+			// Skip over token
+			f_lseek(p->file, pos + size);
+			continue;
+		}
+
+#if WEB_DEBUG & 8
+		printf("CGI BOGUS: ind:%d, len:%d, size:%d [%s]\n", ind, len, size, buff);
+#endif
+		// Write bogus CGI header and skip over it
+		write_len(p, buff, 2);
+		f_lseek(p->file, pos + 2);
+	}
+
+	if(write_buffer(p) == -1)
+	{
+		write_file_close(p);
+		return(-1);
+	}
+	return(1);
+}
+
 
 // =======================================================
 MEMSPACE
@@ -456,6 +701,7 @@ void rwbuf_winit(rwbuf_t *p)
 		return;
 	p->send = 0;
 	p->wind = 0;
+	p->wlimit = 0;
 }
 
 /**
@@ -504,6 +750,9 @@ void rwbuf_delete(rwbuf_t *p)
 	p->wbuf = NULL;
 	rwbuf_winit(p);
 
+	// Close any file we were sending
+	write_file_close(p);
+
 	p->remote_ip[0] = 0; p->remote_ip[1] = 0; p->remote_ip[2] = 0; p->remote_ip[3] = 0;
 	p->remote_port = 0;
 	p->local_ip[0] = 0; p->local_ip[1] = 0; p->local_ip[2] = 0; p->local_ip[3] = 0;
@@ -557,7 +806,7 @@ rwbuf_t *rwbuf_create()
 	// write buffer for this connection
 	rwbuf_winit(p);
 	// Always over allocate to allow an extra EOS or TWO
-	buf = safecalloc(BUFFER_SIZE+4,1);
+	buf = safecalloc(WBUF_SIZE+4,1);
 	if(!buf) 
 	{
 #if WEB_DEBUG & 1
@@ -567,7 +816,9 @@ rwbuf_t *rwbuf_create()
 		return(NULL);
 	}
 	p->wbuf = buf;
-	p->wsize = BUFFER_SIZE;
+	p->wsize = WBUF_SIZE;
+	p->file = NULL;
+	p->state = WEB_RECEIVE;
 	p->delete = 0;
 	p->remote_ip[0] = 0; p->remote_ip[1] = 0; p->remote_ip[2] = 0; p->remote_ip[3] = 0;
 	p->remote_port = 0;
@@ -2130,28 +2381,26 @@ int rewrite_cgi_token(rwbuf_t *p, char *src)
 
 /**
     @brief Process an incoming HTTP request
+	Parses the request, runs CGI actions, opens the file and writes the
+	HTTP header. Sets p->state to send the file, see web_state().
     @param[in] *p: rwbuf_t pointer to socket buffer
     @return void
 */
 MEMSPACE
 static void process_requests(rwbuf_t *p)
 {
-	int len,ind,size;
-	long pos;
-    uint8_t byte;
+	int len;
 	int8_t type;
 	char *name;
 	char *param;
-	char *value,*ptr;
-	FILE *fi;
 	hinfo_t hibuff;
 	hinfo_t *hi;
     struct stat sp;
 
 	hi = &hibuff;
-	// a token like; $i_am_a_token_name$, must be less then this in length
-#define READBUFFSIZE 512
-	char buff[READBUFFSIZE+4];
+
+	// Errors send a message and close, success picks a send state below
+	p->state = WEB_CLOSE;
 
 	if(!p->conn )
 	{
@@ -2322,109 +2571,30 @@ static void process_requests(rwbuf_t *p)
     }
     len = (long) sp.st_size;
 
-	fi = fopen(name,"r");
 	/* Search the specified file in stored binaray html image */
-	if(!fi)
+	if(!write_file_open(p, name))
 	{
 		html_msg(p, STATUS_NOT_FOUND, PTYPE_HTML, "File: %s not found\n", name);
 		return;
 	}
 
-
 #if WEB_DEBUG & 8
 	printf("Found name: %s, type:%d\n",name,type);
 #endif
 	if(type == PTYPE_HTML || type == PTYPE_CGI || type == PTYPE_TEXT)
 	{
         // Content length is not required for text and HTML files
-
         sock_printf(p,"HTTP/1.1 %s\nContent-Type: %s\n\n\n",
             html_status(200),
             mime_type(type));
-		// socket write buffering
-		while( 1 )
-		{
-            optimistic_yield(1000);
-
-            // Yeild happens when sending
-            //
-			// keep track of file position
-			pos = ftell(fi);
-			memset(buff,0,READBUFFSIZE);
-			len = fread(buff, 1, READBUFFSIZE,fi);
-			if(len == 0)
-				break;
-
-
-			// make sure that string operations stop at end of read data
-			buff[len] = 0;
-
-			// Seach for a CGI token
-
-			ind = find_cgitoken_start(buff);
-
-			if(ind < 0) // NOT FOUND
-			{
-				// Write all data in buffer
-				write_len(p, buff, len);
-			}
-
-			if(ind > 0)	// FOUND a token start header ahead of this position
-			{
-				// Write all data up to token start header
-				write_len(p, buff, ind);
-				// Reposition CGI token to start of buffer and reread
-				fseek(fi, pos + ind, 0L);
-				continue;
-			}
-
-			// FOUND CGI token at this position
-			size = is_cgitoken(buff);
-
-			if(size > 0)
-			{
-				buff[size] = 0;
-#if WEB_DEBUG & 8
-				printf("CGI: ind:%d, len:%d, size:%d [%s]\n", ind, len, size, buff);
-#endif
-				// TODO CGI actions go here
-				rewrite_cgi_token(p, buff);	
-				// Skip over token
-				fseek(fi, pos + size, 0L);
-				continue;
-			}
-
-			fseek(fi, pos + len, 0L);
-#if WEB_DEBUG & 8
-			printf("CGI BOGUS: ind:%d, len:%d, size:%d [%s]\n", ind, len, size, buff);
-#endif
-			// Write bogus CGI header and skip over it
-			write_len(p, buff, 2);
-		}
+		p->state = WEB_SEND_TEXT;
 	}
 	else 
 	{	// NON CGI read and echo
         // Content length is required for all other files
         html_head(p, 200, type, len   );
-
-		while(1)
-		{
-            optimistic_yield(1000);
-            // Yeild happens when sending
-			// FIXME
-			len = fread(buff, 1, READBUFFSIZE,fi);
-			if(!len)
-				break;
-			write_len(p, buff, len);
-		}
+		p->state = WEB_SEND_FILE;
 	}
-    write_flush(p);
-#if WEB_DEBUG & 2+8
-	web_sep();
-	printf("\nDone: ftell:%ld, len:%ld, feof%d\n",ftell(fi),len,feof(fi));
-	web_sep();
-#endif
-	fclose(fi);
 
 ///FIXME if we want to support keep-alive we have to change this
 }
@@ -2432,41 +2602,91 @@ static void process_requests(rwbuf_t *p)
 // =======================================================
 
 
+/**
+    @brief Run one step of the state machine for a connection
+	- WEB_RECEIVE: wait for a request, then process_requests()
+	- WEB_SEND_TEXT, WEB_SEND_FILE: send one chunk of the file
+	- WEB_CLOSE: send the rest of the write buffer, then disconnect
+	At most one espconn_send() per call. Nothing waits, the sent callback
+	clears p->send and the next call sends the next chunk.
+    @param[in] *p: rwbuf_t pointer to socket buffer
+    @return void
+*/
+MEMSPACE
+void web_state(rwbuf_t *p)
+{
+	int ret;
+
+	// Closing, the disconnect callback deletes the connection
+	if(p->delete)
+		return;
+
+	if(p->state == WEB_RECEIVE)
+	{
+		if(!p->received)
+			return;
+#if WEB_DEBUG & 2
+		web_sep();
+		printf("web_state: received:%d\n",p->received);
+#endif
+		process_requests(p);
+		p->received = 0;
+	}
+
+	// Backpressure, wait for the last send
+	if(p->send)
+		return;
+
+	if(p->state == WEB_SEND_TEXT)
+		ret = write_text(p);
+	else if(p->state == WEB_SEND_FILE)
+		ret = write_file(p);
+	else
+		ret = 0;
+
+	if(ret == 1 || p->delete)
+		return;
+
+	p->state = WEB_CLOSE;
+	if(ret == 0 && p->wind)
+	{
+		write_buffer(p);
+		return;
+	}
+	p->delete = 1;
+	espconn_disconnect(p->conn);
+}
+
 /**
     @brief Process ALL incoming HTTP requests
+	Connections take turns, one step each, see web_state().
+	The first connection served moves round each call.
 	@see process_requests()
     @return void
 */
 MEMSPACE
 void web_task()
 {
+	static int next = 0;
 	int i;
 	rwbuf_t *p;
-	// loop through all connections and process read actions
 
+	// loop through all connections and process read and send actions
 	connections = 0;
 	for(i=0;i< MAX_CONNECTIONS;++i)
 	{
-		p = web_connections[i];
+		p = web_connections[(next + i) % MAX_CONNECTIONS];
 
 		if(!p)
 			continue;
 
 		++connections;
 
-		if(p->received)
-		{
-
-#if WEB_DEBUG & 2
-            web_sep();
-			printf("web_task: received:%d\n",p->received);
-#endif
-			process_requests(p);
-			p->received = 0;
-            espconn_disconnect(p->conn);
-			optimistic_yield(1000);
-		}
+		web_state(p);
+		optimistic_yield(1000);
 	}
+	if(++next >= MAX_CONNECTIONS)
+		next = 0;
 	esp_schedule();
 }
 
@@ -27,8 +27,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 typedef struct espconn espconn_t;
 
 // WEB CONNECTIONS
+// Each connection has its own buffers and state, see web_state()
+// Heap per connection: read and write buffers, about 3KB with the default
+// WEB_SEND_CHUNK, and a FIL of about 560 bytes while a file is sent
 #ifndef MAX_CONNECTIONS
-	#define MAX_CONNECTIONS 1
+	#define MAX_CONNECTIONS 4
 #endif
 
 // =======================================================
@@ -64,6 +67,15 @@ typedef struct {
 // Memory buffering for socket writes
 #define IO_MAX 512  // buffered IO
 
+// Static file data sent per espconn_send(), whole 512 byte sectors so
+// f_read() can read them straight into the send buffer
+#ifndef WEB_SEND_CHUNK
+	#define WEB_SEND_CHUNK 2048
+#endif
+#if WEB_SEND_CHUNK < 512 || (WEB_SEND_CHUNK % 512) != 0
+	#error WEB_SEND_CHUNK must be a multiple of 512
+#endif
+
 // HTTP headers from the client
 enum {
     TOKEN_GET,
@@ -139,6 +151,14 @@ typedef struct {
 
 
 // =======================================================
+// Connection states, see web_state()
+enum {
+    WEB_RECEIVE,    // waiting for a request
+    WEB_SEND_TEXT,  // sending a text file, CGI tokens replaced
+    WEB_SEND_FILE,  // sending a file as is
+    WEB_CLOSE       // sending the last data, then disconnect
+};
+
 typedef struct {
     espconn_t *conn;
 
@@ -151,12 +171,15 @@ typedef struct {
     int send;       // bytes to send
     int wind;       // index into wbuf
     int wsize;      // bytes allocated
+    int wlimit;     // write_byte() stops at this index when not 0
 
 	uint8_t remote_ip[4];
 	uint8_t local_ip[4];
 	int remote_port;
 	int local_port;
 
+	FIL *file;		// file being sent by write_file() or write_text()
+	int state;		// connection state
 	int delete;		// close connection
 } rwbuf_t;
 
@@ -168,6 +191,10 @@ MEMSPACE int wait_send ( rwbuf_t *p );
 MEMSPACE int write_buffer ( rwbuf_t *p );
 MEMSPACE int write_flush ( rwbuf_t *p );
 MEMSPACE int write_byte ( rwbuf_t *p , int c );
+MEMSPACE int write_file_open ( rwbuf_t *p , char *name );
+MEMSPACE void write_file_close ( rwbuf_t *p );
+MEMSPACE int write_file ( rwbuf_t *p );
+MEMSPACE int write_text ( rwbuf_t *p );
 MEMSPACE void led_on ( int led );
 MEMSPACE void led_off ( int led );
 MEMSPACE void rwbuf_rinit ( rwbuf_t *p );
@@ -205,6 +232,7 @@ MEMSPACE int is_cgitoken_char ( int c );
 MEMSPACE int find_cgitoken_start ( char *str );
 MEMSPACE int is_cgitoken ( char *str );
 MEMSPACE int rewrite_cgi_token ( rwbuf_t *p , char *src );
+MEMSPACE void web_state ( rwbuf_t *p );
 MEMSPACE void web_task ( void );
 MEMSPACE void web_init_connections ( void );
 MEMSPACE void web_init ( int port );
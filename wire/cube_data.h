@@ -70,8 +70,23 @@ wire_e cube_edges[] = {
 /* END */
 	{ -1,-1},
 };
+
+/// @brief CUBE faces, counter clockwise seen from outside
+MEMSPACE_RO
+wire_f cube_faces[] = {
+	{ 0,1,2,3 },	/* TOP */
+	{ 4,7,6,5 },	/* BOTTOM */
+	{ 0,3,7,4 },	/*  x */
+	{ 1,5,6,2 },	/* -x */
+	{ 0,4,5,1 },	/*  y */
+	{ 3,2,6,7 },	/* -y */
+
+/* END */
+	{ -1,-1,-1,-1 },
+};
 	
 #else
 	extern wire_p cube_points[];
 	extern wire_e cube_edges[];
+	extern wire_f cube_faces[];
 #endif 	// _CUBE_DATA_H_
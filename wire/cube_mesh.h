@@ -0,0 +1,20 @@
+#ifndef _CUBE_MESH_H_
+#define _CUBE_MESH_H_
+/**
+ @file cube_mesh.h
+ Generated by:[earth2wireframe]
+ On: Sun Oct 18 03:59:08 2026
+ By Mike Gore 2015, Wireframe compact mesh, see wire_mesh.h
+ Source: data/cube.dat
+*/
+MEMSPACE_RO uint8_t cube_mesh[92] = {
+	0x57,0x4d,0x53,0x48,0x02,0x01,0x01,0x00,0x14,0x00,0x00,0x00,0x48,0x00,0x00,0x00,
+	0x08,0x00,0x0c,0x00,0x08,0x80,0x80,0x01,0x80,0x80,0x01,0x80,0x80,0x01,0xff,0xff,
+	0x01,0x00,0x00,0x00,0xff,0xff,0x01,0x00,0x80,0x80,0x02,0x00,0x00,0x00,0x80,0x80,
+	0x02,0xff,0xff,0x01,0xff,0xff,0x01,0x00,0x00,0x00,0xff,0xff,0x01,0x00,0x80,0x80,
+	0x02,0x00,0x00,0x0c,0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x05,0x02,0x02,0x02,0x02,
+	0x02,0x02,0x02,0x05,0x0d,0x08,0x02,0x08,0x02,0x08,0x02,0x08,
+};
+#else /* _CUBE_MESH_H_ */
+	extern MEMSPACE_RO uint8_t cube_mesh[];
+#endif /* _CUBE_MESH_H_ */
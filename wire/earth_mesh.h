@@ -0,0 +1,421 @@
+#ifndef _EARTH_MESH_H_
+#define _EARTH_MESH_H_
+/**
+ @file earth_mesh.h
+ Generated by:[earth2wireframe]
+ On: Sun Oct 18 03:59:08 2026
+ By Mike Gore 2015, Wireframe compact mesh, see wire_mesh.h
+ Source: data/world.dat
+*/
+MEMSPACE_RO uint8_t earth_mesh[6498] = {
+	0x57,0x4d,0x53,0x48,0x02,0x00,0x04,0x07,0x38,0x00,0x00,0x00,0x74,0x17,0x00,0x00,
+	0x8f,0x04,0x99,0x00,0xac,0x17,0x00,0x00,0x92,0x00,0x00,0x00,0x58,0x02,0x51,0x00,
+	0x3e,0x18,0x00,0x00,0x92,0x00,0x00,0x00,0x88,0x01,0x3f,0x00,0xd0,0x18,0x00,0x00,
+	0x92,0x00,0x00,0x00,0xda,0x00,0x2a,0x00,0x9b,0x01,0xb7,0x03,0x95,0x55,0xbc,0x5f,
+	0x96,0x06,0x8e,0x01,0x82,0x01,0xf0,0x07,0xe1,0x03,0xff,0x03,0xc8,0x02,0x8b,0x02,
+	0xad,0x02,0x13,0xed,0x03,0xff,0x03,0xc4,0x07,0x84,0x04,0xe4,0x02,0xb6,0x09,0xd0,
+	0x07,0xca,0x04,0xe0,0x06,0x03,0xbd,0x02,0x04,0xe9,0x01,0xd7,0x01,0xbe,0x06,0xa2,
+	0x05,0xee,0x01,0xbf,0x06,0x14,0xfa,0x02,0x22,0xa6,0x02,0xe2,0x01,0x91,0x08,0x89,
+	0x06,0x9f,0x02,0xb4,0x03,0xb6,0x05,0xb8,0x03,0xd6,0x08,0xc2,0x06,0xd4,0x01,0xc2,
+	0x02,0xd4,0x05,0xe0,0x02,0xb3,0x04,0x35,0xc0,0x01,0x2a,0xc2,0x01,0x6c,0xdd,0x03,
+	0x16,0xb8,0x01,0x9f,0x03,0xd2,0x02,0xca,0x02,0xa1,0x04,0xa2,0x02,0xb6,0x02,0x87,
+	0x02,0xdb,0x03,0xc5,0x01,0xff,0x03,0x86,0x02,0x84,0x02,0xbb,0x02,0xa8,0x02,0xd6,
+	0x01,0xa9,0x07,0x77,0x48,0x82,0x02,0xb7,0x04,0xd5,0x02,0xe0,0x01,0xd3,0x06,0xad,
+	0x04,0x7d,0xf9,0x07,0xc3,0x05,0xc7,0x04,0x8a,0x01,0xb2,0x01,0xb3,0x06,0xf0,0x04,
+	0xfa,0x03,0xdb,0x06,0x86,0x02,0xb4,0x01,0xe9,0x03,0xfe,0x03,0xaa,0x02,0xd8,0x03,
+	0xfa,0x05,0xc4,0x03,0x92,0x02,0xae,0x02,0xa0,0x01,0x93,0x05,0x88,0x02,0x70,0xf4,
+	0x05,0x49,0x11,0x44,0xc0,0x02,0x98,0x01,0x98,0x02,0xf4,0x01,0x6a,0xfa,0x01,0xda,
+	0x01,0x58,0xda,0x01,0x84,0x02,0x60,0x93,0x01,0xf0,0x03,0xc8,0x01,0x83,0x02,0xdf,
+	0x03,0xaf,0x01,0xe5,0x01,0x30,0x18,0xa5,0x02,0xa2,0x01,0x40,0x43,0xea,0x01,0x58,
+	0x77,0x80,0x03,0x86,0x01,0xbd,0x02,0x10,0x01,0x92,0x02,0xb5,0x03,0x93,0x01,0x6f,
+	0xcb,0x02,0x83,0x01,0xe1,0x01,0xfd,0x02,0xa5,0x01,0x81,0x02,0xba,0x03,0xa8,0x01,
+	0x99,0x03,0x4d,0x3d,0xa9,0x04,0xe4,0x02,0x50,0xe0,0x01,0xaf,0x01,0x27,0xe3,0x02,
+	0xa1,0x02,0x9f,0x01,0xdd,0x01,0xf0,0x02,0x72,0xe7,0x01,0x8c,0x02,0x40,0xdb,0x03,
+	0xe2,0x04,0x7e,0xb9,0x02,0x92,0x01,0x11,0x97,0x01,0x8e,0x04,0x7a,0xcd,0x03,0x45,
+	0x81,0x01,0xa0,0x01,0x4a,0x3c,0xcb,0x03,0xc0,0x01,0x41,0xf9,0x01,0xf6,0x02,0x18,
+	0x13,0x72,0x16,0x03,0x03,0x01,0x15,0x92,0x01,0x1a,0xd7,0x01,0x82,0x04,0x2a,0x79,
+	0xe6,0x04,0x42,0xcf,0x02,0x84,0x03,0x35,0xef,0x05,0x88,0x04,0xd7,0x01,0x95,0x02,
+	0x93,0x05,0xb9,0x01,0xc1,0x01,0x70,0x41,0x93,0x02,0xb4,0x04,0x39,0x15,0xff,0x06,
+	0x77,0xef,0x04,0xee,0x02,0xf3,0x01,0xc5,0x04,0x81,0x02,0xd9,0x02,0xa5,0x02,0xd7,
+	0x03,0xf7,0x01,0xa2,0x01,0xe7,0x04,0x23,0x9d,0x07,0xa0,0x03,0xe1,0x03,0x8c,0x06,
+	0xb9,0x05,0xc6,0x02,0xa6,0x05,0xb5,0x01,0xce,0x02,0xec,0x04,0xed,0x02,0xd4,0x01,
+	0xcb,0x02,0x4d,0xb9,0x01,0xb4,0x03,0xa7,0x02,0x7c,0xb2,0x03,0xcb,0x06,0x59,0x0c,
+	0xa5,0x04,0xd5,0x01,0x88,0x02,0x14,0x7c,0x6f,0xbd,0x04,0xad,0x02,0x5c,0xc5,0x03,
+	0xb3,0x01,0x7a,0x9a,0x02,0xc0,0x01,0xb9,0x02,0xfa,0x0a,0xc6,0x03,0x5d,0x4e,0x0d,
+	0xa4,0x04,0x8d,0x08,0xb1,0x01,0xf1,0x02,0xdd,0x07,0xff,0x04,0x78,0xfd,0x02,0x99,
+	0x01,0x3e,0xb1,0x04,0xb3,0x02,0xf7,0x01,0xb5,0x01,0xe9,0x01,0xf8,0x01,0xe7,0x03,
+	0xcf,0x01,0xc8,0x01,0xc5,0x02,0x8b,0x01,0x14,0x0b,0x02,0x87,0x04,0x63,0xcd,0x02,
+	0xa7,0x04,0xff,0x05,0xb7,0x07,0x9d,0x01,0x9b,0x06,0xeb,0x06,0x5a,0xb1,0x03,0x9f,
+	0x03,0xbe,0x04,0xaf,0x07,0xff,0x05,0x12,0x85,0x01,0xa7,0x01,0x0d,0x13,0x25,0x8e,
+	0x02,0xed,0x06,0x85,0x09,0xf0,0x02,0xbf,0x04,0xff,0x05,0xc0,0x03,0x8d,0x02,0xbd,
+	0x01,0xd3,0x04,0xf6,0x07,0x80,0x0b,0x8e,0x03,0x6d,0x62,0x82,0x04,0x8b,0x06,0xfd,
+	0x07,0xce,0x06,0xf1,0x05,0x95,0x08,0xb6,0x06,0xe1,0x04,0xc5,0x08,0x98,0x0d,0xab,
+	0x03,0x8f,0x04,0xc8,0x07,0x8d,0x01,0x89,0x02,0x01,0x11,0x47,0xf2,0x0b,0xa1,0x01,
+	0xe1,0x05,0x9e,0x08,0x4f,0xbd,0x07,0xe2,0x06,0x84,0x01,0x18,0xb4,0x06,0x82,0x01,
+	0x83,0x02,0xf3,0x0a,0xd1,0x01,0xc6,0x02,0xb1,0x04,0x84,0x01,0x96,0x08,0xab,0x05,
+	0xa0,0x01,0xdc,0x06,0xb9,0x04,0x0f,0x22,0x0f,0x7a,0x9a,0x03,0xf6,0x02,0x82,0x03,
+	0x9e,0x08,0xd9,0x09,0x8d,0x02,0xbb,0x05,0x85,0x0b,0x88,0x02,0xbc,0x03,0x67,0xe4,
+	0x04,0xf2,0x0a,0x0a,0x10,0x26,0xa6,0x04,0xd0,0x02,0x80,0x06,0xbc,0x09,0x29,0x30,
+	0xd2,0x06,0xb6,0x01,0xa8,0x02,0x9c,0x09,0xb9,0x01,0x85,0x04,0x98,0x05,0x61,0xf9,
+	0x02,0x91,0x02,0xf8,0x05,0xfe,0x0a,0xa0,0x06,0x98,0x05,0xe4,0x05,0x11,0xe6,0x03,
+	0xfe,0x04,0xca,0x01,0x2f,0x79,0xc0,0x05,0xdc,0x07,0x82,0x07,0xd2,0x01,0xbe,0x04,
+	0xfa,0x03,0x70,0xa0,0x05,0xbc,0x04,0xfd,0x06,0xdb,0x05,0xf7,0x02,0xe1,0x08,0x8f,
+	0x05,0xfb,0x02,0xcf,0x05,0xf9,0x01,0x91,0x01,0xc3,0x01,0x8a,0x04,0xb2,0x04,0xa9,
+	0x04,0xff,0x02,0xd3,0x02,0x9d,0x02,0x3b,0x2f,0xc6,0x02,0x92,0x04,0x84,0x04,0xcb,
+	0x01,0x76,0x7e,0xdb,0x06,0x1c,0x26,0x88,0x02,0xf4,0x01,0xe4,0x01,0x02,0xbb,0x3b,
+	0xf0,0x36,0xfc,0x0d,0x00,0x03,0x01,0x03,0xb1,0x01,0x1c,0x59,0x05,0x9d,0x01,0x31,
+	0x02,0xa0,0x01,0x30,0x02,0xb3,0x0c,0xd2,0x0d,0xe5,0x04,0x03,0x08,0x01,0x02,0x95,
+	0x01,0xc8,0x01,0x4b,0x19,0x21,0x17,0x02,0xe7,0x01,0x90,0x03,0x75,0x19,0x19,0x15,
+	0x02,0xdf,0x01,0x8e,0x05,0x69,0x03,0x00,0x03,0x02,0x4d,0xf0,0x02,0x25,0x04,0x0a,
+	0x04,0x02,0x00,0xa2,0x01,0x06,0x1b,0x19,0x17,0x01,0x14,0x98,0x01,0x16,0x02,0x12,
+	0x86,0x06,0x08,0x07,0x04,0x05,0x02,0xe2,0x02,0xb8,0x06,0xd8,0x01,0x04,0x13,0x06,
+	0x03,0xbe,0x1d,0xff,0x50,0xd3,0x06,0xf3,0x02,0xac,0x07,0xd0,0x03,0xe6,0x02,0x9f,
+	0x07,0xcd,0x03,0x02,0x9b,0x05,0xfe,0x0d,0xb8,0x06,0x0c,0x00,0x04,0x03,0x09,0x2a,
+	0x14,0xc0,0x01,0x28,0x76,0xbd,0x01,0x29,0x75,0x08,0xae,0x61,0xe9,0x08,0xff,0x01,
+	0xec,0x02,0xa7,0x02,0xf1,0x02,0x9a,0x03,0xf1,0x01,0x83,0x03,0xfc,0x01,0x75,0xe3,
+	0x01,0xb7,0x04,0x8b,0x02,0x68,0xd1,0x03,0x75,0x8e,0x01,0xb7,0x01,0xd8,0x04,0x90,
+	0x04,0xc0,0x01,0xb2,0x03,0xce,0x01,0x03,0xff,0x04,0x93,0x08,0xcb,0x03,0x63,0x10,
+	0x34,0x60,0x0b,0x2f,0x03,0x2d,0xc5,0x04,0xbd,0x03,0xef,0x01,0x8b,0x01,0x11,0xee,
+	0x01,0x84,0x01,0x0c,0x02,0x88,0x04,0xea,0x01,0x25,0x01,0x04,0x04,0x02,0x81,0x0e,
+	0xa5,0x0f,0xd7,0x08,0x01,0x08,0x08,0x02,0xcb,0x0b,0xf3,0x14,0x87,0x1a,0x35,0x0d,
+	0x09,0x02,0xf7,0x36,0x9e,0x19,0xdc,0x1b,0x17,0x05,0x11,0x02,0xa9,0x48,0x88,0x26,
+	0xeb,0x29,0x01,0x03,0x09,0x02,0x0b,0xe0,0x01,0xd6,0x01,0x00,0x00,0x00,0x02,0x17,
+	0xa6,0x01,0x72,0x13,0x13,0x43,0x01,0x23,0xd6,0x01,0x7c,0x01,0x5f,0xb4,0x03,0xae,
+	0x01,0x06,0xca,0x57,0xf1,0x03,0xa0,0x45,0xf5,0x02,0x9f,0x01,0x8f,0x01,0xd9,0x03,
+	0xe6,0x01,0x17,0xe6,0x01,0xa0,0x02,0xa6,0x01,0x98,0x03,0xbd,0x02,0x19,0xd0,0x01,
+	0x2d,0x1a,0x09,0x85,0x05,0xe3,0x02,0xa1,0x02,0xc8,0x03,0xe1,0x05,0xdd,0x01,0xf2,
+	0x05,0xbd,0x01,0x36,0xc7,0x04,0xbf,0x01,0xcb,0x01,0xef,0x05,0xea,0x02,0x00,0xc8,
+	0x01,0x6f,0x03,0x9a,0x02,0xfc,0x01,0xbc,0x01,0xe1,0x01,0x96,0x04,0xb8,0x01,0x81,
+	0x01,0x3a,0x05,0x08,0x9a,0x03,0xc5,0x0d,0xf3,0x05,0xaa,0x04,0x30,0x92,0x01,0xf8,
+	0x04,0xc5,0x02,0x4f,0x70,0xb7,0x04,0xcb,0x02,0xd4,0x01,0xc2,0x03,0xb2,0x02,0x8b,
+	0x03,0x8c,0x01,0x1c,0x9f,0x07,0xc4,0x01,0x3b,0xb1,0x01,0x62,0x10,0x04,0xf0,0x0c,
+	0xc1,0x13,0x8b,0x0b,0x65,0xf6,0x03,0x82,0x03,0x05,0xaf,0x01,0x87,0x01,0x68,0x83,
+	0x02,0xc1,0x01,0x05,0xc0,0x02,0x53,0x21,0x18,0xe0,0x06,0x9e,0x05,0xeb,0x01,0xdb,
+	0x01,0xb9,0x01,0xce,0x01,0xbd,0x03,0xc3,0x02,0x0c,0xc7,0x01,0xa1,0x01,0x04,0x94,
+	0x02,0x9b,0x02,0xd5,0x01,0xc0,0x04,0xf4,0x01,0xf0,0x01,0xd9,0x02,0xa9,0x01,0x9f,
+	0x01,0xed,0x01,0x79,0x79,0x03,0xe0,0x13,0xd2,0x0d,0xfe,0x09,0xc2,0x01,0x13,0x23,
+	0xb5,0x01,0x02,0x16,0x02,0xcd,0x1b,0xca,0x05,0x86,0x03,0x07,0x01,0x03,0x03,0xe8,
+	0x01,0xbd,0x01,0x51,0x47,0x20,0x0a,0x50,0x19,0x05,0x04,0x7f,0x91,0x04,0xe1,0x02,
+	0xa0,0x05,0xd4,0x01,0xd8,0x01,0xb3,0x04,0xd9,0x01,0xcd,0x01,0x6d,0x03,0x11,0x23,
+	0x8c,0x2a,0xcf,0x35,0xd1,0x5a,0x99,0x02,0xaf,0x01,0xfd,0x0c,0xc7,0x04,0x37,0x8f,
+	0x0c,0x88,0x09,0xd2,0x05,0x9b,0x16,0x82,0x0b,0x8c,0x06,0xf9,0x08,0xc9,0x02,0xe4,
+	0x05,0xa1,0x0f,0xbb,0x03,0xc8,0x05,0xbb,0x0b,0xb3,0x05,0xa2,0x05,0xcf,0x09,0xbb,
+	0x01,0xe2,0x06,0xa9,0x08,0xfb,0x01,0xee,0x05,0xaf,0x06,0xb5,0x01,0xf6,0x02,0xfd,
+	0x02,0xf3,0x01,0xd8,0x05,0x87,0x05,0x90,0x02,0x80,0x05,0x91,0x03,0xaa,0x04,0xa3,
+	0x04,0xa0,0x04,0xea,0x04,0xcf,0x05,0x94,0x06,0xa2,0x08,0xe1,0x02,0x84,0x06,0xe6,
+	0x03,0xb9,0x02,0xb4,0x04,0x80,0x0a,0x28,0x86,0x06,0xe4,0x07,0xb2,0x01,0xd4,0x04,
+	0xb6,0x04,0x12,0xfe,0x03,0x94,0x09,0xb7,0x01,0xe6,0x0c,0xd4,0x0c,0xea,0x08,0xba,
+	0x06,0xb4,0x06,0x21,0xfc,0x0e,0xa0,0x08,0xc2,0x05,0xa0,0x10,0xad,0x09,0xb3,0x0d,
+	0xe2,0x09,0xb9,0x09,0xd7,0x09,0xc2,0x03,0x57,0x51,0x4e,0xff,0x03,0xbb,0x03,0xc0,
+	0x03,0xe9,0x06,0xbf,0x04,0x82,0x0c,0xed,0x0b,0xcf,0x06,0xc0,0x06,0xa5,0x07,0x97,
+	0x03,0xb8,0x03,0xbd,0x0d,0xa1,0x05,0xd6,0x01,0x49,0x30,0xde,0x02,0xe3,0x0a,0xbb,
+	0x04,0xef,0x06,0xe3,0x02,0x9f,0x01,0xab,0x04,0x05,0x26,0xe6,0x33,0x89,0x75,0x86,
+	0x02,0xa8,0x05,0x81,0x03,0xb7,0x04,0x95,0x02,0x22,0x03,0xff,0x01,0xac,0x01,0x98,
+	0x02,0x97,0x01,0xb0,0x01,0x02,0xa4,0x0d,0x80,0x04,0xd8,0x01,0x03,0x0d,0x08,0x02,
+	0x6a,0x42,0x01,0x0e,0x0c,0x01,0x05,0xef,0x1d,0xd7,0x32,0x84,0x93,0x01,0xe2,0x15,
+	0xe8,0x02,0xc9,0x03,0x97,0x0b,0xc1,0x01,0x84,0x03,0xa1,0x09,0x6d,0xa6,0x01,0x95,
+	0x01,0x37,0x65,0x02,0xf0,0x23,0xc2,0x06,0xa5,0x07,0x15,0x0d,0x0f,0x02,0xe9,0x15,
+	0xaf,0x07,0xb5,0x01,0x2b,0x1d,0x41,0x04,0xa2,0x07,0xc4,0x02,0xac,0x02,0x86,0x09,
+	0xcc,0x03,0xf6,0x01,0x91,0x02,0xd5,0x01,0xcd,0x02,0xe9,0x06,0x85,0x02,0x1c,0x21,
+	0xdb,0x1d,0xd4,0x51,0xd0,0x53,0x10,0xf7,0x05,0xf1,0x01,0x26,0x8e,0x02,0x5a,0x0a,
+	0x98,0x02,0x58,0xd0,0x02,0x52,0x0c,0xe2,0x01,0xcf,0x01,0x4d,0xe8,0x01,0x98,0x01,
+	0x1e,0xac,0x01,0x71,0x2f,0xbc,0x01,0xd1,0x01,0x55,0x88,0x01,0x59,0x2b,0xb2,0x01,
+	0x0f,0x19,0xd0,0x01,0x57,0x39,0x82,0x02,0x27,0x33,0x09,0xed,0x01,0x51,0xe2,0x02,
+	0x2d,0x4b,0x94,0x02,0x9b,0x01,0x6f,0x66,0xd7,0x02,0x9b,0x01,0x95,0x03,0x18,0x58,
+	0x4f,0xdf,0x01,0x4d,0xf4,0x04,0xe3,0x02,0x99,0x02,0xb3,0x02,0x6f,0x0e,0xd1,0x01,
+	0xd3,0x02,0x77,0xfd,0x03,0xd2,0x01,0xba,0x01,0xcd,0x04,0x39,0x32,0xce,0x02,0xc8,
+	0x03,0xa6,0x01,0x82,0x02,0x84,0x03,0x80,0x01,0x93,0x02,0x82,0x01,0x5a,0xfb,0x03,
+	0x6c,0x62,0xb1,0x02,0xac,0x03,0xb8,0x01,0xd7,0x02,0xb7,0x01,0x2d,0xa5,0x04,0x3c,
+	0x28,0xc7,0x01,0xde,0x02,0x7c,0xdc,0x02,0x86,0x05,0xc6,0x01,0x22,0xf6,0x01,0xac,
+	0x05,0xb0,0x01,0xe5,0x01,0x14,0x0c,0xc1,0x02,0x0a,0x06,0xd4,0x01,0xa6,0x02,0x42,
+	0x09,0x94,0x01,0x20,0x67,0xa4,0x01,0x24,0xcc,0x01,0x82,0x01,0x16,0x73,0x8c,0x02,
+	0x34,0xb4,0x01,0x09,0x03,0xb0,0x01,0xe0,0x02,0x34,0x99,0x02,0x89,0x01,0x0d,0x05,
+	0x98,0x01,0x18,0xa9,0x01,0x2f,0x03,0x7f,0x2a,0x06,0x2b,0x30,0x08,0x2e,0x88,0x01,
+	0x14,0x4e,0x7e,0x12,0x8a,0x02,0x29,0x09,0x09,0x8e,0x01,0x12,0x42,0x66,0x0c,0x44,
+	0x48,0x06,0x9c,0x01,0x02,0x03,0xd6,0x01,0x32,0x03,0xb6,0x01,0xdd,0x01,0x25,0x7d,
+	0xdf,0x01,0x17,0x2a,0x85,0x02,0x29,0x17,0xa3,0x01,0x17,0x87,0x01,0x93,0x01,0x13,
+	0x13,0x81,0x01,0x15,0x04,0x1f,0x05,0x14,0xc9,0x01,0x29,0xdf,0x01,0xb3,0x02,0x37,
+	0xb2,0x01,0x33,0x11,0x8d,0x01,0x8b,0x02,0x37,0x04,0xc9,0x06,0xd3,0x04,0x93,0x01,
+	0x0a,0x87,0x03,0x73,0xbf,0x01,0x8a,0x01,0x26,0xae,0x01,0x82,0x02,0x50,0x09,0x4d,
+	0x90,0x06,0xc8,0x01,0xca,0x02,0x89,0x02,0x3b,0x54,0xaf,0x01,0x2d,0xb0,0x03,0x6e,
+	0x14,0x84,0x02,0xf3,0x01,0x4b,0xf3,0x03,0xb5,0x01,0x1f,0xa7,0x03,0xbe,0x01,0x36,
+	0xeb,0x01,0xb2,0x04,0x8a,0x01,0x32,0x0a,0x02,0x06,0xdf,0x03,0xc3,0x06,0xe7,0x01,
+	0x84,0x01,0xfb,0x01,0x45,0x65,0xd7,0x03,0x9b,0x01,0xef,0x01,0x98,0x04,0x9e,0x01,
+	0x44,0x30,0x12,0x9c,0x01,0x60,0x26,0x0e,0x87,0x05,0x3e,0x1b,0x54,0x8f,0x05,0xc3,
+	0x01,0xb6,0x01,0xbd,0x03,0x8b,0x01,0xa3,0x02,0xbd,0x01,0x5f,0xd7,0x01,0xc6,0x01,
+	0x34,0xd1,0x05,0xf8,0x01,0x07,0x86,0x01,0xfc,0x01,0x6a,0x97,0x01,0x82,0x01,0x14,
+	0x64,0xfc,0x01,0x5e,0x24,0xd0,0x02,0x66,0xac,0x02,0x9b,0x01,0x01,0x94,0x02,0xa7,
+	0x01,0x11,0xe2,0x01,0xe1,0x01,0x2d,0x28,0xf0,0x02,0x72,0x05,0xd3,0x06,0xf2,0x05,
+	0x64,0x35,0x89,0x04,0x8d,0x01,0xa1,0x04,0x65,0x77,0xea,0x02,0xde,0x04,0xde,0x01,
+	0xee,0x01,0x0c,0x28,0x0a,0xae,0x08,0xfe,0x01,0xb0,0x01,0x44,0xf1,0x02,0x51,0x75,
+	0xb7,0x01,0x37,0xe3,0x03,0x05,0x2f,0x8a,0x01,0xbe,0x01,0x40,0xd3,0x01,0xc6,0x01,
+	0x18,0x98,0x01,0xc2,0x01,0x3e,0xd0,0x01,0x97,0x02,0x2b,0x96,0x01,0xa6,0x01,0x34,
+	0x60,0x52,0x1a,0x04,0xc7,0x02,0xea,0x02,0x30,0x9b,0x02,0xd9,0x01,0x4b,0xa9,0x01,
+	0x76,0x06,0x9e,0x03,0x40,0x3a,0x03,0x94,0x03,0x04,0x24,0x95,0x01,0x04,0x09,0x98,
+	0x01,0x05,0x0a,0x03,0x50,0x9c,0x01,0x24,0xbd,0x01,0x43,0x19,0xbe,0x01,0x44,0x1a,
+	0x05,0xc2,0x04,0xa3,0x05,0x71,0x91,0x01,0xd5,0x02,0x59,0x65,0x64,0x14,0x84,0x01,
+	0xa2,0x01,0x2e,0x78,0x4e,0x16,0x02,0xb2,0x01,0xbf,0x02,0x47,0x04,0x01,0x01,0x04,
+	0xab,0x03,0x9e,0x08,0xdc,0x01,0xc4,0x01,0xcb,0x03,0x53,0xcf,0x01,0xc2,0x01,0x20,
+	0x01,0xfc,0x01,0x32,0x02,0xa0,0x04,0xe9,0x03,0x53,0x00,0x00,0x00,0x03,0x9f,0x01,
+	0xa2,0x02,0x3a,0x19,0xc9,0x01,0x29,0x16,0xc4,0x01,0x28,0x04,0xf6,0x07,0xe3,0x1a,
+	0xcf,0x08,0xb4,0x03,0xcb,0x03,0xef,0x01,0x97,0x03,0x9b,0x02,0x73,0x11,0xc6,0x05,
+	0xd4,0x02,0x02,0xb2,0x03,0xc9,0x05,0xef,0x02,0x11,0x21,0x0f,0x02,0xac,0x02,0x53,
+	0x41,0x00,0x00,0x00,0x36,0x84,0x24,0xda,0x0e,0xb5,0x02,0xb7,0x02,0x29,0x6e,0xa5,
+	0x02,0xdf,0x01,0x18,0xd1,0x03,0x7a,0xd6,0x01,0x97,0x03,0xca,0x02,0x82,0x02,0x93,
+	0x01,0x34,0x3e,0xc9,0x02,0x7a,0x88,0x01,0xe9,0x01,0xbc,0x01,0x7e,0x27,0x4a,0x22,
+	0x29,0xdc,0x02,0x7a,0xf9,0x01,0x88,0x02,0x88,0x01,0x91,0x01,0xee,0x01,0x64,0xc3,
+	0x02,0x6d,0x22,0xbb,0x01,0x82,0x03,0x88,0x01,0xa5,0x03,0xa0,0x02,0x8a,0x01,0xf5,
+	0x03,0x94,0x01,0x64,0xf5,0x01,0xc5,0x01,0x11,0x9d,0x03,0xbc,0x01,0x50,0xc0,0x01,
+	0xfe,0x01,0x24,0xf3,0x01,0x29,0x0c,0x62,0xec,0x04,0x6a,0x6d,0x94,0x03,0x46,0x5a,
+	0xfe,0x02,0x2a,0x92,0x02,0xca,0x01,0x00,0x2c,0x98,0x02,0x16,0x53,0xfc,0x01,0x1a,
+	0x84,0x03,0xbe,0x02,0x13,0xd8,0x01,0xb9,0x01,0x23,0xd2,0x02,0xa3,0x01,0x39,0x68,
+	0xb4,0x04,0x10,0xb8,0x01,0xc3,0x01,0x25,0xb2,0x02,0x95,0x02,0x45,0xe6,0x02,0x3d,
+	0x49,0xd2,0x01,0xa7,0x02,0x45,0xfa,0x02,0x33,0x5d,0x9c,0x01,0x93,0x01,0x35,0x6e,
+	0xf3,0x01,0x37,0x40,0xfb,0x01,0x31,0xa6,0x01,0x64,0x21,0xda,0x02,0x74,0x55,0x0e,
+	0x97,0x02,0x29,0x11,0xfd,0x01,0x1f,0xd2,0x01,0x71,0x55,0xa4,0x02,0xcc,0x01,0x3f,
+	0x1a,0xf5,0x03,0x5d,0xf7,0x01,0xe3,0x02,0x0e,0xcc,0x02,0xcd,0x04,0xfd,0x01,0x69,
+	0xad,0x02,0x29,0x16,0xd9,0x02,0x69,0x9a,0x01,0xc9,0x01,0x75,0x2e,0xa9,0x02,0x71,
+	0xa4,0x02,0xa7,0x03,0x89,0x02,0xb0,0x01,0xcd,0x01,0x97,0x01,0x0d,0x4d,0x17,0x09,
+	0xd4,0x02,0xf4,0x1d,0xc8,0x06,0xb0,0x04,0x29,0xfb,0x01,0x10,0x81,0x05,0x67,0xf9,
+	0x01,0x7b,0x5e,0xa3,0x01,0x7a,0x5c,0xe9,0x01,0x7d,0x4e,0x61,0xca,0x01,0x4a,0x9a,
+	0x01,0xb6,0x02,0x0f,0x20,0xaa,0x02,0x1a,0x0b,0xb6,0x1e,0x8e,0x0f,0x8d,0x11,0x9d,
+	0x06,0xf9,0x02,0xd2,0x04,0xef,0x04,0xf1,0x01,0x9a,0x03,0xad,0x01,0xa5,0x02,0x5e,
+	0xda,0x04,0x71,0x8d,0x03,0xd4,0x01,0xe6,0x02,0x7d,0xb0,0x03,0xe9,0x01,0xc5,0x02,
+	0xbc,0x02,0xca,0x02,0xe3,0x01,0xc0,0x02,0xdb,0x01,0x8f,0x02,0xd5,0x01,0x9a,0x07,
+	0xc0,0x01,0x39,0x6f,0x32,0x05,0xe9,0x06,0x87,0x0a,0xd8,0x04,0x84,0x02,0x81,0x04,
+	0xf1,0x01,0xa8,0x03,0xba,0x01,0xa7,0x02,0xf3,0x04,0xb6,0x04,0x86,0x04,0x89,0x01,
+	0xff,0x01,0x4a,0x02,0xd5,0x09,0xee,0x07,0xb6,0x06,0x48,0x16,0x27,0x02,0xac,0x03,
+	0xf5,0x05,0x99,0x02,0x16,0x0c,0x0b,0x02,0xb4,0x01,0x4d,0x75,0x0c,0x14,0x05,0x01,
+	0x0f,0x93,0x01,0x00,0x01,0x70,0x27,0x4b,0x01,0x2c,0x8c,0x01,0x11,0x01,0xf6,0x01,
+	0x3a,0x9d,0x01,0x01,0x6a,0x88,0x01,0x3d,0x02,0x9a,0x02,0x54,0xbf,0x01,0x2e,0x14,
+	0x1f,0x02,0xbb,0x21,0x1d,0x9e,0x11,0x2a,0x11,0x0d,0x06,0xa1,0x13,0xe0,0x0c,0xf8,
+	0x04,0xb6,0x01,0xf6,0x02,0x39,0x8c,0x05,0x7b,0x7f,0xf5,0x01,0x83,0x01,0x40,0x8f,
+	0x01,0x25,0x20,0xb3,0x03,0x53,0x58,0x06,0x38,0x61,0x03,0x38,0x5a,0x0f,0x84,0x03,
+	0x0f,0x4b,0xab,0x01,0x45,0x28,0xcf,0x01,0x65,0x2c,0x3f,0x60,0x08,0x02,0xb4,0x01,
+	0xe8,0x03,0x3f,0x06,0x05,0x01,0x04,0x84,0x01,0x20,0x1b,0x46,0xba,0x01,0x1d,0x2f,
+	0xb3,0x01,0x1a,0x3b,0x3c,0x06,0x06,0xc1,0x04,0xcd,0x01,0x78,0x04,0x8e,0x02,0x15,
+	0xbc,0x02,0x9f,0x02,0x1f,0x47,0x83,0x01,0x16,0xb1,0x01,0x30,0x1c,0x41,0x64,0x04,
+	0x03,0xd3,0x05,0x82,0x07,0x0e,0xba,0x01,0x51,0x0d,0xbf,0x01,0x5a,0x0c,0x04,0x6f,
+	0x6e,0x00,0x32,0x48,0x0f,0x6e,0x57,0x00,0x97,0x01,0x1c,0x0c,0x02,0xd1,0x03,0xac,
+	0x02,0x02,0x00,0x00,0x00,0x03,0xcb,0x01,0x3b,0x1a,0x2e,0x0a,0x05,0x2f,0x05,0x04,
+	0x23,0xf0,0x5e,0x8b,0x1c,0xd7,0x33,0x8f,0x01,0xc8,0x10,0xe0,0x01,0x89,0x02,0x94,
+	0x0b,0x70,0x90,0x04,0xc8,0x02,0xb1,0x06,0x41,0x88,0x11,0xd3,0x06,0xcf,0x04,0x90,
+	0x05,0xfa,0x03,0xe1,0x05,0xc2,0x0e,0xcd,0x02,0xbe,0x01,0xe4,0x0a,0x81,0x0e,0x06,
+	0xd4,0x0a,0xe3,0x12,0x9f,0x03,0xac,0x06,0xc9,0x07,0xe9,0x0d,0xde,0x0c,0x20,0xf6,
+	0x03,0x91,0x01,0xeb,0x09,0xb8,0x0b,0xc7,0x09,0xf7,0x10,0xfe,0x04,0xb3,0x07,0xbf,
+	0x0f,0xb9,0x03,0x4e,0xab,0x0c,0x9e,0x01,0xa1,0x06,0xd7,0x0a,0x14,0x93,0x06,0xbf,
+	0x09,0xc1,0x01,0x89,0x07,0xfb,0x0a,0x25,0x89,0x0e,0xf5,0x0b,0xd4,0x03,0xa1,0x0c,
+	0x85,0x02,0xcc,0x06,0xe9,0x01,0xd4,0x08,0xd6,0x0d,0xab,0x07,0xc6,0x18,0xdc,0x02,
+	0xa2,0x04,0xe2,0x0c,0xb6,0x03,0xad,0x03,0x80,0x10,0xcc,0x01,0x8b,0x05,0xd8,0x0c,
+	0x44,0xc1,0x05,0x92,0x08,0x56,0x8f,0x0c,0xc8,0x03,0x1d,0xbb,0x0e,0xe3,0x01,0xe7,
+	0x02,0xe7,0x0f,0xe6,0x04,0xa1,0x03,0x9d,0x07,0xac,0x09,0xd9,0x02,0x81,0x01,0xea,
+	0x09,0xc9,0x04,0xea,0x01,0xac,0x0e,0xdd,0x02,0xb6,0x07,0xe6,0x09,0xf9,0x02,0xa6,
+	0x07,0xe0,0x07,0xbb,0x04,0xa8,0x08,0xb0,0x08,0x04,0xec,0x02,0xec,0x50,0xbb,0x4a,
+	0x0c,0x45,0xcf,0x07,0x2e,0x11,0x98,0x07,0x39,0x58,0x38,0x07,0xfd,0x18,0xda,0x17,
+	0xd9,0x1b,0xb7,0x02,0xf3,0x02,0xc1,0x0d,0x90,0x04,0xd3,0x0b,0xef,0x0d,0xe2,0x02,
+	0xf2,0x03,0x94,0x0b,0x91,0x01,0xe6,0x04,0x80,0x08,0xc9,0x01,0xa2,0x03,0xe8,0x04,
+	0xdd,0x01,0xce,0x02,0xb6,0x03,0xb9,0x01,0x8f,0x7f,0xeb,0x5d,0xa4,0x93,0x01,0xb5,
+	0x01,0xef,0x01,0x47,0x9f,0x01,0xfd,0x01,0x43,0xad,0x02,0xf7,0x04,0x9b,0x01,0xc9,
+	0x03,0xd8,0x01,0xc1,0x01,0xc0,0x01,0xca,0x03,0x6c,0x85,0x01,0xc4,0x02,0x3b,0x43,
+	0x4c,0x1d,0x95,0x01,0xa0,0x01,0x47,0xa5,0x03,0x6e,0xd5,0x01,0xfd,0x03,0x80,0x08,
+	0xcf,0x02,0x76,0xca,0x06,0x27,0x93,0x04,0x8e,0x03,0xfb,0x02,0xf7,0x03,0xd8,0x02,
+	0x87,0x03,0xdb,0x03,0x98,0x09,0x8b,0x05,0x8e,0x0b,0xe9,0x04,0xd4,0x08,0xae,0x04,
+	0xb3,0x0a,0xbc,0x04,0x47,0xca,0x04,0x87,0x01,0xfa,0x02,0xb4,0x02,0x82,0x01,0x95,
+	0x03,0x8a,0x05,0xeb,0x02,0xc0,0x03,0xf6,0x04,0x34,0xc4,0x03,0xc2,0x08,0x9d,0x01,
+	0x87,0x03,0xda,0x08,0xad,0x05,0xb1,0x05,0xdb,0x01,0x97,0x02,0xef,0x04,0xe6,0x07,
+	0xb1,0x07,0xa4,0x04,0xda,0x0f,0xad,0x08,0x93,0x01,0xdc,0x05,0x8b,0x06,0x3a,0xec,
+	0x05,0xef,0x05,0xc6,0x04,0x99,0x03,0xfa,0x06,0xf0,0x05,0x86,0x02,0xec,0x01,0xdc,
+	0x04,0xea,0x05,0xad,0x03,0xa9,0x07,0x8f,0x02,0xa9,0x02,0x95,0x01,0xce,0x05,0xe5,
+	0x07,0xab,0x02,0xee,0x01,0xc9,0x04,0xb8,0x01,0x98,0x07,0xc1,0x0a,0x92,0x0a,0xfa,
+	0x07,0xb3,0x06,0x86,0x08,0x8e,0x03,0x15,0x60,0xb0,0x04,0xaf,0x0b,0x37,0x86,0x03,
+	0xe5,0x0c,0x98,0x06,0xe6,0x01,0x15,0xd4,0x09,0x4c,0xf2,0x06,0x75,0x8a,0x02,0xb9,
+	0x0b,0xd9,0x06,0x09,0xfd,0x0e,0x9c,0x0b,0x42,0xf4,0x10,0xcc,0x01,0xdf,0x02,0xc0,
+	0x0d,0xc0,0x07,0x61,0x9a,0x05,0xec,0x08,0xd3,0x02,0xa8,0x08,0x03,0x4a,0xbd,0x01,
+	0x90,0x11,0xb6,0x02,0xdf,0x0a,0xd2,0x04,0xc6,0x01,0x95,0x09,0x8c,0x08,0x35,0xef,
+	0x06,0xb2,0x06,0xaf,0x06,0x9a,0x13,0x80,0x01,0x9d,0x02,0xb8,0x05,0xb8,0x05,0xcf,
+	0x03,0x94,0x04,0xb2,0x07,0xbd,0x05,0xfc,0x04,0xf6,0x0b,0xf5,0x06,0x5e,0x88,0x07,
+	0xc3,0x06,0xf0,0x02,0x9c,0x03,0xeb,0x06,0xac,0x06,0x68,0xfe,0x04,0xb9,0x08,0xbf,
+	0x04,0xb4,0x05,0xbd,0x03,0xd3,0x07,0xfa,0x05,0xe3,0x01,0xcc,0x03,0x9c,0x01,0xdf,
+	0x07,0xe8,0x09,0x9f,0x04,0xd3,0x06,0xb8,0x0a,0xd9,0x06,0x81,0x06,0xa2,0x06,0xc7,
+	0x07,0xde,0x03,0xc4,0x01,0xd3,0x06,0xc2,0x0a,0x27,0x93,0x08,0xda,0x0c,0xf4,0x01,
+	0xb9,0x07,0xaa,0x05,0xa1,0x01,0xb9,0x02,0x9c,0x04,0x3e,0x51,0x0b,0xc7,0x08,0x84,
+	0x03,0xae,0x08,0xb4,0x02,0x93,0x06,0x88,0x02,0xb4,0x03,0xf3,0x07,0xb2,0x01,0xdd,
+	0x01,0xaf,0x03,0xf8,0x03,0x9d,0x06,0xb0,0x06,0xe6,0x02,0xb1,0x06,0xfe,0x09,0x47,
+	0x81,0x05,0x19,0xbc,0x04,0xbb,0x03,0xf3,0x03,0x9a,0x05,0xa8,0x06,0xb1,0x04,0xa3,
+	0x02,0xc4,0x01,0x93,0x02,0x05,0xbe,0x02,0xc1,0x04,0x24,0x8e,0x06,0x4a,0xf7,0x05,
+	0xe6,0x03,0x8f,0x02,0xe3,0x02,0xae,0x02,0xb9,0x04,0x25,0xec,0x02,0xcc,0x01,0x89,
+	0x04,0xea,0x01,0xf3,0x02,0x5f,0xf5,0x04,0xc3,0x07,0xe6,0x08,0xad,0x01,0xd5,0x07,
+	0xde,0x03,0x84,0x03,0x72,0xab,0x03,0xfc,0x01,0x94,0x07,0xc3,0x04,0xba,0x01,0xd1,
+	0x03,0x2f,0xb7,0x02,0xbd,0x08,0x8a,0x05,0x12,0xd9,0x07,0x98,0x01,0xc4,0x03,0xbb,
+	0x06,0xa5,0x03,0xd6,0x05,0xd5,0x06,0xeb,0x06,0x00,0x95,0x09,0x65,0xbd,0x04,0xdb,
+	0x03,0x86,0x05,0xdb,0x04,0xa4,0x04,0xfc,0x05,0x97,0x03,0xa2,0x09,0xee,0x03,0xeb,
+	0x04,0xbf,0x04,0xac,0x04,0x7b,0xc0,0x06,0x84,0x01,0xfd,0x03,0x96,0x05,0x92,0x03,
+	0x91,0x03,0xe4,0x02,0x9e,0x02,0xe3,0x05,0xec,0x01,0xf6,0x03,0x0c,0x9e,0x04,0x47,
+	0xa2,0x03,0x58,0xaf,0x02,0xbd,0x02,0x9e,0x06,0x52,0xd9,0x05,0xa0,0x04,0xe2,0x02,
+	0x89,0x03,0x86,0x03,0x8a,0x01,0xcd,0x05,0xe4,0x02,0xac,0x02,0xec,0x01,0x93,0x05,
+	0x30,0xe1,0x04,0xbd,0x04,0xb2,0x03,0xcd,0x05,0x49,0xd2,0x02,0x86,0x07,0xc9,0x02,
+	0xdf,0x02,0x94,0x05,0x9e,0x02,0x8d,0x03,0xa8,0x02,0x09,0xa5,0x01,0x90,0x06,0x81,
+	0x02,0xb3,0x03,0x9f,0x03,0xa5,0x05,0xf0,0x02,0xba,0x01,0xe7,0x03,0x3d,0xbf,0x02,
+	0xab,0x03,0xe4,0x01,0xb1,0x03,0xb2,0x01,0xee,0x01,0xfb,0x01,0x0f,0x88,0x01,0xc3,
+	0x02,0xea,0x01,0x96,0x01,0xcb,0x05,0xca,0x02,0xb4,0x02,0xe1,0x03,0x7e,0xbe,0x01,
+	0xdb,0x03,0xc8,0x01,0xa2,0x01,0x85,0x03,0x8a,0x02,0x68,0xe1,0x01,0xa4,0x01,0x34,
+	0x2c,0x92,0x01,0x25,0x95,0x02,0x90,0x01,0x42,0x6c,0xc2,0x01,0x43,0x43,0xb8,0x03,
+	0x41,0x39,0x98,0x08,0xf1,0x01,0xd8,0x04,0xf7,0x03,0x43,0xa0,0x01,0x93,0x01,0x15,
+	0x88,0x02,0xf0,0x03,0xe5,0x01,0x8b,0x01,0xf0,0x01,0x0f,0xcd,0x02,0xfa,0x02,0x08,
+	0x99,0x04,0x0a,0xb6,0x01,0xe7,0x03,0xd7,0x03,0xa2,0x02,0xa6,0x01,0xca,0x02,0x91,
+	0x01,0x97,0x05,0xde,0x01,0x70,0xa9,0x01,0x74,0x04,0xb3,0x04,0xb4,0x02,0x16,0xed,
+	0x04,0x1c,0x66,0xd1,0x02,0x70,0x0c,0x9d,0x01,0xc1,0x03,0xae,0x01,0xcd,0x03,0x19,
+	0x3c,0xb8,0x01,0xee,0x06,0xc7,0x02,0xe2,0x04,0xb6,0x02,0xc9,0x01,0xab,0x03,0xa8,
+	0x01,0x09,0xb5,0x04,0x8d,0x03,0xdc,0x01,0x89,0x02,0xe6,0x03,0xaf,0x01,0xda,0x03,
+	0xed,0x04,0xd0,0x01,0xc7,0x01,0xb1,0x06,0xb0,0x02,0xef,0x01,0x90,0x03,0x73,0x35,
+	0xe5,0x02,0x7c,0xdf,0x02,0xf2,0x01,0x3b,0x6b,0xd2,0x02,0x71,0xa6,0x01,0xfd,0x05,
+	0xf8,0x01,0xc3,0x03,0xa7,0x02,0x68,0x63,0xcf,0x01,0x3a,0xbf,0x01,0x77,0x22,0x28,
+	0x5d,0x18,0xf7,0x02,0x79,0x1a,0xb3,0x02,0x4d,0x0a,0xc7,0x01,0xc1,0x03,0x5e,0xdb,
+	0x01,0x88,0x02,0x47,0xfb,0x03,0x36,0x37,0xb4,0x01,0xec,0x04,0x8d,0x01,0xc1,0x01,
+	0x3f,0x00,0xfb,0x01,0x01,0x1b,0xcd,0x05,0xe3,0x02,0x07,0xaf,0x03,0xe3,0x01,0x15,
+	0x3e,0xbe,0x02,0x41,0xa1,0x04,0x2c,0x7b,0xd5,0x01,0xb7,0x03,0x3c,0x65,0x91,0x03,
+	0x40,0xaf,0x02,0xd7,0x03,0x0e,0x53,0x23,0x0f,0x89,0x03,0xa5,0x01,0x53,0xfd,0x04,
+	0x8f,0x05,0x6b,0xd7,0x02,0xb5,0x05,0x31,0x2e,0x85,0x02,0x24,0xbd,0x02,0xc7,0x06,
+	0x57,0x08,0xc0,0x38,0xba,0x1a,0xfe,0x04,0x86,0x02,0xda,0x01,0x49,0x8a,0x05,0x82,
+	0x01,0x71,0xbe,0x03,0x40,0x55,0x99,0x02,0xa1,0x01,0x56,0x8b,0x02,0x99,0x01,0x4c,
+	0xb3,0x03,0x05,0x38,0xe9,0x02,0x5b,0x38,0x05,0x8e,0x0c,0xa6,0x03,0xb9,0x02,0x3b,
+	0xf4,0x05,0xc5,0x01,0xc8,0x01,0x81,0x02,0x26,0x75,0x99,0x03,0x86,0x01,0x45,0x41,
+	0x1e,0x09,0xa6,0x1f,0xea,0x26,0xa5,0x1d,0xac,0x02,0xe2,0x01,0xe1,0x02,0xd8,0x01,
+	0xae,0x04,0xe1,0x04,0x08,0xc4,0x02,0xad,0x02,0x82,0x01,0xda,0x03,0xb3,0x04,0xd0,
+	0x06,0xa5,0x06,0x86,0x01,0x83,0x03,0xd5,0x05,0xa6,0x07,0xad,0x04,0x91,0x02,0xce,
+	0x04,0xab,0x04,0xe0,0x01,0xac,0x01,0x04,0xf3,0x0c,0xd4,0x08,0x23,0x9e,0x05,0xfc,
+	0x02,0x95,0x05,0x75,0x81,0x04,0x82,0x04,0xe7,0x03,0x60,0x96,0x01,0x04,0xbd,0x19,
+	0xa2,0x09,0x29,0xd2,0x08,0x5c,0xd1,0x02,0x8d,0x07,0x3d,0x90,0x02,0xd5,0x01,0x0f,
+	0x38,0x02,0xe4,0x05,0xa6,0x05,0xcb,0x06,0x14,0x10,0x15,0x03,0xd8,0x3f,0xc3,0x20,
+	0xdb,0x0b,0x72,0x4b,0x49,0x77,0x50,0x4e,0x03,0x80,0x0a,0x89,0x12,0x26,0x12,0x7e,
+	0x61,0x33,0x4d,0x70,0x03,0x88,0x02,0xc1,0x0f,0xbe,0x04,0x76,0xc5,0x03,0x00,0x75,
+	0xc6,0x03,0x00,0x03,0xfd,0x01,0x81,0x0b,0xa4,0x05,0xd6,0x01,0xcf,0x01,0xd1,0x01,
+	0x95,0x01,0x7a,0x98,0x01,0x02,0xfb,0x02,0x44,0x98,0x03,0x36,0x1d,0x33,0x03,0xd1,
+	0x48,0x88,0x6d,0xa7,0x42,0x86,0x02,0x44,0xcf,0x06,0x75,0x3f,0x98,0x05,0x02,0xec,
+	0x2d,0xc9,0x6f,0xb4,0x59,0x38,0x2f,0x1d,0x02,0xdb,0x2b,0xc5,0x7e,0x9b,0x36,0x03,
+	0x37,0x75,0x02,0x6e,0x2d,0x9b,0x01,0x6e,0x1a,0x04,0x02,0x90,0x03,0x9c,0x01,0x80,
+	0x01,0x1e,0x1e,0x30,0x02,0xbf,0x20,0x89,0x0f,0x87,0x35,0x21,0x00,0x19,0x02,0xfa,
+	0x2e,0xdc,0x33,0xd8,0x5d,0x29,0x6b,0x43,0x02,0xd1,0x06,0xb2,0x02,0xda,0x04,0x4e,
+	0x1c,0x07,0x15,0x85,0x89,0x01,0x80,0x97,0x01,0xdf,0x78,0xc1,0x01,0x95,0x07,0xbb,
+	0x0c,0x8f,0x01,0xd7,0x09,0x8f,0x0c,0x42,0x97,0x08,0xcf,0x09,0xf4,0x0a,0x01,0xff,
+	0x0f,0xba,0x08,0x8c,0x05,0xfb,0x05,0xf0,0x04,0xae,0x08,0xbc,0x01,0x36,0xaa,0x06,
+	0xa2,0x05,0xe6,0x01,0xa4,0x02,0x30,0x8a,0x03,0xac,0x08,0x86,0x06,0xb6,0x10,0xe0,
+	0x08,0xad,0x04,0xde,0x09,0xf2,0x05,0x60,0x55,0xc0,0x08,0x86,0x0e,0x9b,0x03,0x98,
+	0x03,0xda,0x09,0xf1,0x0e,0xb7,0x05,0xcc,0x06,0xc7,0x06,0xd5,0x01,0xdc,0x07,0x97,
+	0x05,0x91,0x04,0x65,0xd9,0x07,0x9d,0x04,0xc8,0x07,0xd1,0x05,0x91,0x06,0x99,0x02,
+	0x95,0x01,0xc5,0x04,0xd7,0x08,0x8b,0x08,0x87,0x05,0xa6,0x0c,0x04,0x98,0x14,0xf3,
+	0x14,0xbd,0x3b,0xc3,0x01,0x9b,0x06,0xb9,0x02,0xa2,0x03,0xa4,0x03,0x83,0x01,0xe3,
+	0x02,0x0a,0xd0,0x02,0x05,0xdb,0x18,0x87,0x28,0xa4,0x0c,0xdc,0x03,0x9f,0x06,0xf9,
+	0x05,0xd2,0x02,0xe9,0x01,0xb7,0x03,0xdf,0x01,0x90,0x04,0xc6,0x02,0xc5,0x04,0x80,
+	0x04,0xe4,0x06,0x05,0xc2,0x08,0x21,0x8d,0x0b,0xe2,0x04,0xc5,0x01,0xb7,0x05,0xe2,
+	0x04,0xb8,0x06,0xd3,0x03,0x85,0x05,0x83,0x02,0xd2,0x04,0x93,0x04,0x93,0x05,0xe2,
+	0x03,0x09,0xe7,0x0d,0xf8,0x32,0xa0,0x3d,0xda,0x08,0xcc,0x0e,0x9e,0x04,0x8a,0x06,
+	0x88,0x08,0xec,0x02,0xd8,0x09,0xec,0x0a,0xfc,0x08,0xd2,0x01,0xd2,0x01,0xc6,0x03,
+	0xcf,0x05,0xa9,0x05,0xef,0x02,0xa3,0x0a,0xa9,0x0b,0x06,0xfb,0x07,0xa1,0x0d,0xa5,
+	0x0c,0x99,0x02,0x9f,0x05,0xd5,0x04,0x06,0xde,0x33,0xb6,0x33,0xb6,0x26,0xdd,0x01,
+	0x14,0xf5,0x0d,0x92,0x08,0xda,0x03,0xbf,0x09,0x92,0x09,0xf0,0x03,0xfe,0x05,0xcb,
+	0x07,0x97,0x03,0xae,0x09,0xf9,0x07,0xc5,0x04,0x8a,0x08,0x05,0xae,0x2e,0xec,0x0d,
+	0xe5,0x02,0xc1,0x0f,0xe5,0x01,0xd7,0x09,0xff,0x07,0x93,0x02,0xe1,0x09,0xf4,0x09,
+	0xba,0x02,0x30,0xee,0x0d,0xc4,0x01,0x84,0x13,0x08,0xe9,0x3e,0xb5,0x42,0x8c,0x48,
+	0x8f,0x06,0xa0,0x05,0x89,0x0a,0xd0,0x03,0xbc,0x06,0x95,0x02,0xae,0x04,0x8e,0x04,
+	0x24,0x86,0x02,0x58,0xa2,0x01,0xe3,0x03,0x85,0x07,0x9c,0x03,0x55,0xcf,0x06,0xf2,
+	0x04,0x56,0xb9,0x02,0xb6,0x02,0x04,0x96,0x01,0xd0,0x0f,0xc7,0x0c,0x78,0xae,0x05,
+	0x8b,0x05,0x8c,0x04,0x8c,0x01,0xee,0x02,0x9b,0x05,0xdf,0x06,0xae,0x02,0x05,0xd6,
+	0x02,0xe1,0x14,0x84,0x13,0xad,0x05,0x37,0x8f,0x04,0xac,0x02,0x96,0x06,0x8d,0x02,
+	0x8e,0x03,0x8b,0x05,0xf6,0x05,0x07,0x55,0x2e,0x05,0xaa,0x0b,0xff,0x09,0xd8,0x0c,
+	0x91,0x08,0xa2,0x04,0x91,0x07,0xeb,0x02,0xa2,0x05,0xff,0x04,0xcc,0x06,0x83,0x05,
+	0xb0,0x07,0xac,0x04,0xc1,0x04,0xde,0x04,0x03,0xe9,0x01,0xe0,0x34,0xf5,0x30,0x84,
+	0x02,0x8c,0x02,0xc9,0x01,0xd1,0x01,0xef,0x01,0xd2,0x01,0x03,0x80,0x12,0x8c,0x0e,
+	0x99,0x0b,0x88,0x03,0xba,0x01,0x6d,0x87,0x03,0xb9,0x01,0x6e,0x04,0xc6,0x06,0xd0,
+	0x09,0xd3,0x39,0xdd,0x0f,0xa1,0x06,0xb9,0x03,0x9e,0x0b,0xac,0x04,0x2f,0xc0,0x04,
+	0xf6,0x01,0xea,0x03,0x02,0xcd,0x4f,0xb3,0x59,0x87,0x1e,0x22,0x16,0x45,0x02,0xeb,
+	0x06,0xe7,0x1d,0xec,0x06,0x00,0x00,0x00,0x02,0x35,0xe3,0x01,0xa6,0x01,0x02,0x1c,
+	0x00,0x02,0x5b,0xc3,0x11,0xc8,0x06,0x18,0x14,0x6b,0x05,0xc8,0x3a,0xc2,0x76,0xba,
+	0x47,0x85,0x03,0xd0,0x01,0xa7,0x0a,0xa0,0x04,0xd8,0x02,0x0f,0xac,0x01,0x7d,0xd6,
+	0x05,0xd5,0x01,0xc5,0x02,0x98,0x04,0x04,0x8d,0x09,0x35,0xd1,0x12,0x83,0x01,0x4e,
+	0xdf,0x07,0xfa,0x05,0xe4,0x03,0xcc,0x01,0xc9,0x04,0xfb,0x03,0xa2,0x05,0x04,0xc6,
+	0x0a,0xe0,0x05,0xaa,0x04,0xae,0x01,0xaa,0x01,0xcd,0x02,0xad,0x01,0x89,0x01,0xc4,
+	0x01,0x00,0x1f,0x8a,0x01,0x06,0xa2,0x08,0x95,0x6d,0xf8,0x5a,0x86,0x01,0xc3,0x02,
+	0x3c,0xbf,0x01,0xc9,0x03,0x6b,0xca,0x03,0xd7,0x01,0xc2,0x01,0xae,0x02,0xf8,0x04,
+	0x9c,0x01,0xa0,0x01,0xfe,0x01,0x44,0x03,0x86,0x2a,0xda,0x18,0xd4,0x06,0x1f,0xd6,
+	0x02,0x45,0x44,0xc3,0x02,0x44,0x05,0xfc,0x02,0x11,0x0e,0x45,0xa6,0x01,0x21,0xe1,
+	0x01,0xf3,0x01,0x28,0x96,0x01,0x1d,0x0a,0x5e,0x02,0x02,0x03,0x18,0x8f,0x02,0x30,
+	0x84,0x01,0x98,0x02,0x2f,0x71,0xff,0x01,0x2c,0x05,0xa3,0x15,0x43,0x83,0x02,0x97,
+	0x03,0xf9,0x01,0x29,0x68,0xda,0x02,0x21,0xf0,0x01,0x54,0x20,0x3e,0x99,0x01,0x26,
+	0x03,0xe9,0x03,0xbf,0x02,0x2f,0xc3,0x01,0x11,0x29,0x9a,0x01,0x44,0x1a,0x02,0x3d,
+	0xd0,0x03,0x5b,0x09,0x04,0x01,0x21,0x8a,0x44,0x95,0x16,0xb7,0xf4,0x01,0x8a,0x02,
+	0xee,0x04,0x66,0x75,0xa0,0x06,0x0c,0x95,0x03,0xe4,0x06,0x1b,0x09,0x9c,0x07,0xa0,
+	0x01,0xbb,0x03,0xb4,0x02,0x41,0x20,0xee,0x04,0xa4,0x01,0x6f,0xce,0x03,0x66,0xb3,
+	0x01,0x82,0x02,0x1e,0x97,0x01,0xc8,0x03,0x70,0xbf,0x05,0x5a,0x89,0x01,0x9d,0x04,
+	0xba,0x01,0x29,0x8b,0x06,0x5a,0x59,0x2f,0x99,0x04,0xc3,0x01,0xc1,0x04,0xb6,0x03,
+	0x5a,0x83,0x09,0x8a,0x07,0xac,0x02,0x8d,0x06,0x0a,0x0e,0xf7,0x05,0x04,0x32,0xcf,
+	0x08,0x93,0x02,0x14,0x8d,0x05,0xc5,0x04,0x6d,0xb1,0x06,0xc3,0x02,0x48,0xe9,0x04,
+	0xeb,0x03,0x06,0xab,0x03,0x91,0x05,0x3d,0xc7,0x01,0xad,0x06,0x87,0x01,0x9b,0x01,
+	0xdd,0x05,0x59,0x43,0x99,0x05,0x4b,0x9e,0x01,0xdb,0x03,0x6b,0xd2,0x01,0xeb,0x04,
+	0x73,0xa0,0x06,0xd0,0x01,0xdd,0x01,0xba,0x06,0x5b,0xc9,0x01,0x86,0x03,0x0f,0x4f,
+	0xea,0x07,0xef,0x03,0xaf,0x01,0xf0,0x01,0xcd,0x02,0x21,0x31,0x8c,0x01,0xad,0x01,
+	0x0d,0xee,0x03,0x8f,0x05,0x19,0xf3,0x08,0xc3,0x03,0x90,0x01,0xad,0x03,0xa1,0x01,
+	0x4e,0xad,0x03,0x8d,0x03,0x72,0x63,0x8d,0x03,0x44,0x6e,0xcd,0x05,0x5a,0xda,0x01,
+	0xa3,0x03,0x26,0xe4,0x03,0xbd,0x03,0x12,0xfa,0x03,0xa1,0x03,0x22,0xe2,0x02,0x98,
+	0x02,0x6b,0xa8,0x03,0xc7,0x02,0x2e,0x92,0x02,0xdb,0x01,0x2c,0x3f,0x93,0x02,0x52,
+	0x38,0x2b,0x0a,0xd8,0x04,0x04,0x15,0xf6,0x04,0x1f,0x0c,0xd0,0x03,0x14,0x0c,0xa0,
+	0x01,0x6f,0x2c,0xc0,0x03,0xf2,0x02,0x49,0xc2,0x04,0xc7,0x03,0xc8,0x01,0xda,0x01,
+	0x9f,0x04,0xd6,0x01,0xb2,0x02,0xd7,0x03,0xe0,0x01,0xa0,0x03,0xfd,0x01,0xb4,0x01,
+	0xec,0x05,0x31,0xbe,0x01,0x81,0x01,0x70,0x4d,0xf7,0x03,0xba,0x01,0xbd,0x01,0x55,
+	0xa8,0x01,0x51,0xd5,0x03,0xaa,0x01,0x95,0x01,0x32,0xce,0x02,0x6d,0x1f,0x8e,0x04,
+	0xaf,0x01,0xb1,0x01,0xd8,0x03,0xa3,0x01,0xdf,0x01,0xf6,0x02,0x81,0x01,0xdd,0x02,
+	0xb6,0x02,0x73,0x8d,0x07,0x0a,0x4d,0xb9,0x03,0x3f,0x03,0x88,0x02,0xd8,0x08,0xcb,
+	0x01,0x94,0x04,0x86,0x05,0x37,0x84,0x04,0x84,0x02,0x14,0xf4,0x04,0x8e,0x01,0x44,
+	0xa2,0x01,0xfb,0x01,0x32,0xf2,0x03,0xdb,0x01,0x70,0xd2,0x03,0xcc,0x01,0x48,0xb6,
+	0x07,0xe2,0x02,0xcc,0x01,0xf8,0x03,0x8c,0x03,0x7a,0x30,0xda,0x01,0x02,0xb2,0x01,
+	0x8e,0x02,0x30,0x37,0xa6,0x03,0x19,0x10,0x4e,0x06,0x03,0x8d,0x42,0x86,0x07,0xd1,
+	0x03,0xdd,0x01,0xd9,0x02,0x20,0xc8,0x01,0x9f,0x04,0x35,0x03,0x01,0x59,0x00,0xa4,
+	0x01,0xdb,0x05,0x0b,0x3d,0xdb,0x03,0x2c,0x03,0xc4,0x35,0xfd,0x24,0xb6,0x09,0xcf,
+	0x05,0x98,0x06,0xc5,0x03,0x93,0x03,0xd2,0x05,0xa9,0x02,0x04,0xef,0x03,0xe6,0x05,
+	0x89,0x02,0x84,0x02,0xe6,0x06,0x93,0x01,0xb2,0x02,0xb2,0x04,0x2b,0xb2,0x01,0xc0,
+	0x02,0x0d,0x0c,0x5c,0x16,0x0c,0xc8,0x06,0xb8,0x01,0x96,0x01,0xc4,0x06,0xda,0x01,
+	0xc2,0x01,0xde,0x03,0xfc,0x03,0x66,0x9a,0x03,0xee,0x03,0x6e,0xb4,0x03,0x8a,0x04,
+	0x94,0x01,0xbd,0x02,0x94,0x04,0x6d,0x09,0xca,0x04,0x1a,0x63,0x9e,0x04,0x0c,0x8b,
+	0x03,0x88,0x06,0x21,0x65,0xbe,0x05,0x5c,0x91,0x01,0x54,0x1d,0x02,0xcd,0x15,0xba,
+	0x13,0x6c,0x95,0x03,0x8f,0x01,0x63,0x03,0x9b,0x05,0xd0,0x04,0xaa,0x01,0xb7,0x02,
+	0xaa,0x03,0xa2,0x01,0xf7,0x03,0x39,0x23,0x06,0x87,0x19,0x91,0x4a,0xed,0x05,0xb4,
+	0x03,0xf3,0x06,0x72,0x8e,0x05,0x6f,0x43,0x98,0x04,0x3d,0x2b,0xc4,0x02,0x7f,0x06,
+	0x13,0x42,0x0f,0x07,0xcc,0x18,0xbd,0x08,0x98,0x03,0x9d,0x03,0xde,0x04,0xef,0x01,
+	0x42,0xd7,0x01,0x48,0x9f,0x02,0xc5,0x01,0x24,0xee,0x02,0x93,0x01,0x54,0xf8,0x01,
+	0x97,0x02,0x7e,0x0c,0xfc,0x01,0x55,0x06,0xa4,0x02,0xa4,0x14,0xdd,0x04,0x0c,0xfa,
+	0x02,0x37,0xfd,0x01,0x9a,0x02,0x45,0x9f,0x04,0xef,0x03,0x08,0x8c,0x06,0xa3,0x01,
+	0x74,0x36,0x22,0x02,0x03,0xb3,0x06,0xc2,0x01,0x7d,0xe5,0x01,0x67,0x03,0xde,0x01,
+	0x62,0x04,0x03,0xbf,0x23,0xd4,0x0b,0x48,0xe6,0x02,0x15,0x3d,0xe5,0x02,0x14,0x3e,
+	0x02,0xe6,0x2b,0xae,0x35,0x98,0xf3,0x01,0x00,0x00,0x00,0x00,0xd7,0x9f,0xb1,0xcd,
+	0x8e,0xc5,0x76,0x48,0xd0,0xfe,0xdc,0x32,0xb2,0xe2,0x29,0x6d,0xaf,0x46,0xd9,0x06,
+	0x00,0x00,0x0e,0x52,0x71,0x00,0x80,0xf6,0x6b,0xe7,0xce,0x05,0xd8,0x6e,0xac,0xfa,
+	0xd9,0x5e,0x98,0xf0,0x13,0x10,0xad,0x52,0x0b,0x84,0x80,0x00,0xdc,0xa8,0x65,0xab,
+	0x7c,0x9b,0x6d,0x60,0xb2,0xe0,0x21,0x11,0x41,0xc0,0x86,0x54,0x25,0x3c,0x99,0xd0,
+	0x0f,0x00,0x38,0x4b,0xe0,0x04,0x80,0xbe,0x3f,0x77,0x5f,0xee,0x33,0xcb,0xfd,0x7d,
+	0xdf,0xfb,0xeb,0xea,0xb6,0xed,0x6f,0xff,0xfb,0xf5,0x2c,0x12,0x44,0xaa,0xc3,0xff,
+	0x18,0x68,0x9c,0x64,0xe2,0x8c,0xff,0x0b,0xf0,0x72,0x00,0x20,0xcf,0xff,0x7f,0xbd,
+	0x55,0xdf,0x7f,0xfb,0xf7,0xfe,0x0f,0x70,0x7f,0xdb,0xc7,0x4f,0x50,0x20,0x6b,0xa2,
+	0x74,0xd2,0x88,0x29,0x4a,0x5b,0x63,0xdb,0x2c,0xc1,0x3f,0xae,0x5b,0x1c,0x55,0x9b,
+	0x80,0xc9,0x0e,0x45,0x52,0x00,0xc0,0xd6,0x04,0x32,0x90,0x60,0x09,0x4d,0xa7,0x06,
+	0xd9,0x04,0x00,0x00,0x0e,0x52,0x01,0x00,0x80,0xb2,0x62,0xe6,0xce,0x05,0xd8,0x4e,
+	0x88,0x58,0x91,0x4e,0x98,0xb0,0x13,0x10,0x88,0x42,0x0b,0x84,0x80,0x00,0x84,0x88,
+	0x65,0x22,0x58,0x13,0x04,0x00,0x00,0xa0,0x21,0x01,0x41,0x40,0x04,0x00,0x01,0x2c,
+	0x99,0xd0,0x0a,0x00,0x28,0x01,0x00,0x00,0x80,0x2e,0x33,0x36,0x5d,0xee,0x31,0x02,
+	0x39,0x24,0x9b,0xaa,0x8b,0xe2,0x36,0x49,0x25,0x54,0xba,0x95,0x2c,0x12,0x44,0x2a,
+	0x41,0xa9,0x18,0x48,0x10,0x60,0xe2,0x8c,0xb9,0x0b,0x00,0x70,0x00,0x20,0x4f,0x45,
+	0x67,0xbd,0x55,0xdf,0x3e,0xf9,0xb7,0x02,0x0b,0x70,0x1f,0x52,0x00,0x00,0x10,0x20,
+	0x2b,0xa2,0x74,0x12,0x08,0x21,0x42,0x0b,0x61,0xdb,0x2c,0x41,0x3a,0x0e,0x5b,0x00,
+	0x11,0x99,0x80,0x48,0x00,0x01,0x40,0x00,0x40,0x80,0x00,0x20,0x80,0x20,0x09,0x44,
+	0x25,0x02,0x09,0x04,0x00,0x00,0x0e,0x12,0x01,0x00,0x00,0xa0,0x60,0x22,0x4c,0x00,
+	0x80,0x0a,0x88,0x58,0x90,0x02,0x98,0xb0,0x01,0x00,0x88,0x00,0x03,0x00,0x80,0x00,
+	0x84,0x88,0x40,0x02,0x08,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x40,0x40,0x00,0x00,
+	0x01,0x04,0x90,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x2a,0x13,0x16,0x51,0x42,
+	0x31,0x02,0x28,0x24,0x89,0xaa,0x88,0x42,0x12,0x49,0x05,0x54,0x20,0x00,0x24,0x12,
+	0x04,0x20,0x00,0x09,0x00,0x08,0x10,0x60,0x22,0x88,0x09,0x0b,0x00,0x00,0x00,0x20,
+	0x4b,0x45,0x43,0xad,0x11,0xdb,0x3a,0xd9,0xb5,0x02,0x0b,0x30,0x1b,0x42,0x00,0x00,
+	0x10,0x20,0x20,0x22,0x30,0x10,0x00,0x20,0x00,0x02,0x20,0xda,0x0c,0x41,0x10,0x02,
+	0x00,0x00,
+};
+#else /* _EARTH_MESH_H_ */
+	extern MEMSPACE_RO uint8_t earth_mesh[];
+#endif /* _EARTH_MESH_H_ */
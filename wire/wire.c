@@ -29,8 +29,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "display/ili9341.h"
 #include "cordic/cordic.h"
+#include "cordic/fixed3d.h"
 #include "wire/wire_types.h"
 #include "wire/wire.h"
+#include "wire/wire_mesh.h"
 
 /*
  @brief convert fixed point coordinate to floating point
@@ -47,35 +49,429 @@ void wire2fp(wire_p *in, point *out)
 }
 
 /*
- @brief Draw a wireframe
+ @brief Build the view transform for a frame
+ The rotation matrix comes from the fixed point Cordic code, the perspective
+ projection, scale and offset are then folded into the same matrix
+ The view and scale are converted to fixed point once, nothing else uses doubles
+ @param [out] *M: view transform
+ @param [in] *view: view point, degrees
+ @param [in] scale: scale factor
+ @param [in] x: X offset
+ @param [in] y: Y offset
+ @return void
+*/
+void wire_view(wire_view_t *M, point *view, double scale, int x, int y)
+{
+	fx_mat3 R;
+	int64_t row[2][3];
+	int64_t max = 0;
+	int32_t s;
+	int i,k;
+
+	fx_mat3_rotate(&R, FX_DEG(view->x), FX_DEG(view->y), FX_DEG(view->z));
+	s = FX_Q16(scale);
+
+	// Same as PerspectiveProjection(), Q15 rows times Q16 scale, 2^32 = 1.0
+	for(k=0;k<3;++k)
+	{
+		row[0][k] = (int64_t) (2 * R.m[0][k] + R.m[2][k]) * s;
+		row[1][k] = (int64_t) (2 * R.m[1][k] - R.m[2][k]) * s;
+		for(i=0;i<2;++i)
+		{
+			if(row[i][k] > max)
+				max = row[i][k];
+			if(-row[i][k] > max)
+				max = -row[i][k];
+		}
+	}
+
+	// Three products of a vertex coordinate must fit in 32 bits
+	M->shift = 16;
+	while(M->shift > 0 && ((max >> (32 - M->shift)) + 1) * 3 * 32768 >= 2147483647LL)
+		M->shift--;
+
+	for(i=0;i<2;++i)
+		for(k=0;k<3;++k)
+			M->m[i][k] = (row[i][k] + (1LL << (31 - M->shift))) >> (32 - M->shift);
+	for(k=0;k<3;++k)
+		M->m[2][k] = (R.m[2][k] + 1) >> 1;
+	M->x = x;
+	M->y = y;
+}
+
+/*
+ @brief Depth of a vertex
+ @param [in] *M: view transform
+ @param [in] *in: fixed point vertex
+ @return depth in WIRE_ONE units, > 0 is behind the horizon
+*/
+static int16_t wire_depth(wire_view_t *M, wire_p *in)
+{
+	return((M->m[2][0] * in->x + M->m[2][1] * in->y + M->m[2][2] * in->z + WIRE_HALF) >> 14);
+}
+
+/*
+ @brief Transform a vertex to screen coordinates, depth is not set
+ @param [in] *M: view transform
+ @param [in] *in: fixed point vertex
+ @param [out] *out: screen X and Y
+ @return void
+*/
+static void wire_screen(wire_view_t *M, wire_p *in, p3_int16_t *out)
+{
+	int32_t round = 1L << (M->shift + 13);
+	int shift = M->shift + 14;
+
+	out->X = ((M->m[0][0] * in->x + M->m[0][1] * in->y + M->m[0][2] * in->z + round) >> shift) + M->x;
+	out->Y = ((M->m[1][0] * in->x + M->m[1][1] * in->y + M->m[1][2] * in->z + round) >> shift) + M->y;
+}
+
+/*
+ @brief Transform a vertex to screen coordinates and depth
+ @param [in] *M: view transform
+ @param [in] *in: fixed point vertex
+ @param [out] *out: screen X and Y, depth Z in WIRE_ONE units
+ @return void
+*/
+void wire_project(wire_view_t *M, wire_p *in, p3_int16_t *out)
+{
+	wire_screen(M, in, out);
+	out->Z = wire_depth(M, in);
+}
+
+/*
+ @brief Screen position where a line crosses the horizon, the Z = 0 plane
+ @param [in] *M: view transform
+ @param [in] *A: vertex in front of the horizon
+ @param [in] za: depth of A, <= 0
+ @param [in] *B: vertex behind the horizon
+ @param [in] zb: depth of B, > 0
+ @param [out] *out: screen X and Y of the crossing
+ @return void
+*/
+static void wire_horizon(wire_view_t *M, wire_p *A, int16_t za, wire_p *B, int16_t zb, p3_int16_t *out)
+{
+	wire_p C;
+	int32_t den = zb - za;
+
+	// A + (B - A) * -za / (zb - za), only lines that cross use 64 bits
+	C.x = A->x + (int32_t) (((int64_t) (B->x - A->x) * -za) / den);
+	C.y = A->y + (int32_t) (((int64_t) (B->y - A->y) * -za) / den);
+	C.z = A->z + (int32_t) (((int64_t) (B->z - A->z) * -za) / den);
+	wire_screen(M, &C, out);
+	out->Z = 0;
+}
+
+/*
+ @brief Transformed vertex of an edge or face list
+ The first WIRE_CACHE vertices are transformed once and kept
+ Vertices behind the horizon only get a depth when culling the horizon
+ @param [in] *M: view transform
+ @param [in] *wire: fixed point points
+ @param [in] i: vertex index
+ @param [in,out] *cache: transformed vertices
+ @param [in,out] *valid: cache valid bits
+ @param [in] cull: culling mode
+ @param [out] *P: transformed vertex
+ @return void
+*/
+static void wire_vertex(wire_view_t *M, const wire_p *wire, int i, p3_int16_t *cache, uint8_t *valid, int cull, p3_int16_t *P)
+{
+	wire_p W;
+
+	if(i < WIRE_CACHE && (valid[i>>3] & (1 << (i&7))))
+	{
+		*P = cache[i];
+		return;
+	}
+	cpy_flash((uint8_t *) &wire[i], (uint8_t *) &W, sizeof(W));
+	P->Z = wire_depth(M, &W);
+	P->X = 0;
+	P->Y = 0;
+	if(!(cull & WIRE_CULL_HORIZON) || P->Z <= 0)
+		wire_screen(M, &W, P);
+	if(i < WIRE_CACHE)
+	{
+		cache[i] = *P;
+		valid[i>>3] |= (1 << (i&7));
+	}
+}
+
+/*
+ @brief Release the display and yield every WIRE_YIELD lines
+ @param [in] *S: span writer
+ @param [in] i: line count
+ @return void
+*/
+static void wire_yield(tft_span_t *S, int i)
+{
+	if((i % WIRE_YIELD) == (WIRE_YIELD-1))
+	{
+		// Other tasks may use the SPI bus
+		tft_span_end(S);
+		optimistic_yield(1000);
+		wdt_reset();
+	}
+}
+
+/*
+ @brief Is a face in front
+ A face is in front when its points are clockwise on the display, Y is down
+ The first WIRE_CACHE faces are tested once by wire_faces(), later faces
+ are tested again each time they are needed
+ @param [in] *M: view transform
+ @param [in] *wire: fixed point points
+ @param [in] *face: faces
+ @param [in] i: face index
+ @param [in,out] *cache: transformed vertices
+ @param [in,out] *valid: cache valid bits
+ @param [in] *front: front face bits of the first WIRE_CACHE faces, NULL to test them
+ @return 1 if the face is in front, 0 if not
+*/
+static int wire_front(wire_view_t *M, const wire_p *wire, const wire_f *face, int i, p3_int16_t *cache, uint8_t *valid, uint8_t *front)
+{
+	p3_int16_t P[3];
+	wire_f F;
+	int32_t area;
+
+	if(front != NULL && i < WIRE_CACHE)
+		return((front[i>>3] & (1 << (i&7))) != 0);
+	// F = face[i];
+	cpy_flash((uint8_t *) &face[i], (uint8_t *) &F, sizeof(F));
+	wire_vertex(M, wire, F.p1, cache, valid, 0, &P[0]);
+	wire_vertex(M, wire, F.p2, cache, valid, 0, &P[1]);
+	wire_vertex(M, wire, F.p3, cache, valid, 0, &P[2]);
+	area = (int32_t) (P[1].X - P[0].X) * (P[2].Y - P[0].Y) -
+		(int32_t) (P[1].Y - P[0].Y) * (P[2].X - P[0].X);
+	return(area < 0);
+}
+
+/*
+ @brief Is an edge part of a front face
+ @param [in] *M: view transform
+ @param [in] *wire: fixed point points
+ @param [in] *face: faces
+ @param [in,out] *cache: transformed vertices
+ @param [in,out] *valid: cache valid bits
+ @param [in] *front: front face bits of the first WIRE_CACHE faces
+ @param [in] count: number of faces
+ @param [in] a: first point
+ @param [in] b: second point, a to b counter clockwise
+ @return 1 if a front face has the edge, 0 if not
+*/
+static int wire_front_edge(wire_view_t *M, const wire_p *wire, const wire_f *face, p3_int16_t *cache, uint8_t *valid, uint8_t *front, int count, int a, int b)
+{
+	wire_f F;
+	wire_t v[4];
+	int i,k,n;
+
+	for(i=0;i<count;++i)
+	{
+		// F = face[i];
+		cpy_flash((uint8_t *) &face[i], (uint8_t *) &F, sizeof(F));
+		v[0] = F.p1;
+		v[1] = F.p2;
+		v[2] = F.p3;
+		v[3] = F.p4;
+		n = (F.p4 == -1) ? 3 : 4;
+		for(k=0;k<n;++k)
+		{
+			if(v[k] == a && v[(k+1) % n] == b && wire_front(M, wire, face, i, cache, valid, front))
+				return(1);
+		}
+	}
+	return(0);
+}
+
+/*
+ @brief Draw the edges of the front faces of a mesh with a span writer
+ Edges shared by two front faces are drawn once
+ Front face bits and transformed vertices are kept for the first WIRE_CACHE,
+ larger meshes are culled the same way but transform more often
+ @param [in] *S: span writer, started by the caller
+ @param [in] *M: view transform
+ @param [in] *wire: fixed point  points
+ @param [in] *face: faces
+ @return void
+*/
+static void wire_faces(tft_span_t *S, wire_view_t *M, const wire_p *wire, const wire_f *face)
+{
+	p3_int16_t cache[WIRE_CACHE];
+	uint8_t valid[WIRE_CACHE/8];
+	uint8_t front[WIRE_CACHE/8];
+	p3_int16_t P[2];
+	wire_t v[4];
+	wire_f F;
+	int i,k,n,count;
+
+	memset(valid, 0, sizeof(valid));
+	memset(front, 0, sizeof(front));
+
+	for(i=0;;++i)
+	{
+		// F = face[i];
+		cpy_flash((uint8_t *) &face[i], (uint8_t *) &F, sizeof(F));
+		if(F.p1 == -1)
+			break;
+		if(i < WIRE_CACHE && wire_front(M, wire, face, i, cache, valid, NULL))
+			front[i>>3] |= (1 << (i&7));
+	}
+	count = i;
+
+	for(i=0;i<count;++i)
+	{
+		if(!wire_front(M, wire, face, i, cache, valid, front))
+			continue;
+		cpy_flash((uint8_t *) &face[i], (uint8_t *) &F, sizeof(F));
+		v[0] = F.p1;
+		v[1] = F.p2;
+		v[2] = F.p3;
+		v[3] = F.p4;
+		n = (F.p4 == -1) ? 3 : 4;
+		for(k=0;k<n;++k)
+		{
+			// The other face has the edge in the opposite direction
+			if(v[k] > v[(k+1) % n] && wire_front_edge(M, wire, face, cache, valid, front, count, v[(k+1) % n], v[k]))
+				continue;
+			wire_vertex(M, wire, v[k], cache, valid, 0, &P[0]);
+			wire_vertex(M, wire, v[(k+1) % n], cache, valid, 0, &P[1]);
+			tft_span_line(S, P[0].X, P[0].Y, P[1].X, P[1].Y);
+		}
+		wire_yield(S, i);
+	}
+}
+
+/// @brief Pen state for a list of connected points
+typedef struct {
+	int last;		// WIRE_SEP when there is no previous point
+	int drawn;		// a line of the current polyline was drawn
+	int x0;			// previous point on the display
+	int y0;
+	int16_t z0;		// previous point depth
+	wire_p W0;		// previous point
+} wire_pen_t;
+
+/*
+ @brief Draw the line from the previous connected point to the next one
+ Each point is used by the lines on either side, so it is transformed once
+ Lines that start and end on the same pixel add nothing to a polyline that
+ is already on the display, they are merged into the previous line
+ @param [in] *S: span writer, started by the caller
+ @param [in] *M: view transform
+ @param [in,out] *pen: pen state
+ @param [in] *W: next point or WIRE_SEP
+ @param [in] cull: culling mode
+ @param [in] i: point count, for yielding
+ @return void
+*/
+static void wire_pen(tft_span_t *S, wire_view_t *M, wire_pen_t *pen, wire_p *W, int cull, int i)
+{
+	p3_int16_t P,C;
+
+	if(W->x == WIRE_SEP)
+	{
+		pen->last = WIRE_SEP;
+		pen->drawn = 0;
+		return;
+	}
+
+	// Observation: for a sphere we can cut a plain parallel to the view plain
+	// intersecting the objects center at 0,0,0 point. 
+	// We then skip points below this plain (ie. away from the viewer).
+	// Points behind the plain are never projected to the display
+	if(cull & WIRE_CULL_HORIZON)
+	{
+		P.X = 0;
+		P.Y = 0;
+		P.Z = wire_depth(M, W);
+		if(P.Z <= 0)
+			wire_screen(M, W, &P);
+		if(pen->last != WIRE_SEP)
+		{
+			if(pen->z0 <= 0 && P.Z <= 0)
+			{
+				if(!pen->drawn || P.X != pen->x0 || P.Y != pen->y0)
+					tft_span_line(S, pen->x0, pen->y0, P.X, P.Y);
+				pen->drawn = 1;
+			}
+			else if(pen->z0 <= 0)
+			{
+				// Line goes behind the horizon
+				wire_horizon(M, &pen->W0, pen->z0, W, P.Z, &C);
+				tft_span_line(S, pen->x0, pen->y0, C.X, C.Y);
+				pen->drawn = 1;
+			}
+			else if(P.Z <= 0)
+			{
+				// Line comes out from behind the horizon
+				wire_horizon(M, W, P.Z, &pen->W0, pen->z0, &C);
+				tft_span_line(S, C.X, C.Y, P.X, P.Y);
+				pen->drawn = 1;
+			}
+			wire_yield(S, i);
+		}
+		pen->last = 0;
+		pen->W0 = *W;
+		pen->z0 = P.Z;
+		pen->x0 = P.X;
+		pen->y0 = P.Y;
+		return;
+	}
+
+	wire_project(M, W, &P);
+
+	if(pen->last == WIRE_SEP)	
+	{
+		// first point in list ??
+		pen->x0 = P.X;
+		pen->y0 = P.Y;
+		pen->last = 0;
+		pen->drawn = 0;
+		return;
+	}
+
+	// Draw line
+	if(!pen->drawn || P.X != pen->x0 || P.Y != pen->y0)
+		tft_span_line(S, pen->x0, pen->y0, P.X, P.Y);
+	pen->drawn = 1;
+
+	// First is Next
+	pen->x0 = P.X;
+	pen->y0 = P.Y;
+
+	wire_yield(S, i);
+}
+
+/*
+ @brief Draw the lines of a wireframe with a span writer
+ @param [in] *S: span writer, started by the caller
+ @param [in] *M: view transform
  @param [in] *wire: fixed point  points
  @param [in] *edge: fixed point  edges - optional or NULL
- @param [in] *view: view point
- @param [in] x: X offset
- @param [in] y: Y offsetfactor
- @param [in] scale: scale factor
- @param [in] color: color
+ @param [in] *face: faces - optional or NULL, needed by WIRE_CULL_BACK
+ @param [in] cull: culling mode
  @return void
 */
-void wire_draw(window *win, const wire_p *wire, const wire_e *edge, point *view, int x, int y, double scale, uint16_t color)
+static void wire_lines(tft_span_t *S, wire_view_t *M, const wire_p *wire, const wire_e *edge, const wire_f *face, int cull)
 {
 	int i;
-	int last = WIRE_SEP;
-	int x0 = 0;
-	int y0 = 0;
-	int x1 = 0;
-	int y1 = 0;
-	int z = 0;
-	wire_p W;
+	wire_p W, W0;
 	wire_e E;
-	point P,R;
+	wire_pen_t pen;
+	p3_int16_t P,P2;
 
-	W.x = 0;
-	W.y = 0;
-	W.z = 0;
+	if(face != NULL && (cull & WIRE_CULL_BACK))
+	{
+		wire_faces(S, M, wire, face);
+		return;
+	}
 
 	if(edge != NULL )
 	{
+		p3_int16_t cache[WIRE_CACHE];
+		uint8_t valid[WIRE_CACHE/8];
+
+		memset(valid, 0, sizeof(valid));
 		for (i = 0;; i++)
 		{
 			// E = edge[i];
@@ -83,41 +479,34 @@ void wire_draw(window *win, const wire_p *wire, const wire_e *edge, point *view,
 			if(E.p1 == -1)
 				break;
 
-			// P1 
-			cpy_flash((uint8_t *) &wire[E.p1], (uint8_t *) &W, sizeof(W));
-			wire2fp(&W, &P);
-			// CORDIC Rotate
-			rotate(&P,view);
+			wire_vertex(M, wire, E.p1, cache, valid, cull, &P);
+			wire_vertex(M, wire, E.p2, cache, valid, cull, &P2);
 
-			// CORDIC Perspective Projection Offset and Scale
-			PerspectiveProjection(&P, scale, x,y);
-			x0 = P.x;
-			y0 = P.y;
-
-			// P2 
-			cpy_flash((uint8_t *) &wire[E.p2], (uint8_t *) &W, sizeof(W));
-			wire2fp(&W, &P);
-			// CORDIC Rotate
-			rotate(&P,view);
-
-
-			// CORDIC Perspective Projection Offset and Scale
-			PerspectiveProjection(&P, scale, x,y);
-			x1 = P.x;
-			y1 = P.y;
+			if((cull & WIRE_CULL_HORIZON) && (P.Z > 0 || P2.Z > 0))
+			{
+				if(P.Z > 0 && P2.Z > 0)
+					continue;
+				// Split the line at the horizon, keep the front part
+				cpy_flash((uint8_t *) &wire[E.p1], (uint8_t *) &W, sizeof(W));
+				cpy_flash((uint8_t *) &wire[E.p2], (uint8_t *) &W0, sizeof(W0));
+				if(P.Z > 0)
+					wire_horizon(M, &W0, P2.Z, &W, P.Z, &P);
+				else
+					wire_horizon(M, &W, P.Z, &W0, P2.Z, &P2);
+			}
 
 			// Draw line
-			tft_drawLine(win, x0, y0, x1, y1, color);
-//printf("i:%d (x:%d,y:%d),(x1:%d,y1:%d),color:%04x\n", i,(int)x0, (int)y0, (int)x1, (int)y1, (int)color);
+			tft_span_line(S, P.X, P.Y, P2.X, P2.Y);
 
-			optimistic_yield(1000);
-			wdt_reset();
+			wire_yield(S, i);
 		}
 		return;
 	}
 
 	/* edge == NULL */
 	/* We have a list of connected points and no edge data */
+	pen.last = WIRE_SEP;
+	pen.drawn = 0;
 	for (i = 0; ; i++)
 	{
 		// W = wire[i];
@@ -127,58 +516,226 @@ void wire_draw(window *win, const wire_p *wire, const wire_e *edge, point *view,
 		{
 			break;
 		}
-		if(W.x == WIRE_SEP)
-		{
-			last = WIRE_SEP;
-			continue;
-		}
+		wire_pen(S, M, &pen, &W, cull, i);
+	}
+}
 
-		// Get next point
-		wire2fp(&W, &P);
+/*
+ @brief Draw a wireframe
+ @param [in] *wire: fixed point  points
+ @param [in] *edge: fixed point  edges - optional or NULL
+ @param [in] *view: view point
+ @param [in] x: X offset
+ @param [in] y: Y offsetfactor
+ @param [in] scale: scale factor
+ @param [in] color: color
+ @return void
+*/
+void wire_draw(window *win, const wire_p *wire, const wire_e *edge, point *view, int x, int y, double scale, uint16_t color)
+{
+	wire_draw_cull(win, wire, edge, NULL, view, x, y, scale, color, 0);
+}
 
-		// CORDIC Rotate
-		rotate(&P,view);
+/*
+ @brief Draw a wireframe with hidden lines removed
+ WIRE_CULL_HORIZON drops the parts of lines behind the Z = 0 plane, for
+ spheres centered on 0,0,0, points behind it are never projected
+ WIRE_CULL_BACK draws only the edges of front faces, edge is not used
+ @param [in] *wire: fixed point  points
+ @param [in] *edge: fixed point  edges - optional or NULL
+ @param [in] *face: faces - optional or NULL, needed by WIRE_CULL_BACK
+ @param [in] *view: view point
+ @param [in] x: X offset
+ @param [in] y: Y offset
+ @param [in] scale: scale factor
+ @param [in] color: color
+ @param [in] cull: culling mode, 0 draws every line
+ @return void
+*/
+void wire_draw_cull(window *win, const wire_p *wire, const wire_e *edge, const wire_f *face, point *view, int x, int y, double scale, uint16_t color, int cull)
+{
+	wire_view_t M;
+	tft_span_t S;
 
-		// FIXME - Add proper hidden line removal
-		// 	add a flag for this
-		// Observation: for a sphere we can cut a plain parallel to the view plain
-		// intersecting the objects center at 0,0,0 point. 
-		// We then skip points below this plain (ie. away from the viewer).
-#if 0
-		if(P.z >= 0.0)
-		{
-			// force restart, we have no points
-			last = WIRE_SEP;
-			continue;
-		}
-#endif
+	// One rotation and projection matrix for the whole frame
+	wire_view(&M, view, scale, x, y);
 
-		// CORDIC Perspective Projection Offset and Scale
-		PerspectiveProjection(&P, scale, x,y);
+	// Lines share one span writer so runs merge across joints
+	tft_span_begin(&S, win, color);
+	wire_lines(&S, &M, wire, edge, face, cull);
+	tft_span_end(&S);
+}
 
-		if(last == WIRE_SEP)	
-		{
-			// first point in list ??
-			x0 = P.x;
-			y0 = P.y;
-			last = 0;
-			continue;
-		}
-		x1 = P.x;
-		y1 = P.y;
-		last = 0;
+/*
+ @brief Draw a compact mesh, see wire_mesh.h
+ Line meshes are drawn while they are decoded, edge meshes are decoded
+ into RAM for the frame
+ Meshes opened with WIRE_MESH_AUTO use the least detailed level that is
+ accurate to a pixel at this scale, so the time depends on the size drawn
+ @param [in] *m: open mesh decoder
+ @param [in] *view: view point
+ @param [in] x: X offset
+ @param [in] y: Y offset
+ @param [in] scale: scale factor
+ @param [in] color: color
+ @param [in] cull: culling mode, WIRE_CULL_BACK is not used
+ @return 0 on success, -1 on a decoding error
+*/
+int wire_draw_mesh(window *win, wire_mesh_t *m, point *view, int x, int y, double scale, uint16_t color, int cull)
+{
+	wire_view_t M;
+	tft_span_t S;
+	wire_pen_t pen;
+	wire_p W;
+	wire_p *wire;
+	wire_e *edge;
+	int i, ret;
+
+	cull &= ~WIRE_CULL_BACK;
+
+	if(m->autolod && wire_mesh_level(m, wire_mesh_lod(m, scale)) < 0)
+		return(-1);
 
-		//printf("i:%d,x:%d,y:%d-x1:%d,y1:%d,color:%04x", i,(int)x0, (int)y0, (int)x1, (int)y1, (int)color);
+	if(m->type == WIRE_MESH_EDGES)
+	{
+		if(wire_mesh_load(m, &wire, &edge) < 0)
+			return(-1);
+		wire_draw_cull(win, wire, edge, NULL, view, x, y, scale, color, cull);
+		free(wire);
+		free(edge);
+		return(0);
+	}
 
-		// Draw line
-		tft_drawLine(win, x0, y0, x1, y1, color);
+	wire_view(&M, view, scale, x, y);
+	wire_mesh_rewind(m);
 
-		// First is Next
-		x0 = x1;
-		y0 = y1;
+	tft_span_begin(&S, win, color);
+	pen.last = WIRE_SEP;
+	pen.drawn = 0;
+	for(i = 0; (ret = wire_mesh_point(m, &W)) > 0; ++i)
+		wire_pen(&S, &M, &pen, &W, cull, i);
+	tft_span_end(&S);
+	return(ret);
+}
 
-		optimistic_yield(1000);
-		wdt_reset();
+/*
+ @brief Release the bitmaps of a wireframe animator
+ @param [in] *A: animator
+ @return void
+*/
+MEMSPACE
+void wire_anim_free(wire_anim_t *A)
+{
+	if(A->mask[0])
+		free(A->mask[0]);
+	if(A->mask[1])
+		free(A->mask[1]);
+	A->mask[0] = NULL;
+	A->mask[1] = NULL;
+	A->drawn = 0;
+}
+
+/*
+ @brief Start a wireframe animator
+ Each frame is compared with the last one on the display, only pixels that
+ change are written. Without memory for the bitmaps frames are erased and
+ redrawn in full. The window must not be drawn on by anything else while
+ a frame is displayed, call wire_anim_erase() first.
+ @param [in] *A: animator, zero before the first call, may be started again
+ @param [in] *win: window
+ @param [in] color: line color, frames are erased with win->bg
+ @return 1 when pixel differences are used, 0 when frames are redrawn in full
+*/
+MEMSPACE
+int wire_anim_init(wire_anim_t *A, window *win, uint16_t color)
+{
+	wire_anim_free(A);
+
+	A->win = win;
+	A->color = color;
+	A->wire = NULL;
+	A->edge = NULL;
+	A->face = NULL;
+	A->cull = 0;
+	A->size = ((int32_t) win->w * win->h + 7) / 8;
+	A->mask[0] = calloc(A->size, 1);
+	A->mask[1] = calloc(A->size, 1);
+	if(A->mask[0] == NULL || A->mask[1] == NULL)
+	{
+		wire_anim_free(A);
+		return(0);
+	}
+	return(1);
+}
+
+/*
+ @brief Erase the frame on the display
+ @param [in] *A: animator
+ @return void
+*/
+void wire_anim_erase(wire_anim_t *A)
+{
+	tft_span_t S;
+
+	if(!A->drawn)
+		return;
+	tft_span_begin(&S, A->win, A->win->bg);
+	wire_lines(&S, &A->M, A->wire, A->edge, A->face, A->cull);
+	tft_span_end(&S);
+	if(A->mask[0])
+		memset(A->mask[0], 0, A->size);
+	A->drawn = 0;
+}
+
+/*
+ @brief Replace the frame on the display with a new view of a wireframe
+ The new frame is drawn first, skipping pixels already on the display, then
+ the last frame is erased, skipping pixels that belong to the new frame
+ @param [in] *A: animator
+ @param [in] *wire: fixed point  points
+ @param [in] *edge: fixed point  edges - optional or NULL
+ @param [in] *face: faces - optional or NULL, needed by WIRE_CULL_BACK
+ @param [in] *view: view point
+ @param [in] x: X offset
+ @param [in] y: Y offset
+ @param [in] scale: scale factor
+ @param [in] cull: culling mode, see wire_draw_cull()
+ @return void
+*/
+void wire_anim_draw(wire_anim_t *A, const wire_p *wire, const wire_e *edge, const wire_f *face, point *view, int x, int y, double scale, int cull)
+{
+	wire_view_t M;
+	tft_span_t S;
+	uint8_t *tmp;
+
+	wire_view(&M, view, scale, x, y);
+
+	if(A->mask[0] == NULL)
+		wire_anim_erase(A);
+	else
+		memset(A->mask[1], 0, A->size);
+
+	tft_span_begin(&S, A->win, A->color);
+	S.mark = A->mask[1];
+	S.skip = A->mask[0];
+	wire_lines(&S, &M, wire, edge, face, cull);
+	tft_span_end(&S);
+
+	if(A->drawn)
+	{
+		tft_span_begin(&S, A->win, A->win->bg);
+		S.skip = A->mask[1];
+		wire_lines(&S, &A->M, A->wire, A->edge, A->face, A->cull);
+		tft_span_end(&S);
 	}
-//printf("i:%d,done\n",(int) i);
+
+	tmp = A->mask[0];
+	A->mask[0] = A->mask[1];
+	A->mask[1] = tmp;
+	A->M = M;
+	A->wire = wire;
+	A->edge = edge;
+	A->face = face;
+	A->cull = cull;
+	A->drawn = 1;
 }
@@ -25,9 +25,51 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define _WIRE_H_
 
 #include "wire_types.h"
+#include "wire_mesh.h"
+
+/// @brief Lines drawn between releasing the display and yielding
+#define WIRE_YIELD 16
+
+/// @brief Transformed vertices and front face bits kept by wire_draw
+#define WIRE_CACHE 64
+
+/// @brief Culling modes of wire_draw_cull()
+#define WIRE_CULL_HORIZON	1	// lines behind the Z = 0 plane are not drawn
+#define WIRE_CULL_BACK		2	// only edges of front faces are drawn
+
+/// @brief Fixed point view transform, rotation and projection for one frame
+/// Rows give screen X, screen Y and depth from a WIRE_ONE fixed point vertex
+typedef struct {
+	int32_t m[3][3];
+	int32_t x;		// screen X offset
+	int32_t y;		// screen Y offset
+	uint8_t shift;	// fraction bits of the screen X and Y rows
+} wire_view_t;
+
+/// @brief Wireframe animator, only pixels that change between frames are written
+typedef struct {
+	window *win;
+	uint16_t color;
+	const wire_p *wire;	// frame on the display
+	const wire_e *edge;
+	const wire_f *face;
+	int cull;
+	wire_view_t M;
+	uint8_t *mask[2];	// window bitmaps, pixels of the frame on the display and the next frame
+	int32_t size;		// bitmap size in bytes
+	uint8_t drawn;		// a frame is on the display
+} wire_anim_t;
 
 /* wire.c */
 void wire2fp ( wire_p *in , point *out );
+void wire_view ( wire_view_t *M , point *view , double scale , int x , int y );
+void wire_project ( wire_view_t *M , wire_p *in , p3_int16_t *out );
 void wire_draw ( window *win , const wire_p *wire , const wire_e *edge , point *view , int x , int y , double scale , uint16_t color );
+void wire_draw_cull ( window *win , const wire_p *wire , const wire_e *edge , const wire_f *face , point *view , int x , int y , double scale , uint16_t color , int cull );
+int wire_draw_mesh ( window *win , wire_mesh_t *m , point *view , int x , int y , double scale , uint16_t color , int cull );
+MEMSPACE void wire_anim_free ( wire_anim_t *A );
+MEMSPACE int wire_anim_init ( wire_anim_t *A , window *win , uint16_t color );
+void wire_anim_erase ( wire_anim_t *A );
+void wire_anim_draw ( wire_anim_t *A , const wire_p *wire , const wire_e *edge , const wire_f *face , point *view , int x , int y , double scale , int cull );
 
 #endif
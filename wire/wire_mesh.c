@@ -0,0 +1,522 @@
+/**
+ @file wire_mesh.c
+
+ @brief Compact wireframe mesh streaming decoder
+ Meshes are decoded a few bytes at a time from flash or from a file,
+ see wire_mesh.h for the layout
+
+ @par Copyright &copy; 2015 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "user_config.h"
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include "wire/wire_types.h"
+#include "wire/wire_mesh.h"
+
+/// @brief Decoder states
+#define MESH_COUNT	0	// next is a polyline point count
+#define MESH_POINTS	1	// points of a polyline or of the point list
+#define MESH_EDGES	2	// next is the edge count
+#define MESH_EDGE	3	// edges
+#define MESH_END	4
+#define MESH_ERROR	5
+
+/*
+ @brief Read mesh bytes from flash
+ @param [in] *arg: start of the mesh in flash
+ @param [in] offset: offset from the start of the mesh
+ @param [out] *buf: buffer
+ @param [in] size: bytes to read
+ @return bytes read
+*/
+int wire_mesh_flash_read(void *arg, uint32_t offset, uint8_t *buf, int size)
+{
+	cpy_flash((uint8_t *) arg + offset, buf, size);
+	return(size);
+}
+
+#ifdef FATFS_SUPPORT
+/*
+ @brief Read mesh bytes from a file
+ @param [in] *arg: open FILE, the mesh starts at offset 0
+ @param [in] offset: offset from the start of the mesh
+ @param [out] *buf: buffer
+ @param [in] size: bytes to read
+ @return bytes read, < 0 on error
+*/
+int wire_mesh_file_read(void *arg, uint32_t offset, uint8_t *buf, int size)
+{
+	FILE *fp = (FILE *) arg;
+
+	if(fseek(fp, (long) offset, SEEK_SET) != 0)
+		return(-1);
+	return(fread(buf, 1, size, fp));
+}
+#endif
+
+/*
+ @brief Next byte of the open level
+ @param [in] *m: decoder
+ @return byte, -1 at the end of the level or on a read error
+*/
+static int wire_mesh_byte(wire_mesh_t *m)
+{
+	int size;
+
+	if(m->ind >= m->len)
+	{
+		if(m->pos >= m->end)
+			return(-1);
+		size = WIRE_MESH_BUF;
+		if(m->end - m->pos < (uint32_t) size)
+			size = m->end - m->pos;
+		size = m->read(m->arg, m->pos, m->buf, size);
+		if(size <= 0)
+			return(-1);
+		m->pos += size;
+		m->len = size;
+		m->ind = 0;
+	}
+	return(m->buf[m->ind++]);
+}
+
+/*
+ @brief Next keep flag of a subset level
+ @param [in] *m: decoder
+ @return 1 keep, 0 skip, -1 at the end of the flags or on a read error
+*/
+static int wire_mesh_flag(wire_mesh_t *m)
+{
+	int size, bit;
+
+	if(m->fbit >= m->flen * 8)
+	{
+		if(m->fpos >= m->fend)
+			return(-1);
+		size = WIRE_MESH_FLAGS;
+		if(m->fend - m->fpos < (uint32_t) size)
+			size = m->fend - m->fpos;
+		size = m->read(m->arg, m->fpos, m->fbuf, size);
+		if(size <= 0)
+			return(-1);
+		m->fpos += size;
+		m->flen = size;
+		m->fbit = 0;
+	}
+	bit = (m->fbuf[m->fbit >> 3] >> (m->fbit & 7)) & 1;
+	m->fbit++;
+	return(bit);
+}
+
+/*
+ @brief Decode a varint
+ @param [in] *m: decoder
+ @param [out] *v: value
+ @return 0 on success, -1 on error
+*/
+static int wire_mesh_varint(wire_mesh_t *m, uint32_t *v)
+{
+	int c;
+	int shift = 0;
+
+	*v = 0;
+	do
+	{
+		c = wire_mesh_byte(m);
+		if(c < 0 || shift > 28)
+		{
+			m->state = MESH_ERROR;
+			return(-1);
+		}
+		*v |= (uint32_t) (c & 0x7f) << shift;
+		shift += 7;
+	} while(c & 0x80);
+	return(0);
+}
+
+/*
+ @brief Decode a zigzag varint delta and add it to a value
+ @param [in] *m: decoder
+ @param [in,out] *v: value
+ @return 0 on success, -1 on error
+*/
+static int wire_mesh_delta(wire_mesh_t *m, wire_t *v)
+{
+	uint32_t u;
+
+	if(wire_mesh_varint(m, &u) < 0)
+		return(-1);
+	*v += (int32_t) (u >> 1) ^ -(int32_t) (u & 1);
+	return(0);
+}
+
+/*
+ @brief Little endian number from a header buffer
+ @param [in] *p: buffer
+ @param [in] size: bytes
+ @return value
+*/
+static uint32_t wire_mesh_le(uint8_t *p, int size)
+{
+	uint32_t v = 0;
+
+	while(size--)
+		v = (v << 8) | p[size];
+	return(v);
+}
+
+/*
+ @brief Open a mesh and select a level of detail
+ @param [out] *m: decoder
+ @param [in] read: source read function, wire_mesh_flash_read or wire_mesh_file_read
+ @param [in] *arg: source
+ @param [in] level: 0 is the most detail, levels past the last use the last,
+	WIRE_MESH_AUTO lets wire_draw_mesh() choose the level from the scale
+ @return 0 on success, -1 if the source is not a mesh
+*/
+MEMSPACE
+int wire_mesh_open(wire_mesh_t *m, wire_read_t read, void *arg, int level)
+{
+	uint8_t *p = m->buf;
+
+	memset(m, 0, sizeof(*m));
+	m->read = read;
+	m->arg = arg;
+	m->state = MESH_ERROR;
+
+	if(read(arg, 0, p, WIRE_MESH_HEADER) != WIRE_MESH_HEADER)
+		return(-1);
+	if(memcmp(p, "WMSH", 4) != 0 || p[4] != WIRE_MESH_VERSION)
+		return(-1);
+	if(p[5] > WIRE_MESH_EDGES || p[6] < 1 || p[6] > WIRE_MESH_LEVELS)
+		return(-1);
+	m->type = p[5];
+	m->levels = p[6];
+	m->lod = p[7];
+
+	if(level == WIRE_MESH_AUTO)
+	{
+		m->autolod = 1;
+		level = 0;
+	}
+	// Force the level table read
+	m->level = WIRE_MESH_LEVELS;
+	return(wire_mesh_level(m, level));
+}
+
+/*
+ @brief Select a level of detail of an open mesh
+ @param [in] *m: decoder
+ @param [in] level: 0 is the most detail, levels past the last use the last
+ @return 0 on success, -1 on a read error
+*/
+int wire_mesh_level(wire_mesh_t *m, int level)
+{
+	uint8_t *p = m->buf;
+
+	if(level < 0)
+		level = 0;
+	if(level >= m->levels)
+		level = m->levels - 1;
+	if(level == m->level)
+	{
+		wire_mesh_rewind(m);
+		return(0);
+	}
+
+	m->state = MESH_ERROR;
+	m->level = WIRE_MESH_LEVELS;
+	if(m->read(m->arg, WIRE_MESH_HEADER + level * WIRE_MESH_ENTRY, p, WIRE_MESH_ENTRY) != WIRE_MESH_ENTRY)
+		return(-1);
+	m->start = wire_mesh_le(p, 4);
+	m->end = m->start + wire_mesh_le(p + 4, 4);
+	m->points = wire_mesh_le(p + 8, 2);
+	m->lines = wire_mesh_le(p + 10, 2);
+	m->fstart = 0;
+	m->fend = 0;
+
+	// Coarse line levels are keep flags over the level 0 points
+	if(level > 0 && m->type == WIRE_MESH_LINES)
+	{
+		m->fstart = m->start;
+		m->fend = m->end;
+		if(m->read(m->arg, WIRE_MESH_HEADER, p, WIRE_MESH_ENTRY) != WIRE_MESH_ENTRY)
+			return(-1);
+		m->start = wire_mesh_le(p, 4);
+		m->end = m->start + wire_mesh_le(p + 4, 4);
+	}
+	m->level = level;
+
+	wire_mesh_rewind(m);
+	return(0);
+}
+
+/*
+ @brief Least detailed level that is still accurate to a pixel at a scale
+ @param [in] *m: decoder
+ @param [in] scale: pixels per WIRE_ONE, as passed to wire_draw_mesh()
+ @return level
+*/
+int wire_mesh_lod(wire_mesh_t *m, double scale)
+{
+	int32_t pixel;
+	int level = 0;
+
+	if(m->lod == 0 || scale < 1)
+		return(0);
+	// Size of one pixel in mesh units
+	pixel = WIRE_ONE / scale;
+	while(level + 1 < m->levels && (1L << (m->lod + level)) <= pixel)
+		++level;
+	return(level);
+}
+
+/*
+ @brief Restart decoding at the first point of the open level
+ @param [in] *m: decoder
+ @return void
+*/
+void wire_mesh_rewind(wire_mesh_t *m)
+{
+	uint32_t n;
+
+	m->pos = m->start;
+	m->ind = 0;
+	m->len = 0;
+	m->fpos = m->fstart;
+	m->fbit = 0;
+	m->flen = 0;
+	m->kept = 0;
+	m->P.x = 0;
+	m->P.y = 0;
+	m->P.z = 0;
+	m->p1 = 0;
+	m->left = 0;
+	m->state = MESH_COUNT;
+	if(m->type == WIRE_MESH_EDGES)
+	{
+		if(wire_mesh_varint(m, &n) < 0)
+			return;
+		m->left = n;
+		m->state = MESH_POINTS;
+	}
+}
+
+/*
+ @brief Decode the next point
+ Line meshes give the same points as a wire_p list, WIRE_SEP after each
+ polyline and WIRE_END at the end. Coarse levels give the kept points of
+ level 0. Edge meshes give the point list, then WIRE_END before the edges.
+ @param [in] *m: decoder
+ @param [out] *W: point
+ @return 1 for a point or WIRE_SEP, 0 at the end, -1 on error
+*/
+int wire_mesh_point(wire_mesh_t *m, wire_p *W)
+{
+	uint32_t n;
+	int keep;
+
+	W->x = WIRE_END;
+	W->y = WIRE_END;
+	W->z = WIRE_END;
+
+	// Skipped points and polylines of a subset level loop back here
+	for(;;)
+	{
+		if(m->state == MESH_COUNT)
+		{
+			if(wire_mesh_varint(m, &n) < 0)
+				return(-1);
+			if(n == 0)
+			{
+				m->state = MESH_END;
+				return(0);
+			}
+			m->left = n;
+			m->kept = 0;
+			m->state = MESH_POINTS;
+		}
+		if(m->state != MESH_POINTS)
+			return(m->state == MESH_ERROR ? -1 : 0);
+
+		if(m->left == 0)
+		{
+			if(m->type == WIRE_MESH_EDGES)
+			{
+				m->state = MESH_EDGES;
+				return(0);
+			}
+			m->state = MESH_COUNT;
+			if(m->fstart && !m->kept)
+				continue;
+			W->x = WIRE_SEP;
+			W->y = WIRE_SEP;
+			W->z = WIRE_SEP;
+			return(1);
+		}
+
+		if(wire_mesh_delta(m, &m->P.x) < 0 ||
+			wire_mesh_delta(m, &m->P.y) < 0 ||
+			wire_mesh_delta(m, &m->P.z) < 0)
+			return(-1);
+		m->left--;
+		if(m->fstart)
+		{
+			keep = wire_mesh_flag(m);
+			if(keep < 0)
+			{
+				m->state = MESH_ERROR;
+				return(-1);
+			}
+			if(!keep)
+				continue;
+		}
+		m->kept++;
+		*W = m->P;
+		return(1);
+	}
+}
+
+/*
+ @brief Decode the next edge of an edge mesh
+ Any points not yet decoded are skipped
+ @param [in] *m: decoder
+ @param [out] *E: edge, -1,-1 at the end
+ @return 1 for an edge, 0 at the end, -1 on error
+*/
+int wire_mesh_edge(wire_mesh_t *m, wire_e *E)
+{
+	wire_p W;
+	uint32_t n;
+	int ret;
+
+	E->p1 = -1;
+	E->p2 = -1;
+	if(m->type != WIRE_MESH_EDGES)
+		return(-1);
+
+	while(m->state == MESH_POINTS)
+	{
+		ret = wire_mesh_point(m, &W);
+		if(ret < 0)
+			return(-1);
+	}
+	if(m->state == MESH_EDGES)
+	{
+		if(wire_mesh_varint(m, &n) < 0)
+			return(-1);
+		m->left = n;
+		m->state = MESH_EDGE;
+	}
+	if(m->state != MESH_EDGE)
+		return(m->state == MESH_ERROR ? -1 : 0);
+
+	if(m->left == 0)
+	{
+		m->state = MESH_END;
+		return(0);
+	}
+	if(wire_mesh_delta(m, &m->p1) < 0)
+		return(-1);
+	E->p1 = m->p1;
+	E->p2 = m->p1;
+	if(wire_mesh_delta(m, &E->p2) < 0)
+	{
+		E->p1 = -1;
+		E->p2 = -1;
+		return(-1);
+	}
+	m->left--;
+	return(1);
+}
+
+/*
+ @brief Decode the open level into RAM in the wire_p and wire_e formats
+ The arrays can be used with wire_draw() and released with free()
+ Line meshes end with WIRE_END, edge lists end with -1,-1
+ @param [in] *m: decoder
+ @param [out] **wire: points
+ @param [out] **edge: edges, NULL for line meshes
+ @return 0 on success, -1 on error or when out of memory
+*/
+MEMSPACE
+int wire_mesh_load(wire_mesh_t *m, wire_p **wire, wire_e **edge)
+{
+	int32_t size;
+	int i, ret;
+
+	*wire = NULL;
+	*edge = NULL;
+	wire_mesh_rewind(m);
+
+	// Line meshes add a WIRE_SEP for each polyline
+	size = m->points + 1;
+	if(m->type == WIRE_MESH_LINES)
+		size += m->lines;
+	*wire = calloc(size, sizeof(wire_p));
+	if(*wire == NULL)
+		return(-1);
+
+	for(i=0;i<size;++i)
+	{
+		ret = wire_mesh_point(m, &(*wire)[i]);
+		if(ret <= 0)
+			break;
+	}
+	if(ret < 0 || i >= size)
+		goto fail;
+	(*wire)[i].x = WIRE_END;
+	(*wire)[i].y = WIRE_END;
+	(*wire)[i].z = WIRE_END;
+
+	if(m->type == WIRE_MESH_EDGES)
+	{
+		*edge = calloc(m->lines + 1, sizeof(wire_e));
+		if(*edge == NULL)
+			goto fail;
+		for(i=0;i<=m->lines;++i)
+		{
+			ret = wire_mesh_edge(m, &(*edge)[i]);
+			if(ret <= 0)
+				break;
+		}
+		if(ret != 0)
+			goto fail;
+		// Edge indexes must be inside the point list
+		for(i=0;(*edge)[i].p1 != -1;++i)
+		{
+			if((*edge)[i].p1 < 0 || (*edge)[i].p1 >= m->points ||
+				(*edge)[i].p2 < 0 || (*edge)[i].p2 >= m->points)
+				goto fail;
+		}
+	}
+	return(0);
+
+fail:
+	if(*wire)
+		free(*wire);
+	if(*edge)
+		free(*edge);
+	*wire = NULL;
+	*edge = NULL;
+	return(-1);
+}
@@ -0,0 +1,117 @@
+/**
+ @file wire_mesh.h
+
+ @brief Compact wireframe mesh format and streaming decoder
+
+ @par Copyright &copy; 2015 Mike Gore, GPL License
+ @par You are free to use this code under the terms of GPL
+   please retain a copy of this notice in any code you use it in.
+
+This is free software: you can redistribute it and/or modify it under the
+terms of the GNU General Public License as published by the Free Software
+Foundation, either version 3 of the License, or (at your option)
+any later version.
+
+This software is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _WIRE_MESH_H_
+#define _WIRE_MESH_H_
+
+#include "wire_types.h"
+
+/*
+ Mesh layout, all numbers little endian
+	header: "WMSH", version, type, levels, lod
+	level table, one entry per level, most detailed first:
+		uint32_t offset		// from the start of the mesh
+		uint32_t bytes
+		uint16_t points		// points, WIRE_SEP and WIRE_END are not counted
+		uint16_t lines		// polylines or edges
+	WIRE_MESH_LINES level 0 data, connected points:
+		repeated: varint n, n points
+		varint 0
+	WIRE_MESH_LINES level 1 .. levels-1 data, a subset of level 0:
+		keep flags, one bit per level 0 point in order, low bit first
+		polylines without a kept point are left out
+	WIRE_MESH_EDGES level data, index buffer:
+		varint n, n points
+		varint e, e edges, zigzag p1 - last p1, zigzag p2 - p1
+	Points are three zigzag varint deltas from the previous point, the
+	first point is a delta from 0,0,0
+	Varints have 7 bits per byte, low bits first, bit 7 set when more follow
+	Levels past the first are simplified so no point moves more than
+	1 << (lod + level - 1) from the full detail line, lod 0 means the
+	levels have no known tolerance and are never selected by scale
+	Edge meshes have one level
+*/
+
+#define WIRE_MESH_VERSION	2
+#define WIRE_MESH_LINES		0	// connected points, like wire_p lists with WIRE_SEP
+#define WIRE_MESH_EDGES		1	// points and an edge index list
+#define WIRE_MESH_LEVELS	4	// maximum levels of detail
+#define WIRE_MESH_HEADER	8	// header size before the level table
+#define WIRE_MESH_ENTRY		12	// level table entry size
+#define WIRE_MESH_AUTO		-1	// wire_mesh_open() level chosen by scale when drawn
+
+/// @brief Decoder read buffer size
+#define WIRE_MESH_BUF		64
+/// @brief Decoder keep flag buffer size
+#define WIRE_MESH_FLAGS		8
+
+/// @brief Read mesh bytes from a source
+/// @param[in] *arg: source
+/// @param[in] offset: offset from the start of the mesh
+/// @param[out] *buf: buffer
+/// @param[in] size: bytes to read
+/// @return bytes read, < 0 on error
+typedef int (*wire_read_t)(void *arg, uint32_t offset, uint8_t *buf, int size);
+
+/// @brief Streaming mesh decoder, one level of one mesh
+typedef struct {
+	wire_read_t read;
+	void *arg;
+	uint8_t type;		// WIRE_MESH_LINES or WIRE_MESH_EDGES
+	uint8_t levels;		// levels in the mesh
+	uint8_t level;		// open level
+	uint8_t lod;		// level tolerance, see above
+	uint8_t autolod;	// level chosen by wire_draw_mesh()
+	uint8_t state;
+	uint16_t points;	// points in the open level
+	uint16_t lines;		// polylines or edges in the open level
+	uint32_t start;		// start of the open level, of level 0 for a subset
+	uint32_t pos;		// offset of the next buffer fill
+	uint32_t end;		// end of the open level, of level 0 for a subset
+	uint32_t fstart;	// keep flags of a subset level, 0 for level 0
+	uint32_t fpos;		// offset of the next flag buffer fill
+	uint32_t fend;		// end of the keep flags
+	uint16_t left;		// points or edges left in the current list
+	uint16_t kept;		// points given from the current polyline
+	wire_p P;			// last point
+	wire_t p1;			// last edge start
+	uint8_t ind;		// next byte in buf
+	uint8_t len;		// bytes in buf
+	uint8_t fbit;		// next bit in fbuf
+	uint8_t flen;		// bytes in fbuf
+	uint8_t buf[WIRE_MESH_BUF];
+	uint8_t fbuf[WIRE_MESH_FLAGS];
+} wire_mesh_t;
+
+/* wire_mesh.c */
+int wire_mesh_flash_read ( void *arg , uint32_t offset , uint8_t *buf , int size );
+int wire_mesh_file_read ( void *arg , uint32_t offset , uint8_t *buf , int size );
+MEMSPACE int wire_mesh_open ( wire_mesh_t *m , wire_read_t read , void *arg , int level );
+int wire_mesh_level ( wire_mesh_t *m , int level );
+int wire_mesh_lod ( wire_mesh_t *m , double scale );
+void wire_mesh_rewind ( wire_mesh_t *m );
+int wire_mesh_point ( wire_mesh_t *m , wire_p *W );
+int wire_mesh_edge ( wire_mesh_t *m , wire_e *E );
+MEMSPACE int wire_mesh_load ( wire_mesh_t *m , wire_p **wire , wire_e **edge );
+
+#endif // _WIRE_MESH_H_
@@ -36,6 +36,15 @@ typedef struct {
 	wire_t p2;
 } wire_e;
 
+/// @brief Face for back face culling, a triangle or a quad, p4 = -1 for a triangle
+/// Points are counter clockwise seen from outside, the list ends with p1 = -1
+typedef struct {
+	wire_t p1;
+	wire_t p2;
+	wire_t p3;
+	wire_t p4;
+} wire_f;
+
 // FIXED point format for int16_t
 #define WIRE_ONE  16384 /* 1.0 */
 #define WIRE_HALF (WIRE_ONE/2) /* 0.5 */